@@ -9,18 +9,31 @@
 
 #include <functional>
 #include <Sapphire/tensor/Tensor.hpp>
+#include <vector>
 
 namespace Sapphire
 {
+//! Tensors returned by Reshape, Squeeze, UnSqueeze, Expand, Flatten and Chunk
+//! are views of the input if the layout of the data allows it.
+//! Views share the buffer of the input without copying and are copied only
+//! when either of them is written while the buffer is shared
+//! Gradients of the views are written directly to the gradient of the input
+
+//! Returns a new tensor with given shape
+//! \param tensor : input tensor to reshape
+//! \param shape : new shape. Must have same number of elements as the input
+//! \return : reshaped tensor. Returned tensor is view of the input
+Tensor Reshape(const Tensor& tensor, const Shape& shape);
+
 //! Returns a new tensor with all the dimensions of input of size 1 removed
 //! \param tensor : input tensor to squeeze
-//! \return : squeezed tensor. Returned tensor is independent from the input
+//! \return : squeezed tensor. Returned tensor is view of the input
 Tensor Squeeze(const Tensor& tensor);
 
 //! Returns a new tensor with all the dimensions of given dimension of size 1 removed
 //! \param tensor : input tensor to squeeze
 //! \param dim : dimension to squeeze
-//! \return : squeezed tensor. Returned tensor is independent from the input
+//! \return : squeezed tensor. Returned tensor is view of the input
 Tensor Squeeze(const Tensor& tensor, int dim);
 
 //! Removes all dimensions with size 1
@@ -37,6 +50,7 @@ void Squeeze(Tensor& tensor, int dim);
 //! Returns a new tensor with a dimension of size one inserted at the specified position
 //! \param tensor : input tensor to unSqueeze
 //! \param dim : dimension to insert one
+//! \return : unSqueezed tensor. Returned tensor is view of the input
 Tensor UnSqueeze(const Tensor& tensor, int dim);
 
 //! Inserts dimension of size one at the given tensor
@@ -70,7 +84,7 @@ Tensor VStack(const std::vector<Tensor>& tensors);
 //! Tensors with more dimension than given dimension is returned as-is
 //! \param tensor : tensor to expand from
 //! \param dim : dimension to expand
-//! \return : expanded tensor
+//! \return : expanded tensor. Returned tensor is view of the input
 Tensor Expand(const Tensor& tensor, int dim);
 
 //! Expands tensor to given dimension
@@ -81,7 +95,8 @@ void Expand(Tensor& tensor, int dim);
 
 //! Creates new tensor converted into one dimension
 //! Tensors with one dimension is returned as-is
-//! \param tensor : tensor 
+//! \param tensor : tensor to flatten
+//! \return : flattened tensor. Returned tensor is view of the input
 Tensor Flatten(const Tensor& tensor);
 
 //! Converts tensor to one dimension
@@ -90,10 +105,14 @@ Tensor Flatten(const Tensor& tensor);
 void Flatten(Tensor& tensor);
 
 //! Splits tensor into a specific number of chunks.
+//! Each chunk has ceil(size of dim / chunks) entries along dim except the last
+//! one which can be smaller
 //! \param tensor : tensor to split
+//! \param chunks : number of chunks to split
 //! \param dim : dimension along which to split the tensor
-//! \return : vector of split by tensor
-std::vector<Tensor> Chunk(const Tensor& tensor, int dim);
+//! \return : vector of split by tensor. Chunks are views of the input if they
+//! are contiguous in memory
+std::vector<Tensor> Chunk(const Tensor& tensor, int chunks, int dim);
 
 //! Gathers values along an axis specified by dim
 //! \param tensor : input tensor
@@ -139,16 +158,24 @@ std::vector<Tensor> Split(const Tensor& tensor, std::vector<int> splitSize, int
 Tensor Take(const Tensor& tensor, std::vector<int> index);
 
 //! Creates new tensor with transposed value from input tensor
-//! First and second dimension is swapped
+//! Last two dimensions (rows and columns) are swapped
 //! \param tensor : tensor to transpose
-//! \return : transposed tensor
+//! \return : transposed tensor. Returned tensor is strided view of the input
 Tensor Transpose(const Tensor& tensor);
 
 //! Transposes the given tensor
-//! First and second dimension is swapped
+//! Last two dimensions (rows and columns) are swapped
 //! \param tensor : tensor to transpose
 void Transpose(Tensor& tensor);
 
+//! Returns a new tensor with its dimensions permuted
+//! Only strides of the returned tensor are changed and data is not moved
+//! until it is read by an operation that requires contiguous data
+//! \param tensor : tensor to permute
+//! \param dims : new order of the dimensions
+//! \return : permuted tensor. Returned tensor is strided view of the input
+Tensor Permute(const Tensor& tensor, const std::vector<int>& dims);
+
 //! Creates new tensor with given dimension removed
 //! \param tensor : tensor given to remove dimension
 //! \param dim : dimension to unbind
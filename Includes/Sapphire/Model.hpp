@@ -10,11 +10,18 @@
 #include <Sapphire/operations/Unit.hpp>
 #include <Sapphire/tensor/Tensor.hpp>
 #include <Sapphire/tensor/TensorDescriptor.hpp>
+#include <cstddef>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace Sapphire
 {
+//! Model owns the tensor descriptors and the units
+//! Registration and lookup are thread-safe, and references returned by
+//! GetDescriptor stay valid while new descriptors are registered
 class Model
 {
  public:
@@ -22,9 +29,9 @@ class Model
     ~Model() = default;
 
     Model(const Model& model) = delete;
-    Model(Model&& model) noexcept = default;
+    Model(Model&& model) noexcept = delete;
     Model& operator=(const Model& model) = delete;
-    Model& operator=(Model&& model) noexcept = default;
+    Model& operator=(Model&& model) noexcept = delete;
 
     //! Registers unitDataWrapper to the unit
     //! Assigns new key to the given unitDataWrapper
@@ -34,16 +41,93 @@ class Model
 
     //! Creates and registers tensor descriptor
     //! Assigns new key to the given tensorDesc
+    //! Backward data is not created if gradient is disabled on this thread
     int RegisterTensorDescriptor(const Shape& shape, Type type,
                                  const Device& device, unsigned int batchSize,
                                  bool createBackwardData);
 
-    //! Initializes gradients before training every epoch
+    //! Creates and registers tensor descriptor that shares the data of the
+    //! source descriptor
+    //! Forward data of both descriptors are copied on write while they are
+    //! sharing the buffer. Backward data is shared without copy so gradient
+    //! written to the view is directly accumulated to the source
+    //! Backward data is not created if gradient is disabled on this thread
+    //! \param sourceKey : key of the descriptor to create view from
+    //! \param shape : shape of the view
+    //! \param hostOffset : offset of the view on the host buffer
+    //! \param cudaOffset : offset of the view on the cuda buffer
+    //! \return : Assigned key
+    int RegisterTensorDescriptorView(int sourceKey, const Shape& shape,
+                                     unsigned long hostOffset,
+                                     unsigned long cudaOffset);
+
+    //! Registers new tensor descriptor with its dimensions permuted from the
+    //! source descriptor by changing the strides
+    //! Since gradient can't be written to the strided buffer, view has its
+    //! own gradient buffer
+    //! \param sourceKey : key of the descriptor to create view from
+    //! \param dims : new order of the dimensions
+    //! \return : Assigned key
+    int RegisterTensorDescriptorPermuteView(
+        int sourceKey, const std::vector<unsigned int>& dims);
+
+    //! Releases forward and backward data of the descriptors
+    //! Descriptors stay registered, but their data can't be used anymore
+    //! \param keys : keys of the descriptors to release
+    //! \return : number of host bytes returned to the memory pool. Buffers
+    //! still referenced by other tensorData are not counted
+    std::size_t ReleaseTensorData(const std::vector<int>& keys);
+
+    //! Zeros gradient of every parameter of the units
+    //! Gradients are accumulated over back propagations until this is called
+    //! (or the optimizer zeros them)
     void ZeroGrad();
 
+    //! Returns trainable parameters of every unit with their gradients in the
+    //! order of the unit keys and names. Quantized parameters are excluded
+    [[nodiscard]] std::vector<Parameter> GetParameters() const;
+
+    //! Returns tables of every unit whose gradients are accumulated by rows
+    //! in the order of the unit keys and names
+    [[nodiscard]] std::vector<RowParameter> GetRowParameters() const;
+
+    //! Packs parameters of every unit into a single contiguous buffer, and
+    //! their gradients into another
+    //! Parameters and gradients in the units are replaced by views of the
+    //! flat buffers, so whole-model operations (ZeroGrad, ClipGradientNorm,
+    //! optimizer steps) sweep each buffer once instead of visiting every
+    //! small parameter. Every parameter keeps its padded layout, so the views
+    //! stay aligned to 32 bytes
+    //! State of the optimizer is kept for each parameter, and is packed
+    //! into the flat buffer on the next step
+    //! Parameters must be dense, contiguous and placed on the same device
+    void FlattenParameters();
+
+    //! Returns true if parameters have been packed by FlattenParameters
+    [[nodiscard]] bool IsFlattened() const;
+
+    //! Returns buffers covering every parameter with as few buffers as
+    //! possible. Packed parameters are returned as a single parameter made of
+    //! the flat buffers, followed by the parameters registered after packing
+    [[nodiscard]] std::vector<Parameter> GetParameterBuffers() const;
+
+    //! Scales the gradients so that their global L2 norm does not exceed
+    //! maxNorm. Only gradients on the host are supported
+    //! \return : L2 norm of the gradients before clipping
+    float ClipGradientNorm(float maxNorm);
+
+    //! Back propagates from the tensor
+    //! Gradient of the tensor is initialized with ones, and gradients are
+    //! accumulated to every tensor that the tensor was computed from
+    //! \param tensor : tensor to start back propagation (e.g. loss)
+    void Backward(const Tensor& tensor);
+
     //! Returns unitDataWrapper with given key
     UnitDataWrapper GetUnitDataWrapper(int key) const;
 
+    //! Replaces unit data wrapper registered with given key
+    void SetUnitDataWrapper(int key, const UnitDataWrapper& unitDataWrapper);
+
     //! Converts tensor into vector in 1 dimensional format
     //! \param tensor : tensor to extract data from
     [[nodiscard]] const std::vector<float>& GetData(Tensor tensor);
@@ -56,8 +140,14 @@ class Model
     //! \return : tensor descriptor of given key
     TensorUtil::TensorDescriptor& GetDescriptor(int key);
 
+    [[nodiscard]] const std::string& Name() const
+    {
+        return m_name;
+    }
+
  private:
     //! Automatically calculates gradient
+    //! Independent branches of the graph are back propagated in parallel
     //! \param tensorKey : tensor key to the descriptor to start back
     //! propagation
     void m_autoGrad(int tensorKey);
@@ -76,26 +166,202 @@ class Model
         int Counter = 0;
     };
 
+    friend class TensorKeyRecorder;
+
+    //! Records the key to the recorder of the calling thread if any
+    static void m_recordKey(int key);
+
     TensorDescriptorPool m_tensorDescriptorPool;
     UnitPool m_unitPool;
+    //! Flat buffers made by FlattenParameters. Empty if not flattened
+    Parameter m_flatParameter;
     std::string m_name;
+    //! Guards the pools. Elements of unordered_map are never moved, so
+    //! descriptors can be used without the lock once they are found
+    mutable std::mutex m_mtx;
+    //! Keys registered by the calling thread are recorded here if not null
+    static thread_local std::vector<int>* m_recordedKeys;
 };
 
 //! Singleton class for model management
+//! Current model is stored for each thread, so multiple threads can run
+//! different models (or replicas of the same model) concurrently
 class ModelManager
 {
  public:
     static Model& GetModel(const std::string& name);
 
+    //! Returns current model of the calling thread
+    //! Throws runtime_error if current model was not set on this thread
     static Model& GetCurrentModel();
 
+    //! Sets current model of the calling thread
     static void SetCurrentModel(const std::string& name);
 
     static void AddModel(const std::string& name);
 
+    //! Destroys every model with its tensors, and resets current model of the
+    //! calling thread
+    //! Models must be cleared before the static destruction, since memory
+    //! pools holding their tensors may be destroyed first. Models must not be
+    //! used by other threads while they are cleared
+    static void ClearModels();
+
+ private:
+    friend class ModelContext;
+
+    static std::mutex m_mtx;
+    static std::unordered_map<std::string, std::unique_ptr<Model>> m_modelMap;
+    static thread_local Model* m_currentModel;
+};
+
+//! Gradient mode of the calling thread
+//! While disabled, operations allocate no gradient, build no back propagation
+//! wrapper, record no history and save no input
+class GradMode
+{
+ public:
+    static bool IsEnabled();
+
+    static void SetEnabled(bool enabled);
+
+ private:
+    static thread_local bool m_enabled;
+};
+
+//! Disables gradient on the calling thread during its lifetime
+//! Used for inference, where only the forward outputs are required
+//! Previous mode of the thread is restored on destruction
+class NoGradGuard
+{
+ public:
+    NoGradGuard();
+    ~NoGradGuard();
+
+    NoGradGuard(const NoGradGuard& guard) = delete;
+    NoGradGuard(NoGradGuard&& guard) noexcept = delete;
+    NoGradGuard& operator=(const NoGradGuard& guard) = delete;
+    NoGradGuard& operator=(NoGradGuard&& guard) noexcept = delete;
+
+ private:
+    bool m_previousMode;
+};
+
+//! Enables gradient on the calling thread during its lifetime
+//! Used for computing gradient inside the NoGradGuard (e.g. recomputing the
+//! checkpointed segment)
+class EnableGradGuard
+{
+ public:
+    EnableGradGuard();
+    ~EnableGradGuard();
+
+    EnableGradGuard(const EnableGradGuard& guard) = delete;
+    EnableGradGuard(EnableGradGuard&& guard) noexcept = delete;
+    EnableGradGuard& operator=(const EnableGradGuard& guard) = delete;
+    EnableGradGuard& operator=(EnableGradGuard&& guard) noexcept = delete;
+
+ private:
+    bool m_previousMode;
+};
+
+//! Training mode of the calling thread
+//! Units behaving differently for training and inference (e.g. Dropout and
+//! BatchNorm) follow this mode instead of GradMode, so a segment computed
+//! without gradient (e.g. the checkpointed segment) is still trained
+class TrainingMode
+{
+ public:
+    static bool IsEnabled();
+
+    static void SetEnabled(bool enabled);
+
+ private:
+    static thread_local bool m_enabled;
+};
+
+//! Sets training mode of the calling thread during its lifetime
+//! Previous mode of the thread is restored on destruction
+class TrainingModeGuard
+{
+ public:
+    explicit TrainingModeGuard(bool enabled);
+    ~TrainingModeGuard();
+
+    TrainingModeGuard(const TrainingModeGuard& guard) = delete;
+    TrainingModeGuard(TrainingModeGuard&& guard) noexcept = delete;
+    TrainingModeGuard& operator=(const TrainingModeGuard& guard) = delete;
+    TrainingModeGuard& operator=(TrainingModeGuard&& guard) noexcept =
+        delete;
+
+ private:
+    bool m_previousMode;
+};
+
+//! Marks the calling thread as recomputing a checkpointed segment during its
+//! lifetime
+//! Units updating their state in the forward pass (e.g. running statistics of
+//! BatchNorm) skip the update while recomputing, since the original forward
+//! pass has already done it
+class RecomputeGuard
+{
+ public:
+    RecomputeGuard();
+    ~RecomputeGuard();
+
+    RecomputeGuard(const RecomputeGuard& guard) = delete;
+    RecomputeGuard(RecomputeGuard&& guard) noexcept = delete;
+    RecomputeGuard& operator=(const RecomputeGuard& guard) = delete;
+    RecomputeGuard& operator=(RecomputeGuard&& guard) noexcept = delete;
+
+    static bool IsRecomputing();
+
+ private:
+    bool m_previousState;
+    static thread_local bool m_recomputing;
+};
+
+//! Records keys of the tensor descriptors registered by the calling thread
+//! during its lifetime
+//! Recorders can be nested, and keys are only recorded to the innermost one
+class TensorKeyRecorder
+{
+ public:
+    TensorKeyRecorder();
+    ~TensorKeyRecorder();
+
+    TensorKeyRecorder(const TensorKeyRecorder& recorder) = delete;
+    TensorKeyRecorder(TensorKeyRecorder&& recorder) noexcept = delete;
+    TensorKeyRecorder& operator=(const TensorKeyRecorder& recorder) = delete;
+    TensorKeyRecorder& operator=(TensorKeyRecorder&& recorder) noexcept =
+        delete;
+
+    [[nodiscard]] const std::vector<int>& Keys() const
+    {
+        return m_keys;
+    }
+
+ private:
+    std::vector<int> m_keys;
+    std::vector<int>* m_previousKeys;
+};
+
+//! Sets current model of the calling thread during its lifetime
+//! Previous model of the thread is restored on destruction
+class ModelContext
+{
+ public:
+    explicit ModelContext(Model& model);
+    explicit ModelContext(const std::string& name);
+    ~ModelContext();
+
+    ModelContext(const ModelContext& context) = delete;
+    ModelContext(ModelContext&& context) noexcept = delete;
+    ModelContext& operator=(const ModelContext& context) = delete;
+    ModelContext& operator=(ModelContext&& context) noexcept = delete;
+
  private:
-    static std::string m_currentModel;
-    static std::unordered_map<std::string, Model> m_modelMap;
+    Model* m_previousModel;
 };
 }  // namespace Sapphire
 
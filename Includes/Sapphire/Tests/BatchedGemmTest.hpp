@@ -0,0 +1,24 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_BATCHEDGEMMTEST_HPP
+#define Sapphire_BATCHEDGEMMTEST_HPP
+
+namespace Sapphire::Test
+{
+//! Compares the host gemm broadcast over the batch with the reference loops
+//! for small and blocked multiplications
+void TestBatchedGemm();
+
+//! Checks that every schedule of the batched gemm gives the same result,
+//! including the output computed in place
+void TestGemmSchedules();
+
+//! Prints throughput of each schedule over a grid of batch and matrix sizes
+void BenchmarkBatchedGemm();
+}  // namespace Sapphire::Test
+
+#endif  // Sapphire_BATCHEDGEMMTEST_HPP
@@ -14,6 +14,14 @@ void BroadcastWithMissingDimension();
 
 void BroadcastMixed();
 
+//! Compares host element-wise operations broadcasting along the batch, rows,
+//! columns and missing dimensions with the reference loops
+void TestHostBroadcast();
+
+//! Checks that the broadcast output with itself as an input accumulates the
+//! values as the gradients of the broadcast inputs do
+void TestBroadcastAccumulation();
+
 }  // namespace Sapphire::Test
 
 #endif  // Sapphire_BROADCASTTEST_HPP
@@ -0,0 +1,21 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_CONCURRENTQUEUETEST_HPP
+#define Sapphire_CONCURRENTQUEUETEST_HPP
+
+namespace Sapphire::Test
+{
+void TestConcurrentQueueSingleThread();
+
+void TestConcurrentQueueMultiThread();
+
+//! Prints throughput of ConcurrentQueue and mutex guarded queue under
+//! contention
+void BenchmarkConcurrentQueue();
+}  // namespace Sapphire::Test
+
+#endif  // Sapphire_CONCURRENTQUEUETEST_HPP
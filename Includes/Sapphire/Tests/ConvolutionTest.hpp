@@ -0,0 +1,21 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_CONVOLUTIONTEST_HPP
+#define Sapphire_CONVOLUTIONTEST_HPP
+
+namespace Sapphire::Test
+{
+//! Compares host convolution (forward, backward data and backward filter)
+//! with the reference loops for every algorithm
+void TestHostConvolution();
+
+//! Compares Winograd convolution of both tile sizes with the reference loops,
+//! and checks the transformed filter cached by NN::Conv2D follows the weight
+void TestWinogradConvolution();
+}  // namespace Sapphire::Test
+
+#endif  // Sapphire_CONVOLUTIONTEST_HPP
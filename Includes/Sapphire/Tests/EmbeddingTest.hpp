@@ -0,0 +1,21 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_EMBEDDINGTEST_HPP
+#define Sapphire_EMBEDDINGTEST_HPP
+
+namespace Sapphire::Test
+{
+//! Compares gathered rows and scattered gradients with the reference loops
+//! for indices with repetitions
+void TestEmbeddingKernels();
+
+//! Checks that back propagation of the Embedding unit accumulates only the
+//! gathered rows, and the optimizer step updates only those rows
+void TestEmbeddingSparseUpdate();
+}  // namespace Sapphire::Test
+
+#endif  // Sapphire_EMBEDDINGTEST_HPP
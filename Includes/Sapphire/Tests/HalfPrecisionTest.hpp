@@ -0,0 +1,21 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_HALFPRECISIONTEST_HPP
+#define Sapphire_HALFPRECISIONTEST_HPP
+
+namespace Sapphire::Test
+{
+void TestHalfConversion();
+
+void TestHalfGemm();
+
+void TestHalfElementWise();
+
+void TestNonFloat32Rejected();
+}  // namespace Sapphire::Test
+
+#endif  // Sapphire_HALFPRECISIONTEST_HPP
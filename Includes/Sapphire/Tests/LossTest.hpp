@@ -0,0 +1,20 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_LOSSTEST_HPP
+#define Sapphire_LOSSTEST_HPP
+
+namespace Sapphire::Test
+{
+//! Compares the fused cross entropy with the reference computed in double
+//! precision, including logits which overflow exp without the maximum
+void TestCrossEntropyKernels();
+
+//! Checks the gradient of x propagated through NN::Loss::CrossEntropy
+void TestCrossEntropyGradient();
+}  // namespace Sapphire::Test
+
+#endif  // Sapphire_LOSSTEST_HPP
@@ -0,0 +1,36 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_MODELTEST_HPP
+#define Sapphire_MODELTEST_HPP
+
+namespace Sapphire::Test
+{
+//! Runs replicas of the same model on multiple threads, each with its own
+//! model context
+void TestConcurrentModels();
+
+//! Back propagates through parallel branches joined into one tensor, and
+//! compares the gradient with the sum of the branches
+void TestParallelBackward();
+
+//! Back propagates through a chain deeper than the stack could recurse
+void TestDeepBackward();
+
+//! Checks that operations under NoGradGuard allocate no gradient and record
+//! no history
+void TestNoGrad();
+
+//! Checks that saved inputs are kept by reference, and back propagation fails
+//! if they are modified in place
+void TestSavedTensor();
+
+//! Compares the checkpointed segment with the same segment computed without
+//! checkpoint
+void TestCheckpoint();
+}  // namespace Sapphire::Test
+
+#endif  // Sapphire_MODELTEST_HPP
@@ -0,0 +1,25 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_NORMALIZATIONTEST_HPP
+#define Sapphire_NORMALIZATIONTEST_HPP
+
+namespace Sapphire::Test
+{
+//! Compares host layer and batch normalization (forward and backward) with
+//! the reference loops
+void TestHostNormalization();
+
+//! Checks that NN::FoldBatchNorm keeps the inference output of
+//! NN::Linear followed by NN::BatchNorm
+void TestBatchNormFolding();
+
+//! Checks that checkpointed NN::BatchNorm has the same output, gradient and
+//! running statistics as the one without checkpoint
+void TestCheckpointBatchNorm();
+}  // namespace Sapphire::Test
+
+#endif  // Sapphire_NORMALIZATIONTEST_HPP
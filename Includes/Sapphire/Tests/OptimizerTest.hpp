@@ -0,0 +1,28 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_OPTIMIZERTEST_HPP
+#define Sapphire_OPTIMIZERTEST_HPP
+
+namespace Sapphire::Test
+{
+//! Checks that gradients are accumulated over back propagations and zeroed by
+//! the optimizer step
+void TestGradientAccumulation();
+
+//! Compares the fused optimizer kernels with the scalar update rules
+void TestOptimizerUpdate();
+
+//! Checks that flattened parameters keep their data and gradients, and that
+//! whole-model operations work on the flat buffers
+void TestFlattenParameters();
+
+//! Checks that state of the optimizer is carried over when the parameters are
+//! flattened between the steps
+void TestFlattenOptimizerState();
+}  // namespace Sapphire::Test
+
+#endif  // Sapphire_OPTIMIZERTEST_HPP
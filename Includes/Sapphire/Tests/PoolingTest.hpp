@@ -0,0 +1,20 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_POOLINGTEST_HPP
+#define Sapphire_POOLINGTEST_HPP
+
+namespace Sapphire::Test
+{
+//! Compares host max and average pooling (forward and backward) with the
+//! reference loops
+void TestHostPooling();
+
+//! Back propagates through NN::MaxPool2D and NN::GlobalAvgPool
+void TestPoolingUnits();
+}  // namespace Sapphire::Test
+
+#endif  // Sapphire_POOLINGTEST_HPP
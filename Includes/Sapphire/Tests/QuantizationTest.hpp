@@ -0,0 +1,18 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_QUANTIZATIONTEST_HPP
+#define Sapphire_QUANTIZATIONTEST_HPP
+
+namespace Sapphire::Test
+{
+void TestInt8Linear();
+
+//! Checks that quantized linear unit is only called without gradient
+void TestQuantizedLinearGradMode();
+}  // namespace Sapphire::Test
+
+#endif  // Sapphire_QUANTIZATIONTEST_HPP
@@ -0,0 +1,27 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_RANDOMTEST_HPP
+#define Sapphire_RANDOMTEST_HPP
+
+namespace Sapphire::Test
+{
+//! Checks Philox with the known answers of the reference implementation and
+//! the vectorized generator with the scalar one
+void TestPhilox();
+
+//! Checks the distribution of the initializers and that the values only
+//! depend on the seed regardless of the number of threads
+void TestRandomInitialize();
+
+//! Checks that dropout backward regenerates the mask of the forward
+void TestDropout();
+
+//! Checks that the checkpointed dropout replays the mask of the forward
+void TestCheckpointDropout();
+}  // namespace Sapphire::Test
+
+#endif  // Sapphire_RANDOMTEST_HPP
@@ -0,0 +1,23 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_REDUCTIONTEST_HPP
+#define Sapphire_REDUCTIONTEST_HPP
+
+namespace Sapphire::Test
+{
+//! Compares reductions over every set of dimensions with the reference loops
+void TestReduction();
+
+//! Checks long reductions split into parallel chunks and the mean of each
+//! sample
+void TestLongReduction();
+
+//! Checks the column sum accumulated over the rows of every sample
+void TestColumnSum();
+}  // namespace Sapphire::Test
+
+#endif  // Sapphire_REDUCTIONTEST_HPP
@@ -0,0 +1,23 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_TENSORVIEWTEST_HPP
+#define Sapphire_TENSORVIEWTEST_HPP
+
+namespace Sapphire::Test
+{
+void TestReshapeView();
+
+void TestChunkView();
+
+void TestViewCopyOnWrite();
+
+void TestTransposeView();
+
+void TestPermuteView();
+}  // namespace Sapphire::Test
+
+#endif  // Sapphire_TENSORVIEWTEST_HPP
@@ -6,7 +6,15 @@
 
 #ifndef SAPPHIRE_TEST_TESTUTIL_HPP
 #define SAPPHIRE_TEST_TESTUTIL_HPP
+#include <cstddef>
 #include <cstdlib>
+#include <vector>
+
+namespace Sapphire::TensorUtil
+{
+class TensorData;
+}
+
 namespace Sapphire::Test
 {
 void InitIntegerDenseMatrix(float* matrixPtr, const size_t m, const size_t n,
@@ -16,6 +24,44 @@ void InitIntegerDenseMatrix(float* matrixPtr, const size_t m, const size_t n,
 void InitRandomDenseMatrix(float* matrixPtr, const size_t m, const size_t n,
                            const size_t paddedN, const size_t numMatrices,
                            const float sparsity);
+
+//! Returns element (n, c, h, w) of the padded host data of 3 dimensional
+//! tensorData with batch
+float& ElementAt(const TensorUtil::TensorData& tensorData, unsigned int n,
+                 unsigned int c, unsigned int h, unsigned int w);
+
+//! Checks every element of 3 dimensional tensorData with batch against
+//! expected in (n, c, h, w) order, within tolerance relative to the expected
+void CheckClose(const TensorUtil::TensorData& tensorData,
+                const std::vector<float>& expected, float tolerance);
+
+//! Returns element (row, col) of the matrixIdx th matrix in the padded host
+//! data of tensorData
+float& MatrixAt(const TensorUtil::TensorData& tensorData,
+                std::size_t matrixIdx, unsigned int row, unsigned int col);
+
+//! Returns element at the logical index of the padded host data
+float GetAt(const TensorUtil::TensorData& tensorData, unsigned int idx);
+
+//! Returns host data of tensorData without padding
+std::vector<float> GetValues(const TensorUtil::TensorData& tensorData);
+
+//! Copies host data of the tensorData including the padding
+std::vector<float> ToVector(const TensorUtil::TensorData& tensorData);
+
+//! Fills every element of tensorData with values depending on the position
+void Fill(const TensorUtil::TensorData& tensorData, unsigned int seed);
+
+//! Fills the tensor with its logical index
+void FillIndex(const TensorUtil::TensorData& tensorData);
+
+//! Fills the tensor with small integers that are exact in 16 bits
+void FillSmallIntegers(const TensorUtil::TensorData& tensorData);
+
+//! Fills the tensor with integers in [-127, 127]
+//! First row and first column hold 127, so that every row and every column
+//! is quantized with scale of 1 without error
+void FillQuantizable(const TensorUtil::TensorData& tensorData);
 }  // namespace Sapphire::Test
 
-#endif  // SAPPHIRE_TESTUTIL_HPP
+#endif  // SAPPHIRE_TEST_TESTUTIL_HPP
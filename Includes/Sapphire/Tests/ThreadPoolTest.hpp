@@ -0,0 +1,24 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_THREADPOOLTEST_HPP
+#define Sapphire_THREADPOOLTEST_HPP
+
+namespace Sapphire::Test
+{
+void TestParallelFor();
+
+//! Checks that exceptions thrown by the chunks are rethrown on the caller
+void TestParallelForException();
+
+void TestTaskGroup();
+
+//! Checks that sessions sharing the global pool never use more threads than
+//! the global thread budget
+void TestThreadBudget();
+}  // namespace Sapphire::Test
+
+#endif  // Sapphire_THREADPOOLTEST_HPP
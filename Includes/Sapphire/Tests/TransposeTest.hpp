@@ -0,0 +1,21 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_TRANSPOSETEST_HPP
+#define Sapphire_TRANSPOSETEST_HPP
+
+namespace Sapphire::Test
+{
+//! Compares the blocked transpose with the reference loops for the shapes
+//! with partial tiles and blocks, with and without the batch broadcast
+void TestTranspose();
+
+//! Checks the in-place transpose of square matrices and the contiguous copy
+//! of transposed views
+void TestTransposeInPlace();
+}  // namespace Sapphire::Test
+
+#endif  // Sapphire_TRANSPOSETEST_HPP
@@ -7,13 +7,22 @@
 #ifndef Sapphire_COMPUTE_COMPUTE_DECL_HPP
 #define Sapphire_COMPUTE_COMPUTE_DECL_HPP
 
+#include <Sapphire/compute/dense/naive/NaiveReduction.hpp>
 #include <Sapphire/tensor/TensorData.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
 #include <algorithm>
+#include <cstdint>
 #include <vector>
 
+namespace Sapphire
+{
+struct RowGradient;
+}
+
 namespace Sapphire::Compute
 {
 using namespace TensorUtil;
+using Dense::Naive::ReduceOp;
 
 //! Performs out = a + b
 void Add(TensorData& out, const TensorData& a, const TensorData& b);
@@ -33,8 +42,24 @@ void SparseGemm(TensorData& out, const TensorData& a, const TensorData& b,
 void Scale(TensorData& output, const TensorData& input, float factor);
 
 //! Performs output = TransposeKernel(input)
+//! Square matrices on the host are transposed in place if output shares the
+//! data with input
 void Transpose(TensorData& output, const TensorData& input);
 
+//! Copies input to output with different shape
+//! Output and input must have same number of elements
+void Reshape(TensorData& output, const TensorData& input);
+
+//! Copies slice of input along given dimension to output
+//! Output and input must have same shape except the given dimension
+//! \param dim : dimension to slice (batch dimension excluded)
+//! \param outputStart : starting index of the slice in output
+//! \param inputStart : starting index of the slice in input
+//! \param length : length of the slice
+void CopySlice(TensorData& output, const TensorData& input, int dim,
+               unsigned int outputStart, unsigned int inputStart,
+               unsigned int length);
+
 //! Performs Element-wise multiply
 void Dot(TensorData& out, const TensorData& a, const TensorData& b);
 
@@ -67,12 +92,204 @@ void LeakyReluDerivative(TensorData& out, const TensorData& input, float a);
 
 void Inverse(TensorData& out, const TensorData& input);
 
+//! Averages each sample of x into out with shape (1)
 void Mean(TensorData& out, const TensorData& x);
 
+//! Accumulates the sum of every row of input into out with shape (cols)
+//! Rows of every sample in the batch are summed together
+void ColumnSum(TensorData& out, const TensorData& input);
+
+//! Reduces input over dims of its shape by op
+//! Each sample is reduced separately, so out has the batch size of input.
+//! out has the shape of input with the reduced dimensions removed or set to
+//! 1, and shape (1) if every dimension is reduced
+//! Only host tensors are supported
+void Reduce(TensorData& out, const TensorData& input,
+            const std::vector<int>& dims, ReduceOp op);
+
+//! Reduces input over dimension dim by Reduce
+void Sum(TensorData& out, const TensorData& input, int dim);
+
 void Mean(TensorData& out, const TensorData& input, int dim);
 
+void Max(TensorData& out, const TensorData& input, int dim);
+
+void Min(TensorData& out, const TensorData& input, int dim);
+
+//! Computes Euclidean norm over dimension dim
+void Norm(TensorData& out, const TensorData& input, int dim);
+
+//! Stores index of the first maximum along dimension dim as float
+void ArgMax(TensorData& out, const TensorData& input, int dim);
+
 void Softmax(TensorData& out, const TensorData& x);
 
+//! Performs y = conv2d(x, filter) (cross-correlation)
+//! x has shape (C, H, W), filter has shape (K, C, R, S) with batch size 1,
+//! and y has shape (K, P, Q) with the batch size of x
+//! Stride, dilation and padding have the same meaning as
+//! Dense::Cuda::CreateConvDescriptors
+//! Only host tensors are supported. Cuda tensors are convolved by
+//! Dense::Cuda::ConvolutionForward2D with the cudnn metadata of the unit
+void Conv2DForward(TensorData& y, const TensorData& x, const TensorData& filter,
+                   int strideRow, int strideCol, int dilationRow,
+                   int dilationCol, int paddingRow, int paddingCol);
+
+//! Returns output tile size of the Winograd convolution for the operands of
+//! Conv2DForward (4 for F(4x4, 3x3) and 2 for F(2x2, 3x3))
+//! \return : tile size, or 0 if Conv2DForward should not use Winograd
+unsigned int GetWinogradTileSize(const TensorData& x, const TensorData& filter,
+                                 const TensorData& y, int strideRow,
+                                 int strideCol, int dilationRow,
+                                 int dilationCol, int paddingRow,
+                                 int paddingCol);
+
+//! Returns the filter transformed for Conv2DForwardWinograd
+//! Units cache the result, since it only changes when the filter is updated
+TensorData TransformWinogradFilter(const TensorData& filter,
+                                   unsigned int tileSize);
+
+//! Performs y = conv2d(x, filter) with unit stride and dilation by Winograd
+//! convolution using the filter transformed by TransformWinogradFilter
+void Conv2DForwardWinograd(TensorData& y, const TensorData& x,
+                           const TensorData& filter,
+                           const TensorData& transformedFilter,
+                           unsigned int tileSize, int paddingRow,
+                           int paddingCol);
+
+//! Accumulates gradient of x of Conv2DForward to dx
+void Conv2DBackwardData(TensorData& dx, const TensorData& filter,
+                        const TensorData& dy, int strideRow, int strideCol,
+                        int dilationRow, int dilationCol, int paddingRow,
+                        int paddingCol);
+
+//! Accumulates gradient of the filter of Conv2DForward to dFilter
+void Conv2DBackwardFilter(TensorData& dFilter, const TensorData& x,
+                          const TensorData& dy, int strideRow, int strideCol,
+                          int dilationRow, int dilationCol, int paddingRow,
+                          int paddingCol);
+
+//! Performs y = maxpool2d(x)
+//! x has shape (C, H, W) and y has shape (C, P, Q) with the same batch size
+//! Padding must be smaller than the window, and padded elements are ignored
+//! Only host tensors are supported
+//! \param indices : if not nullptr, filled with the position of the maximum
+//! in each window for MaxPool2DBackward. Window can have at most 256
+//! elements so each position fits in a byte
+void MaxPool2DForward(TensorData& y, const TensorData& x, int windowRow,
+                      int windowCol, int strideRow, int strideCol,
+                      int paddingRow, int paddingCol,
+                      std::vector<std::uint8_t>* indices = nullptr);
+
+//! Accumulates gradient of x of MaxPool2DForward to dx
+void MaxPool2DBackward(TensorData& dx, const TensorData& dy,
+                       const std::vector<std::uint8_t>& indices, int windowRow,
+                       int windowCol, int strideRow, int strideCol,
+                       int paddingRow, int paddingCol);
+
+//! Performs y = avgpool2d(x) with the same shapes as MaxPool2DForward
+//! Windows are averaged over the elements inside x
+void AvgPool2DForward(TensorData& y, const TensorData& x, int windowRow,
+                      int windowCol, int strideRow, int strideCol,
+                      int paddingRow, int paddingCol);
+
+//! Accumulates gradient of x of AvgPool2DForward to dx
+void AvgPool2DBackward(TensorData& dx, const TensorData& dy, int windowRow,
+                       int windowCol, int strideRow, int strideCol,
+                       int paddingRow, int paddingCol);
+
+//! Performs y = mean of x over each channel
+//! x has shape (C, H, W) and y has shape (C) with the same batch size
+void GlobalAvgPoolForward(TensorData& y, const TensorData& x);
+
+//! Accumulates gradient of x of GlobalAvgPoolForward to dx
+void GlobalAvgPoolBackward(TensorData& dx, const TensorData& dy);
+
+//! Performs y[i] = table[indices[i]] on the rows of the table
+//! table has shape (rows, cols) with batch size 1, and y has one row of cols
+//! elements for each index
+//! Only host tensors are supported
+void EmbeddingForward(TensorData& y, const TensorData& table,
+                      const std::vector<std::size_t>& indices);
+
+//! Accumulates dy[i] into the gradient of row indices[i] of the table
+//! Only the rows in indices are added to the gradient
+void EmbeddingBackward(RowGradient& gradient, const TensorData& dy,
+                       const std::vector<std::size_t>& indices);
+
+//! Performs loss = mean(log(sum(exp(x[row]))) - x[row][labels[row]]) over
+//! the rows of the last dimension of x, where labels[row] is the class of
+//! each row
+//! loss has shape (1) with batch size 1
+//! Only host tensors are supported
+//! \param logSumExp : if not nullptr, filled with the log-sum-exp of each row
+//! for CrossEntropyBackward
+void CrossEntropyForward(TensorData& loss, const TensorData& x,
+                         const std::vector<std::size_t>& labels,
+                         std::vector<float>* logSumExp = nullptr);
+
+//! Accumulates dy / rows * (softmax(x) - onehot(labels)) to dx, which is the
+//! gradient of x of CrossEntropyForward
+void CrossEntropyBackward(TensorData& dx, const TensorData& dy,
+                          const TensorData& x,
+                          const std::vector<std::size_t>& labels,
+                          const std::vector<float>& logSumExp);
+
+//! Performs y = x * mask / (1 - rate), where each element of the mask is 0
+//! with probability rate
+//! Mask is generated by Philox from (seed, offset) of
+//! Initialize::ReserveRandom, so DropoutBackward regenerates it with the
+//! same seed and offset instead of storing it
+//! Only host tensors are supported
+void DropoutForward(TensorData& y, const TensorData& x, float rate,
+                    std::uint64_t seed, std::uint64_t offset);
+
+//! Accumulates dy * mask / (1 - rate) to dx with the mask of DropoutForward
+void DropoutBackward(TensorData& dx, const TensorData& dy, float rate,
+                     std::uint64_t seed, std::uint64_t offset);
+
+//! Performs y = (x - mean) / sqrt(var + epsilon) * gamma + beta, where mean
+//! and var are computed over the last dimension of x
+//! gamma and beta have shape (cols) with batch size 1
+//! Only host tensors are supported
+//! \param mean, rstd : if not nullptr, filled with mean and
+//! 1 / sqrt(var + epsilon) of each row for LayerNormBackward
+void LayerNormForward(TensorData& y, const TensorData& x,
+                      const TensorData& gamma, const TensorData& beta,
+                      float epsilon, std::vector<float>* mean = nullptr,
+                      std::vector<float>* rstd = nullptr);
+
+//! Accumulates gradients of x, gamma and beta of LayerNormForward
+void LayerNormBackward(TensorData& dx, TensorData& dGamma, TensorData& dBeta,
+                       const TensorData& dy, const TensorData& x,
+                       const TensorData& gamma, const std::vector<float>& mean,
+                       const std::vector<float>& rstd);
+
+//! Performs y = (x - mean) / sqrt(var + epsilon) * gamma + beta on each
+//! channel, where mean and var are computed over the batch and the other
+//! dimensions. Channel is the first dimension of x with shape (C, ...), or
+//! the only dimension of x with shape (C)
+//! gamma, beta, runningMean and runningVar have shape (C) with batch size 1
+//! If isTraining is true, statistics of the batch are used and the running
+//! statistics are updated as running = (1 - momentum) * running +
+//! momentum * batch with the unbiased variance. Running statistics are used
+//! otherwise
+//! Only host tensors are supported
+//! \param mean, rstd : if not nullptr, filled with mean and
+//! 1 / sqrt(var + epsilon) of each channel for BatchNormBackward
+void BatchNormForward(TensorData& y, const TensorData& x,
+                      const TensorData& gamma, const TensorData& beta,
+                      TensorData& runningMean, TensorData& runningVar,
+                      float momentum, float epsilon, bool isTraining,
+                      std::vector<float>* mean = nullptr,
+                      std::vector<float>* rstd = nullptr);
+
+//! Accumulates gradients of x, gamma and beta of BatchNormForward in training
+void BatchNormBackward(TensorData& dx, TensorData& dGamma, TensorData& dBeta,
+                       const TensorData& dy, const TensorData& x,
+                       const TensorData& gamma, const std::vector<float>& mean,
+                       const std::vector<float>& rstd);
+
 //! Broadcasts given shape and invokes the function
 //! Each shape variable are required to be same size in reversed order
 //! containing row and column indices shapes must be padded to match the same
@@ -80,6 +297,8 @@ void Softmax(TensorData& out, const TensorData& x);
 //! shapeIdx starts at last index of the shape array
 //! totalSize parameters should contain actual total size of the whole array
 //! including batch size
+//! If parallel is true, chunks writing to disjoint parts of out are invoked
+//! in parallel on the thread pool. Must be false for CUDA kernels
 template <typename Func, typename... Params>
 void BroadcastWith3Inputs(const Shape& shapeOut, const Shape& shapeA,
                           const Shape& shapeB, const Shape& shapeC,
@@ -87,8 +306,8 @@ void BroadcastWith3Inputs(const Shape& shapeOut, const Shape& shapeA,
                           unsigned int totalSizeB, unsigned int totalSizeC,
                           float* out, float* A, float* B, float* C,
                           unsigned int shapeIdx,
-                          unsigned int minimumRequiredDim, Func func,
-                          Params... params)
+                          unsigned int minimumRequiredDim, bool parallel,
+                          Func func, Params... params)
 {
     if (shapeIdx >= shapeOut.Dim() - minimumRequiredDim)
     {
@@ -129,16 +348,26 @@ void BroadcastWith3Inputs(const Shape& shapeOut, const Shape& shapeA,
     const auto maxChunkSize =
         std::max({ chunkSizeOut, chunkSizeA, chunkSizeB, chunkSizeC });
 
-    for (unsigned int chunkIdx = 0; chunkIdx < maxChunkSize; chunkIdx++)
-    {
-        BroadcastWith3Inputs(shapeOut, shapeA, shapeB, shapeC, strideOut,
-                             strideA, strideB, strideC,
-                             out + (chunkIdx % chunkSizeOut) * strideOut,
-                             A + (chunkIdx % chunkSizeA) * strideA,
-                             B + (chunkIdx % chunkSizeB) * strideB,
-                             C + (chunkIdx % chunkSizeC) * strideC,
-                             shapeIdx + 1, minimumRequiredDim, func, params...);
-    }
+    const auto invokeChunks = [&](std::size_t chunkBegin,
+                                  std::size_t chunkEnd) {
+        for (auto chunkIdx = chunkBegin; chunkIdx < chunkEnd; chunkIdx++)
+        {
+            BroadcastWith3Inputs(
+                shapeOut, shapeA, shapeB, shapeC, strideOut, strideA, strideB,
+                strideC, out + (chunkIdx % chunkSizeOut) * strideOut,
+                A + (chunkIdx % chunkSizeA) * strideA,
+                B + (chunkIdx % chunkSizeB) * strideB,
+                C + (chunkIdx % chunkSizeC) * strideC, shapeIdx + 1,
+                minimumRequiredDim, parallel, func, params...);
+        }
+    };
+
+    //! Chunks can be computed in parallel only if they do not share the output
+    if (parallel && chunkSizeOut == maxChunkSize)
+        Util::ParallelFor(0, maxChunkSize, Util::GrainSize(strideOut),
+                          invokeChunks);
+    else
+        invokeChunks(0, maxChunkSize);
 }
 
 template <typename Func, typename... Params>
@@ -146,8 +375,8 @@ void BroadcastWith2Inputs(const Shape& shapeOut, const Shape& shapeA,
                           const Shape& shapeB, unsigned int totalSizeOut,
                           unsigned int totalSizeA, unsigned int totalSizeB,
                           float* out, float* A, float* B, unsigned int shapeIdx,
-                          unsigned int minimumRequiredDim, Func func,
-                          Params... params)
+                          unsigned int minimumRequiredDim, bool parallel,
+                          Func func, Params... params)
 {
     if (shapeIdx >= shapeOut.Dim() - minimumRequiredDim)
     {
@@ -185,15 +414,25 @@ void BroadcastWith2Inputs(const Shape& shapeOut, const Shape& shapeA,
     const auto maxChunkSize =
         std::max({ chunkSizeOut, chunkSizeA, chunkSizeB });
 
-    for (unsigned int chunkIdx = 0; chunkIdx < maxChunkSize; chunkIdx++)
-    {
-        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, strideOut, strideA,
-                             strideB,
-                             out + (chunkIdx % chunkSizeOut) * strideOut,
-                             A + (chunkIdx % chunkSizeA) * strideA,
-                             B + (chunkIdx % chunkSizeB) * strideB,
-                             shapeIdx + 1, minimumRequiredDim, func, params...);
-    }
+    const auto invokeChunks = [&](std::size_t chunkBegin,
+                                  std::size_t chunkEnd) {
+        for (auto chunkIdx = chunkBegin; chunkIdx < chunkEnd; chunkIdx++)
+        {
+            BroadcastWith2Inputs(
+                shapeOut, shapeA, shapeB, strideOut, strideA, strideB,
+                out + (chunkIdx % chunkSizeOut) * strideOut,
+                A + (chunkIdx % chunkSizeA) * strideA,
+                B + (chunkIdx % chunkSizeB) * strideB, shapeIdx + 1,
+                minimumRequiredDim, parallel, func, params...);
+        }
+    };
+
+    //! Chunks can be computed in parallel only if they do not share the output
+    if (parallel && chunkSizeOut == maxChunkSize)
+        Util::ParallelFor(0, maxChunkSize, Util::GrainSize(strideOut),
+                          invokeChunks);
+    else
+        invokeChunks(0, maxChunkSize);
 }
 
 }  // namespace Sapphire::Compute
@@ -8,11 +8,83 @@
 #define Sapphire_INITIALIZE_HPP
 
 #include <Sapphire/tensor/TensorData.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace Sapphire::Compute::Initialize
 {
+//! Seed and first Philox counter of the random values of an operation
+struct RandomStream
+{
+    std::uint64_t Seed = 0;
+    std::uint64_t Offset = 0;
+};
+
+//! Sets seed of the random values drawn by the initializers and dropout, and
+//! restarts the stream. Values drawn afterwards are reproducible regardless
+//! of the number of threads
+//! Seed is chosen from std::random_device if this is never called
+void SetSeed(std::uint64_t seed);
+
+//! Reserves count random values from the stream
+//! Each operation takes its own range of counters, so operations running in
+//! parallel draw different values
+RandomStream ReserveRandom(std::size_t count);
+
+//! Records the streams reserved by the calling thread during its lifetime
+//! Recorders can be nested. Streams of the innermost one are appended to the
+//! previous one on destruction
+class RandomRecorder
+{
+ public:
+    RandomRecorder();
+    ~RandomRecorder();
+
+    RandomRecorder(const RandomRecorder& recorder) = delete;
+    RandomRecorder(RandomRecorder&& recorder) noexcept = delete;
+    RandomRecorder& operator=(const RandomRecorder& recorder) = delete;
+    RandomRecorder& operator=(RandomRecorder&& recorder) noexcept = delete;
+
+    [[nodiscard]] const std::vector<RandomStream>& Streams() const
+    {
+        return m_streams;
+    }
+
+ private:
+    friend RandomStream ReserveRandom(std::size_t count);
+
+    std::vector<RandomStream> m_streams;
+    RandomRecorder* m_previous;
+};
+
+//! Replays recorded streams on the calling thread during its lifetime
+//! ReserveRandom returns the recorded streams in order instead of reserving
+//! new ones, so recomputed operations draw the same values as the recorded
+//! ones. Reserving more streams than recorded throws runtime_error
+class RandomReplayGuard
+{
+ public:
+    explicit RandomReplayGuard(std::vector<RandomStream> streams);
+    ~RandomReplayGuard();
+
+    RandomReplayGuard(const RandomReplayGuard& guard) = delete;
+    RandomReplayGuard(RandomReplayGuard&& guard) noexcept = delete;
+    RandomReplayGuard& operator=(const RandomReplayGuard& guard) = delete;
+    RandomReplayGuard& operator=(RandomReplayGuard&& guard) noexcept = delete;
+
+ private:
+    friend RandomStream ReserveRandom(std::size_t count);
+
+    std::vector<RandomStream> m_streams;
+    std::size_t m_next = 0;
+    RandomReplayGuard* m_previous;
+};
+
 void Normal(const TensorUtil::TensorData& data, float mean, float sd);
 
+void Uniform(const TensorUtil::TensorData& data, float min, float max);
+
 void Ones(const TensorUtil::TensorData& data);
 
 void Zeros(const TensorUtil::TensorData& data);
@@ -71,6 +71,10 @@ __host__ void Inverse(float* output, const float* input,
 __host__ void Mean(float* output, const float* input, unsigned int totalSize,
                    unsigned int unitSize);
 
+//! Accumulates the sum of the rows of input into output with size cols
+__host__ void ColumnSum(float* output, const float* input, unsigned int rows,
+                        unsigned int cols);
+
 __host__ void Softmax(float* output, const float* input, unsigned int totalSize,
                       unsigned int unitSize);
 
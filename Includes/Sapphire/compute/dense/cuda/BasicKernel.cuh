@@ -93,6 +93,10 @@ __global__ void InverseKernel(float* output, const float* input,
 __global__ void MeanKernel(float* output, const float* input,
                            unsigned int totalSize, unsigned int unitSize);
 
+//! Each thread accumulates the sum of a column of input into output
+__global__ void ColumnSumKernel(float* output, const float* input,
+                                unsigned int rows, unsigned int cols);
+
 //! Total size must be multiple of unitSize
 __global__ void SoftmaxKernel(float* output, const float* input,
                               unsigned int totalSize, unsigned int unitSize);
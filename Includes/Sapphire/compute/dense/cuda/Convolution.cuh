@@ -42,12 +42,12 @@ struct CudnnMetaData
     cudnnConvolutionBwdFilterAlgo_t BackwardFilterAlgo;
 };
 
-__host__ void checkCuDNN(cudnnStatus_t status)
+__host__ inline void checkCuDNN(cudnnStatus_t status)
 {
     assert(status == CUDNN_STATUS_SUCCESS);
 }
 
-__host__ void checkCuda(cudaError_t status)
+__host__ inline void checkCuda(cudaError_t status)
 {
     assert(status == cudaSuccess);
 }
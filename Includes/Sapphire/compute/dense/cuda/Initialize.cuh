@@ -12,11 +12,13 @@
 
 namespace Sapphire::Compute::Dense::Cuda
 {
+//! Values are drawn by Philox from the seed, and offset is the first
+//! counter reserved by Initialize::ReserveRandom
 __host__ void Normal(float* data, float mean, float sd, unsigned int size,
-                     int seed);
+                     unsigned long long seed, unsigned long long offset);
 
 __host__ void Uniform(float* data, float min, float max, unsigned int size,
-                      int seed);
+                      unsigned long long seed, unsigned long long offset);
 
 __host__ void Scalar(float* data, float value, unsigned int size);
 }  // namespace Sapphire::Compute::Cuda::Dense
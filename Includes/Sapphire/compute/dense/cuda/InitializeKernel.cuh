@@ -12,11 +12,14 @@
 
 namespace Sapphire::Compute::Dense::Cuda
 {
+//! Each thread draws from its own Philox subsequence starting at offset
 __global__ void NormalKernel(float* data, float mean, float sd,
-                             unsigned int size, int seed);
+                             unsigned int size, unsigned long long seed,
+                             unsigned long long offset);
 
 __global__ void UniformKernel(float* data, float min, float max,
-                              unsigned int size, int seed);
+                              unsigned int size, unsigned long long seed,
+                              unsigned long long offset);
 
 __global__ void ScalarKernel(float* data, float value, unsigned int size);
 }  // namespace Sapphire::Compute::Dense::Cuda
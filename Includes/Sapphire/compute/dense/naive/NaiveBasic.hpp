@@ -24,10 +24,33 @@ void Dot(unsigned int totalSize, float* output, const float* inputA,
 void Scale(float* output, const float* input, float scaleFactor,
            unsigned int totalSize);
 
-void Transpose(float* output, const float* input, unsigned int inputRows,
-               unsigned int paddedInputRows, unsigned int inputCols,
-               unsigned int paddedInputCols, unsigned int batchSize,
-               bool broadcast);
+//! Copies input to output with different column size
+//! totalSize is number of elements excluding the padding
+void Reshape(float* output, const float* input, unsigned int totalSize,
+             unsigned int outputCols, unsigned int paddedOutputCols,
+             unsigned int inputCols, unsigned int paddedInputCols);
+
+//! Copies slice of input to output along the dimension split by outerSize and
+//! innerSize
+//! \param outputDimSize : size of the sliced dimension of output
+//! \param inputDimSize : size of the sliced dimension of input
+//! \param outputStart : starting index of the slice in output
+//! \param inputStart : starting index of the slice in input
+//! \param length : length of the slice
+void CopySlice(float* output, const float* input, unsigned int outerSize,
+               unsigned int innerSize, unsigned int outputDimSize,
+               unsigned int inputDimSize, unsigned int outputStart,
+               unsigned int inputStart, unsigned int length,
+               unsigned int outputCols, unsigned int paddedOutputCols,
+               unsigned int inputCols, unsigned int paddedInputCols);
+
+//! Copies strided input to output laid out in padded row-major order
+//! \param shape : size of each dimension. Last dimension is the column
+//! \param inputStrides : stride of each dimension of input
+//! \param dim : number of dimensions
+void StridedCopy(float* output, const float* input, const unsigned int* shape,
+                 const unsigned long* inputStrides, unsigned int dim,
+                 unsigned int paddedOutputCols);
 
 void Pow(float* output, const float* input, float scaleFactor,
          unsigned int totalSize);
@@ -63,6 +86,11 @@ void Inverse(float* output, const float* input, unsigned int totalSize);
 void Mean(float* output, const float* input, unsigned int totalSize,
           unsigned int unitSize);
 
+//! Accumulates the sum of the rows of input into output with size cols
+//! \param padSize : stride between the rows of input
+void ColumnSum(float* output, const float* input, unsigned int rows,
+               unsigned int cols, unsigned int padSize);
+
 void Softmax(float* output, const float* input, unsigned int totalSize,
              unsigned int unitSize, unsigned int padSize);
 
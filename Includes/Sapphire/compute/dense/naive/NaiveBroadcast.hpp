@@ -0,0 +1,78 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_COMPUTE_NAIVEBROADCAST_HPP
+#define Sapphire_COMPUTE_NAIVEBROADCAST_HPP
+
+#include <array>
+#include <cstddef>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Element-wise operation of two operands
+enum class BinaryOp
+{
+    Add,
+    Sub,
+    //! Element-wise multiplication
+    Mul,
+};
+
+//! Maximum number of dimensions of the broadcast, which are the dimensions of
+//! the shape and the batch
+constexpr unsigned int MaxBroadcastDims = 9;
+
+//! Dimension of BroadcastPlan
+//! Operands broadcast along the dimension have zero stride
+struct BroadcastDim
+{
+    std::size_t Size = 1;
+    std::size_t StrideOut = 0;
+    std::size_t StrideA = 0;
+    std::size_t StrideB = 0;
+};
+
+//! Iteration of the element-wise operation broadcasting its operands
+//! Dimensions are ordered from the outermost to the innermost. Innermost
+//! dimension is the vectorized loop, and each combination of the outer
+//! dimensions is a run of it. Built by MakeBroadcastPlan
+//! Plan has a fixed size so it can be cached without allocation
+struct BroadcastPlan
+{
+    std::array<BroadcastDim, MaxBroadcastDims> Dims{};
+    unsigned int NumDims = 0;
+    //! Number of runs of the innermost dimension
+    std::size_t NumRuns = 1;
+    //! True if out is broadcast, so multiple elements are written to the same
+    //! output. Such plans are executed in order on a single thread
+    bool SharesOutput = false;
+};
+
+//! Builds the plan broadcasting the operands of given dimensions and strides
+//! Each dimension iterates over the largest size among the operands, and the
+//! other operands must have size 1 in it. Out can also be broadcast, where
+//! each write overwrites the previous one. If out is also an input, the
+//! values are accumulated into it, as gradients of the broadcast inputs are
+//! Dimensions of size 1 are removed, and adjacent dimensions laid out
+//! contiguously in every operand, or broadcast in the same operands, are
+//! coalesced into one
+//! Throws std::invalid_argument if the shapes cannot be broadcast
+BroadcastPlan MakeBroadcastPlan(unsigned int numDims,
+                                const std::size_t* sizesOut,
+                                const std::size_t* sizesA,
+                                const std::size_t* sizesB,
+                                const std::size_t* stridesOut,
+                                const std::size_t* stridesA,
+                                const std::size_t* stridesB);
+
+//! Performs out = a op b by the plan
+//! Runs are distributed over the thread pool, and each run is vectorized if
+//! out is contiguous in the innermost dimension
+void BroadcastBinary(float* out, const float* a, const float* b,
+                     const BroadcastPlan& plan, BinaryOp op);
+}  // namespace Sapphire::Compute::Dense::Naive
+
+#endif  // Sapphire_COMPUTE_NAIVEBROADCAST_HPP
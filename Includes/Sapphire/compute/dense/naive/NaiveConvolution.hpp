@@ -0,0 +1,92 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_COMPUTE_NAIVECONVOLUTION_HPP
+#define Sapphire_COMPUTE_NAIVECONVOLUTION_HPP
+
+#include <cstddef>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Algorithm of the host convolution
+enum class ConvAlgorithm
+{
+    //! Chooses Winograd for 3x3 filters with unit stride and dilation if
+    //! GetWinogradTileSize accepts the shape, Direct for other small filters
+    //! with enough channels, and Im2ColGemm otherwise
+    Auto,
+    //! Unfolds the input into columns and multiplies them with the filter
+    //! using the blocked GEMM. Works for every shape
+    Im2ColGemm,
+    //! Convolves the input reordered into NCHW8c blocks, where 8 channels are
+    //! stored together so each vector register holds 8 output channels
+    Direct,
+    //! Winograd minimal filtering for 3x3 filters with unit stride and
+    //! dilation. Falls back to Auto for the other shapes
+    Winograd,
+};
+
+//! Shape and parameters of the 2D convolution (cross-correlation)
+//! Parameters have the same meaning as Cuda::CreateConvDescriptors
+//! Input, filter and output are laid out in NCHW order, and each row is padded
+//! on the host as TensorData does
+struct ConvShape
+{
+    //! Input (N, C, H, W)
+    unsigned int N = 0, C = 0, H = 0, W = 0;
+    //! Filter (K, C, R, S)
+    unsigned int K = 0, R = 0, S = 0;
+    //! Output (N, K, P, Q)
+    unsigned int P = 0, Q = 0;
+
+    unsigned int StrideRow = 1, StrideCol = 1;
+    unsigned int DilationRow = 1, DilationCol = 1;
+    unsigned int PaddingRow = 0, PaddingCol = 0;
+
+    //! Padded row sizes of input, filter and output on the host
+    unsigned int PaddedW = 0, PaddedS = 0, PaddedQ = 0;
+};
+
+//! Performs y = conv(x, filter)
+void Conv2DForward(float* y, const float* x, const float* filter,
+                   const ConvShape& shape,
+                   ConvAlgorithm algorithm = ConvAlgorithm::Auto);
+
+//! Returns output tile size of the Winograd convolution for the shape
+//! 4 selects F(4x4, 3x3) and 2 selects F(2x2, 3x3). F(4x4, 3x3) needs 4x
+//! fewer multiplications than the direct convolution but amplifies the
+//! rounding error, so F(2x2, 3x3) is chosen for long sums over the channels
+//! \return : tile size, or 0 if Winograd should not be used for the shape
+unsigned int GetWinogradTileSize(const ConvShape& shape);
+
+//! Returns number of elements of the filter transformed for tileSize
+std::size_t GetWinogradFilterSize(const ConvShape& shape,
+                                  unsigned int tileSize);
+
+//! Transforms the filter for Conv2DForwardWinograd
+//! Transformed filter only depends on the filter, so it can be reused while
+//! the filter does not change
+//! \param transformed : GetWinogradFilterSize elements laid out in
+//! ((tileSize + 2)^2, K, C)
+void WinogradTransformFilter(float* transformed, const float* filter,
+                             const ConvShape& shape, unsigned int tileSize);
+
+//! Performs y = conv(x, filter) by Winograd convolution with the filter
+//! transformed by WinogradTransformFilter
+//! Shape must be a 3x3 convolution with unit stride and dilation
+void Conv2DForwardWinograd(float* y, const float* x, const float* transformed,
+                           const ConvShape& shape, unsigned int tileSize);
+
+//! Performs dx += gradient of x from dy
+void Conv2DBackwardData(float* dx, const float* filter, const float* dy,
+                        const ConvShape& shape);
+
+//! Performs dFilter += gradient of the filter from x and dy
+void Conv2DBackwardFilter(float* dFilter, const float* x, const float* dy,
+                          const ConvShape& shape);
+}  // namespace Sapphire::Compute::Dense::Naive
+
+#endif  // Sapphire_COMPUTE_NAIVECONVOLUTION_HPP
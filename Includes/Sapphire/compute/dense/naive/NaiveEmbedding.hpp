@@ -0,0 +1,33 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_COMPUTE_NAIVEEMBEDDING_HPP
+#define Sapphire_COMPUTE_NAIVEEMBEDDING_HPP
+
+#include <cstddef>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Performs output[i] = table[indices[i]] on the rows of rowSize elements
+//! Rows of the table are prefetched ahead of the copy, since the gathered
+//! rows are scattered over the table
+//! \param outputStride, tableStride : distances between the rows
+void Gather(float* output, std::size_t outputStride, const float* table,
+            std::size_t tableStride, const std::size_t* indices,
+            std::size_t count, unsigned int rowSize);
+
+//! Performs rows[slots[i]] += gradient[i] on the rows of rowSize elements
+//! Rows of the same slot are added in the order of i by one thread, so the
+//! result does not depend on the scheduling
+//! \param numSlots : number of rows of rows
+//! \param gradientStride : distance between the rows of gradient
+void ScatterAddRows(float* rows, std::size_t numSlots,
+                    const std::size_t* slots, const float* gradient,
+                    std::size_t gradientStride, std::size_t count,
+                    unsigned int rowSize);
+}  // namespace Sapphire::Compute::Dense::Naive
+
+#endif  // Sapphire_COMPUTE_NAIVEEMBEDDING_HPP
@@ -7,17 +7,97 @@
 #ifndef Sapphire_COMPUTE_NAIVEGEMM_HPP
 #define Sapphire_COMPUTE_NAIVEGEMM_HPP
 
+#include <cstddef>
+#include <vector>
+
 namespace Sapphire::Compute::Dense::Naive
 {
 void NaiveGemm(unsigned int paddedSizeOut, float* out, float* A, float* B, float* C,
                unsigned int M, unsigned int N, unsigned int paddedN,
                unsigned int K, unsigned int paddedK);
 
+//! Performs GEMM (out = A*B + C) with strided A and B
+//! Transposed operands can be given by swapping their row and column strides
+//! \param matrixStrideA : stride between the matrices of A
+//! \param rowStrideA : stride between the rows of A
+//! \param colStrideA : stride between the columns of A
+void StridedGemm(unsigned int paddedSizeOut, float* out, float* A, float* B,
+                 float* C, unsigned int M, unsigned int N, unsigned int paddedN,
+                 unsigned int K, unsigned int matrixStrideA,
+                 unsigned int rowStrideA, unsigned int colStrideA,
+                 unsigned int matrixStrideB, unsigned int rowStrideB,
+                 unsigned int colStrideB);
+
 void Gemm(float* out, float* A, float* B, float* C, unsigned int M,
           unsigned int N, unsigned int paddedN, unsigned int K,
           unsigned int paddedK, unsigned int batchSizeOut,
           unsigned int batchSizeA, unsigned int batchSizeB,
           unsigned int batchSizeC, unsigned int unitBatchSize);
+
+//! Performs GEMM (out = A*B, or out += A*B if accumulate is true) with cache
+//! blocking
+//! Blocks of A and B are packed into panels fitting in the cache, and each
+//! tile of out is computed by a register blocked micro kernel. Tiles of out
+//! are distributed over the thread pool
+//! Operands are read through their strides, so transposed operands are given
+//! by swapping their row and column strides
+//! \param ldOut : stride between the rows of out
+void BlockedGemm(unsigned int M, unsigned int N, unsigned int K,
+                 const float* A, std::size_t rowStrideA,
+                 std::size_t colStrideA, const float* B,
+                 std::size_t rowStrideB, std::size_t colStrideB, float* out,
+                 std::size_t ldOut, bool accumulate);
+
+//! Pointers of a single multiplication (Out = A*B + C) in the batched GEMM
+//! C can be the same as Out
+struct GemmBatchEntry
+{
+    float* Out = nullptr;
+    const float* A = nullptr;
+    const float* B = nullptr;
+    const float* C = nullptr;
+};
+
+//! Shape and strides shared by every multiplication of the batched GEMM
+struct GemmBatchShape
+{
+    unsigned int M = 0, N = 0, K = 0;
+    std::size_t RowStrideA = 0, ColStrideA = 0;
+    std::size_t RowStrideB = 0, ColStrideB = 0;
+    //! Stride between the rows of Out and C
+    std::size_t LdOut = 0, LdC = 0;
+};
+
+//! Parallelization of the batched GEMM
+enum class GemmSchedule
+{
+    //! Multiplications are distributed over the thread pool, and each of them
+    //! is computed by a single thread
+    Batch,
+    //! Multiplications are computed in order, and tiles of each output are
+    //! distributed over the thread pool
+    Matrix,
+};
+
+//! Chooses the schedule keeping more threads busy. Batch is chosen if both
+//! keep the same number of threads busy, since it does not synchronize
+//! between the multiplications
+GemmSchedule ChooseGemmSchedule(std::size_t numMatrices, unsigned int M,
+                                unsigned int N, unsigned int K,
+                                unsigned int numThreads);
+
+//! Performs Out = A*B + C for every entry
+//! Entries sharing Out must be computed with GemmSchedule::Matrix, where the
+//! last entry determines the result
+void BatchedGemm(const GemmBatchShape& shape, const GemmBatchEntry* entries,
+                 std::size_t numEntries, GemmSchedule schedule);
+
+inline void BatchedGemm(const GemmBatchShape& shape,
+                        const std::vector<GemmBatchEntry>& entries,
+                        GemmSchedule schedule)
+{
+    BatchedGemm(shape, entries.data(), entries.size(), schedule);
+}
 }  // namespace Sapphire::Compute::Naive::Dense
 
 #endif
@@ -0,0 +1,68 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_COMPUTE_NAIVEHALF_HPP
+#define Sapphire_COMPUTE_NAIVEHALF_HPP
+
+#include <Sapphire/tensor/Shape.hpp>
+#include <cstdint>
+
+//! Kernels for 16 bit data (Float16 and BFloat16) stored on the host
+//! Values are converted to float in registers and every computation is
+//! performed in float
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Converts float data into 16 bit data with round to nearest even
+//! \param output : 16 bit output buffer
+//! \param input : float input buffer
+//! \param totalSize : number of elements to convert
+//! \param dataType : data type of output (Float16 or BFloat16)
+void ConvertFromFloat(std::uint16_t* output, const float* input,
+                      unsigned long totalSize, DataType dataType);
+
+//! Converts 16 bit data into float data
+//! \param output : float output buffer
+//! \param input : 16 bit input buffer
+//! \param totalSize : number of elements to convert
+//! \param dataType : data type of input (Float16 or BFloat16)
+void ConvertToFloat(float* output, const std::uint16_t* input,
+                    unsigned long totalSize, DataType dataType);
+
+//! Performs GEMM (out = A*B + C) with A and B stored in 16 bits
+//! Products are accumulated in float, and C and out are float matrices
+//! \param numMatrices : number of matrices to compute
+//! \param strideA : stride between the matrices of A (0 for broadcast)
+//! \param strideB : stride between the matrices of B (0 for broadcast)
+//! \param strideC : stride between the matrices of C (0 for broadcast)
+void HalfGemm(unsigned int numMatrices, float* out, const std::uint16_t* A,
+              const std::uint16_t* B, const float* C, unsigned int M,
+              unsigned int N, unsigned int paddedN, unsigned int K,
+              unsigned int paddedK, unsigned long strideA,
+              unsigned long strideB, unsigned long strideC,
+              DataType dataType);
+
+//! out = A + B
+void HalfAdd(unsigned long totalSize, std::uint16_t* output,
+             const std::uint16_t* inputA, const std::uint16_t* inputB,
+             DataType dataType);
+
+//! out = A - B
+void HalfSub(unsigned long totalSize, std::uint16_t* output,
+             const std::uint16_t* inputA, const std::uint16_t* inputB,
+             DataType dataType);
+
+//! out = A * B (element-wise)
+void HalfDot(unsigned long totalSize, std::uint16_t* output,
+             const std::uint16_t* inputA, const std::uint16_t* inputB,
+             DataType dataType);
+
+//! out = input * scaleFactor
+void HalfScale(unsigned long totalSize, std::uint16_t* output,
+               const std::uint16_t* input, float scaleFactor,
+               DataType dataType);
+}  // namespace Sapphire::Compute::Dense::Naive
+
+#endif
@@ -7,15 +7,24 @@
 #ifndef Sapphire_NAIVEINITIALIZE_HPP
 #define Sapphire_NAIVEINITIALIZE_HPP
 #include "Sapphire/tensor/Shape.hpp"
+#include "cstdint"
 #include "cstdlib"
 
 namespace Sapphire::Compute::Dense::Naive
 {
+//! Fills the data with values drawn from the normal distribution
+//! Values are generated by Philox from (seed, offset) and transformed by
+//! Box-Muller, so they do not depend on the number of threads
+//! \param offset : first Philox counter of the values
 void Normal(float* data, float mean, float sd, const Shape& shape,
-            size_t paddedCols, size_t batchSize);
+            size_t paddedCols, size_t batchSize, std::uint64_t seed,
+            std::uint64_t offset);
 
+//! Fills the data with values drawn from the uniform distribution in
+//! [min, max) generated by Philox from (seed, offset)
 void Uniform(float* data, float min, float max, const Shape& shape,
-             size_t paddedCols, size_t batchSize);
+             size_t paddedCols, size_t batchSize, std::uint64_t seed,
+             std::uint64_t offset);
 
 void Scalar(float* data, float value, const Shape& shape, size_t paddedCols,
             size_t batchSize);
@@ -0,0 +1,51 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_COMPUTE_NAIVEINT8_HPP
+#define Sapphire_COMPUTE_NAIVEINT8_HPP
+
+#include <cstdint>
+
+//! Kernels for int8 data quantized symmetrically with a scale per row
+//! Quantized values are in range of [-127, 127] so that products of two
+//! values can be accumulated in pairs without saturating 16 bits
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Quantizes each row of float data into int8 with its own scale
+//! \param output : int8 output buffer
+//! \param scales : scale of each row (output * scale restores the input)
+//! \param input : float input buffer
+//! \param rows : number of rows
+//! \param cols : number of columns
+//! \param paddedCols : stride between the rows of input and output
+void QuantizeRows(std::int8_t* output, float* scales, const float* input,
+                  unsigned int rows, unsigned int cols,
+                  unsigned int paddedCols);
+
+//! Restores float data from int8 data quantized with QuantizeRows
+void DequantizeRows(float* output, const std::int8_t* input,
+                    const float* scales, unsigned int rows, unsigned int cols,
+                    unsigned int paddedCols);
+
+//! Performs out = (A*B)*scaleA*scaleB + C with int32 accumulation
+//! Each row of A and each column of B are quantized with its own scale
+//! \param rows : number of rows of A and out
+//! \param out : float output with padded rows of N columns
+//! \param A : int8 matrix with padded rows of K columns
+//! \param scaleA : scale of each row of A
+//! \param transposedB : int8 matrix B stored as padded rows of K columns for
+//! each column of B
+//! \param scaleB : scale of each column of B
+//! \param C : float matrix to add to the output
+//! \param strideC : stride between the rows of C (0 for broadcast)
+void Int8Gemm(unsigned int rows, float* out, const std::int8_t* A,
+              const float* scaleA, const std::int8_t* transposedB,
+              const float* scaleB, const float* C, unsigned long strideC,
+              unsigned int N, unsigned int paddedN, unsigned int K,
+              unsigned int paddedK);
+}  // namespace Sapphire::Compute::Dense::Naive
+
+#endif
@@ -0,0 +1,34 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_COMPUTE_NAIVELOSS_HPP
+#define Sapphire_COMPUTE_NAIVELOSS_HPP
+
+#include <cstddef>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Computes loss[row] = log(sum(exp(x[row]))) - x[row][labels[row]] for each
+//! of rows rows with cols logits padded to paddedCols elements
+//! Log-sum-exp of each row is computed by a single pass which rescales the
+//! running sum whenever the running maximum grows
+//! \param logSumExp : log-sum-exp of each row for CrossEntropyBackward. Not
+//! written if nullptr
+void CrossEntropyForward(float* loss, float* logSumExp, const float* x,
+                         const std::size_t* labels, std::size_t rows,
+                         unsigned int cols, std::size_t paddedCols);
+
+//! Performs dx[row] += scale * (softmax(x[row]) - onehot(labels[row]))
+//! Softmax is recomputed from the log-sum-exp of CrossEntropyForward while
+//! dx is written, so neither the probabilities nor the one-hot labels are
+//! stored
+void CrossEntropyBackward(float* dx, const float* x, const float* logSumExp,
+                          const std::size_t* labels, float scale,
+                          std::size_t rows, unsigned int cols,
+                          std::size_t paddedCols);
+}  // namespace Sapphire::Compute::Dense::Naive
+
+#endif  // Sapphire_COMPUTE_NAIVELOSS_HPP
@@ -0,0 +1,66 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_COMPUTE_NAIVENORMALIZATION_HPP
+#define Sapphire_COMPUTE_NAIVENORMALIZATION_HPP
+
+#include <cstddef>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Shape of the layer normalization operand
+//! Each of Rows rows with Cols elements is normalized, and rows are padded to
+//! PaddedCols elements on the host
+struct LayerNormShape
+{
+    std::size_t Rows = 0;
+    unsigned int Cols = 0;
+    std::size_t PaddedCols = 0;
+};
+
+//! Shape of the batch normalization operand
+//! Element i of channel c in sample n is stored at
+//! n * BatchStride + c * ChannelStride + (i / Cols) * PaddedCols + i % Cols
+//! for i < Rows * Cols
+struct BatchNormShape
+{
+    unsigned int N = 0, C = 0;
+    unsigned int Rows = 1, Cols = 1;
+    std::size_t PaddedCols = 0, ChannelStride = 0, BatchStride = 0;
+};
+
+//! Performs y = (x - mean) / sqrt(var + epsilon) * gamma + beta over each row
+//! Statistics of each row are computed by a single Welford pass, and the
+//! row is normalized by a second pass while it is still in the cache
+//! \param mean, rstd : mean and 1 / sqrt(var + epsilon) of each row for
+//! LayerNormBackward. Not written if nullptr
+void LayerNormForward(float* y, float* mean, float* rstd, const float* x,
+                      const float* gamma, const float* beta,
+                      const LayerNormShape& shape, float epsilon);
+
+//! Performs dx += gradient of x, dGamma += gradient of gamma and
+//! dBeta += gradient of beta from dy in two passes over each row
+void LayerNormBackward(float* dx, float* dGamma, float* dBeta, const float* dy,
+                       const float* x, const float* gamma, const float* mean,
+                       const float* rstd, const LayerNormShape& shape);
+
+//! Computes mean and biased variance of each channel by a single Welford pass
+void BatchNormStatistics(float* mean, float* variance, const float* x,
+                         const BatchNormShape& shape);
+
+//! Performs y = (x - mean) * rstd * gamma + beta on each channel
+void BatchNormNormalize(float* y, const float* x, const float* mean,
+                        const float* rstd, const float* gamma,
+                        const float* beta, const BatchNormShape& shape);
+
+//! Performs dx += gradient of x, dGamma += gradient of gamma and
+//! dBeta += gradient of beta from dy in two passes over each channel
+void BatchNormBackward(float* dx, float* dGamma, float* dBeta, const float* dy,
+                       const float* x, const float* gamma, const float* mean,
+                       const float* rstd, const BatchNormShape& shape);
+}  // namespace Sapphire::Compute::Dense::Naive
+
+#endif  // Sapphire_COMPUTE_NAIVENORMALIZATION_HPP
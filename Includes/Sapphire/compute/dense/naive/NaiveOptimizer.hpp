@@ -0,0 +1,62 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_NAIVEOPTIMIZER_HPP
+#define Sapphire_NAIVEOPTIMIZER_HPP
+
+#include <cstddef>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Host buffers of a parameter updated by the fused optimizer kernels
+//! Every buffer has Size elements including the padding
+struct OptimizerParameter
+{
+    float* Data = nullptr;
+    float* Gradient = nullptr;
+    //! Velocity of momentum, or first moment of Adam
+    float* FirstState = nullptr;
+    //! Second moment of Adam
+    float* SecondState = nullptr;
+    std::size_t Size = 0;
+};
+
+//! Fused kernels below update every parameter in a single parallel loop
+//! Each element is read and written once, and gradient is zeroed in the same
+//! pass if zeroGradient is true
+
+//! Performs data -= learningRate * (gradient + weightDecay * data)
+void SgdUpdate(const OptimizerParameter* parameters, std::size_t count,
+               float learningRate, float weightDecay, bool zeroGradient);
+
+//! Performs velocity = momentum * velocity + gradient + weightDecay * data
+//! and data -= learningRate * velocity
+void MomentumUpdate(const OptimizerParameter* parameters, std::size_t count,
+                    float learningRate, float momentum, float weightDecay,
+                    bool zeroGradient);
+
+//! Performs Adam update with bias corrected moments
+//! \param weightDecay : If decoupled is false, weightDecay * data is added to
+//! the gradient (L2 regularization). Otherwise, data is decayed directly by
+//! learningRate * weightDecay (AdamW)
+//! \param step : number of updates including this one (starts from 1)
+void AdamUpdate(const OptimizerParameter* parameters, std::size_t count,
+                float learningRate, float beta1, float beta2, float epsilon,
+                float weightDecay, bool decoupled, unsigned long step,
+                bool zeroGradient);
+
+//! Returns sum of the squares of the gradients
+//! Only Gradient and Size of the parameters are used
+float GradientSquaredSum(const OptimizerParameter* parameters,
+                         std::size_t count);
+
+//! Performs gradient *= factor
+//! Only Gradient and Size of the parameters are used
+void ScaleGradient(const OptimizerParameter* parameters, std::size_t count,
+                   float factor);
+}  // namespace Sapphire::Compute::Dense::Naive
+
+#endif  // Sapphire_NAIVEOPTIMIZER_HPP
@@ -0,0 +1,61 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_COMPUTE_NAIVEPOOLING_HPP
+#define Sapphire_COMPUTE_NAIVEPOOLING_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Shape and parameters of the 2D pooling
+//! Input and output are laid out in NCHW order, and each row is padded on the
+//! host as TensorData does
+struct PoolShape
+{
+    //! Input (N, C, H, W)
+    unsigned int N = 0, C = 0, H = 0, W = 0;
+    //! Output (N, C, P, Q)
+    unsigned int P = 0, Q = 0;
+
+    unsigned int WindowRow = 1, WindowCol = 1;
+    unsigned int StrideRow = 1, StrideCol = 1;
+    unsigned int PaddingRow = 0, PaddingCol = 0;
+
+    //! Padded row sizes of input and output on the host
+    unsigned int PaddedW = 0, PaddedQ = 0;
+};
+
+//! Performs y = maxpool(x). Padded elements are ignored
+//! \param indices : position (r * WindowCol + s) of the maximum in each
+//! window laid out in (N, C, P, Q) without padding. Not written if nullptr
+void MaxPool2DForward(float* y, std::uint8_t* indices, const float* x,
+                      const PoolShape& shape);
+
+//! Performs dx += gradient of x from dy using the indices of MaxPool2DForward
+void MaxPool2DBackward(float* dx, const float* dy, const std::uint8_t* indices,
+                       const PoolShape& shape);
+
+//! Performs y = avgpool(x). Each window is averaged over the elements inside
+//! the input, so padded elements are not counted
+void AvgPool2DForward(float* y, const float* x, const PoolShape& shape);
+
+//! Performs dx += gradient of x from dy
+void AvgPool2DBackward(float* dx, const float* dy, const PoolShape& shape);
+
+//! Performs y = mean of each channel of x over H x W
+//! Window and output members of the shape are ignored
+//! \param paddedC : padded row size of y (N, C) on the host
+void GlobalAvgPoolForward(float* y, std::size_t paddedC, const float* x,
+                          const PoolShape& shape);
+
+//! Performs dx += gradient of x from dy
+void GlobalAvgPoolBackward(float* dx, const float* dy, std::size_t paddedC,
+                           const PoolShape& shape);
+}  // namespace Sapphire::Compute::Dense::Naive
+
+#endif  // Sapphire_COMPUTE_NAIVEPOOLING_HPP
@@ -0,0 +1,56 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_COMPUTE_NAIVERANDOM_HPP
+#define Sapphire_COMPUTE_NAIVERANDOM_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Number of elements whose random bits are generated together
+//! Chunks start at multiples of this size, so each chunk is generated
+//! independently regardless of how chunks are split between the threads
+constexpr std::size_t RandomChunkSize = 2048;
+
+//! Computes Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy
+//! as 1, 2, 3") of the counter with the key
+//! Output only depends on the counter and the key, so any part of the stream
+//! can be generated without generating the values before it
+std::array<std::uint32_t, 4> Philox4x32(
+    const std::array<std::uint32_t, 4>& counter,
+    const std::array<std::uint32_t, 2>& key);
+
+//! Writes 4 random words for each of numCounters counters starting from
+//! firstCounter to bits, using seed as the key
+//! Element i of a stream starting at counter offset takes word i % 4 of
+//! counter offset + i / 4
+void GenerateRandomBits(std::uint32_t* bits, std::uint64_t firstCounter,
+                        std::size_t numCounters, std::uint64_t seed);
+
+//! Converts random bits to a float in [0, 1)
+inline float ToUniform(std::uint32_t bits)
+{
+    return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+}
+
+//! Performs y = x * mask / (1 - rate) on rows rows with cols elements padded
+//! to paddedCols elements
+//! Each element of the mask is 0 with probability rate, and is generated
+//! from (seed, offset) so DropoutBackward regenerates the same mask
+void DropoutForward(float* y, const float* x, float rate, std::size_t rows,
+                    unsigned int cols, std::size_t paddedCols,
+                    std::uint64_t seed, std::uint64_t offset);
+
+//! Performs dx += dy * mask / (1 - rate) with the mask of DropoutForward
+void DropoutBackward(float* dx, const float* dy, float rate, std::size_t rows,
+                     unsigned int cols, std::size_t paddedCols,
+                     std::uint64_t seed, std::uint64_t offset);
+}  // namespace Sapphire::Compute::Dense::Naive
+
+#endif  // Sapphire_COMPUTE_NAIVERANDOM_HPP
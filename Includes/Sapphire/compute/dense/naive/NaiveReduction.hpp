@@ -0,0 +1,70 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_COMPUTE_NAIVEREDUCTION_HPP
+#define Sapphire_COMPUTE_NAIVEREDUCTION_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Operation reducing the values into one
+enum class ReduceOp
+{
+    Sum,
+    Mean,
+    Max,
+    Min,
+    //! Euclidean (L2) norm
+    Norm,
+    //! Index of the first maximum in row-major order of the reduced
+    //! dimensions, stored as float
+    ArgMax,
+};
+
+//! Dimension of ReducePlan
+struct ReduceDim
+{
+    std::size_t Size = 1;
+    std::size_t InputStride = 0;
+    //! Not used by the reduced dimensions
+    std::size_t OutputStride = 0;
+};
+
+//! Reduction of a strided input over a set of its dimensions
+//! Kept dimensions index the output, and the reduced dimensions are reduced
+//! into each output element. Both are ordered from the outermost to the
+//! innermost. Built by MakeReducePlan
+struct ReducePlan
+{
+    std::vector<ReduceDim> Kept;
+    std::vector<ReduceDim> Reduced;
+    std::size_t OutputSize = 1;
+    std::size_t ReduceSize = 1;
+};
+
+//! Builds the plan reducing the input of given dimensions and strides
+//! Dimensions of size 1 are removed, and adjacent dimensions laid out
+//! contiguously in both input and output are coalesced into one, so padded
+//! rows split the dimensions only where the padding is
+//! \param outputStrides : strides of the output for the kept dimensions
+//! \param isReduced : true for the dimensions to reduce
+ReducePlan MakeReducePlan(const std::vector<std::size_t>& dims,
+                          const std::vector<std::size_t>& inputStrides,
+                          const std::vector<std::size_t>& outputStrides,
+                          const std::vector<bool>& isReduced);
+
+//! Reduces the input into the output by the plan
+//! Contiguous reductions are vectorized, strided reductions are performed on
+//! blocks of contiguous outputs, and sums are added pairwise. Long reductions
+//! are split into fixed size chunks reduced in parallel and combined as a
+//! tree, so the result only depends on the plan
+void Reduce(float* output, const float* input, const ReducePlan& plan,
+            ReduceOp op);
+}  // namespace Sapphire::Compute::Dense::Naive
+
+#endif  // Sapphire_COMPUTE_NAIVEREDUCTION_HPP
@@ -0,0 +1,32 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_COMPUTE_NAIVETRANSPOSE_HPP
+#define Sapphire_COMPUTE_NAIVETRANSPOSE_HPP
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Transposes each (inputRows, inputCols) matrix of the input
+//! Matrices are split into blocks fitting in the cache, and each block is
+//! transposed in tiles held in vector registers (8x8 with AVX, 16x16 with
+//! AVX-512). Blocks of every matrix are distributed over the thread pool
+//! \param paddedInputRows : padded row size of the output
+//! \param paddedInputCols : padded row size of the input
+//! \param broadcast : transposes the first input matrix into every output
+//! matrix if true
+void Transpose(float* output, const float* input, unsigned int inputRows,
+               unsigned int paddedInputRows, unsigned int inputCols,
+               unsigned int paddedInputCols, unsigned int batchSize,
+               bool broadcast);
+
+//! Transposes each (size, size) matrix of data in place
+//! Pairs of tiles mirrored over the diagonal are swapped while transposed
+//! \param paddedSize : padded row size of data
+void TransposeInPlace(float* data, unsigned int size, unsigned int paddedSize,
+                      unsigned int batchSize);
+}  // namespace Sapphire::Compute::Dense::Naive
+
+#endif  // Sapphire_COMPUTE_NAIVETRANSPOSE_HPP
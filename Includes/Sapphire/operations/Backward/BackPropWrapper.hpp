@@ -9,6 +9,7 @@
 
 #include <Sapphire/compute/dense/cuda/Basic.cuh>
 #include <Sapphire/compute/dense/naive/NaiveBasic.hpp>
+#include <Sapphire/operations/Backward/SavedTensor.hpp>
 #include <Sapphire/tensor/TensorData.hpp>
 #include <functional>
 #include <list>
@@ -52,6 +53,13 @@ class BackPropWrapper
         return m_gradientOutputs;
     }
 
+    //! Returns key of the unit whose parameters are updated by this wrapper
+    //! \return : key of the unit. -1 if there is none
+    [[nodiscard]] int GetUnitKey() const
+    {
+        return m_unitKey;
+    }
+
     //! todo : Copy required save data inside BackPropWrapper
     //! todo : Backward will only do its job when all inputs are provided
     //! Invokes back propagation if ready
@@ -62,7 +70,8 @@ class BackPropWrapper
     //! Vector of tensorData that should give its output
     std::vector<TensorUtil::TensorData> m_gradientOutputs;
     std::vector<TensorUtil::TensorData> m_gradientInputs;
-    std::unordered_map<std::string, TensorUtil::TensorData> m_savedTensorMap;
+    //! TensorData saved from the forward operation by reference
+    std::unordered_map<std::string, SavedTensor> m_savedTensorMap;
 };
 }  // namespace Sapphire::BackProp
 
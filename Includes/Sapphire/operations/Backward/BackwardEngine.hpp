@@ -0,0 +1,105 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_BACKWARDENGINE_HPP
+#define Sapphire_BACKWARDENGINE_HPP
+
+#include <Sapphire/operations/Backward/BackPropWrapper.hpp>
+#include <Sapphire/tensor/TensorDescriptor.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Sapphire
+{
+class Model;
+}
+
+namespace Sapphire::BackProp
+{
+//! Executes back propagation of the graph recorded in the model
+//! Reverse graph reachable from the root is built once with the number of
+//! gradients each descriptor receives. Descriptor is scheduled on the thread
+//! pool as soon as all of its gradients are accumulated, so independent
+//! branches are computed in parallel. Graph is traversed without recursion
+class BackwardEngine
+{
+ public:
+    explicit BackwardEngine(
+        Model& model,
+        Util::ThreadPool& threadPool = Util::ThreadPool::Global());
+    ~BackwardEngine() = default;
+
+    BackwardEngine(const BackwardEngine& engine) = delete;
+    BackwardEngine& operator=(const BackwardEngine& engine) = delete;
+
+    //! Back propagates from the descriptor with given key
+    //! Gradient of the root must be written before calling this
+    //! Rethrows the first exception thrown by the wrappers
+    void Run(int rootKey);
+
+ private:
+    struct Node : Util::Task
+    {
+        BackwardEngine* Engine = nullptr;
+        TensorUtil::TensorDescriptor* Descriptor = nullptr;
+        //! nullptr if descriptor is a leaf
+        BackPropWrapper* Wrapper = nullptr;
+        //! Nodes receiving gradient from this node
+        std::vector<std::size_t> Children;
+        //! Indices of the locks for the buffers written by this node, sorted
+        std::vector<std::size_t> Locks;
+        //! Number of gradients not received yet
+        std::atomic<std::uint32_t> Pending = 0;
+    };
+
+    void m_build(int rootKey);
+
+    static void m_runNode(Util::Task* task);
+
+    //! Lock of the buffers written by the nodes. Node failing to acquire the
+    //! lock is parked on it, and submitted again when the holder releases it
+    struct Lock
+    {
+        std::mutex Mtx;
+        bool IsHeld = false;
+        std::vector<Node*> Waiters;
+    };
+
+    //! Consumes history of the descriptor and invokes the wrapper
+    //! \return : false if any lock of the node is held by other node, in
+    //! which case nothing is done and the node is parked on that lock
+    bool m_backProp(Node& node);
+
+    //! Acquires the lock, or parks the node on it if it is held
+    bool m_tryLock(std::size_t lockIdx, Node& node);
+
+    //! Releases the lock and submits the nodes parked on it
+    void m_unlock(std::size_t lockIdx);
+
+    //! Notifies the children and counts the node as finished
+    void m_finish(Node& node);
+
+    Model& m_model;
+    Util::ThreadPool& m_threadPool;
+    //! deque keeps the nodes in place while new nodes are added
+    std::deque<Node> m_nodes;
+    //! Writes to the same buffer are serialized. Gradients are accumulated to
+    //! the buffers shared by views, and parameter gradients of shared units are
+    //! accumulated by multiple nodes
+    std::unique_ptr<Lock[]> m_locks;
+    std::atomic<std::uint32_t> m_remaining = 0;
+    std::atomic<bool> m_failed = false;
+    std::mutex m_exceptionMtx;
+    std::exception_ptr m_exception;
+};
+}  // namespace Sapphire::BackProp
+
+#endif  // Sapphire_BACKWARDENGINE_HPP
@@ -0,0 +1,50 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_CHECKPOINTBACKWARD_HPP
+#define Sapphire_CHECKPOINTBACKWARD_HPP
+
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/operations/Backward/BackPropWrapper.hpp>
+#include <Sapphire/tensor/Tensor.hpp>
+#include <functional>
+#include <vector>
+
+namespace Sapphire::BackProp
+{
+//! Back propagates through the checkpointed segment by recomputing it
+//! Segment is replayed from its saved input with gradient enabled, and the
+//! recomputed graph is back propagated by a nested BackwardEngine. Every
+//! descriptor created by the replay is released afterwards
+class CheckpointBackProp : public BackPropWrapper
+{
+ public:
+    using Function = std::function<Tensor(const Tensor&)>;
+
+    //! \param function : forward operations of the segment
+    //! \param inputKey : key of the input descriptor of the segment
+    //! \param x : forward data of the input
+    //! \param dx : backward data of the input
+    //! \param dy : backward data of the output
+    //! \param isTraining : training mode of the forward pass
+    //! \param randomStreams : random streams reserved by the forward pass
+    CheckpointBackProp(
+        Function function, int inputKey, const TensorUtil::TensorData& x,
+        TensorUtil::TensorData dx, TensorUtil::TensorData dy, bool isTraining,
+        std::vector<Compute::Initialize::RandomStream> randomStreams);
+
+    bool InvokeBackProp(const TensorUtil::TensorData& input) override;
+
+ private:
+    Function m_function;
+    int m_inputKey;
+    Shape m_inputShape;
+    bool m_isTraining;
+    std::vector<Compute::Initialize::RandomStream> m_randomStreams;
+};
+}  // namespace Sapphire::BackProp
+
+#endif  // Sapphire_CHECKPOINTBACKWARD_HPP
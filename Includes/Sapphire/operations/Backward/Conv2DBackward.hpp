@@ -0,0 +1,34 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_CONV2DBACKWARD_HPP
+#define Sapphire_CONV2DBACKWARD_HPP
+
+#include <Sapphire/operations/Backward/BackPropWrapper.hpp>
+#include <utility>
+
+namespace Sapphire::BackProp
+{
+class Conv2DBackProp : public BackPropWrapper
+{
+ public:
+    explicit Conv2DBackProp(const TensorUtil::TensorData& x,
+                            TensorUtil::TensorData dx,
+                            TensorUtil::TensorData dy, int unitKey,
+                            std::pair<int, int> stride,
+                            std::pair<int, int> dilation,
+                            std::pair<int, int> padding);
+
+    bool InvokeBackProp(const TensorUtil::TensorData& input) override;
+
+ private:
+    std::pair<int, int> m_stride;
+    std::pair<int, int> m_dilation;
+    std::pair<int, int> m_padding;
+};
+}  // namespace Sapphire::BackProp
+
+#endif  // Sapphire_CONV2DBACKWARD_HPP
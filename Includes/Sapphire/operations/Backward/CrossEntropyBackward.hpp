@@ -0,0 +1,35 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_CROSSENTROPYBACKWARD_HPP
+#define Sapphire_CROSSENTROPYBACKWARD_HPP
+
+#include <Sapphire/operations/Backward/BackPropWrapper.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace Sapphire::BackProp
+{
+//! Keeps x with the labels and the log-sum-exp of each row computed by the
+//! forward operation, so softmax is evaluated once while dx is written
+class CrossEntropyBackProp : public BackPropWrapper
+{
+ public:
+    explicit CrossEntropyBackProp(const TensorUtil::TensorData& x,
+                                  TensorUtil::TensorData dx,
+                                  TensorUtil::TensorData dy,
+                                  std::vector<std::size_t> labels,
+                                  std::vector<float> logSumExp);
+
+    bool InvokeBackProp(const TensorUtil::TensorData& input) override;
+
+ private:
+    std::vector<std::size_t> m_labels;
+    std::vector<float> m_logSumExp;
+};
+}  // namespace Sapphire::BackProp
+
+#endif  // Sapphire_CROSSENTROPYBACKWARD_HPP
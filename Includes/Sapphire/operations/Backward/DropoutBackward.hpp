@@ -0,0 +1,32 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_DROPOUTBACKWARD_HPP
+#define Sapphire_DROPOUTBACKWARD_HPP
+
+#include <Sapphire/operations/Backward/BackPropWrapper.hpp>
+#include <cstdint>
+
+namespace Sapphire::BackProp
+{
+//! Keeps the seed and offset of the forward operation instead of the mask
+class DropoutBackProp : public BackPropWrapper
+{
+ public:
+    explicit DropoutBackProp(TensorUtil::TensorData dx,
+                             TensorUtil::TensorData dy, float rate,
+                             std::uint64_t seed, std::uint64_t offset);
+
+    bool InvokeBackProp(const TensorUtil::TensorData& input) override;
+
+ private:
+    float m_rate;
+    std::uint64_t m_seed;
+    std::uint64_t m_offset;
+};
+}  // namespace Sapphire::BackProp
+
+#endif  // Sapphire_DROPOUTBACKWARD_HPP
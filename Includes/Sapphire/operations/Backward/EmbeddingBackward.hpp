@@ -0,0 +1,31 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_EMBEDDINGBACKWARD_HPP
+#define Sapphire_EMBEDDINGBACKWARD_HPP
+
+#include <Sapphire/operations/Backward/BackPropWrapper.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace Sapphire::BackProp
+{
+//! Accumulates dy into the row gradient of the table using the indices of
+//! the forward operation
+class EmbeddingBackProp : public BackPropWrapper
+{
+ public:
+    explicit EmbeddingBackProp(TensorUtil::TensorData dy, int unitKey,
+                               std::vector<std::size_t> indices);
+
+    bool InvokeBackProp(const TensorUtil::TensorData& input) override;
+
+ private:
+    std::vector<std::size_t> m_indices;
+};
+}  // namespace Sapphire::BackProp
+
+#endif  // Sapphire_EMBEDDINGBACKWARD_HPP
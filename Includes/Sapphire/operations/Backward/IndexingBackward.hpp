@@ -0,0 +1,64 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_BACKPROP_INDEXINGBACKWARD_DECL_HPP
+#define Sapphire_BACKPROP_INDEXINGBACKWARD_DECL_HPP
+
+#include <Sapphire/operations/Backward/BackPropWrapper.hpp>
+
+namespace Sapphire::BackProp
+{
+//! Back propagation of reshape, squeeze, unSqueeze, expand and flatten
+//! If dx and dy are sharing the buffer, gradient of dy is already written to
+//! dx and this wrapper only keeps the connection of the graph
+class ReshapeBackProp : public BackPropWrapper
+{
+ public:
+    explicit ReshapeBackProp(TensorUtil::TensorData dx,
+                             TensorUtil::TensorData dy, bool isView);
+
+    bool InvokeBackProp(const TensorUtil::TensorData& input) override;
+
+ private:
+    bool m_isView;
+};
+
+//! Back propagation of each chunk created by chunk
+//! If dx and dy are sharing the buffer, gradient of dy is already written to
+//! dx and this wrapper only keeps the connection of the graph
+class ChunkBackProp : public BackPropWrapper
+{
+ public:
+    explicit ChunkBackProp(TensorUtil::TensorData dx,
+                           TensorUtil::TensorData dy, int dim,
+                           unsigned int start, bool isView);
+
+    bool InvokeBackProp(const TensorUtil::TensorData& input) override;
+
+ private:
+    int m_dim;
+    unsigned int m_start;
+    bool m_isView;
+};
+
+//! Back propagation of permute and transpose
+//! dy is read through the strided view with inverse permutation and
+//! accumulated to dx
+class PermuteBackProp : public BackPropWrapper
+{
+ public:
+    explicit PermuteBackProp(TensorUtil::TensorData dx,
+                             TensorUtil::TensorData dy,
+                             std::vector<unsigned int> dims);
+
+    bool InvokeBackProp(const TensorUtil::TensorData& input) override;
+
+ private:
+    std::vector<unsigned int> m_inverseDims;
+};
+}  // namespace Sapphire::BackProp
+
+#endif
@@ -23,13 +23,13 @@ class LinearBackProp : public BackPropWrapper
     bool InvokeBackProp(const TensorUtil::TensorData& input) override;
 
  private:
-    void m_backProp(const TensorUtil::TensorData& weight);
+    void m_backProp(TensorUtil::TensorData& weight);
 
-    void m_updateWeight(TensorUtil::TensorData& weight);
+    //! Accumulates gradient of the weight
+    void m_weightGradient(TensorUtil::TensorData& weightGradient);
 
-    void m_updateBias(TensorUtil::TensorData& bias);
-
-    unsigned int m_batchSize;
+    //! Accumulates gradient of the bias
+    void m_biasGradient(TensorUtil::TensorData& biasGradient);
 };
 
 }  // namespace Sapphire::BackProp
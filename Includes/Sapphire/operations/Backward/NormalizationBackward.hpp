@@ -0,0 +1,51 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_NORMALIZATIONBACKWARD_HPP
+#define Sapphire_NORMALIZATIONBACKWARD_HPP
+
+#include <Sapphire/operations/Backward/BackPropWrapper.hpp>
+#include <vector>
+
+namespace Sapphire::BackProp
+{
+//! Keeps x with the statistics of each row computed by the forward operation
+class LayerNormBackProp : public BackPropWrapper
+{
+ public:
+    explicit LayerNormBackProp(const TensorUtil::TensorData& x,
+                               TensorUtil::TensorData dx,
+                               TensorUtil::TensorData dy, int unitKey,
+                               std::vector<float> mean,
+                               std::vector<float> rstd);
+
+    bool InvokeBackProp(const TensorUtil::TensorData& input) override;
+
+ private:
+    std::vector<float> m_mean;
+    std::vector<float> m_rstd;
+};
+
+//! Keeps x with the statistics of each channel computed by the forward
+//! operation
+class BatchNormBackProp : public BackPropWrapper
+{
+ public:
+    explicit BatchNormBackProp(const TensorUtil::TensorData& x,
+                               TensorUtil::TensorData dx,
+                               TensorUtil::TensorData dy, int unitKey,
+                               std::vector<float> mean,
+                               std::vector<float> rstd);
+
+    bool InvokeBackProp(const TensorUtil::TensorData& input) override;
+
+ private:
+    std::vector<float> m_mean;
+    std::vector<float> m_rstd;
+};
+}  // namespace Sapphire::BackProp
+
+#endif  // Sapphire_NORMALIZATIONBACKWARD_HPP
@@ -0,0 +1,65 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_POOLINGBACKWARD_HPP
+#define Sapphire_POOLINGBACKWARD_HPP
+
+#include <Sapphire/operations/Backward/BackPropWrapper.hpp>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Sapphire::BackProp
+{
+//! Routes dy to the maximum of each window using the indices of the forward
+//! operation, so neither x nor a mask of its size is kept
+class MaxPool2DBackProp : public BackPropWrapper
+{
+ public:
+    explicit MaxPool2DBackProp(TensorUtil::TensorData dx,
+                               TensorUtil::TensorData dy,
+                               std::vector<std::uint8_t> indices,
+                               std::pair<int, int> windowSize,
+                               std::pair<int, int> stride,
+                               std::pair<int, int> padding);
+
+    bool InvokeBackProp(const TensorUtil::TensorData& input) override;
+
+ private:
+    std::vector<std::uint8_t> m_indices;
+    std::pair<int, int> m_windowSize;
+    std::pair<int, int> m_stride;
+    std::pair<int, int> m_padding;
+};
+
+class AvgPool2DBackProp : public BackPropWrapper
+{
+ public:
+    explicit AvgPool2DBackProp(TensorUtil::TensorData dx,
+                               TensorUtil::TensorData dy,
+                               std::pair<int, int> windowSize,
+                               std::pair<int, int> stride,
+                               std::pair<int, int> padding);
+
+    bool InvokeBackProp(const TensorUtil::TensorData& input) override;
+
+ private:
+    std::pair<int, int> m_windowSize;
+    std::pair<int, int> m_stride;
+    std::pair<int, int> m_padding;
+};
+
+class GlobalAvgPoolBackProp : public BackPropWrapper
+{
+ public:
+    explicit GlobalAvgPoolBackProp(TensorUtil::TensorData dx,
+                                   TensorUtil::TensorData dy);
+
+    bool InvokeBackProp(const TensorUtil::TensorData& input) override;
+};
+}  // namespace Sapphire::BackProp
+
+#endif  // Sapphire_POOLINGBACKWARD_HPP
@@ -0,0 +1,51 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_SAVEDTENSOR_HPP
+#define Sapphire_SAVEDTENSOR_HPP
+
+#include <Sapphire/tensor/TensorData.hpp>
+#include <cstdint>
+#include <string>
+
+namespace Sapphire::BackProp
+{
+//! TensorData saved by the operation for its back propagation
+//! Holds reference to the forward buffer instead of copying it, and remembers
+//! version of the buffer at the time it was saved. Since the buffer is not
+//! copied, back propagation cannot be performed correctly if it is written in
+//! place before back propagation. Such modification is detected by comparing
+//! the versions
+class SavedTensor
+{
+ public:
+    SavedTensor() = default;
+
+    //! Saves reference to given tensorData
+    //! \param tensorData : tensorData to save. Shape of the saved tensorData
+    //! can be different from the original as long as it shares the buffer
+    //! \param name : name of the tensorData used in the error message
+    explicit SavedTensor(TensorUtil::TensorData tensorData,
+                         std::string name = "");
+
+    //! Returns the saved tensorData
+    //! Throws runtime_error if the buffer has been modified after it was saved
+    [[nodiscard]] TensorUtil::TensorData Get() const;
+
+    //! Returns true if the buffer has been modified after it was saved
+    [[nodiscard]] bool IsModified() const
+    {
+        return m_tensorData.GetVersion() != m_version;
+    }
+
+ private:
+    TensorUtil::TensorData m_tensorData;
+    std::uint64_t m_version = 0;
+    std::string m_name;
+};
+}  // namespace Sapphire::BackProp
+
+#endif  // Sapphire_SAVEDTENSOR_HPP
@@ -0,0 +1,62 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_CHECKPOINT_HPP
+#define Sapphire_CHECKPOINT_HPP
+
+#include <Sapphire/tensor/Tensor.hpp>
+#include <cstddef>
+#include <functional>
+
+namespace Sapphire::NN
+{
+//! Segment of forward operations checkpointed for back propagation
+//! Segment is computed without gradient, and its intermediate outputs are
+//! released as soon as the output is computed. Only the input and the output
+//! are kept, and the segment is computed again during back propagation to
+//! regenerate the intermediate outputs. This trades one more forward pass of
+//! the segment for the memory of its intermediate outputs
+//! Units used by the segment must be created outside of the function, and
+//! must not be used outside of the segment in the same back propagation
+class Checkpoint
+{
+ public:
+    using Function = std::function<Tensor(const Tensor&)>;
+
+    //! \param function : forward operations of the segment
+    //! \param recompute : If false, segment is computed as usual and keeps
+    //! every intermediate output
+    explicit Checkpoint(Function function, bool recompute = true);
+
+    Tensor operator()(const Tensor& input);
+
+    //! Chooses between recomputing (true) and keeping (false) the
+    //! intermediate outputs. Applied from the next call
+    void SetRecompute(bool recompute)
+    {
+        m_recompute = recompute;
+    }
+
+    [[nodiscard]] bool IsRecompute() const
+    {
+        return m_recompute;
+    }
+
+    //! Returns host bytes of the intermediate outputs released by the last
+    //! call. 0 if the segment was not checkpointed
+    [[nodiscard]] std::size_t SavedBytes() const
+    {
+        return m_savedBytes;
+    }
+
+ private:
+    Function m_function;
+    bool m_recompute;
+    std::size_t m_savedBytes = 0;
+};
+}  // namespace Sapphire::NN
+
+#endif  // Sapphire_CHECKPOINT_HPP
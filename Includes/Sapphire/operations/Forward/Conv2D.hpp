@@ -0,0 +1,54 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_CONV2D_HPP
+#define Sapphire_CONV2D_HPP
+
+#include <Sapphire/tensor/Tensor.hpp>
+#include <utility>
+
+namespace Sapphire
+{
+class UnitDataWrapper;
+}
+
+namespace Sapphire::NN
+{
+//! 2D convolution (cross-correlation) without bias
+//! Input has shape (C, H, W) and output has shape (K, P, Q)
+//! Pairs of parameters are given in (row, column) order
+//! Host 3x3 convolutions with unit stride and dilation use the Winograd
+//! convolution with the transformed filter cached in the unit
+class Conv2D
+{
+ public:
+    Conv2D(unsigned int inputChannels, unsigned int outputChannels,
+           std::pair<unsigned int, unsigned int> filterSize,
+           const Device& device, std::pair<int, int> stride = { 1, 1 },
+           std::pair<int, int> dilation = { 1, 1 },
+           std::pair<int, int> padding = { 0, 0 });
+
+    Tensor operator()(const Tensor& tensor) const;
+
+ private:
+    int m_unitKey = -1;
+    unsigned int m_outputChannels;
+    std::pair<unsigned int, unsigned int> m_filterSize;
+    std::pair<int, int> m_stride;
+    std::pair<int, int> m_dilation;
+    std::pair<int, int> m_padding;
+};
+
+//! Stores "weight" of the convolution unitDataWrapper transformed for
+//! Compute::Conv2DForwardWinograd with tileSize as "winogradWeight"
+//! Cached "winogradWeight" is kept if the tile size is the same and the
+//! weight has not been updated since
+//! \return : true if "winogradWeight" has been transformed again
+bool UpdateWinogradWeight(UnitDataWrapper& unitDataWrapper,
+                          unsigned int tileSize);
+}  // namespace Sapphire::NN
+
+#endif  // Sapphire_CONV2D_HPP
@@ -0,0 +1,36 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_DROPOUT_HPP
+#define Sapphire_DROPOUT_HPP
+
+#include <Sapphire/tensor/Tensor.hpp>
+
+namespace Sapphire::NN
+{
+//! Zeros each element of the input with probability rate and scales the
+//! others by 1 / (1 - rate) while TrainingMode is enabled, and passes the
+//! input through otherwise
+//! Mask is not stored. Backward regenerates it from the Philox seed and
+//! offset reserved by the forward operation
+class Dropout
+{
+ public:
+    explicit Dropout(float rate);
+
+    Tensor operator()(const Tensor& tensor) const;
+
+    [[nodiscard]] float GetRate() const
+    {
+        return m_rate;
+    }
+
+ private:
+    float m_rate;
+};
+}  // namespace Sapphire::NN
+
+#endif  // Sapphire_DROPOUT_HPP
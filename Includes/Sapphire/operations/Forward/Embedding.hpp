@@ -0,0 +1,39 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_EMBEDDING_HPP
+#define Sapphire_EMBEDDING_HPP
+
+#include <Sapphire/tensor/Tensor.hpp>
+
+namespace Sapphire::NN
+{
+//! Looks up rows of the "weight" table of shape (numEmbeddings, embeddingSize)
+//! Input holds indices of the rows stored as float, so indices must be
+//! smaller than 2^24. Output has the shape of the input followed by
+//! embeddingSize
+//! Gradient of the table is accumulated only on the gathered rows in
+//! RowGradientMap, and the optimizer updates only those rows
+class Embedding
+{
+ public:
+    Embedding(unsigned int numEmbeddings, unsigned int embeddingSize,
+              const Device& device);
+
+    Tensor operator()(const Tensor& tensor) const;
+
+    [[nodiscard]] int GetUnitKey() const
+    {
+        return m_unitKey;
+    }
+
+ private:
+    int m_unitKey = -1;
+    unsigned int m_embeddingSize;
+};
+}  // namespace Sapphire::NN
+
+#endif  // Sapphire_EMBEDDING_HPP
@@ -10,6 +10,11 @@
 #include <Sapphire/tensor/Tensor.hpp>
 #include <ostream>
 
+namespace Sapphire
+{
+class UnitDataWrapper;
+}
+
 namespace Sapphire::NN
 {
 class Linear
@@ -20,12 +25,27 @@ class Linear
 
     Tensor operator()(const Tensor& tensor) const;
 
+    //! Quantizes weight of this unit into int8 for inference
+    //! Quantized unit does not support back propagation, so it must be called
+    //! under NoGradGuard
+    void Quantize() const;
+
+    [[nodiscard]] int GetUnitKey() const
+    {
+        return m_unitKey;
+    }
+
  private:
     int m_unitKey = -1;
     unsigned int m_outputs;
     Type m_type = Type::Dense;
     bool m_bias;
 };
+
+//! Quantizes "weight" of the linear unitDataWrapper into int8 with a scale for
+//! each output channel. Weight is stored channel-major and kept as its
+//! transposed view. "bias" is kept in float and added in the gemm epilogue
+void QuantizeLinear(UnitDataWrapper& unitDataWrapper);
 }  // namespace Sapphire::NN
 
 #endif  // Sapphire_LINEAR_HPP
@@ -0,0 +1,67 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_NORMALIZATION_HPP
+#define Sapphire_NORMALIZATION_HPP
+
+#include <Sapphire/operations/Forward/Linear.hpp>
+#include <Sapphire/tensor/Tensor.hpp>
+
+namespace Sapphire::NN
+{
+//! Normalizes the last dimension of the input, then scales it by "gamma" and
+//! shifts it by "beta" of shape (normalizedSize)
+class LayerNorm
+{
+ public:
+    LayerNorm(unsigned int normalizedSize, const Device& device,
+              float epsilon = 1e-5f);
+
+    Tensor operator()(const Tensor& tensor) const;
+
+ private:
+    int m_unitKey = -1;
+    float m_epsilon;
+};
+
+//! Normalizes each channel over the batch, then scales it by "gamma" and
+//! shifts it by "beta" of shape (channels)
+//! Input has shape (channels) or (channels, ...)
+//! Statistics of the batch are used and "runningMean" and "runningVar" are
+//! updated while TrainingMode is enabled. Running statistics are used
+//! otherwise, which must be under NoGradGuard
+class BatchNorm
+{
+ public:
+    BatchNorm(unsigned int channels, const Device& device,
+              float momentum = 0.1f, float epsilon = 1e-5f);
+
+    Tensor operator()(const Tensor& tensor) const;
+
+    [[nodiscard]] int GetUnitKey() const
+    {
+        return m_unitKey;
+    }
+
+    [[nodiscard]] float GetEpsilon() const
+    {
+        return m_epsilon;
+    }
+
+ private:
+    int m_unitKey = -1;
+    float m_momentum;
+    float m_epsilon;
+};
+
+//! Folds the running statistics and parameters of batchNorm into the weight
+//! and bias of the preceding linear for inference
+//! batchNorm passes its input through after folding, so neither of them
+//! should be trained afterwards
+void FoldBatchNorm(const Linear& linear, const BatchNorm& batchNorm);
+}  // namespace Sapphire::NN
+
+#endif  // Sapphire_NORMALIZATION_HPP
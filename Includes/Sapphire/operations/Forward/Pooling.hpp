@@ -0,0 +1,57 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_POOLING_HPP
+#define Sapphire_POOLING_HPP
+
+#include <Sapphire/tensor/Tensor.hpp>
+#include <utility>
+
+namespace Sapphire::NN
+{
+//! 2D max pooling of (C, H, W) inputs
+//! Pairs of parameters are given in (row, column) order
+//! Back propagation keeps the position of the maximum in each window as a
+//! byte instead of the input, so the window can have at most 256 elements
+class MaxPool2D
+{
+ public:
+    MaxPool2D(std::pair<int, int> windowSize, std::pair<int, int> stride,
+              std::pair<int, int> padding = { 0, 0 });
+
+    Tensor operator()(const Tensor& tensor) const;
+
+ private:
+    std::pair<int, int> m_windowSize;
+    std::pair<int, int> m_stride;
+    std::pair<int, int> m_padding;
+};
+
+//! 2D average pooling of (C, H, W) inputs
+//! Windows are averaged over the elements inside the input
+class AvgPool2D
+{
+ public:
+    AvgPool2D(std::pair<int, int> windowSize, std::pair<int, int> stride,
+              std::pair<int, int> padding = { 0, 0 });
+
+    Tensor operator()(const Tensor& tensor) const;
+
+ private:
+    std::pair<int, int> m_windowSize;
+    std::pair<int, int> m_stride;
+    std::pair<int, int> m_padding;
+};
+
+//! Averages each channel of (C, H, W) inputs into (C) outputs
+class GlobalAvgPool
+{
+ public:
+    Tensor operator()(const Tensor& tensor) const;
+};
+}  // namespace Sapphire::NN
+
+#endif  // Sapphire_POOLING_HPP
@@ -0,0 +1,24 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_CROSSENTROPY_HPP
+#define Sapphire_CROSSENTROPY_HPP
+
+#include <Sapphire/tensor/Tensor.hpp>
+
+namespace Sapphire::NN::Loss
+{
+//! Returns mean of the negative log-likelihood of log-softmax over the last
+//! dimension of x, which holds the logits of each class
+//! Label holds the class index of each row of x stored as float, so it has
+//! one element for each row (e.g. shape of x without the last dimension)
+//! Label receives no gradient, and the gradient of x is
+//! (softmax(x) - onehot(label)) / rows
+//! Only host tensors are supported
+Tensor CrossEntropy(const Tensor& x, const Tensor& label);
+}  // namespace Sapphire::NN::Loss
+
+#endif  // Sapphire_CROSSENTROPY_HPP
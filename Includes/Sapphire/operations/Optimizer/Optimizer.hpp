@@ -0,0 +1,174 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef Sapphire_OPTIMIZER_HPP
+#define Sapphire_OPTIMIZER_HPP
+
+#include <Sapphire/compute/dense/naive/NaiveOptimizer.hpp>
+#include <Sapphire/operations/Unit.hpp>
+#include <Sapphire/tensor/TensorData.hpp>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Sapphire::NN
+{
+//! Base of the optimizers updating the parameters of the current model with
+//! their gradients
+//! Every parameter is updated by one fused kernel, which reads and writes each
+//! element once. State of each parameter (e.g. momentum) is kept in pooled
+//! buffers allocated on the first step, and is identified by the unit key and
+//! the name of the parameter, so it survives Model::FlattenParameters
+//! Tables with row gradients (e.g. NN::Embedding) are updated only on the
+//! gathered rows by the same kernel
+class Optimizer
+{
+ public:
+    explicit Optimizer(float learningRate);
+    virtual ~Optimizer() = default;
+
+    Optimizer(const Optimizer& optimizer) = delete;
+    Optimizer(Optimizer&& optimizer) noexcept = delete;
+    Optimizer& operator=(const Optimizer& optimizer) = delete;
+    Optimizer& operator=(Optimizer&& optimizer) noexcept = delete;
+
+    //! Updates every parameter of the current model with its gradient
+    //! Only parameters on the host are supported
+    //! \param zeroGrad : If true, gradients are zeroed in the same pass.
+    //! Otherwise gradients are kept, and accumulated by the next back
+    //! propagation
+    void Step(bool zeroGrad = true);
+
+    void SetLearningRate(float learningRate)
+    {
+        m_learningRate = learningRate;
+    }
+
+    [[nodiscard]] float GetLearningRate() const
+    {
+        return m_learningRate;
+    }
+
+    //! Returns number of steps performed
+    [[nodiscard]] unsigned long GetStepCount() const
+    {
+        return m_stepCount;
+    }
+
+ protected:
+    //! Returns number of state buffers for each parameter (at most 2)
+    [[nodiscard]] virtual unsigned int m_numStates() const = 0;
+
+    //! Invokes the fused kernel on the parameters
+    virtual void m_update(
+        const std::vector<Compute::Dense::Naive::OptimizerParameter>&
+            parameters,
+        bool zeroGrad) = 0;
+
+    float m_learningRate;
+    unsigned long m_stepCount = 0;
+
+ private:
+    //! Identifies the parameter by the key of its unit and its name
+    using ParameterKey = std::pair<int, std::string>;
+
+    //! Returns state buffers of the parameter. Buffers are allocated on the
+    //! first step, and again if the size of the parameter has changed
+    std::vector<TensorUtil::TensorData>& m_getStates(
+        const ParameterKey& key, const TensorUtil::TensorData& data);
+
+    //! Copies states of the parameters into the states of the flat buffer at
+    //! the offsets of their views
+    void m_packStates(const std::vector<Parameter>& parameters,
+                      const TensorUtil::TensorData& flatData,
+                      std::vector<TensorUtil::TensorData>& flatStates) const;
+
+    //! State buffers of each parameter. States of the parameters that are no
+    //! longer in the model (e.g. packed into the flat buffer) are removed on
+    //! each step
+    std::map<ParameterKey, std::vector<TensorUtil::TensorData>> m_states;
+};
+
+//! Stochastic gradient descent with optional weight decay
+class SGD : public Optimizer
+{
+ public:
+    explicit SGD(float learningRate, float weightDecay = 0.0f);
+
+ protected:
+    [[nodiscard]] unsigned int m_numStates() const override
+    {
+        return 0;
+    }
+
+    void m_update(const std::vector<Compute::Dense::Naive::OptimizerParameter>&
+                      parameters,
+                  bool zeroGrad) override;
+
+ private:
+    float m_weightDecay;
+};
+
+//! Stochastic gradient descent with momentum
+class Momentum : public Optimizer
+{
+ public:
+    Momentum(float learningRate, float momentum, float weightDecay = 0.0f);
+
+ protected:
+    [[nodiscard]] unsigned int m_numStates() const override
+    {
+        return 1;
+    }
+
+    void m_update(const std::vector<Compute::Dense::Naive::OptimizerParameter>&
+                      parameters,
+                  bool zeroGrad) override;
+
+ private:
+    float m_momentum;
+    float m_weightDecay;
+};
+
+//! Adam with weight decay added to the gradient (L2 regularization)
+class Adam : public Optimizer
+{
+ public:
+    explicit Adam(float learningRate, float beta1 = 0.9f, float beta2 = 0.999f,
+                  float epsilon = 1e-8f, float weightDecay = 0.0f);
+
+ protected:
+    [[nodiscard]] unsigned int m_numStates() const override
+    {
+        return 2;
+    }
+
+    void m_update(const std::vector<Compute::Dense::Naive::OptimizerParameter>&
+                      parameters,
+                  bool zeroGrad) override;
+
+    //! If true, weight decay is applied to the parameters directly
+    bool m_decoupled = false;
+
+ private:
+    float m_beta1;
+    float m_beta2;
+    float m_epsilon;
+    float m_weightDecay;
+};
+
+//! Adam with decoupled weight decay
+class AdamW : public Adam
+{
+ public:
+    explicit AdamW(float learningRate, float beta1 = 0.9f,
+                   float beta2 = 0.999f, float epsilon = 1e-8f,
+                   float weightDecay = 0.01f);
+};
+}  // namespace Sapphire::NN
+
+#endif  // Sapphire_OPTIMIZER_HPP
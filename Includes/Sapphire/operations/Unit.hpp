@@ -9,10 +9,49 @@
 
 #include <Sapphire/compute/dense/cuda/Convolution.cuh>
 #include <Sapphire/tensor/TensorData.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace Sapphire
 {
+//! Gradient of a table accumulated only on the rows it has been gathered by
+//! Size of the gradient depends on the number of distinct rows used since it
+//! was cleared instead of the size of the table
+struct RowGradient
+{
+    //! Returns position of the row with given index in Indices
+    //! Row is added with zero gradient if it is not found
+    std::size_t AddRow(std::size_t index)
+    {
+        const auto [it, inserted] = Positions.emplace(index, Indices.size());
+        if (inserted)
+        {
+            Indices.emplace_back(index);
+            Rows.resize(Rows.size() + RowSize, 0.0f);
+        }
+        return it->second;
+    }
+
+    void Clear()
+    {
+        Indices.clear();
+        Rows.clear();
+        Positions.clear();
+    }
+
+    //! Number of elements in each row
+    unsigned int RowSize = 0;
+    //! Indices of the rows in the order they were added
+    std::vector<std::size_t> Indices;
+    //! Gradients of the rows in Indices with RowSize elements each
+    std::vector<float> Rows;
+    //! Position of each index in Indices
+    std::unordered_map<std::size_t, std::size_t> Positions;
+};
+
 class UnitDataWrapper
 {
  public:
@@ -26,9 +65,20 @@ class UnitDataWrapper
         default;
 
     std::unordered_map<std::string, TensorUtil::TensorData> TensorDataMap;
+    //! Gradient of the trainable tensor in TensorDataMap with the same name
+    //! Accumulated by back propagation until it is zeroed
+    std::unordered_map<std::string, TensorUtil::TensorData> GradientDataMap;
+    //! Gradient of the table in TensorDataMap with the same name which is
+    //! only accessed by rows (e.g. embedding). Shared by the copies of the
+    //! wrapper
+    std::unordered_map<std::string, std::shared_ptr<RowGradient>>
+        RowGradientMap;
     std::unordered_map<std::string, std::string> StringLiterals;
     std::unordered_map<std::string, float> ScalarLiterals;
     std::unordered_map<std::string, int> IntegerLiterals;
+    //! Version of the tensor each cached tensor in TensorDataMap has been
+    //! computed from. Cached tensor is recomputed when the version changes
+    std::unordered_map<std::string, std::uint64_t> CachedVersions;
 
     Compute::Dense::Cuda::CudnnMetaData CudnnConvMetaData;
 
@@ -36,6 +86,26 @@ class UnitDataWrapper
     Device HostDevice;
     int Key = -1;
 };
+
+//! Trainable tensor of the unit with its gradient
+//! UnitKey and Name identify the parameter regardless of the buffer holding
+//! it. Flat buffer of the model (see Model::FlattenParameters) has UnitKey -1
+struct Parameter
+{
+    TensorUtil::TensorData Data;
+    TensorUtil::TensorData Gradient;
+    int UnitKey = -1;
+    std::string Name;
+};
+
+//! Table of the unit with the gradient of its rows
+struct RowParameter
+{
+    TensorUtil::TensorData Data;
+    std::shared_ptr<RowGradient> Gradient;
+    int UnitKey = -1;
+    std::string Name;
+};
 }  // namespace Sapphire
 
 #endif
@@ -7,6 +7,8 @@
 #ifndef Sapphire_UTIL_SHAPE_DECL_HPP
 #define Sapphire_UTIL_SHAPE_DECL_HPP
 
+#include <array>
+#include <initializer_list>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -19,52 +21,106 @@ enum class Type
     Dense,
 };
 
+//! Type of each element of the dense data
+//! Float16 and BFloat16 are stored in 16 bits on the host and are converted
+//! to float when they are computed
+//! Int8 is quantized with a scale for each row and is used for inference
+enum class DataType
+{
+    Float32,
+    Float16,
+    BFloat16,
+    Int8,
+};
+
+//! Shape of the tensor stored inline with fixed capacity
+//! Shape is trivially copyable, so copying and expanding it never allocates
 class Shape
 {
  public:
-    Shape() = default;
+    //! Maximum number of dimensions that shape can hold
+    static constexpr unsigned int MaxDim = 8;
+
+    constexpr Shape() = default;
     ~Shape() = default;
 
-    Shape(std::initializer_list<unsigned int> shape);
-    explicit Shape(std::vector<unsigned int> shape);
+    constexpr Shape(std::initializer_list<unsigned int> shape)
+    {
+        if (shape.size() > MaxDim)
+            throw std::invalid_argument(
+                "Shape - Dimension exceeds maximum dimension");
+        for (auto dim : shape)
+            m_dims[m_dim++] = dim;
+    }
 
-    Shape(const Shape& shape) = default;
-    Shape(Shape&& shape) noexcept;
+    explicit Shape(const std::vector<unsigned int>& shape);
 
-    Shape& operator=(const Shape& shape);
-    Shape& operator=(Shape&& shape) noexcept;
-    unsigned int& operator[](unsigned int index);
+    constexpr Shape(const Shape& shape) = default;
+    constexpr Shape(Shape&& shape) noexcept = default;
 
-    bool operator==(const Shape& shape) const;
-    bool operator!=(const Shape& shape) const;
+    constexpr Shape& operator=(const Shape& shape) = default;
+    constexpr Shape& operator=(Shape&& shape) noexcept = default;
+
+    constexpr unsigned int& operator[](unsigned int index)
+    {
+        if (index >= m_dim)
+            throw std::out_of_range("Shape - Index out of range");
+        return m_dims[index];
+    }
+
+    constexpr bool operator==(const Shape& shape) const
+    {
+        if (m_dim != shape.m_dim)
+            return false;
+        for (unsigned int i = 0; i < m_dim; ++i)
+            if (m_dims[i] != shape.m_dims[i])
+                return false;
+        return true;
+    }
+
+    constexpr bool operator!=(const Shape& shape) const
+    {
+        return !(*this == shape);
+    }
 
     [[nodiscard]] std::string ToString() const;
 
-    [[nodiscard]] unsigned int At(unsigned int index) const;
+    [[nodiscard]] constexpr unsigned int At(unsigned int index) const
+    {
+        if (index >= m_dim)
+            throw std::out_of_range("Shape - Index out of range");
+        return m_dims[index];
+    }
 
-    [[nodiscard]] unsigned int Dim() const;
+    [[nodiscard]] constexpr unsigned int Dim() const
+    {
+        return m_dim;
+    }
 
-    [[nodiscard]] unsigned int Size() const noexcept;
+    [[nodiscard]] constexpr unsigned int Size() const noexcept
+    {
+        unsigned int size = 1;
+        for (unsigned int i = 0; i < m_dim; ++i)
+            size *= m_dims[i];
+        return size;
+    }
 
     [[nodiscard]] std::vector<unsigned int> GetShapeVector() const
     {
-        return m_shapeVector;
+        return std::vector<unsigned int>(m_dims.begin(),
+                                         m_dims.begin() + m_dim);
     }
 
     void Set(unsigned int dim, unsigned int value);
 
-    [[nodiscard]] unsigned int Rows() const
+    [[nodiscard]] constexpr unsigned int Rows() const
     {
-        return m_shapeVector.size() > 1
-                   ? m_shapeVector.at(m_shapeVector.size() - 2)
-                   : 1;
+        return m_dim > 1 ? m_dims[m_dim - 2] : 1;
     }
 
-    [[nodiscard]] unsigned int Cols() const
+    [[nodiscard]] constexpr unsigned int Cols() const
     {
-        return !m_shapeVector.empty()
-                   ? m_shapeVector.at(m_shapeVector.size() - 1)
-                   : 0;
+        return m_dim > 0 ? m_dims[m_dim - 1] : 0;
     }
 
     //! Expands the shape to dim
@@ -77,7 +133,8 @@ class Shape
     [[nodiscard]] Shape GetTranspose() const;
 
  private:
-    std::vector<unsigned int> m_shapeVector;
+    std::array<unsigned int, MaxDim> m_dims{};
+    unsigned int m_dim = 0;
 };
 }  // namespace Sapphire
 
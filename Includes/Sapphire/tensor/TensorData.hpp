@@ -12,6 +12,11 @@
 #include <Sapphire/tensor/Shape.hpp>
 #include <Sapphire/util/Device.hpp>
 #include <Sapphire/util/SharedPtr.hpp>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace Sapphire::TensorUtil
 {
@@ -24,6 +29,11 @@ class TensorData
     TensorData(Shape shape, Type type, Device device, unsigned int batchSize,
                int parentDescKey);
 
+    //! Creates tensorData with elements stored in given data type
+    //! Float16 and BFloat16 are only available on the host
+    TensorData(Shape shape, Type type, Device device, unsigned int batchSize,
+               int parentDescKey, DataType dataType);
+
     TensorData(const TensorData& tensorData);
     TensorData(TensorData&& tensorData) noexcept;
     TensorData& operator=(const TensorData& tensorData);
@@ -77,6 +87,34 @@ class TensorData
         return TensorShape;
     }
 
+    //! Gets type of each element (Float32, Float16 or BFloat16)
+    [[nodiscard]] DataType GetDataType() const
+    {
+        return m_dataType;
+    }
+
+    //! Returns host data of 16 bit tensorData
+    //! Layout is same as DenseMatHost with elements stored in 16 bits
+    [[nodiscard]] std::uint16_t* HalfMatHost() const
+    {
+        return reinterpret_cast<std::uint16_t*>(DenseMatHost);
+    }
+
+    //! Returns host data of int8 tensorData
+    //! Layout is same as DenseMatHost with elements stored in 8 bits
+    [[nodiscard]] std::int8_t* Int8MatHost() const
+    {
+        return reinterpret_cast<std::int8_t*>(DenseMatHost);
+    }
+
+    //! Returns scale of each row of int8 tensorData on the host
+    //! Rows are counted in the layout of the buffer, so the scales of
+    //! transposed view belong to its columns. nullptr if not quantized
+    [[nodiscard]] float* ScaleHost() const
+    {
+        return m_scale ? m_scale->DenseMatHost : nullptr;
+    }
+
     //! Helper static functions
     //! These helper functions are used to control the tensorData from the
     //! operation units
@@ -93,6 +131,109 @@ class TensorData
     //! Creates and returns same copy as this tensorData
     [[nodiscard]] TensorData CreateCopy() const;
 
+    //! Creates copy of this tensorData with elements converted into given
+    //! data type. Only available on the host
+    //! Conversion to Int8 quantizes each row symmetrically with its own scale
+    [[nodiscard]] TensorData ConvertTo(DataType dataType) const;
+
+    //! Creates view of this tensorData with given shape
+    //! Returned tensorData shares the buffer of this tensorData through the
+    //! reference count of the memory pool without copying
+    //! Layout of the view must be compatible with this tensorData
+    //! (see IsViewCompatible)
+    //! \param shape : shape of the view
+    //! \param batchSize : batch size of the view
+    //! \param hostOffset : offset of the view on the host buffer
+    //! \param cudaOffset : offset of the view on the cuda buffer
+    //! \param parentDescKey : key of the descriptor that owns the view
+    //! \param copyOnWrite : If true, both this tensorData and the view are
+    //! detached into their own buffer before they are written while sharing
+    //! the buffer
+    [[nodiscard]] TensorData CreateView(Shape shape, unsigned int batchSize,
+                                        unsigned long hostOffset,
+                                        unsigned long cudaOffset,
+                                        int parentDescKey, bool copyOnWrite);
+
+    //! Checks if given shape can be viewed from this tensorData without
+    //! changing the physical layout of the padded host buffer
+    [[nodiscard]] bool IsViewCompatible(const Shape& shape) const;
+
+    //! Returns true if this tensorData shares the buffer with other view
+    [[nodiscard]] bool IsView() const
+    {
+        return m_hostOffset != 0 || m_cudaOffset != 0 || m_copyOnWrite;
+    }
+
+    //! Returns start of the buffer shared by this tensorData and its views
+    //! Used for finding out whether two tensorData write to the same buffer
+    [[nodiscard]] const void* GetBufferBase() const
+    {
+        return DenseMatHost ? static_cast<const void*>(m_hostBase())
+                            : static_cast<const void*>(m_cudaBase());
+    }
+
+    //! Must be called before the kernel writes to this tensorData
+    //! Detaches this tensorData into its own buffer if it is sharing the
+    //! buffer with other views (copy-on-write) or if it is not contiguous
+    //! Copies of this tensorData (e.g. saved tensors) are not other views, so
+    //! the buffer is written in place once the other views are gone
+    void CopyOnWrite();
+
+    //! Returns version of the buffer this tensorData belongs to
+    //! Version is shared between the views of the same buffer and increases
+    //! whenever the buffer is written by the kernel. Used for detecting
+    //! in-place modification of the tensorData saved for back propagation
+    [[nodiscard]] std::uint64_t GetVersion() const;
+
+    //! Increases the version of the buffer
+    //! Called by CopyOnWrite and by functions writing to the buffer directly
+    void BumpVersion() const;
+
+    //! Creates view of this tensorData with dimensions permuted
+    //! Only the strides are permuted and no data is moved
+    //! \param dims : new order of the dimensions (batch dimension excluded)
+    //! \param parentDescKey : key of the descriptor that owns the view
+    //! \param copyOnWrite : If true, this tensorData is copied on write while
+    //! sharing the buffer with the view
+    [[nodiscard]] TensorData CreatePermuteView(
+        const std::vector<unsigned int>& dims, int parentDescKey,
+        bool copyOnWrite);
+
+    //! Creates view of this tensorData with last two dimensions swapped
+    [[nodiscard]] TensorData CreateTransposeView(int parentDescKey,
+                                                 bool copyOnWrite);
+
+    //! Returns true if host data is laid out in padded row-major order
+    [[nodiscard]] bool IsContiguous() const
+    {
+        return m_strides.empty();
+    }
+
+    //! Returns true if every dimension except the last two is laid out in
+    //! row-major order. Last two dimensions can have arbitrary strides
+    [[nodiscard]] bool IsMatrixContiguous() const;
+
+    //! Returns strides of the host data in number of elements
+    //! First element is the stride of the batch followed by the strides of
+    //! each dimension
+    [[nodiscard]] std::vector<unsigned long> GetStrides() const;
+
+    //! Returns stride between the rows of the host data
+    [[nodiscard]] unsigned long RowStride() const;
+
+    //! Returns stride between the columns of the host data
+    [[nodiscard]] unsigned long ColStride() const;
+
+    //! Returns stride between the matrices composed with last two dimensions
+    [[nodiscard]] unsigned long MatrixStride() const;
+
+    //! Returns contiguous tensorData with same data as this tensorData
+    //! Returns shallow copy of itself if it is already contiguous
+    //! Otherwise, copy is made on first call and reused until this
+    //! tensorData is written by the kernel
+    //! Safe to call from multiple threads on the same tensorData
+    [[nodiscard]] TensorData GetContiguous() const;
+
     //! Changes device of the tensor
     //! Transfers data to target device from current device
     //! immediately returns false if change device is requested to same device
@@ -133,9 +274,78 @@ class TensorData
     //! Free space allocated on GPU memory
     void m_freeCuda();
 
+    //! Returns pointer to the pooled host buffer this tensorData belongs to
+    [[nodiscard]] float* m_hostBase() const
+    {
+        return DenseMatHost - m_hostOffset;
+    }
+
+    //! Returns pointer to the pooled cuda buffer this tensorData belongs to
+    [[nodiscard]] float* m_cudaBase() const
+    {
+        return DenseMatCuda - m_cudaOffset;
+    }
+
+    //! Returns column size padded to 32 bytes
+    static unsigned long m_paddedColSize(unsigned long colSize);
+
+    //! Returns size of each element in bytes
+    [[nodiscard]] unsigned long m_elementByteSize() const
+    {
+        if (m_dataType == DataType::Float32)
+            return sizeof(float);
+        return m_dataType == DataType::Int8 ? sizeof(std::int8_t)
+                                            : sizeof(std::uint16_t);
+    }
+
+    //! Returns strides of the host data in row-major order
+    [[nodiscard]] std::vector<unsigned long> m_defaultStrides() const;
+
+    //! Creates new tensorData with data of this tensorData laid out
+    //! contiguously
+    [[nodiscard]] TensorData m_createContiguousCopy() const;
+
+    //! Offset of DenseMatHost and DenseMatCuda from the pooled buffer
+    //! Non-zero only if this tensorData is view of other tensorData
+    unsigned long m_hostOffset = 0;
+    unsigned long m_cudaOffset = 0;
+    bool m_copyOnWrite = false;
+
+    //! Copy-on-write views sharing the same buffer. Each view holds its own
+    //! token, which is shared by the copies of the view
+    struct ViewGroup
+    {
+        std::mutex Mtx;
+        std::vector<std::weak_ptr<int>> Tokens;
+    };
+
+    //! Adds the view to the view group of this tensorData
+    void m_addView(TensorData& view);
+
+    //! Returns true if any other view of the group is alive
+    [[nodiscard]] bool m_hasOtherViews() const;
+
+    std::shared_ptr<ViewGroup> m_viewGroup;
+    std::shared_ptr<int> m_viewToken;
+
+    //! Strides of the host data (batch first). Empty if contiguous
+    std::vector<unsigned long> m_strides;
+    //! Order of the dimensions of the contiguous tensorData that this view
+    //! was permuted from. Empty if contiguous
+    std::vector<unsigned int> m_permutation;
+    //! Contiguous copy of the strided view made by GetContiguous
+    //! Accessed with std::atomic_load and std::atomic_store (see GetContiguous)
+    mutable std::shared_ptr<TensorData> m_contiguousCache;
+    //! Scale of each row of int8 data. Shared between the copies since it is
+    //! never modified after quantization
+    std::shared_ptr<TensorData> m_scale;
+    //! Version of the buffer shared between the views (see GetVersion)
+    std::shared_ptr<std::atomic<std::uint64_t>> m_version;
+
     int m_parentDescKey = -1;
 
     Type m_type = Type::Dense;
+    DataType m_dataType = DataType::Float32;
 
     Device m_device;
 };
@@ -9,9 +9,9 @@
 
 #include <Sapphire/operations/Backward/BackPropWrapper.hpp>
 #include <Sapphire/tensor/TensorData.hpp>
-#include <list>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 namespace Sapphire::TensorUtil
 {
@@ -27,6 +27,14 @@ class TensorDescriptor
     TensorDescriptor(const Shape& shape, Type type, const Device& device,
                      unsigned int batchSize, int key);
 
+    //! Creates descriptor from already allocated tensorData
+    //! Used for creating descriptors that views the data of other descriptors
+    //! \param forwardData : tensorData to be used as forward data
+    //! \param backwardData : tensorData to be used as backward data
+    //! \param key : key of this descriptor
+    TensorDescriptor(TensorData forwardData, TensorData backwardData,
+                     int key);
+
     ~TensorDescriptor() = default;
 
     TensorDescriptor(const TensorDescriptor& tensorData) = delete;
@@ -72,6 +80,11 @@ class TensorDescriptor
         return m_history.back().Wrapper;
     }
 
+    //! Returns wrapper of the output history which is invoked next in back
+    //! propagation. Operand history at the back is skipped
+    //! \return : wrapper to invoke. nullptr if this descriptor is a leaf
+    [[nodiscard]] BackProp::BackPropWrapper* GetNextBackPropWrapper() const;
+
     [[nodiscard]] int GetKey() const
     {
         return m_key;
@@ -112,8 +125,8 @@ class TensorDescriptor
         bool IsOutput;
 
         std::unique_ptr<BackProp::BackPropWrapper> Wrapper;
-        //! List of the units that was as operand
-        std::list<int> GradientInputTensorKeys;
+        //! Keys of the tensors that were created using this tensor as operand
+        std::vector<int> GradientInputTensorKeys;
     };
 
     //! m_key to identify tensor data
@@ -121,7 +134,7 @@ class TensorDescriptor
     unsigned int m_batchSize;
     bool m_trainable = true;
 
-    std::list<History> m_history;
+    std::vector<History> m_history;
 };
 }  // namespace Sapphire::TensorUtil
 
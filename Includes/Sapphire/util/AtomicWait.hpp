@@ -0,0 +1,59 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_ATOMICWAIT_HPP
+#define SAPPHIRE_UTIL_ATOMICWAIT_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Sapphire::Util
+{
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+              "atomic<uint32_t> must have same layout as uint32_t");
+
+//! Blocks until value of the atomic is changed from expected and
+//! NotifyAll is called. May return spuriously
+//! Uses futex on linux, and falls back to yielding on other platforms
+inline void AtomicWait(std::atomic<std::uint32_t>& atomic,
+                       std::uint32_t expected)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&atomic),
+            FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+#else
+    while (atomic.load(std::memory_order_acquire) == expected)
+        std::this_thread::yield();
+#endif
+}
+
+//! Wakes up to count threads waiting on the atomic with AtomicWait
+inline void AtomicNotify(std::atomic<std::uint32_t>& atomic, int count)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&atomic),
+            FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+#else
+    static_cast<void>(atomic);
+    static_cast<void>(count);
+#endif
+}
+
+//! Wakes up every thread waiting on the atomic with AtomicWait
+inline void AtomicNotifyAll(std::atomic<std::uint32_t>& atomic)
+{
+    AtomicNotify(atomic, INT32_MAX);
+}
+}  // namespace Sapphire::Util
+
+#endif  // SAPPHIRE_UTIL_ATOMICWAIT_HPP
@@ -7,94 +7,189 @@
 #ifndef Sapphire_CONCURRENTQUEUE_HPP
 #define Sapphire_CONCURRENTQUEUE_HPP
 
+#include <Sapphire/util/AtomicWait.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
 #include <optional>
-#include <shared_mutex>
-#include <vector>
+#include <thread>
+#include <type_traits>
+#include <utility>
 
 namespace Sapphire::Util
 {
+//! Lock-free bounded multi-producer multi-consumer queue
+//! Each slot carries a sequence number which tells whether the slot is ready
+//! to be written or read for the current position. Producers and consumers
+//! only contend on their own position with compare-and-swap, and the
+//! positions are padded into separate cache lines
+//! Blocking operations spin shortly, and sleep on futex afterwards
 template <typename T>
 class ConcurrentQueue
 {
-public:
-    ConcurrentQueue(std::size_t maxSize)
-        : m_vector(maxSize)
+    static constexpr std::size_t CacheLineSize = 64;
+
+ public:
+    //! \param maxSize : capacity of the queue. Rounded up to power of 2
+    explicit ConcurrentQueue(std::size_t maxSize)
+        : m_capacity(m_roundUpCapacity(maxSize)),
+          m_mask(m_capacity - 1),
+          m_slots(new Slot[m_capacity])
     {
+        for (std::size_t i = 0; i < m_capacity; ++i)
+            m_slots[i].Sequence.store(i, std::memory_order_relaxed);
     }
 
-    template <typename U>
-    void TryPush(U&& object)
+    ~ConcurrentQueue()
     {
-        static_assert(std::is_same<std::decay_t<T>, std::decay_t<U>>::value);
-        //! This lock will be released automatically if function returns (same
-        //! for all lock_guards used in this code)
-        std::lock_guard lock(m_mtx);
+        while (TryPop())
+            ;
+    }
 
-        // Return if capacity is full (Waits if given predicate (second
-        // argument) is false)
-        if (Size() == m_vector.size())
-            return;
+    ConcurrentQueue(const ConcurrentQueue& queue) = delete;
+    ConcurrentQueue(ConcurrentQueue&& queue) noexcept = delete;
+    ConcurrentQueue& operator=(const ConcurrentQueue& queue) = delete;
+    ConcurrentQueue& operator=(ConcurrentQueue&& queue) noexcept = delete;
 
-        if (m_startIdx == m_endIdx)
+    //! Tries to push element into the queue
+    //! Returns immediately if queue is full
+    //! \return : true if element was pushed
+    template <typename U>
+    bool TryPush(U&& object)
+    {
+        static_assert(std::is_same<std::decay_t<T>, std::decay_t<U>>::value);
+        std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        while (true)
         {
-            m_PopCondVar.notify_one();
+            Slot& slot = m_slots[pos & m_mask];
+            const auto diff = m_distance(
+                slot.Sequence.load(std::memory_order_acquire), pos);
+            if (diff == 0)
+            {
+                if (m_enqueuePos.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed))
+                {
+                    new (&slot.Storage) T(std::forward<U>(object));
+                    slot.Sequence.store(pos + 1, std::memory_order_release);
+                    m_notify(m_popWaiters, m_popEpoch, 1);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+                return false;
+            else
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
         }
-
-        m_endIdx = m_endIdx == m_vector.size() ? 0 : m_endIdx + 1;
-
-        const long elemIdx = m_endIdx - 1 < 0 ? m_vector.size() : m_endIdx - 1;
-
-        m_vector[static_cast<std::size_t>(elemIdx)] = std::forward<U>(object);
     }
 
     //! Pushes element into the queue
-    //! Waits if element is full
+    //! Waits if queue is full
     template <typename U>
     void Push(U&& object)
     {
-        static_assert(std::is_same<std::decay_t<T>, std::decay_t<U>>::value);
-        std::lock_guard lock(m_mtx);
-
-        // Wait if capacity is full (Waits if given predicate (second argument)
-        // is false)
-        m_PushCondVar.wait(m_mtx,
-                           [this]() { return Size() != m_vector.size(); });
+        //! object is only moved from when TryPush succeeds
+        while (!TryPush(std::forward<U>(object)))
+            m_wait(m_pushWaiters, m_pushEpoch, [this]() { return m_canPush(); });
+    }
 
-        if (m_startIdx == m_endIdx)
+    //! Tries to push up to count elements starting from first with single
+    //! compare-and-swap. Pushed elements are stored consecutively
+    //! \return : number of elements pushed. 0 if queue is full
+    template <typename ForwardIt>
+    std::size_t TryPushN(ForwardIt first, std::size_t count)
+    {
+        std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        while (count > 0)
         {
-            m_PopCondVar.notify_one();
-        }
+            //! Slots with sequence equal to their position are free, and
+            //! nobody else can claim them while enqueue position is pos
+            std::size_t num = 0;
+            while (num < count && num < m_capacity &&
+                   m_slots[(pos + num) & m_mask].Sequence.load(
+                       std::memory_order_acquire) == pos + num)
+                ++num;
 
-        m_endIdx = m_endIdx == m_vector.size() ? 0 : m_endIdx + 1;
+            if (num == 0)
+            {
+                if (m_distance(
+                        m_slots[pos & m_mask].Sequence.load(
+                            std::memory_order_acquire),
+                        pos) < 0)
+                    return 0;
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+                continue;
+            }
 
-        const long elemIdx = m_endIdx - 1 < 0 ? m_vector.size() : m_endIdx - 1;
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + num,
+                                                   std::memory_order_relaxed))
+            {
+                for (std::size_t i = 0; i < num; ++i, ++first)
+                {
+                    Slot& slot = m_slots[(pos + i) & m_mask];
+                    new (&slot.Storage) T(*first);
+                    slot.Sequence.store(pos + i + 1,
+                                        std::memory_order_release);
+                }
+                m_notify(m_popWaiters, m_popEpoch, num);
+                return num;
+            }
+        }
+        return 0;
+    }
 
-        m_vector[static_cast<std::size_t>(elemIdx)] = std::forward<U>(object);
+    //! Pushes count elements starting from first
+    //! Waits while queue is full
+    template <typename ForwardIt>
+    void PushN(ForwardIt first, std::size_t count)
+    {
+        while (count > 0)
+        {
+            const auto num = TryPushN(first, count);
+            if (num == 0)
+            {
+                m_wait(m_pushWaiters, m_pushEpoch,
+                       [this]() { return m_canPush(); });
+                continue;
+            }
+            std::advance(first, num);
+            count -= num;
+        }
     }
 
-    //! Tries Push element into the queue
-    //! returns immediately if element is full
+    //! Tries to pop element from the queue
+    //! Returns immediately if queue is empty
     //! \return : optional value of element. Popped element if successful,
     //! std::nullopt if failure
     std::optional<T> TryPop()
     {
-        std::lock_guard lock(m_mtx);
-
-        //!  if Queue is empty (Waits if given predicate (second argument)
-        //! is false)
-        if (m_startIdx == m_endIdx)
+        std::size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        while (true)
         {
-            return {};
+            Slot& slot = m_slots[pos & m_mask];
+            const auto diff = m_distance(
+                slot.Sequence.load(std::memory_order_acquire), pos + 1);
+            if (diff == 0)
+            {
+                if (m_dequeuePos.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed))
+                {
+                    std::optional<T> object(std::move(*slot.Get()));
+                    slot.Get()->~T();
+                    slot.Sequence.store(pos + m_capacity,
+                                        std::memory_order_release);
+                    m_notify(m_pushWaiters, m_pushEpoch, 1);
+                    return object;
+                }
+            }
+            else if (diff < 0)
+                return {};
+            else
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
         }
-
-        if (Size() == m_vector.size())
-        {
-            m_PushCondVar.notify_one();
-        }
-
-        m_startIdx = m_startIdx == m_vector.size() - 1 ? 0 : m_startIdx + 1;
-
-        return m_vector[m_startIdx];
     }
 
     //! Pops element from the queue
@@ -102,20 +197,73 @@ public:
     //! \return : Popped element
     T Pop()
     {
-        std::lock_guard lock(m_mtx);
-
-        //! Wait if Queue is empty (Waits if given predicate (second argument)
-        //! is false)
-        m_PopCondVar.wait(m_mtx, [this]() { return m_startIdx != m_endIdx; });
+        while (true)
+        {
+            if (auto object = TryPop())
+                return std::move(*object);
+            m_wait(m_popWaiters, m_popEpoch, [this]() { return m_canPop(); });
+        }
+    }
 
-        if (Size() == m_vector.size())
+    //! Tries to pop up to maxCount consecutive elements with single
+    //! compare-and-swap, and writes them to out
+    //! \return : number of elements popped. 0 if queue is empty
+    template <typename OutputIt>
+    std::size_t TryPopN(OutputIt out, std::size_t maxCount)
+    {
+        std::size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        while (maxCount > 0)
         {
-            m_PushCondVar.notify_one();
+            std::size_t num = 0;
+            while (num < maxCount && num < m_capacity &&
+                   m_slots[(pos + num) & m_mask].Sequence.load(
+                       std::memory_order_acquire) == pos + num + 1)
+                ++num;
+
+            if (num == 0)
+            {
+                if (m_distance(
+                        m_slots[pos & m_mask].Sequence.load(
+                            std::memory_order_acquire),
+                        pos + 1) < 0)
+                    return 0;
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (m_dequeuePos.compare_exchange_weak(pos, pos + num,
+                                                   std::memory_order_relaxed))
+            {
+                for (std::size_t i = 0; i < num; ++i, ++out)
+                {
+                    Slot& slot = m_slots[(pos + i) & m_mask];
+                    *out = std::move(*slot.Get());
+                    slot.Get()->~T();
+                    slot.Sequence.store(pos + i + m_capacity,
+                                        std::memory_order_release);
+                }
+                m_notify(m_pushWaiters, m_pushEpoch, num);
+                return num;
+            }
         }
+        return 0;
+    }
 
-        m_startIdx = m_startIdx == m_vector.size() - 1 ? 0 : m_startIdx + 1;
+    //! Pops up to maxCount elements and writes them to out
+    //! Waits until at least one element is available
+    //! \return : number of elements popped
+    template <typename OutputIt>
+    std::size_t PopN(OutputIt out, std::size_t maxCount)
+    {
+        if (maxCount == 0)
+            return 0;
 
-        return m_vector[m_startIdx];
+        while (true)
+        {
+            if (const auto num = TryPopN(out, maxCount); num > 0)
+                return num;
+            m_wait(m_popWaiters, m_popEpoch, [this]() { return m_canPop(); });
+        }
     }
 
     //! Invokes given Handler with parameters if queue is not empty
@@ -123,7 +271,7 @@ public:
     //! \tparam Func : Type for the handler function
     //! \tparam Ts : Additional parameters for the handler (If required)
     template <typename Func, typename... Ts>
-    void TryInvoke(Func handler, Ts ... params)
+    void TryInvoke(Func handler, Ts... params)
     {
         auto elem = TryPop();
         if (elem)
@@ -137,30 +285,115 @@ public:
     //! \tparam Func : Type for the handler function
     //! \tparam Ts : Additional parameters for the handler (If required)
     template <typename Func, typename... Ts>
-    void Invoke(Func handler, Ts ... params)
+    void Invoke(Func handler, Ts... params)
     {
         handler(Pop(), params...);
     }
 
-    //! Returns size of the ConcurrentQueue
-    //! If m_endIdx indicates index for end of the queue (last element stored in
-    //! m_endIdx - 1) while m_startIdx indicates index for start of the queue.
-    //! Therefore, m_startIdx == m_endIdx indicates empty queue
-    std::size_t Size()
+    //! Returns number of elements in the queue
+    //! Result is approximate while other threads are modifying the queue
+    [[nodiscard]] std::size_t Size() const
+    {
+        const auto dequeuePos = m_dequeuePos.load(std::memory_order_acquire);
+        const auto enqueuePos = m_enqueuePos.load(std::memory_order_acquire);
+        return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+    }
+
+    [[nodiscard]] std::size_t Capacity() const
+    {
+        return m_capacity;
+    }
+
+ private:
+    struct alignas(CacheLineSize) Slot
     {
-        if (m_endIdx < m_startIdx)
-            return (m_vector.size() - m_startIdx) + m_endIdx;
-        return m_endIdx - m_startIdx;
+        std::atomic<std::size_t> Sequence;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type Storage;
+
+        T* Get()
+        {
+            return std::launder(reinterpret_cast<T*>(&Storage));
+        }
+    };
+
+    static std::size_t m_roundUpCapacity(std::size_t maxSize)
+    {
+        std::size_t capacity = 2;
+        while (capacity < maxSize)
+            capacity <<= 1;
+        return capacity;
     }
 
-private:
-    std::vector<T> m_vector;
-    long m_startIdx = 0;
-    long m_endIdx = 0;
-    std::shared_mutex m_mtx;
-    std::condition_variable m_PushCondVar;
-    std::condition_variable m_PopCondVar;
+    static std::ptrdiff_t m_distance(std::size_t sequence, std::size_t pos)
+    {
+        return static_cast<std::ptrdiff_t>(sequence - pos);
+    }
+
+    //! Returns true if slot at the enqueue position may be writable
+    bool m_canPush() const
+    {
+        const auto pos = m_enqueuePos.load(std::memory_order_relaxed);
+        return m_distance(m_slots[pos & m_mask].Sequence.load(
+                              std::memory_order_acquire),
+                          pos) >= 0;
+    }
+
+    //! Returns true if slot at the dequeue position may be readable
+    bool m_canPop() const
+    {
+        const auto pos = m_dequeuePos.load(std::memory_order_relaxed);
+        return m_distance(m_slots[pos & m_mask].Sequence.load(
+                              std::memory_order_acquire),
+                          pos + 1) >= 0;
+    }
+
+    //! Spins shortly and sleeps on epoch until isReady becomes true or
+    //! epoch is changed by m_notify
+    template <typename Func>
+    static void m_wait(std::atomic<std::uint32_t>& waiters,
+                       std::atomic<std::uint32_t>& epoch, Func isReady)
+    {
+        for (int i = 0; i < 64; ++i)
+        {
+            if (isReady())
+                return;
+            std::this_thread::yield();
+        }
+
+        waiters.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const auto expected = epoch.load(std::memory_order_seq_cst);
+        if (!isReady())
+            AtomicWait(epoch, expected);
+        waiters.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    //! Wakes up as many waiters as the number of modified slots
+    //! Fence orders the modification before reading the number of waiters,
+    //! so waiter either sees the modification or gets notified
+    static void m_notify(std::atomic<std::uint32_t>& waiters,
+                         std::atomic<std::uint32_t>& epoch, std::size_t count)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters.load(std::memory_order_relaxed) > 0)
+        {
+            epoch.fetch_add(1, std::memory_order_seq_cst);
+            AtomicNotify(epoch, static_cast<int>(
+                                    std::min<std::size_t>(count, INT32_MAX)));
+        }
+    }
+
+    const std::size_t m_capacity;
+    const std::size_t m_mask;
+    std::unique_ptr<Slot[]> m_slots;
+
+    alignas(CacheLineSize) std::atomic<std::size_t> m_enqueuePos = 0;
+    alignas(CacheLineSize) std::atomic<std::size_t> m_dequeuePos = 0;
+    alignas(CacheLineSize) std::atomic<std::uint32_t> m_pushWaiters = 0;
+    std::atomic<std::uint32_t> m_pushEpoch = 0;
+    alignas(CacheLineSize) std::atomic<std::uint32_t> m_popWaiters = 0;
+    std::atomic<std::uint32_t> m_popEpoch = 0;
 };
-}
+}  // namespace Sapphire::Util
 
 #endif
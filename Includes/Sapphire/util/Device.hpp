@@ -9,6 +9,7 @@
 
 #include <cuda_runtime.h>
 #include <Sapphire/tensor/Shape.hpp>
+#include <deque>
 #include <stdexcept>
 #include <string>
 
@@ -20,13 +21,17 @@ enum class DeviceType
     CUDA,
 };
 
+//! Lightweight handle of the device
+//! Name and properties of the device are stored once in the device registry,
+//! and Device only holds its index in the registry. Device is trivially
+//! copyable, and devices with same id, type and name share the same index
 class Device
 {
  public:
     Device() = default;
 
-    explicit Device(std::string name);
-    Device(int id, std::string name);
+    explicit Device(const std::string& name);
+    Device(int id, const std::string& name);
     ~Device() = default;
 
     Device(const Device& device) = default;
@@ -34,33 +39,29 @@ class Device
     Device& operator=(const Device& device) = default;
     Device& operator=(Device&& device) noexcept = default;
 
-    bool operator==(const Device& device) const;
-    bool operator!=(const Device& device) const;
+    bool operator==(const Device& device) const
+    {
+        return m_index == device.m_index;
+    }
 
-    [[nodiscard]] DeviceType Type() const
+    bool operator!=(const Device& device) const
     {
-        return m_type;
+        return m_index != device.m_index;
     }
 
-    [[nodiscard]] std::string Name() const
+    [[nodiscard]] DeviceType Type() const
     {
-        return m_name;
+        return m_type;
     }
 
+    [[nodiscard]] const std::string& Name() const;
+
     [[nodiscard]] int GetID() const
     {
         return m_id;
     }
 
-    [[nodiscard]] int GetCudaCapability() const
-    {
-        if (m_type != DeviceType::CUDA)
-        {
-            throw std::runtime_error(
-                "GetCudaCapability - Device is not set as CUDA");
-        }
-        return m_cudaCapability;
-    }
+    [[nodiscard]] int GetCudaCapability() const;
 
     static int GetAvailableCudaDeviceCount()
     {
@@ -70,11 +71,32 @@ class Device
     }
 
  private:
+    //! Properties of the device stored in the registry
+    struct DeviceInfo
+    {
+        int Id;
+        DeviceType Type;
+        std::string Name;
+        std::size_t PadByteSize;
+        int CudaCapability;
+    };
+
+    //! Entries are never removed, and deque keeps references to existing
+    //! entries valid while new entries are registered
+    static std::deque<DeviceInfo>& m_registry();
+
+    //! Returns registry entry of the given index
+    static const DeviceInfo& m_getInfo(unsigned int index);
+
+    //! Returns index of the registry entry with given properties
+    //! Registers new entry if it does not exist
+    static unsigned int m_register(const DeviceInfo& deviceInfo);
+
+    //! Index 0 is reserved for the undefined device
+    unsigned int m_index = 0;
+    //! Cached from the registry since they are accessed on every operation
     int m_id = -1;
     DeviceType m_type = DeviceType::HOST;
-    std::string m_name = "Undefined";
-    std::size_t m_padByteSize = 0;
-    int m_cudaCapability = 0;
 };
 }  // namespace Sapphire
 
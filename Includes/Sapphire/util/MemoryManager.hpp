@@ -67,6 +67,12 @@ class MemoryManager
 
     static void DeReferenceHost(void* ptr);
 
+    //! Returns number of references to the allocated cuda memory
+    static int GetReferenceCountCuda(void* ptr, int deviceId);
+
+    //! Returns number of references to the allocated host memory
+    static int GetReferenceCountHost(void* ptr);
+
     static void ClearUnusedCudaMemoryPool();
 
     static void ClearUnusedHostMemoryPool();
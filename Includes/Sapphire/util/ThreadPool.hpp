@@ -0,0 +1,292 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_THREADPOOL_HPP
+#define SAPPHIRE_UTIL_THREADPOOL_HPP
+
+#include <Sapphire/util/ConcurrentQueue.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Sapphire::Util
+{
+//! Base of the tasks executed by ThreadPool
+//! Tasks are owned by whoever submits them, and must outlive their execution
+struct Task
+{
+    void (*Run)(Task* task) = nullptr;
+    //! Set to 1 after the task has finished
+    std::atomic<std::uint32_t> Done = 0;
+};
+
+//! Chase-Lev work stealing deque
+//! Owner pushes and pops tasks at the bottom in LIFO order, while the other
+//! threads steal the oldest tasks from the top
+class WorkStealingDeque
+{
+ public:
+    explicit WorkStealingDeque(std::size_t capacity = 1024);
+    ~WorkStealingDeque() = default;
+
+    WorkStealingDeque(const WorkStealingDeque& deque) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque& deque) = delete;
+
+    //! Pushes task at the bottom. Must be called by the owner
+    void Push(Task* task);
+
+    //! Pops task at the bottom. Must be called by the owner
+    //! \return : popped task. nullptr if empty
+    Task* Pop();
+
+    //! Steals task at the top. Can be called by any thread
+    //! \return : stolen task. nullptr if empty or lost the race
+    Task* Steal();
+
+    [[nodiscard]] bool Empty() const;
+
+ private:
+    struct Buffer
+    {
+        explicit Buffer(std::size_t capacity)
+            : Mask(capacity - 1),
+              Tasks(new std::atomic<Task*>[capacity])
+        {
+        }
+
+        std::atomic<Task*>& At(std::int64_t idx) const
+        {
+            return Tasks[static_cast<std::size_t>(idx) & Mask];
+        }
+
+        std::size_t Mask;
+        std::unique_ptr<std::atomic<Task*>[]> Tasks;
+    };
+
+    alignas(64) std::atomic<std::int64_t> m_top = 0;
+    alignas(64) std::atomic<std::int64_t> m_bottom = 0;
+    std::atomic<Buffer*> m_buffer;
+    //! Buffers are kept until destruction since thieves may still read the
+    //! old buffer after it has grown
+    std::vector<std::unique_ptr<Buffer>> m_buffers;
+};
+
+//! Work stealing thread pool for host kernels
+//! Each worker owns a WorkStealingDeque. Tasks spawned on a worker are pushed
+//! on its own deque, and idle workers steal from the others. Threads outside
+//! the pool submit tasks through a shared queue and sleep until the tasks
+//! are done, so number of threads computing never exceeds the pool size
+//! even if multiple threads (e.g. inference sessions) share the pool
+class ThreadPool
+{
+ public:
+    explicit ThreadPool(unsigned int numThreads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool& threadPool) = delete;
+    ThreadPool(ThreadPool&& threadPool) noexcept = delete;
+    ThreadPool& operator=(const ThreadPool& threadPool) = delete;
+    ThreadPool& operator=(ThreadPool&& threadPool) noexcept = delete;
+
+    [[nodiscard]] unsigned int NumThreads() const
+    {
+        return static_cast<unsigned int>(m_workers.size());
+    }
+
+    //! Invokes func(chunkBegin, chunkEnd) on the chunks of [begin, end)
+    //! Range is split in half recursively until it is not larger than
+    //! grainSize, and chunks are executed in parallel
+    //! Ranges not larger than grainSize are executed on the calling thread
+    //! Tasks are allocated on the stack, so no heap allocation is performed
+    //! If func throws, every chunk already started is finished and the first
+    //! exception is rethrown on the calling thread
+    //! \param grainSize : maximum size of each chunk. 0 chooses the size from
+    //! the number of threads
+    template <typename Func>
+    void ParallelFor(std::size_t begin, std::size_t end, std::size_t grainSize,
+                     Func&& func)
+    {
+        using FuncType = std::remove_reference_t<Func>;
+        m_parallelFor(
+            begin, end, grainSize,
+            RangeFunction{ const_cast<void*>(static_cast<const void*>(&func)),
+                           [](void* object, std::size_t chunkBegin,
+                              std::size_t chunkEnd) {
+                               (*static_cast<FuncType*>(object))(chunkBegin,
+                                                                 chunkEnd);
+                           } });
+    }
+
+    //! Returns true if current thread is a worker of this pool
+    [[nodiscard]] bool IsWorker() const;
+
+    //! Submits the task to the pool
+    //! Task is pushed on the deque of the current worker, or to the shared
+    //! queue if called outside the pool
+    void Submit(Task* task);
+
+    //! Waits until counter becomes 0
+    //! Workers execute other tasks while waiting, and other threads sleep
+    void WaitUntilZero(std::atomic<std::uint32_t>& counter);
+
+    //! Returns the pool shared by every host kernel
+    static ThreadPool& Global();
+
+    //! Sets total number of threads used by the global pool
+    //! Global pool is recreated, so it must not be called while any
+    //! operation is running on the global pool
+    static void SetGlobalThreadBudget(unsigned int numThreads);
+
+    [[nodiscard]] static unsigned int GetGlobalThreadBudget();
+
+ private:
+    //! Non-owning reference to the function invoked on the chunks
+    struct RangeFunction
+    {
+        void* Object;
+        void (*Invoke)(void* object, std::size_t begin, std::size_t end);
+    };
+
+    struct RangeTask : Task
+    {
+        ThreadPool* Pool = nullptr;
+        std::size_t Begin = 0;
+        std::size_t End = 0;
+        std::size_t GrainSize = 0;
+        RangeFunction Function{};
+        //! Exception thrown while executing the range
+        std::exception_ptr Exception;
+    };
+
+    void m_parallelFor(std::size_t begin, std::size_t end,
+                       std::size_t grainSize, RangeFunction function);
+
+    //! Splits the range and executes it on the current worker
+    void m_runRange(std::size_t begin, std::size_t end, std::size_t grainSize,
+                    RangeFunction function);
+
+    static void m_runRangeTask(Task* task);
+
+    //! Finds task to execute from own deque, other deques and shared queue
+    Task* m_findTask(unsigned int workerIdx);
+
+    //! Executes tasks until counter becomes 0
+    void m_helpUntilZero(std::atomic<std::uint32_t>& counter);
+
+    void m_workerLoop(unsigned int workerIdx);
+
+    //! Wakes up a sleeping worker if any
+    void m_notifyWorker();
+
+    [[nodiscard]] bool m_hasTask() const;
+
+    std::vector<std::unique_ptr<WorkStealingDeque>> m_deques;
+    std::vector<std::thread> m_workers;
+    ConcurrentQueue<Task*> m_sharedQueue;
+
+    std::atomic<bool> m_stop = false;
+    alignas(64) std::atomic<std::uint32_t> m_sleepers = 0;
+    std::atomic<std::uint32_t> m_epoch = 0;
+
+    static std::mutex m_globalMtx;
+    static std::unique_ptr<ThreadPool> m_global;
+    //! Read without locking on every operation
+    static std::atomic<ThreadPool*> m_globalPtr;
+    static std::atomic<unsigned int> m_globalBudget;
+};
+
+//! Runs tasks in parallel on the thread pool and waits for all of them
+//! Used for parallelism between independent operations. Run must be called
+//! by a single thread
+class TaskGroup
+{
+ public:
+    explicit TaskGroup(ThreadPool& threadPool = ThreadPool::Global())
+        : m_threadPool(threadPool)
+    {
+    }
+
+    ~TaskGroup()
+    {
+        m_threadPool.WaitUntilZero(m_pending);
+    }
+
+    TaskGroup(const TaskGroup& taskGroup) = delete;
+    TaskGroup& operator=(const TaskGroup& taskGroup) = delete;
+
+    //! Submits func to the pool
+    template <typename Func>
+    void Run(Func&& func)
+    {
+        auto& task = m_tasks.emplace_back();
+        task.Group = this;
+        task.Function = std::forward<Func>(func);
+        task.Run = m_runTask;
+        m_pending.fetch_add(1, std::memory_order_relaxed);
+        m_threadPool.Submit(&task);
+    }
+
+    //! Waits until every submitted task is finished
+    //! Rethrows the first exception thrown by the tasks
+    void Wait();
+
+ private:
+    struct FunctionTask : Task
+    {
+        TaskGroup* Group = nullptr;
+        std::function<void()> Function;
+    };
+
+    static void m_runTask(Task* task);
+
+    ThreadPool& m_threadPool;
+    //! deque keeps the tasks in place while new tasks are added
+    std::deque<FunctionTask> m_tasks;
+    std::atomic<std::uint32_t> m_pending = 0;
+    std::mutex m_exceptionMtx;
+    std::exception_ptr m_exception;
+};
+
+//! Approximate number of operations which makes a task worth scheduling
+constexpr std::size_t MinTaskCost = 1 << 15;
+
+//! Returns grain size which gives each chunk at least MinTaskCost operations
+//! \param costPerItem : approximate number of operations for each item
+inline std::size_t GrainSize(std::size_t costPerItem)
+{
+    return costPerItem >= MinTaskCost
+               ? 1
+               : MinTaskCost / (costPerItem > 0 ? costPerItem : 1);
+}
+
+//! Invokes func(chunkBegin, chunkEnd) on the chunks of [begin, end) using
+//! the global thread pool
+//! Ranges not larger than grainSize are executed inline without touching the
+//! pool
+template <typename Func>
+void ParallelFor(std::size_t begin, std::size_t end, std::size_t grainSize,
+                 Func&& func)
+{
+    if (grainSize > 0 && end - begin <= grainSize)
+    {
+        if (begin < end)
+            func(begin, end);
+        return;
+    }
+    ThreadPool::Global().ParallelFor(begin, end, grainSize,
+                                     std::forward<Func>(func));
+}
+}  // namespace Sapphire::Util
+
+#endif  // SAPPHIRE_UTIL_THREADPOOL_HPP
@@ -0,0 +1,292 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Interface/IndexingInterfaceDecl.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/operations/Backward/IndexingBackward.hpp>
+#include <stdexcept>
+
+namespace Sapphire
+{
+//! Connects the view descriptor to the source descriptor for back propagation
+static void AppendViewHistory(
+    TensorUtil::TensorDescriptor& sourceDesc,
+    TensorUtil::TensorDescriptor& viewDesc,
+    std::unique_ptr<BackProp::BackPropWrapper> wrapper)
+{
+    sourceDesc.AppendOperandHistory(viewDesc.GetKey());
+    viewDesc.AppendOutputHistory(std::move(wrapper), false);
+}
+
+static unsigned int CheckDim(const Shape& shape, int dim)
+{
+    if (dim < 0 || static_cast<unsigned int>(dim) >= shape.Dim())
+        throw std::invalid_argument("Given dimension " + std::to_string(dim) +
+                                    " is out of range for shape " +
+                                    shape.ToString());
+    return static_cast<unsigned int>(dim);
+}
+
+Tensor Reshape(const Tensor& tensor, const Shape& shape)
+{
+    Model& model = ModelManager::GetCurrentModel();
+    auto& sourceDesc = model.GetDescriptor(tensor.TensorDescriptorKey());
+    const bool hasGradient = GradMode::IsEnabled() &&
+                             sourceDesc.BackwardData.DenseMatHost != nullptr;
+
+    if (shape.Size() != sourceDesc.ForwardData.TensorShape.Size())
+        throw std::invalid_argument(
+            "Reshape - Number of elements mismatch between " +
+            sourceDesc.ForwardData.TensorShape.ToString() + " and " +
+            shape.ToString());
+
+    const bool isView = sourceDesc.ForwardData.IsViewCompatible(shape);
+
+    int outputKey;
+    if (isView)
+    {
+        outputKey = model.RegisterTensorDescriptorView(
+            tensor.TensorDescriptorKey(), shape, 0, 0);
+    }
+    else
+    {
+        outputKey = model.RegisterTensorDescriptor(
+            shape, sourceDesc.ForwardData.GetType(),
+            sourceDesc.ForwardData.GetDevice(), sourceDesc.GetBatchSize(),
+            hasGradient);
+    }
+
+    auto& outputDesc = model.GetDescriptor(outputKey);
+    if (!isView)
+        Compute::Reshape(outputDesc.ForwardData, sourceDesc.ForwardData);
+
+    if (hasGradient)
+    {
+        AppendViewHistory(sourceDesc, outputDesc,
+                          std::make_unique<BackProp::ReshapeBackProp>(
+                              sourceDesc.BackwardData, outputDesc.BackwardData,
+                              isView));
+    }
+
+    return Tensor(shape, outputKey);
+}
+
+Tensor Squeeze(const Tensor& tensor)
+{
+    const auto shapeVector = tensor.GetShape().GetShapeVector();
+    std::vector<unsigned int> newShapeVector;
+    for (auto dim : shapeVector)
+        if (dim != 1)
+            newShapeVector.emplace_back(dim);
+
+    if (newShapeVector.empty())
+        newShapeVector.emplace_back(1);
+
+    return Reshape(tensor, Shape(newShapeVector));
+}
+
+Tensor Squeeze(const Tensor& tensor, int dim)
+{
+    const auto shape = tensor.GetShape();
+    const auto index = CheckDim(shape, dim);
+    auto shapeVector = shape.GetShapeVector();
+
+    if (shapeVector.at(index) == 1 && shapeVector.size() > 1)
+        shapeVector.erase(shapeVector.begin() + index);
+
+    return Reshape(tensor, Shape(shapeVector));
+}
+
+void Squeeze(Tensor& tensor)
+{
+    const Tensor result = Squeeze(static_cast<const Tensor&>(tensor));
+    tensor = result;
+}
+
+void Squeeze(Tensor& tensor, int dim)
+{
+    const Tensor result = Squeeze(static_cast<const Tensor&>(tensor), dim);
+    tensor = result;
+}
+
+Tensor UnSqueeze(const Tensor& tensor, int dim)
+{
+    auto shapeVector = tensor.GetShape().GetShapeVector();
+    if (dim < 0 || static_cast<std::size_t>(dim) > shapeVector.size())
+        throw std::invalid_argument("UnSqueeze - Given dimension " +
+                                    std::to_string(dim) + " is out of range");
+
+    shapeVector.insert(shapeVector.begin() + dim, 1);
+    return Reshape(tensor, Shape(shapeVector));
+}
+
+void UnSqueeze(Tensor& tensor, int dim)
+{
+    const Tensor result = UnSqueeze(static_cast<const Tensor&>(tensor), dim);
+    tensor = result;
+}
+
+Tensor Expand(const Tensor& tensor, int dim)
+{
+    if (dim < 0)
+        throw std::invalid_argument("Expand - Given dimension " +
+                                    std::to_string(dim) + " is negative");
+
+    auto shape = tensor.GetShape();
+    shape.Expand(static_cast<unsigned int>(dim));
+    return Reshape(tensor, shape);
+}
+
+void Expand(Tensor& tensor, int dim)
+{
+    const Tensor result = Expand(static_cast<const Tensor&>(tensor), dim);
+    tensor = result;
+}
+
+Tensor Flatten(const Tensor& tensor)
+{
+    return Reshape(tensor, Shape({ tensor.GetShape().Size() }));
+}
+
+void Flatten(Tensor& tensor)
+{
+    const Tensor result = Flatten(static_cast<const Tensor&>(tensor));
+    tensor = result;
+}
+
+Tensor Permute(const Tensor& tensor, const std::vector<int>& dims)
+{
+    Model& model = ModelManager::GetCurrentModel();
+    const int sourceKey = tensor.TensorDescriptorKey();
+    const auto shape = model.GetDescriptor(sourceKey).ForwardData.TensorShape;
+
+    if (dims.size() != shape.Dim())
+        throw std::invalid_argument(
+            "Permute - Number of dimensions mismatch with shape " +
+            shape.ToString());
+
+    std::vector<unsigned int> permutation;
+    permutation.reserve(dims.size());
+    for (auto dim : dims)
+        permutation.emplace_back(CheckDim(shape, dim));
+
+    const int outputKey =
+        model.RegisterTensorDescriptorPermuteView(sourceKey, permutation);
+
+    auto& sourceDesc = model.GetDescriptor(sourceKey);
+    auto& outputDesc = model.GetDescriptor(outputKey);
+    if (GradMode::IsEnabled() && sourceDesc.BackwardData.DenseMatHost)
+    {
+        AppendViewHistory(sourceDesc, outputDesc,
+                          std::make_unique<BackProp::PermuteBackProp>(
+                              sourceDesc.BackwardData, outputDesc.BackwardData,
+                              permutation));
+    }
+
+    return Tensor(outputDesc.ForwardData.TensorShape, outputKey);
+}
+
+Tensor Transpose(const Tensor& tensor)
+{
+    const auto dim = static_cast<int>(tensor.GetShape().Dim());
+    if (dim < 2)
+        throw std::invalid_argument(
+            "Transpose - Shape must have dimension of at least 2");
+
+    std::vector<int> dims(dim);
+    for (int i = 0; i < dim; ++i)
+        dims[i] = i;
+    std::swap(dims[dim - 1], dims[dim - 2]);
+
+    return Permute(tensor, dims);
+}
+
+void Transpose(Tensor& tensor)
+{
+    const Tensor result = Transpose(static_cast<const Tensor&>(tensor));
+    tensor = result;
+}
+
+std::vector<Tensor> Chunk(const Tensor& tensor, int chunks, int dim)
+{
+    if (chunks <= 0)
+        throw std::invalid_argument("Chunk - Number of chunks must be positive");
+
+    Model& model = ModelManager::GetCurrentModel();
+    const int sourceKey = tensor.TensorDescriptorKey();
+    const auto shape = model.GetDescriptor(sourceKey).ForwardData.TensorShape;
+    const auto index = CheckDim(shape, dim);
+
+    const auto dimSize = shape.At(index);
+    const auto chunkSize = (dimSize + chunks - 1) / chunks;
+
+    unsigned int outerSize = 1;
+    for (unsigned int i = 0; i < index; ++i)
+        outerSize *= shape.At(i);
+    unsigned int innerSize = 1;
+    for (unsigned int i = index + 1; i < shape.Dim(); ++i)
+        innerSize *= shape.At(i);
+
+    std::vector<Tensor> tensors;
+    for (unsigned int start = 0; start < dimSize; start += chunkSize)
+    {
+        //! Descriptor must be looked up again since registering new
+        //! descriptor may happen between iterations
+        auto& sourceDesc = model.GetDescriptor(sourceKey);
+        const auto batchSize = sourceDesc.GetBatchSize();
+        const bool hasGradient = GradMode::IsEnabled() &&
+                                 sourceDesc.BackwardData.DenseMatHost !=
+                                     nullptr;
+
+        const auto length = std::min(chunkSize, dimSize - start);
+        auto chunkShape = shape;
+        chunkShape.Set(index, length);
+
+        //! Chunk is contiguous only if it does not cut the rows of the padded
+        //! host buffer and every dimension outside is one
+        const bool isView =
+            batchSize == 1 && outerSize == 1 && index != shape.Dim() - 1;
+
+        int outputKey;
+        if (isView)
+        {
+            const auto cols = shape.Cols();
+            const auto hostOffset = static_cast<unsigned long>(start) *
+                                    (innerSize / cols) *
+                                    sourceDesc.ForwardData.PaddedHostColSize;
+            const auto cudaOffset =
+                static_cast<unsigned long>(start) * innerSize;
+            outputKey = model.RegisterTensorDescriptorView(
+                sourceKey, chunkShape, hostOffset, cudaOffset);
+        }
+        else
+        {
+            outputKey = model.RegisterTensorDescriptor(
+                chunkShape, sourceDesc.ForwardData.GetType(),
+                sourceDesc.ForwardData.GetDevice(), batchSize, hasGradient);
+        }
+
+        auto& outputDesc = model.GetDescriptor(outputKey);
+        if (!isView)
+            Compute::CopySlice(outputDesc.ForwardData, sourceDesc.ForwardData,
+                               dim, 0, start, length);
+
+        if (hasGradient)
+        {
+            AppendViewHistory(sourceDesc, outputDesc,
+                              std::make_unique<BackProp::ChunkBackProp>(
+                                  sourceDesc.BackwardData,
+                                  outputDesc.BackwardData, dim, start,
+                                  isView));
+        }
+
+        tensors.emplace_back(chunkShape, outputKey);
+    }
+
+    return tensors;
+}
+}  // namespace Sapphire
@@ -5,6 +5,13 @@
 // property of any third parties.
 
 #include <Sapphire/Model.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/compute/dense/naive/NaiveOptimizer.hpp>
+#include <Sapphire/operations/Backward/BackwardEngine.hpp>
+#include <Sapphire/util/MemoryManager.hpp>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
 
 namespace Sapphire
 {
@@ -14,6 +21,7 @@ Model::Model(std::string name) : m_name(std::move(name))
 
 int Model::RegisterUnitDataWrapper(UnitDataWrapper& unitDataWrapper)
 {
+    std::lock_guard<std::mutex> lock(m_mtx);
     const int unitKey = m_unitPool.Counter++;
     unitDataWrapper.Key = unitKey;
 
@@ -28,73 +36,473 @@ int Model::RegisterTensorDescriptor(const Shape& shape, Type type,
                                     unsigned int batchSize,
                                     bool createBackwardData)
 {
+    std::lock_guard<std::mutex> lock(m_mtx);
     const int tensorDescKey = m_tensorDescriptorPool.Counter++;
     TensorUtil::TensorDescriptor tensorDesc(shape, type, device, batchSize,
                                             tensorDescKey);
-    if (createBackwardData)
+    if (createBackwardData && GradMode::IsEnabled())
     {
         tensorDesc.BackwardData = TensorUtil::TensorData(
             shape, type, device, batchSize, tensorDescKey);
     }
 
     m_tensorDescriptorPool.TensorDescMap[tensorDescKey] = std::move(tensorDesc);
+    m_recordKey(tensorDescKey);
 
     return tensorDescKey;
 }
 
-void Model::m_autoGrad(int tensorKey)
+int Model::RegisterTensorDescriptorView(int sourceKey, const Shape& shape,
+                                        unsigned long hostOffset,
+                                        unsigned long cudaOffset)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto& sourceDesc = m_tensorDescriptorPool.TensorDescMap.at(sourceKey);
+    const int tensorDescKey = m_tensorDescriptorPool.Counter++;
+    const auto batchSize = sourceDesc.GetBatchSize();
+
+    TensorUtil::TensorData forwardData = sourceDesc.ForwardData.CreateView(
+        shape, batchSize, hostOffset, cudaOffset, tensorDescKey, true);
+    TensorUtil::TensorData backwardData;
+    if (sourceDesc.BackwardData.DenseMatHost && GradMode::IsEnabled())
+    {
+        backwardData = sourceDesc.BackwardData.CreateView(
+            shape, batchSize, hostOffset, cudaOffset, tensorDescKey, false);
+    }
+
+    m_tensorDescriptorPool.TensorDescMap[tensorDescKey] =
+        TensorUtil::TensorDescriptor(std::move(forwardData),
+                                     std::move(backwardData), tensorDescKey);
+    m_recordKey(tensorDescKey);
+
+    return tensorDescKey;
+}
+
+int Model::RegisterTensorDescriptorPermuteView(
+    int sourceKey, const std::vector<unsigned int>& dims)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto& sourceDesc = m_tensorDescriptorPool.TensorDescMap.at(sourceKey);
+    const int tensorDescKey = m_tensorDescriptorPool.Counter++;
+
+    TensorUtil::TensorData forwardData =
+        sourceDesc.ForwardData.CreatePermuteView(dims, tensorDescKey, true);
+    TensorUtil::TensorData backwardData;
+    if (sourceDesc.BackwardData.DenseMatHost && GradMode::IsEnabled())
+    {
+        backwardData = TensorUtil::TensorData(
+            forwardData.TensorShape, forwardData.GetType(),
+            forwardData.GetDevice(), forwardData.BatchSize, tensorDescKey);
+    }
+
+    m_tensorDescriptorPool.TensorDescMap[tensorDescKey] =
+        TensorUtil::TensorDescriptor(std::move(forwardData),
+                                     std::move(backwardData), tensorDescKey);
+    m_recordKey(tensorDescKey);
+
+    return tensorDescKey;
+}
+
+std::size_t Model::ReleaseTensorData(const std::vector<int>& keys)
+{
+    const auto releasedBytes = [](const TensorUtil::TensorData& tensorData) {
+        if (!tensorData.DenseMatHost ||
+            Util::MemoryManager::GetReferenceCountHost(
+                const_cast<void*>(tensorData.GetBufferBase())) > 1)
+            return std::size_t{ 0 };
+        return static_cast<std::size_t>(tensorData.DenseTotalLengthHost) *
+               sizeof(float);
+    };
+
+    std::lock_guard<std::mutex> lock(m_mtx);
+    std::size_t byteSize = 0;
+    for (auto key : keys)
+    {
+        auto& tensorDesc = m_tensorDescriptorPool.TensorDescMap.at(key);
+        byteSize += releasedBytes(tensorDesc.ForwardData);
+        tensorDesc.ForwardData = TensorUtil::TensorData();
+        byteSize += releasedBytes(tensorDesc.BackwardData);
+        tensorDesc.BackwardData = TensorUtil::TensorData();
+    }
+    return byteSize;
+}
+
+void Model::ZeroGrad()
+{
+    for (const auto& parameter : GetParameterBuffers())
+        Compute::Initialize::Zeros(parameter.Gradient);
+    for (const auto& parameter : GetRowParameters())
+        parameter.Gradient->Clear();
+}
+
+std::vector<Parameter> Model::GetParameters() const
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    std::vector<Parameter> parameters;
+    for (int unitKey = 0; unitKey < m_unitPool.Counter; ++unitKey)
+    {
+        const auto& unitDataWrapper = m_unitPool.UnitWrapperMap.at(unitKey);
+        //! Parameters are sorted by their names to keep the order stable
+        std::vector<std::string> names;
+        for (const auto& [name, gradient] : unitDataWrapper.GradientDataMap)
+            names.emplace_back(name);
+        std::sort(names.begin(), names.end());
+
+        for (const auto& name : names)
+        {
+            const auto& data = unitDataWrapper.TensorDataMap.at(name);
+            const auto& gradient = unitDataWrapper.GradientDataMap.at(name);
+            if (data.GetDataType() == DataType::Float32)
+                parameters.emplace_back(
+                    Parameter{ data, gradient, unitKey, name });
+        }
+    }
+    return parameters;
+}
+
+std::vector<RowParameter> Model::GetRowParameters() const
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    std::vector<RowParameter> parameters;
+    for (int unitKey = 0; unitKey < m_unitPool.Counter; ++unitKey)
+    {
+        const auto& unitDataWrapper = m_unitPool.UnitWrapperMap.at(unitKey);
+        std::vector<std::string> names;
+        for (const auto& [name, gradient] : unitDataWrapper.RowGradientMap)
+            names.emplace_back(name);
+        std::sort(names.begin(), names.end());
+
+        for (const auto& name : names)
+            parameters.emplace_back(
+                RowParameter{ unitDataWrapper.TensorDataMap.at(name),
+                              unitDataWrapper.RowGradientMap.at(name),
+                              unitKey, name });
+    }
+    return parameters;
+}
+
+void Model::FlattenParameters()
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+
+    //! Parameters are packed in the order of GetParameters
+    std::vector<std::pair<int, std::string>> entries;
+    unsigned long hostLength = 0, cudaLength = 0;
+    Device device;
+    for (int unitKey = 0; unitKey < m_unitPool.Counter; ++unitKey)
+    {
+        const auto& unitDataWrapper = m_unitPool.UnitWrapperMap.at(unitKey);
+        std::vector<std::string> names;
+        for (const auto& [name, gradient] : unitDataWrapper.GradientDataMap)
+            names.emplace_back(name);
+        std::sort(names.begin(), names.end());
+
+        for (const auto& name : names)
+        {
+            const auto& data = unitDataWrapper.TensorDataMap.at(name);
+            const auto& gradient = unitDataWrapper.GradientDataMap.at(name);
+            if (data.GetDataType() != DataType::Float32)
+                continue;
+
+            if (entries.empty())
+                device = data.GetDevice();
+            if (data.GetType() != Type::Dense || !data.IsContiguous() ||
+                !gradient.IsContiguous() || data.GetDevice() != device ||
+                gradient.DenseTotalLengthHost != data.DenseTotalLengthHost)
+                throw std::invalid_argument(
+                    "Model::FlattenParameters - Parameters must be dense, "
+                    "contiguous and placed on the same device");
+
+            entries.emplace_back(unitKey, name);
+            hostLength += data.DenseTotalLengthHost;
+            cudaLength += data.DenseTotalLengthCuda;
+        }
+    }
+
+    if (entries.empty())
+        return;
+
+    //! Padded length of each parameter is multiple of 8 elements, so every
+    //! view starts at 32 byte boundary
+    const Shape flatShape({ static_cast<unsigned int>(hostLength) });
+    TensorUtil::TensorData flatData(flatShape, Type::Dense, device, 1);
+    TensorUtil::TensorData flatGradient(flatShape, Type::Dense, device, 1);
+    Compute::Initialize::Zeros(flatData);
+    Compute::Initialize::Zeros(flatGradient);
+
+    unsigned long hostOffset = 0, cudaOffset = 0;
+    for (const auto& [unitKey, name] : entries)
+    {
+        auto& unitDataWrapper = m_unitPool.UnitWrapperMap.at(unitKey);
+        auto& data = unitDataWrapper.TensorDataMap.at(name);
+        auto& gradient = unitDataWrapper.GradientDataMap.at(name);
+
+        auto dataView =
+            flatData.CreateView(data.TensorShape, data.BatchSize, hostOffset,
+                                cudaOffset, data.GetParentDescKey(), false);
+        auto gradientView = flatGradient.CreateView(
+            gradient.TensorShape, gradient.BatchSize, hostOffset, cudaOffset,
+            gradient.GetParentDescKey(), false);
+        TensorUtil::TensorData::DeepCopy(dataView, data);
+        TensorUtil::TensorData::DeepCopy(gradientView, gradient);
+
+        hostOffset += data.DenseTotalLengthHost;
+        cudaOffset += data.DenseTotalLengthCuda;
+        data = std::move(dataView);
+        gradient = std::move(gradientView);
+    }
+
+    m_flatParameter = Parameter{ std::move(flatData),
+                                 std::move(flatGradient) };
+}
+
+bool Model::IsFlattened() const
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_flatParameter.Data.GetBufferBase() != nullptr;
+}
+
+std::vector<Parameter> Model::GetParameterBuffers() const
 {
-    auto& descriptor = GetDescriptor(tensorKey);
-    if (descriptor.IsBackPropReady())
+    std::vector<Parameter> buffers;
     {
-        descriptor.PopIfOperandHistory();
-        const auto& wrapper = descriptor.GetBackPropWrapper();
-        const auto outputTensorDataVector = wrapper->GetOutputTensorKeys();
-
-        bool isInvoked = wrapper->InvokeBackProp(descriptor.BackwardData);
-        descriptor.PopHistory();  //! Pop output history
-
-        if (isInvoked)
-            for (auto& tensorData : outputTensorDataVector)
-            {
-                GetDescriptor(tensorData.GetParentDescKey())
-                    .RemoveGradientInputKey(tensorKey);
-                m_autoGrad(tensorData.GetParentDescKey());
-            }
+        std::lock_guard<std::mutex> lock(m_mtx);
+        if (m_flatParameter.Data.GetBufferBase())
+            buffers.emplace_back(m_flatParameter);
     }
+
+    for (auto& parameter : GetParameters())
+        if (buffers.empty() || parameter.Data.GetBufferBase() !=
+                                   buffers.front().Data.GetBufferBase())
+            buffers.emplace_back(std::move(parameter));
+    return buffers;
+}
+
+float Model::ClipGradientNorm(float maxNorm)
+{
+    const auto buffers = GetParameterBuffers();
+    std::vector<Compute::Dense::Naive::OptimizerParameter> gradients;
+    gradients.reserve(buffers.size());
+    for (const auto& buffer : buffers)
+    {
+        const auto& gradient = buffer.Gradient;
+        if (gradient.GetDevice().Type() != DeviceType::HOST ||
+            !gradient.IsContiguous())
+            throw std::invalid_argument(
+                "Model::ClipGradientNorm - Only contiguous gradients on the "
+                "host are supported");
+
+        Compute::Dense::Naive::OptimizerParameter parameter;
+        parameter.Gradient = gradient.DenseMatHost;
+        parameter.Size = gradient.DenseTotalLengthHost;
+        gradients.emplace_back(parameter);
+    }
+    //! Gradients of the tables only have the rows gathered
+    const auto rowParameters = GetRowParameters();
+    for (const auto& rowParameter : rowParameters)
+    {
+        Compute::Dense::Naive::OptimizerParameter parameter;
+        parameter.Gradient = rowParameter.Gradient->Rows.data();
+        parameter.Size = rowParameter.Gradient->Rows.size();
+        gradients.emplace_back(parameter);
+    }
+
+    const float norm = std::sqrt(Compute::Dense::Naive::GradientSquaredSum(
+        gradients.data(), gradients.size()));
+    if (norm > maxNorm)
+    {
+        Compute::Dense::Naive::ScaleGradient(
+            gradients.data(), gradients.size(), maxNorm / (norm + 1e-6f));
+        for (const auto& buffer : buffers)
+            buffer.Gradient.BumpVersion();
+    }
+    return norm;
+}
+
+void Model::Backward(const Tensor& tensor)
+{
+    auto& descriptor = GetDescriptor(tensor.TensorDescriptorKey());
+    if (!descriptor.BackwardData.DenseMatHost &&
+        !descriptor.BackwardData.DenseMatCuda)
+        throw std::invalid_argument(
+            "Model::Backward - Tensor does not have gradient");
+
+    Compute::Initialize::Ones(descriptor.BackwardData);
+    m_autoGrad(tensor.TensorDescriptorKey());
+}
+
+void Model::m_autoGrad(int tensorKey)
+{
+    BackProp::BackwardEngine engine(*this);
+    engine.Run(tensorKey);
 }
 
 UnitDataWrapper Model::GetUnitDataWrapper(int key) const
 {
+    std::lock_guard<std::mutex> lock(m_mtx);
     return m_unitPool.UnitWrapperMap.at(key);
 }
 
+void Model::SetUnitDataWrapper(int key, const UnitDataWrapper& unitDataWrapper)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_unitPool.UnitWrapperMap.at(key) = unitDataWrapper;
+}
+
 TensorUtil::TensorDescriptor& Model::GetDescriptor(int key)
 {
+    std::lock_guard<std::mutex> lock(m_mtx);
     return m_tensorDescriptorPool.TensorDescMap.at(key);
 }
 
-std::string ModelManager::m_currentModel;
+std::mutex ModelManager::m_mtx;
+
+std::unordered_map<std::string, std::unique_ptr<Model>>
+    ModelManager::m_modelMap;
 
-std::unordered_map<std::string, Model> ModelManager::m_modelMap;
+thread_local Model* ModelManager::m_currentModel = nullptr;
+
+thread_local std::vector<int>* Model::m_recordedKeys = nullptr;
+
+void Model::m_recordKey(int key)
+{
+    if (m_recordedKeys)
+        m_recordedKeys->emplace_back(key);
+}
 
 Model& ModelManager::GetModel(const std::string& name)
 {
-    return m_modelMap.at(name);
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return *m_modelMap.at(name);
 }
 
 Model& ModelManager::GetCurrentModel()
 {
-    return m_modelMap.at(m_currentModel);
+    if (!m_currentModel)
+        throw std::runtime_error(
+            "ModelManager::GetCurrentModel - Current model is not set on this "
+            "thread");
+    return *m_currentModel;
 }
 
 void ModelManager::SetCurrentModel(const std::string& name)
 {
-    m_currentModel = name;
+    m_currentModel = &GetModel(name);
 }
 
 void ModelManager::AddModel(const std::string& name)
 {
-    m_modelMap.emplace(name, Model(name));
+    std::lock_guard<std::mutex> lock(m_mtx);
+    if (m_modelMap.find(name) == m_modelMap.end())
+        m_modelMap.emplace(name, std::make_unique<Model>(name));
+}
+
+void ModelManager::ClearModels()
+{
+    m_currentModel = nullptr;
+    //! Models are destroyed after releasing the lock
+    std::unordered_map<std::string, std::unique_ptr<Model>> models;
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        std::swap(models, m_modelMap);
+    }
+}
+
+thread_local bool GradMode::m_enabled = true;
+
+bool GradMode::IsEnabled()
+{
+    return m_enabled;
+}
+
+void GradMode::SetEnabled(bool enabled)
+{
+    m_enabled = enabled;
+}
+
+NoGradGuard::NoGradGuard() : m_previousMode(GradMode::IsEnabled())
+{
+    GradMode::SetEnabled(false);
+}
+
+NoGradGuard::~NoGradGuard()
+{
+    GradMode::SetEnabled(m_previousMode);
+}
+
+EnableGradGuard::EnableGradGuard() : m_previousMode(GradMode::IsEnabled())
+{
+    GradMode::SetEnabled(true);
+}
+
+EnableGradGuard::~EnableGradGuard()
+{
+    GradMode::SetEnabled(m_previousMode);
+}
+
+thread_local bool TrainingMode::m_enabled = true;
+
+bool TrainingMode::IsEnabled()
+{
+    return m_enabled;
+}
+
+void TrainingMode::SetEnabled(bool enabled)
+{
+    m_enabled = enabled;
+}
+
+TrainingModeGuard::TrainingModeGuard(bool enabled)
+    : m_previousMode(TrainingMode::IsEnabled())
+{
+    TrainingMode::SetEnabled(enabled);
+}
+
+TrainingModeGuard::~TrainingModeGuard()
+{
+    TrainingMode::SetEnabled(m_previousMode);
+}
+
+thread_local bool RecomputeGuard::m_recomputing = false;
+
+RecomputeGuard::RecomputeGuard() : m_previousState(m_recomputing)
+{
+    m_recomputing = true;
+}
+
+RecomputeGuard::~RecomputeGuard()
+{
+    m_recomputing = m_previousState;
+}
+
+bool RecomputeGuard::IsRecomputing()
+{
+    return m_recomputing;
+}
+
+TensorKeyRecorder::TensorKeyRecorder() : m_previousKeys(Model::m_recordedKeys)
+{
+    Model::m_recordedKeys = &m_keys;
+}
+
+TensorKeyRecorder::~TensorKeyRecorder()
+{
+    Model::m_recordedKeys = m_previousKeys;
+}
+
+ModelContext::ModelContext(Model& model)
+    : m_previousModel(ModelManager::m_currentModel)
+{
+    ModelManager::m_currentModel = &model;
+}
+
+ModelContext::ModelContext(const std::string& name)
+    : ModelContext(ModelManager::GetModel(name))
+{
+}
+
+ModelContext::~ModelContext()
+{
+    ModelManager::m_currentModel = m_previousModel;
 }
 }  // namespace Sapphire
@@ -0,0 +1,205 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Tests/BatchedGemmTest.hpp>
+#include <Sapphire/Tests/TestUtil.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/dense/naive/NaiveGemm.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+void TestBatchedGemm()
+{
+    const Device host("host");
+    const unsigned int sizes[][3] = { { 5, 7, 3 }, { 80, 40, 33 } };
+
+    for (const auto& size : sizes)
+    {
+        const auto M = size[0], N = size[1], K = size[2];
+        //! out (2, 4, 3, M, N) = a (2, 3, M, K) * b (1, 4, 1, K, N) + c (M, N)
+        TensorUtil::TensorData out(Shape({ 4, 3, M, N }), Type::Dense, host,
+                                   2);
+        TensorUtil::TensorData a(Shape({ 3, M, K }), Type::Dense, host, 2);
+        TensorUtil::TensorData b(Shape({ 4, 1, K, N }), Type::Dense, host, 1);
+        TensorUtil::TensorData c(Shape({ M, N }), Type::Dense, host, 1);
+        Fill(a, 1);
+        Fill(b, 2);
+        Fill(c, 3);
+
+        Compute::Gemm(out, a, b, c);
+
+        for (unsigned int n = 0; n < 2; ++n)
+            for (unsigned int i = 0; i < 4; ++i)
+                for (unsigned int j = 0; j < 3; ++j)
+                    for (unsigned int row = 0; row < M; ++row)
+                        for (unsigned int col = 0; col < N; ++col)
+                        {
+                            float expected = MatrixAt(c, 0, row, col);
+                            for (unsigned int k = 0; k < K; ++k)
+                                expected += MatrixAt(a, n * 3 + j, row, k) *
+                                            MatrixAt(b, i, k, col);
+                            CHECK(std::abs(MatrixAt(out, (n * 4 + i) * 3 + j,
+                                                    row, col) -
+                                           expected) < 1e-4f);
+                        }
+    }
+}
+
+void TestGemmSchedules()
+{
+    const Device host("host");
+    const unsigned int sizes[][3] = { { 3, 9, 4 }, { 37, 70, 300 } };
+    const unsigned int numMatrices = 6;
+
+    for (const auto& size : sizes)
+    {
+        const auto M = size[0], N = size[1], K = size[2];
+        TensorUtil::TensorData a(Shape({ numMatrices, M, K }), Type::Dense,
+                                 host, 1);
+        TensorUtil::TensorData b(Shape({ numMatrices, K, N }), Type::Dense,
+                                 host, 1);
+        TensorUtil::TensorData c(Shape({ numMatrices, M, N }), Type::Dense,
+                                 host, 1);
+        TensorUtil::TensorData out(Shape({ numMatrices, M, N }), Type::Dense,
+                                   host, 1);
+        Fill(a, 4);
+        Fill(b, 5);
+        Fill(c, 6);
+
+        Compute::Dense::Naive::GemmBatchShape shape;
+        shape.M = M;
+        shape.N = N;
+        shape.K = K;
+        shape.RowStrideA = a.PaddedHostColSize;
+        shape.ColStrideA = 1;
+        shape.RowStrideB = b.PaddedHostColSize;
+        shape.ColStrideB = 1;
+        shape.LdOut = out.PaddedHostColSize;
+        shape.LdC = c.PaddedHostColSize;
+
+        std::vector<float> expected;
+        for (unsigned int idx = 0; idx < numMatrices; ++idx)
+            for (unsigned int row = 0; row < M; ++row)
+                for (unsigned int col = 0; col < N; ++col)
+                {
+                    float sum = MatrixAt(c, idx, row, col);
+                    for (unsigned int k = 0; k < K; ++k)
+                        sum += MatrixAt(a, idx, row, k) *
+                               MatrixAt(b, idx, k, col);
+                    expected.emplace_back(sum);
+                }
+
+        const auto check = [&](const TensorUtil::TensorData& result) {
+            std::size_t pos = 0;
+            for (unsigned int idx = 0; idx < numMatrices; ++idx)
+                for (unsigned int row = 0; row < M; ++row)
+                    for (unsigned int col = 0; col < N; ++col)
+                        CHECK(std::abs(MatrixAt(result, idx, row, col) -
+                                       expected[pos++]) < 1e-3f);
+        };
+
+        for (auto schedule : { Compute::Dense::Naive::GemmSchedule::Batch,
+                               Compute::Dense::Naive::GemmSchedule::Matrix })
+        {
+            const auto matrixSize =
+                static_cast<std::size_t>(M) * out.PaddedHostColSize;
+            std::vector<Compute::Dense::Naive::GemmBatchEntry> entries(
+                numMatrices);
+            for (unsigned int idx = 0; idx < numMatrices; ++idx)
+            {
+                entries[idx].Out = out.DenseMatHost + idx * matrixSize;
+                entries[idx].A =
+                    a.DenseMatHost + idx * M * a.PaddedHostColSize;
+                entries[idx].B =
+                    b.DenseMatHost + idx * K * b.PaddedHostColSize;
+                entries[idx].C = c.DenseMatHost + idx * matrixSize;
+            }
+            Compute::Dense::Naive::BatchedGemm(shape, entries, schedule);
+            check(out);
+
+            //! c is accumulated in place
+            const auto inPlace = c.CreateCopy();
+            for (unsigned int idx = 0; idx < numMatrices; ++idx)
+            {
+                entries[idx].Out = inPlace.DenseMatHost + idx * matrixSize;
+                entries[idx].C = entries[idx].Out;
+            }
+            Compute::Dense::Naive::BatchedGemm(shape, entries, schedule);
+            check(inPlace);
+        }
+    }
+}
+
+void BenchmarkBatchedGemm()
+{
+    using Compute::Dense::Naive::GemmSchedule;
+    const auto numThreads = Util::ThreadPool::Global().NumThreads();
+
+    for (unsigned int batchSize : { 1, 8, 64, 512 })
+        for (unsigned int size : { 8, 32, 128, 256 })
+        {
+            //! Skips the sizes taking too long
+            if (static_cast<std::size_t>(batchSize) * size * size * size >
+                (std::size_t{ 1 } << 30))
+                continue;
+
+            std::vector<float> a(static_cast<std::size_t>(batchSize) * size *
+                                     size,
+                                 0.5f),
+                b(a.size(), 0.25f), out(a.size(), 0.0f);
+            Compute::Dense::Naive::GemmBatchShape shape;
+            shape.M = shape.N = shape.K = size;
+            shape.RowStrideA = shape.RowStrideB = size;
+            shape.ColStrideA = shape.ColStrideB = 1;
+            shape.LdOut = shape.LdC = size;
+
+            std::vector<Compute::Dense::Naive::GemmBatchEntry> entries(
+                batchSize);
+            for (unsigned int idx = 0; idx < batchSize; ++idx)
+            {
+                const auto offset =
+                    static_cast<std::size_t>(idx) * size * size;
+                entries[idx].Out = out.data() + offset;
+                entries[idx].A = a.data() + offset;
+                entries[idx].B = b.data() + offset;
+                entries[idx].C = out.data() + offset;
+            }
+
+            const auto flops =
+                2.0 * batchSize * static_cast<double>(size) * size * size;
+            std::cout << "BatchedGemm batch " << batchSize << " size " << size
+                      << " :";
+            for (auto schedule : { GemmSchedule::Batch, GemmSchedule::Matrix })
+            {
+                constexpr int iterations = 5;
+                const auto start = std::chrono::steady_clock::now();
+                for (int iteration = 0; iteration < iterations; ++iteration)
+                    Compute::Dense::Naive::BatchedGemm(shape, entries,
+                                                       schedule);
+                const auto elapsed = std::chrono::duration<double>(
+                                         std::chrono::steady_clock::now() -
+                                         start)
+                                         .count();
+                std::cout << " " << flops * iterations / elapsed * 1e-9
+                          << " GFLOP/s ("
+                          << (schedule == GemmSchedule::Batch ? "batch"
+                                                              : "matrix")
+                          << ")";
+            }
+            const auto chosen = Compute::Dense::Naive::ChooseGemmSchedule(
+                batchSize, size, size, size, numThreads);
+            std::cout << ", chooses "
+                      << (chosen == GemmSchedule::Batch ? "batch" : "matrix")
+                      << std::endl;
+        }
+}
+}  // namespace Sapphire::Test
@@ -15,6 +15,8 @@
 #include <cmath>
 #include <iostream>
 #include <random>
+#include <stdexcept>
+#include <vector>
 #include "doctest.h"
 
 namespace Sapphire::Test
@@ -261,4 +263,129 @@ void BroadcastMixed()
     Util::MemoryManager::ClearCudaMemoryPool();
     Util::MemoryManager::ClearHostMemoryPool();
 }
+
+namespace
+{
+//! Returns element of tensorData at position (batch, i, j, k) of the
+//! broadcast, where dimensions of size 1 are broadcast
+//! Shape of tensorData must have 3 dimensions
+float& BroadcastAt(const TensorUtil::TensorData& tensorData,
+                   unsigned int batch, unsigned int i, unsigned int j,
+                   unsigned int k)
+{
+    const auto& shape = tensorData.TensorShape;
+    const auto index = [](unsigned int pos, unsigned int size) {
+        return static_cast<std::size_t>(size == 1 ? 0 : pos);
+    };
+    return tensorData
+        .DenseMatHost[((index(batch, tensorData.BatchSize) * shape.At(0) +
+                        index(i, shape.At(0))) *
+                           shape.At(1) +
+                       index(j, shape.At(1))) *
+                          tensorData.PaddedHostColSize +
+                      index(k, shape.At(2))];
+}
+
+void FillBroadcast(const TensorUtil::TensorData& tensorData, float scale)
+{
+    for (unsigned long idx = 0; idx < tensorData.DenseTotalLengthHost; ++idx)
+        tensorData.DenseMatHost[idx] =
+            static_cast<float>(idx % 23) * scale - 1.0f;
+}
+}  // namespace
+
+void TestHostBroadcast()
+{
+    const Device host("host");
+    const unsigned int B = 3, M = 5, N = 19;
+
+    struct Case
+    {
+        Shape ShapeA;
+        unsigned int BatchA;
+        Shape ShapeB;
+        unsigned int BatchB;
+    };
+    //! Shapes are given with 3 dimensions so BroadcastAt can index them
+    const Case cases[] = {
+        //! Broadcast rows, as [B, 1, N] + [B, M, N]
+        { Shape({ 2, 1, N }), B, Shape({ 2, M, N }), B },
+        //! Broadcast columns
+        { Shape({ 2, M, 1 }), B, Shape({ 2, M, N }), B },
+        //! Broadcast batch and outer dimension on both sides
+        { Shape({ 1, M, N }), B, Shape({ 2, M, N }), 1 },
+        //! Broadcast scalar
+        { Shape({ 1, 1, 1 }), 1, Shape({ 2, M, N }), B },
+    };
+
+    for (const auto& testCase : cases)
+    {
+        TensorUtil::TensorData a(testCase.ShapeA, Type::Dense, host,
+                                 testCase.BatchA);
+        TensorUtil::TensorData b(testCase.ShapeB, Type::Dense, host,
+                                 testCase.BatchB);
+        TensorUtil::TensorData out(Shape({ 2, M, N }), Type::Dense, host, B);
+        FillBroadcast(a, 0.25f);
+        FillBroadcast(b, 0.5f);
+
+        for (int op = 0; op < 3; ++op)
+        {
+            if (op == 0)
+                Compute::Add(out, a, b);
+            else if (op == 1)
+                Compute::Sub(out, b, a);
+            else
+                Compute::Dot(out, a, b);
+
+            for (unsigned int batch = 0; batch < B; ++batch)
+                for (unsigned int i = 0; i < 2; ++i)
+                    for (unsigned int j = 0; j < M; ++j)
+                        for (unsigned int k = 0; k < N; ++k)
+                        {
+                            const float valueA =
+                                BroadcastAt(a, batch, i, j, k);
+                            const float valueB =
+                                BroadcastAt(b, batch, i, j, k);
+                            const float expected =
+                                op == 0   ? valueA + valueB
+                                : op == 1 ? valueB - valueA
+                                          : valueA * valueB;
+                            CHECK(BroadcastAt(out, batch, i, j, k) ==
+                                  expected);
+                        }
+        }
+    }
+
+    //! Sizes other than 1 must match
+    TensorUtil::TensorData a(Shape({ 3, M, N }), Type::Dense, host, 1);
+    TensorUtil::TensorData b(Shape({ 2, M, N }), Type::Dense, host, 1);
+    TensorUtil::TensorData out(Shape({ 3, M, N }), Type::Dense, host, 1);
+    CHECK_THROWS_AS(Compute::Add(out, a, b), std::invalid_argument);
+}
+
+void TestBroadcastAccumulation()
+{
+    const Device host("host");
+    const unsigned int B = 2, M = 6, N = 11;
+
+    TensorUtil::TensorData dy(Shape({ 3, M, N }), Type::Dense, host, B);
+    FillBroadcast(dy, 0.125f);
+
+    //! Gradient of the input broadcast along the batch, rows and columns
+    TensorUtil::TensorData da(Shape({ 3, 1, 1 }), Type::Dense, host, 1);
+    FillBroadcast(da, 1.0f);
+    std::vector<float> expected(3);
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        expected[i] = BroadcastAt(da, 0, i, 0, 0);
+        for (unsigned int batch = 0; batch < B; ++batch)
+            for (unsigned int j = 0; j < M; ++j)
+                for (unsigned int k = 0; k < N; ++k)
+                    expected[i] += BroadcastAt(dy, batch, i, j, k);
+    }
+
+    Compute::Add(da, dy, da);
+    for (unsigned int i = 0; i < 3; ++i)
+        CHECK(std::abs(BroadcastAt(da, 0, i, 0, 0) - expected[i]) < 1e-3f);
+}
 } // namespace Sapphire::Test
@@ -0,0 +1,209 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Tests/ConcurrentQueueTest.hpp>
+#include <Sapphire/util/ConcurrentQueue.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+//! Bounded queue guarded by a mutex for comparison
+template <typename T>
+class LockedQueue
+{
+ public:
+    explicit LockedQueue(std::size_t maxSize) : m_maxSize(maxSize)
+    {
+    }
+
+    void Push(T object)
+    {
+        std::unique_lock<std::mutex> lock(m_mtx);
+        m_pushCondVar.wait(lock,
+                           [this]() { return m_deque.size() < m_maxSize; });
+        m_deque.push_back(std::move(object));
+        m_popCondVar.notify_one();
+    }
+
+    T Pop()
+    {
+        std::unique_lock<std::mutex> lock(m_mtx);
+        m_popCondVar.wait(lock, [this]() { return !m_deque.empty(); });
+        T object = std::move(m_deque.front());
+        m_deque.pop_front();
+        m_pushCondVar.notify_one();
+        return object;
+    }
+
+ private:
+    std::size_t m_maxSize;
+    std::deque<T> m_deque;
+    std::mutex m_mtx;
+    std::condition_variable m_pushCondVar;
+    std::condition_variable m_popCondVar;
+};
+
+//! Runs producers pushing numbers from 1 to numElements each, and consumers
+//! popping them until every element is consumed
+//! \return : sum of every popped element
+template <typename Queue, typename PushFunc, typename PopFunc>
+static unsigned long RunProducerConsumer(Queue& queue, int numProducers,
+                                         int numConsumers,
+                                         unsigned long numElements,
+                                         PushFunc push, PopFunc pop)
+{
+    std::atomic<unsigned long> sum = 0;
+    std::atomic<unsigned long> remaining = numElements * numProducers;
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < numProducers; ++i)
+        threads.emplace_back([&]() {
+            for (unsigned long value = 1; value <= numElements; ++value)
+                push(queue, value);
+        });
+
+    for (int i = 0; i < numConsumers; ++i)
+        threads.emplace_back([&]() {
+            //! Each consumer pops its share, so blocking pop always returns
+            const auto share = numElements * numProducers / numConsumers;
+            unsigned long localSum = 0;
+            for (unsigned long count = 0; count < share; ++count)
+                localSum += pop(queue);
+            sum += localSum;
+            remaining -= share;
+        });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    CHECK(remaining == 0);
+    return sum;
+}
+
+void TestConcurrentQueueSingleThread()
+{
+    Util::ConcurrentQueue<int> queue(5);
+    CHECK(queue.Capacity() == 8);
+
+    for (int i = 0; i < 8; ++i)
+        CHECK(queue.TryPush(i));
+    CHECK(!queue.TryPush(8));
+    CHECK(queue.Size() == 8);
+
+    std::vector<int> popped(8);
+    CHECK(queue.TryPopN(popped.begin(), 3) == 3);
+    CHECK(popped[0] == 0);
+    CHECK(popped[2] == 2);
+
+    //! Batch push only fills free slots
+    const std::vector<int> values = { 10, 11, 12, 13, 14 };
+    CHECK(queue.TryPushN(values.begin(), values.size()) == 3);
+
+    CHECK(queue.TryPopN(popped.begin(), popped.size()) == 8);
+    CHECK(popped[0] == 3);
+    CHECK(popped[5] == 10);
+    CHECK(popped[7] == 12);
+    CHECK(!queue.TryPop());
+    CHECK(queue.Size() == 0);
+}
+
+void TestConcurrentQueueMultiThread()
+{
+    constexpr unsigned long numElements = 20000;
+    constexpr int numThreads = 4;
+    constexpr unsigned long expectedSum =
+        numThreads * numElements * (numElements + 1) / 2;
+
+    //! Small capacity makes both producers and consumers block
+    Util::ConcurrentQueue<unsigned long> queue(16);
+    const auto sum = RunProducerConsumer(
+        queue, numThreads, numThreads, numElements,
+        [](auto& queue, unsigned long value) { queue.Push(value); },
+        [](auto& queue) { return queue.Pop(); });
+    CHECK(sum == expectedSum);
+
+    //! Batch operations with a batch size which is not a divisor of the
+    //! number of elements
+    constexpr unsigned long batchSize = 7;
+    std::atomic<unsigned long> batchSum = 0;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; ++i)
+    {
+        threads.emplace_back([&]() {
+            std::vector<unsigned long> values(numElements);
+            for (unsigned long value = 0; value < numElements; ++value)
+                values[value] = value + 1;
+            for (unsigned long idx = 0; idx < numElements; idx += batchSize)
+                queue.PushN(values.begin() + idx,
+                            std::min(batchSize, numElements - idx));
+        });
+        threads.emplace_back([&]() {
+            std::vector<unsigned long> buffer(batchSize);
+            unsigned long count = 0, localSum = 0;
+            while (count < numElements)
+            {
+                const auto num = queue.PopN(
+                    buffer.begin(), std::min(batchSize, numElements - count));
+                for (unsigned long idx = 0; idx < num; ++idx)
+                    localSum += buffer[idx];
+                count += num;
+            }
+            batchSum += localSum;
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    CHECK(batchSum == expectedSum);
+    CHECK(queue.Size() == 0);
+}
+
+void BenchmarkConcurrentQueue()
+{
+    constexpr unsigned long numElements = 200000;
+    constexpr std::size_t capacity = 1024;
+
+    for (int numThreads : { 1, 2, 4, 8 })
+    {
+        const auto totalElements = numElements * numThreads;
+
+        Util::ConcurrentQueue<unsigned long> lockFreeQueue(capacity);
+        auto start = std::chrono::steady_clock::now();
+        RunProducerConsumer(
+            lockFreeQueue, numThreads, numThreads, numElements,
+            [](auto& queue, unsigned long value) { queue.Push(value); },
+            [](auto& queue) { return queue.Pop(); });
+        const auto lockFreeTime =
+            std::chrono::duration<double, std::nano>(
+                std::chrono::steady_clock::now() - start)
+                .count();
+
+        LockedQueue<unsigned long> lockedQueue(capacity);
+        start = std::chrono::steady_clock::now();
+        RunProducerConsumer(
+            lockedQueue, numThreads, numThreads, numElements,
+            [](auto& queue, unsigned long value) { queue.Push(value); },
+            [](auto& queue) { return queue.Pop(); });
+        const auto lockedTime = std::chrono::duration<double, std::nano>(
+                                    std::chrono::steady_clock::now() - start)
+                                    .count();
+
+        std::cout << "ConcurrentQueue " << numThreads << " producers, "
+                  << numThreads << " consumers : "
+                  << lockFreeTime / totalElements << " ns/element (lock-free), "
+                  << lockedTime / totalElements << " ns/element (mutex)"
+                  << std::endl;
+    }
+}
+}  // namespace Sapphire::Test
@@ -0,0 +1,216 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/Tests/ConvolutionTest.hpp>
+#include <Sapphire/Tests/TestUtil.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/operations/Forward/Conv2D.hpp>
+#include <cmath>
+#include <vector>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+namespace
+{
+struct ConvCase
+{
+    unsigned int N, C, H, W, K, R, S;
+    int StrideRow, StrideCol, DilationRow, DilationCol, PaddingRow,
+        PaddingCol;
+};
+
+void RunConvCase(const ConvCase& conv)
+{
+    const Device host("host");
+    const auto P = (conv.H + 2 * conv.PaddingRow -
+                    conv.DilationRow * (conv.R - 1) - 1) /
+                       conv.StrideRow +
+                   1;
+    const auto Q = (conv.W + 2 * conv.PaddingCol -
+                    conv.DilationCol * (conv.S - 1) - 1) /
+                       conv.StrideCol +
+                   1;
+
+    TensorUtil::TensorData x(Shape({ conv.C, conv.H, conv.W }), Type::Dense,
+                             host, conv.N);
+    TensorUtil::TensorData dx(Shape({ conv.C, conv.H, conv.W }), Type::Dense,
+                              host, conv.N);
+    TensorUtil::TensorData filter(Shape({ conv.K, conv.C, conv.R, conv.S }),
+                                  Type::Dense, host, 1);
+    TensorUtil::TensorData dFilter(Shape({ conv.K, conv.C, conv.R, conv.S }),
+                                   Type::Dense, host, 1);
+    TensorUtil::TensorData y(Shape({ conv.K, P, Q }), Type::Dense, host,
+                             conv.N);
+    TensorUtil::TensorData dy(Shape({ conv.K, P, Q }), Type::Dense, host,
+                              conv.N);
+    Compute::Initialize::Normal(x, 0, 1);
+    Compute::Initialize::Normal(filter, 0, 1);
+    Compute::Initialize::Normal(dy, 0, 1);
+    Compute::Initialize::Ones(dx);
+    Compute::Initialize::Ones(dFilter);
+
+    const auto filterAt = [&](unsigned int k, unsigned int c, unsigned int r,
+                              unsigned int s) -> float& {
+        return filter.DenseMatHost[((static_cast<std::size_t>(k) * conv.C +
+                                     c) *
+                                        conv.R +
+                                    r) *
+                                       filter.PaddedHostColSize +
+                                   s];
+    };
+
+    //! Reference results. Gradients are accumulated to ones
+    std::vector<float> expectedY(conv.N * conv.K * P * Q, 0.0f);
+    std::vector<float> expectedDx(conv.N * conv.C * conv.H * conv.W, 1.0f);
+    std::vector<float> expectedDFilter(conv.K * conv.C * conv.R * conv.S,
+                                       1.0f);
+    for (unsigned int n = 0; n < conv.N; ++n)
+        for (unsigned int k = 0; k < conv.K; ++k)
+            for (unsigned int p = 0; p < P; ++p)
+                for (unsigned int q = 0; q < Q; ++q)
+                    for (unsigned int c = 0; c < conv.C; ++c)
+                        for (unsigned int r = 0; r < conv.R; ++r)
+                            for (unsigned int s = 0; s < conv.S; ++s)
+                            {
+                                const int h = static_cast<int>(
+                                                  p * conv.StrideRow +
+                                                  r * conv.DilationRow) -
+                                              conv.PaddingRow;
+                                const int w = static_cast<int>(
+                                                  q * conv.StrideCol +
+                                                  s * conv.DilationCol) -
+                                              conv.PaddingCol;
+                                if (h < 0 || h >= static_cast<int>(conv.H) ||
+                                    w < 0 || w >= static_cast<int>(conv.W))
+                                    continue;
+
+                                const float xValue = ElementAt(x, n, c, h, w);
+                                const float dyValue = ElementAt(dy, n, k, p, q);
+                                expectedY[((n * conv.K + k) * P + p) * Q + q] +=
+                                    xValue * filterAt(k, c, r, s);
+                                expectedDx[((n * conv.C + c) * conv.H + h) *
+                                               conv.W +
+                                           w] += dyValue * filterAt(k, c, r, s);
+                                expectedDFilter[((k * conv.C + c) * conv.R +
+                                                 r) *
+                                                    conv.S +
+                                                s] += dyValue * xValue;
+                            }
+
+    Compute::Conv2DForward(y, x, filter, conv.StrideRow, conv.StrideCol,
+                           conv.DilationRow, conv.DilationCol,
+                           conv.PaddingRow, conv.PaddingCol);
+    Compute::Conv2DBackwardData(dx, filter, dy, conv.StrideRow,
+                                conv.StrideCol, conv.DilationRow,
+                                conv.DilationCol, conv.PaddingRow,
+                                conv.PaddingCol);
+    Compute::Conv2DBackwardFilter(dFilter, x, dy, conv.StrideRow,
+                                  conv.StrideCol, conv.DilationRow,
+                                  conv.DilationCol, conv.PaddingRow,
+                                  conv.PaddingCol);
+
+    CheckClose(y, expectedY, 1e-3f);
+    CheckClose(dx, expectedDx, 1e-3f);
+    //! Filter (K, C, R, S) is compared as (C, R, S) with batch K
+    dFilter.TensorShape = Shape({ conv.C, conv.R, conv.S });
+    dFilter.BatchSize = conv.K;
+    CheckClose(dFilter, expectedDFilter, 1e-3f);
+}
+//! Returns y = conv2d(x, filter) of 3x3 filter with unit stride and dilation
+std::vector<float> ReferenceConv3x3(const TensorUtil::TensorData& x,
+                                    const TensorUtil::TensorData& filter,
+                                    int padding)
+{
+    const auto N = static_cast<unsigned int>(x.BatchSize);
+    const auto C = x.TensorShape.At(0), H = x.TensorShape.At(1),
+               W = x.TensorShape.At(2), K = filter.TensorShape.At(0);
+    const auto P = H + 2 * padding - 2, Q = W + 2 * padding - 2;
+    std::vector<float> y(N * K * P * Q, 0.0f);
+    for (unsigned int n = 0; n < N; ++n)
+        for (unsigned int k = 0; k < K; ++k)
+            for (unsigned int p = 0; p < P; ++p)
+                for (unsigned int q = 0; q < Q; ++q)
+                    for (unsigned int c = 0; c < C; ++c)
+                        for (unsigned int r = 0; r < 3; ++r)
+                            for (unsigned int s = 0; s < 3; ++s)
+                            {
+                                const int h = static_cast<int>(p + r) - padding;
+                                const int w = static_cast<int>(q + s) - padding;
+                                if (h < 0 || h >= static_cast<int>(H) ||
+                                    w < 0 || w >= static_cast<int>(W))
+                                    continue;
+                                y[((n * K + k) * P + p) * Q + q] +=
+                                    ElementAt(x, n, c, h, w) *
+                                    filter.DenseMatHost
+                                        [((k * C + c) * 3 + r) *
+                                             filter.PaddedHostColSize +
+                                         s];
+                            }
+    return y;
+}
+}  // namespace
+
+void TestHostConvolution()
+{
+    //! Im2col with stride, dilation and padding
+    RunConvCase({ 2, 3, 9, 11, 5, 3, 2, 2, 1, 1, 2, 1, 2 });
+    //! 1x1 filter reads the input as columns directly
+    RunConvCase({ 2, 5, 4, 8, 3, 1, 1, 1, 1, 1, 1, 0, 0 });
+    //! Direct convolution with channels not multiple of 8
+    RunConvCase({ 2, 10, 8, 9, 9, 3, 3, 2, 2, 1, 1, 1, 1 });
+    //! Direct convolution with dilation and wide output
+    RunConvCase({ 1, 16, 7, 21, 16, 3, 3, 1, 1, 2, 2, 2, 2 });
+    //! Im2col spanning multiple blocks of the blocked GEMM
+    RunConvCase({ 1, 12, 20, 20, 80, 5, 5, 1, 1, 1, 1, 2, 2 });
+}
+
+void TestWinogradConvolution()
+{
+    const Device host("host");
+
+    //! F(4x4, 3x3) with partial tiles on the borders
+    RunConvCase({ 2, 64, 11, 13, 72, 3, 3, 1, 1, 1, 1, 1, 1 });
+    //! F(2x2, 3x3) is chosen for long sums over the channels
+    RunConvCase({ 1, 264, 6, 6, 64, 3, 3, 1, 1, 1, 1, 0, 0 });
+    //! F(2x2, 3x3) is chosen for outputs smaller than 4x4
+    RunConvCase({ 3, 64, 4, 5, 64, 3, 3, 1, 1, 1, 1, 0, 0 });
+
+    TensorUtil::TensorData x(Shape({ 64, 11, 13 }), Type::Dense, host, 2);
+    TensorUtil::TensorData filter(Shape({ 72, 64, 3, 3 }), Type::Dense, host,
+                                  1);
+    TensorUtil::TensorData y(Shape({ 72, 11, 13 }), Type::Dense, host, 2);
+    CHECK(Compute::GetWinogradTileSize(x, filter, y, 1, 1, 1, 1, 1, 1) == 4);
+
+    ModelManager::AddModel("WinogradConvolution");
+    ModelContext context("WinogradConvolution");
+    Model& model = ModelManager::GetCurrentModel();
+    NoGradGuard noGrad;
+
+    const NN::Conv2D conv(64, 72, { 3, 3 }, host, { 1, 1 }, { 1, 1 },
+                          { 1, 1 });
+    const auto weight = model.GetParameters().at(0).Data;
+    const int xKey = model.RegisterTensorDescriptor(
+        Shape({ 64, 11, 13 }), Type::Dense, host, 2, true);
+    const auto& input = model.GetDescriptor(xKey).ForwardData;
+    Compute::Initialize::Normal(input, 0, 1);
+
+    //! Transformed weight is cached by the first call and reused afterwards
+    const Tensor first = conv(Tensor(Shape({ 64, 11, 13 }), xKey));
+    CheckClose(model.GetDescriptor(first.TensorDescriptorKey()).ForwardData,
+               ReferenceConv3x3(input, weight, 1), 1e-3f);
+
+    //! Updating the weight invalidates the cached transform
+    Compute::Initialize::Normal(weight, 0, 1);
+    const Tensor second = conv(Tensor(Shape({ 64, 11, 13 }), xKey));
+    CheckClose(model.GetDescriptor(second.TensorDescriptorKey()).ForwardData,
+               ReferenceConv3x3(input, weight, 1), 1e-3f);
+
+    ModelManager::ClearModels();
+}
+}  // namespace Sapphire::Test
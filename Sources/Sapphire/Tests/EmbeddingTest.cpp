@@ -0,0 +1,154 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/Tests/EmbeddingTest.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/operations/Forward/Embedding.hpp>
+#include <Sapphire/operations/Optimizer/Optimizer.hpp>
+#include <cmath>
+#include <vector>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+void TestEmbeddingKernels()
+{
+    const Device host("host");
+    const unsigned int numEmbeddings = 37, embeddingSize = 19;
+    const unsigned int count = 300;
+
+    TensorUtil::TensorData table(Shape({ numEmbeddings, embeddingSize }),
+                                 Type::Dense, host, 1);
+    Compute::Initialize::Normal(table, 0, 1);
+
+    //! Indices are repeated so several gradients fall on the same row
+    std::vector<std::size_t> indices(count);
+    for (unsigned int idx = 0; idx < count; ++idx)
+        indices[idx] = (idx * 7 + idx / 5) % numEmbeddings;
+
+    TensorUtil::TensorData y(Shape({ count, embeddingSize }), Type::Dense,
+                             host, 1);
+    Compute::EmbeddingForward(y, table, indices);
+    for (unsigned int idx = 0; idx < count; ++idx)
+        for (unsigned int col = 0; col < embeddingSize; ++col)
+            CHECK(y.DenseMatHost[idx * y.PaddedHostColSize + col] ==
+                  table.DenseMatHost[indices[idx] * table.PaddedHostColSize +
+                                     col]);
+
+    TensorUtil::TensorData dy(Shape({ count, embeddingSize }), Type::Dense,
+                              host, 1);
+    for (unsigned int idx = 0; idx < count; ++idx)
+        for (unsigned int col = 0; col < embeddingSize; ++col)
+            dy.DenseMatHost[idx * dy.PaddedHostColSize + col] =
+                static_cast<float>((idx + col) % 11) * 0.25f - 1.0f;
+
+    std::vector<float> expected(numEmbeddings * embeddingSize, 0.0f);
+    for (unsigned int idx = 0; idx < count; ++idx)
+        for (unsigned int col = 0; col < embeddingSize; ++col)
+            expected[indices[idx] * embeddingSize + col] +=
+                dy.DenseMatHost[idx * dy.PaddedHostColSize + col];
+
+    //! Second backward pass accumulates on the rows added by the first one
+    RowGradient gradient;
+    gradient.RowSize = embeddingSize;
+    Compute::EmbeddingBackward(gradient, dy, indices);
+    Compute::EmbeddingBackward(gradient, dy, indices);
+
+    CHECK(gradient.Indices.size() == numEmbeddings);
+    CHECK(gradient.Rows.size() == gradient.Indices.size() * embeddingSize);
+    for (std::size_t pos = 0; pos < gradient.Indices.size(); ++pos)
+        for (unsigned int col = 0; col < embeddingSize; ++col)
+            CHECK(std::abs(gradient.Rows[pos * embeddingSize + col] -
+                           2.0f * expected[gradient.Indices[pos] *
+                                               embeddingSize +
+                                           col]) < 1e-4f);
+
+    std::vector<std::size_t> outOfRange = { numEmbeddings };
+    TensorUtil::TensorData single(Shape({ 1, embeddingSize }), Type::Dense,
+                                  host, 1);
+    CHECK_THROWS_AS(Compute::EmbeddingForward(single, table, outOfRange),
+                    std::out_of_range);
+}
+
+void TestEmbeddingSparseUpdate()
+{
+    const Device host("host");
+    const unsigned int numEmbeddings = 20, embeddingSize = 12;
+    const unsigned int batchSize = 2, length = 3;
+    const float learningRate = 0.5f;
+    ModelManager::AddModel("EmbeddingSparseUpdate");
+    ModelContext context("EmbeddingSparseUpdate");
+    Model& model = ModelManager::GetCurrentModel();
+
+    const NN::Embedding embedding(numEmbeddings, embeddingSize, host);
+    //! Table has no dense gradient
+    CHECK(model.GetParameters().empty());
+    const auto rowParameters = model.GetRowParameters();
+    REQUIRE(rowParameters.size() == 1);
+    const auto& table = rowParameters[0].Data;
+    const auto& gradient = *rowParameters[0].Gradient;
+
+    const int xKey = model.RegisterTensorDescriptor(
+        Shape({ length }), Type::Dense, host, batchSize, true);
+    const auto xData = model.GetDescriptor(xKey).ForwardData;
+    const float indices[batchSize][length] = { { 3, 7, 3 }, { 15, 3, 7 } };
+    for (unsigned int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+        for (unsigned int i = 0; i < length; ++i)
+            xData.DenseMatHost[batchIdx * xData.PaddedHostColSize + i] =
+                indices[batchIdx][i];
+
+    const std::vector<float> before(
+        table.DenseMatHost, table.DenseMatHost + table.DenseTotalLengthHost);
+
+    const auto y = embedding(Tensor(Shape({ length }), xKey));
+    const auto& yData = model.GetDescriptor(y.TensorDescriptorKey())
+                            .ForwardData;
+    CHECK(yData.TensorShape == Shape({ length, embeddingSize }));
+    for (unsigned int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+        for (unsigned int i = 0; i < length; ++i)
+            for (unsigned int col = 0; col < embeddingSize; ++col)
+                CHECK(yData.DenseMatHost[(batchIdx * length + i) *
+                                             yData.PaddedHostColSize +
+                                         col] ==
+                      before[static_cast<std::size_t>(indices[batchIdx][i]) *
+                                 table.PaddedHostColSize +
+                             col]);
+
+    //! Gradient of each row is the number of times it has been gathered
+    model.Backward(y);
+    CHECK(gradient.Indices.size() == 3);
+    std::vector<float> counts(numEmbeddings, 0.0f);
+    counts[3] = 3.0f;
+    counts[7] = 2.0f;
+    counts[15] = 1.0f;
+    for (std::size_t pos = 0; pos < gradient.Indices.size(); ++pos)
+        for (unsigned int col = 0; col < embeddingSize; ++col)
+            CHECK(gradient.Rows[pos * embeddingSize + col] ==
+                  counts[gradient.Indices[pos]]);
+
+    //! Only the gathered rows are updated, and the row gradients are cleared
+    NN::SGD optimizer(learningRate);
+    optimizer.Step();
+    for (unsigned int row = 0; row < numEmbeddings; ++row)
+        for (unsigned int col = 0; col < embeddingSize; ++col)
+        {
+            const auto idx = row * table.PaddedHostColSize + col;
+            CHECK(table.DenseMatHost[idx] ==
+                  before[idx] - learningRate * counts[row]);
+        }
+    CHECK(gradient.Indices.empty());
+    CHECK(gradient.Rows.empty());
+
+    model.Backward(embedding(Tensor(Shape({ length }), xKey)));
+    CHECK(!gradient.Indices.empty());
+    model.ZeroGrad();
+    CHECK(gradient.Indices.empty());
+
+    ModelManager::ClearModels();
+}
+}  // namespace Sapphire::Test
@@ -0,0 +1,150 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Tests/HalfPrecisionTest.hpp>
+#include <Sapphire/Tests/TestUtil.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/compute/dense/naive/NaiveHalf.hpp>
+#include <Sapphire/tensor/TensorData.hpp>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+void TestHalfConversion()
+{
+    //! Size is not a multiple of 8 to test both vector and scalar paths
+    const std::vector<float> input = { 1.0f,    -2.0f,  65504.0f, 1e5f,
+                                       0.0f,    0.5f,   1.0f / 3, 3.0f,
+                                       -1e-8f,  1.5f,   2.0f,     -0.25f,
+                                       1024.0f, 7.0f,   -7.5f,    100.0f,
+                                       0.125f,  -1.0f,  5.0f };
+    const auto size = static_cast<unsigned long>(input.size());
+    std::vector<std::uint16_t> half(size);
+    std::vector<std::uint16_t> bfloat(size);
+    std::vector<float> output(size);
+
+    Compute::Dense::Naive::ConvertFromFloat(half.data(), input.data(), size,
+                                            DataType::Float16);
+    Compute::Dense::Naive::ConvertFromFloat(bfloat.data(), input.data(), size,
+                                            DataType::BFloat16);
+    CHECK(half[0] == 0x3c00);
+    CHECK(half[1] == 0xc000);
+    CHECK(half[2] == 0x7bff);
+    CHECK(half[3] == 0x7c00);
+    CHECK(half[8] == 0x8000);
+    CHECK(bfloat[0] == 0x3f80);
+    CHECK(bfloat[1] == 0xc000);
+
+    Compute::Dense::Naive::ConvertToFloat(output.data(), half.data(), size,
+                                          DataType::Float16);
+    for (unsigned long i = 0; i < size; ++i)
+        if (std::isfinite(output[i]))
+            CHECK(std::abs(output[i] - input[i]) <=
+                  std::abs(input[i]) / 1024.0f + 1e-7f);
+
+    Compute::Dense::Naive::ConvertToFloat(output.data(), bfloat.data(), size,
+                                          DataType::BFloat16);
+    for (unsigned long i = 0; i < size; ++i)
+        CHECK(std::abs(output[i] - input[i]) <= std::abs(input[i]) / 128.0f);
+}
+
+void TestHalfGemm()
+{
+    const Device host("host");
+    const unsigned int M = 5, N = 12, K = 20;
+    TensorUtil::TensorData a(Shape({ M, K }), Type::Dense, host, 2);
+    TensorUtil::TensorData b(Shape({ K, N }), Type::Dense, host, 2);
+    TensorUtil::TensorData c(Shape({ M, N }), Type::Dense, host, 2);
+    TensorUtil::TensorData expected(Shape({ M, N }), Type::Dense, host, 2);
+    TensorUtil::TensorData out(Shape({ M, N }), Type::Dense, host, 2);
+    FillSmallIntegers(a);
+    FillSmallIntegers(b);
+    FillSmallIntegers(c);
+    Compute::Gemm(expected, a, b, c);
+
+    for (auto dataType : { DataType::Float16, DataType::BFloat16 })
+    {
+        const auto halfA = a.ConvertTo(dataType);
+        const auto halfB = b.ConvertTo(dataType);
+        CHECK(halfA.GetDataType() == dataType);
+
+        //! Products of small integers are accumulated in float without error
+        Compute::Initialize::Zeros(out);
+        Compute::Gemm(out, halfA, halfB, c);
+        for (unsigned int i = 0; i < M * 2; ++i)
+            for (unsigned int j = 0; j < N; ++j)
+                CHECK(out.DenseMatHost[i * out.PaddedHostColSize + j] ==
+                      expected.DenseMatHost[i * out.PaddedHostColSize + j]);
+    }
+}
+
+void TestHalfElementWise()
+{
+    const Device host("host");
+    TensorUtil::TensorData a(Shape({ 3, 11 }), Type::Dense, host, 2);
+    FillSmallIntegers(a);
+
+    for (auto dataType : { DataType::Float16, DataType::BFloat16 })
+    {
+        const auto halfA = a.ConvertTo(dataType);
+        auto sum = halfA.CreateCopy();
+        auto scaled = halfA.CreateCopy();
+        Compute::Add(sum, halfA, halfA);
+        Compute::Scale(scaled, halfA, 2.0f);
+
+        const auto sumFloat = sum.ConvertTo(DataType::Float32);
+        const auto scaledFloat = scaled.ConvertTo(DataType::Float32);
+        for (unsigned int i = 0; i < a.DenseTotalLengthHost; ++i)
+        {
+            CHECK(sumFloat.DenseMatHost[i] == 2 * a.DenseMatHost[i]);
+            CHECK(scaledFloat.DenseMatHost[i] == 2 * a.DenseMatHost[i]);
+        }
+    }
+
+    //! Mixing data types is not allowed
+    auto halfA = a.ConvertTo(DataType::Float16);
+    CHECK_THROWS_AS(Compute::Add(halfA, halfA, a), std::invalid_argument);
+}
+
+void TestNonFloat32Rejected()
+{
+    const Device host("host");
+    TensorUtil::TensorData a(Shape({ 4, 4 }), Type::Dense, host, 2);
+    TensorUtil::TensorData out(Shape({ 4, 4 }), Type::Dense, host, 2);
+    FillSmallIntegers(a);
+
+    //! Kernels without a dispatch for the data type must not run on it
+    for (auto dataType :
+         { DataType::Float16, DataType::BFloat16, DataType::Int8 })
+    {
+        auto converted = a.ConvertTo(dataType);
+        CHECK_THROWS_AS(Compute::Gemm(converted, a, a, a),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(Compute::Pow(out, converted, 2.0f),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(Compute::ReLU(converted, a), std::invalid_argument);
+        CHECK_THROWS_AS(Compute::Softmax(out, converted),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(Compute::Mean(out, converted), std::invalid_argument);
+        CHECK_THROWS_AS(Compute::Reshape(out, converted),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(Compute::Transpose(out, converted),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(Compute::Initialize::Normal(converted, 0.0f, 1.0f),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(Compute::Initialize::Uniform(converted, 0.0f, 1.0f),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(Compute::Initialize::Ones(converted),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(Compute::Initialize::Zeros(converted),
+                        std::invalid_argument);
+    }
+}
+}  // namespace Sapphire::Test
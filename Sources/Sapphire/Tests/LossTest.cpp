@@ -0,0 +1,167 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/Tests/LossTest.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/operations/Loss/CrossEntropy.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+namespace
+{
+//! Returns log(sum(exp(row))) computed in double precision
+double ReferenceLogSumExp(const float* row, unsigned int cols)
+{
+    double max = row[0];
+    for (unsigned int col = 1; col < cols; ++col)
+        max = std::max(max, static_cast<double>(row[col]));
+    double sum = 0.0;
+    for (unsigned int col = 0; col < cols; ++col)
+        sum += std::exp(row[col] - max);
+    return max + std::log(sum);
+}
+}  // namespace
+
+void TestCrossEntropyKernels()
+{
+    const Device host("host");
+    for (unsigned int cols : { 1u, 5u, 8u, 19u, 100u })
+    {
+        const unsigned int rows = 7, batchSize = 3;
+        TensorUtil::TensorData x(Shape({ rows, cols }), Type::Dense, host,
+                                 batchSize);
+        Compute::Initialize::Normal(x, 0, 4);
+        //! Large logits overflow exp unless the maximum is subtracted
+        x.DenseMatHost[0] = 1000.0f;
+        x.DenseMatHost[x.PaddedHostColSize] = -1000.0f;
+
+        const std::size_t numRows = rows * batchSize;
+        std::vector<std::size_t> labels(numRows);
+        for (std::size_t row = 0; row < numRows; ++row)
+            labels[row] = (row * 7) % cols;
+
+        TensorUtil::TensorData loss(Shape({ 1 }), Type::Dense, host, 1);
+        std::vector<float> logSumExp;
+        Compute::CrossEntropyForward(loss, x, labels, &logSumExp);
+        REQUIRE(logSumExp.size() == numRows);
+
+        double expected = 0.0;
+        for (std::size_t row = 0; row < numRows; ++row)
+        {
+            const float* input = x.DenseMatHost + row * x.PaddedHostColSize;
+            const double rowLogSumExp = ReferenceLogSumExp(input, cols);
+            CHECK(std::abs(logSumExp[row] - rowLogSumExp) <
+                  1e-4 * (1.0 + std::abs(rowLogSumExp)));
+            expected += rowLogSumExp - input[labels[row]];
+        }
+        expected /= static_cast<double>(numRows);
+        CHECK(std::isfinite(loss.DenseMatHost[0]));
+        CHECK(std::abs(loss.DenseMatHost[0] - expected) <
+              1e-4 * (1.0 + std::abs(expected)));
+
+        //! Gradient is accumulated on dx
+        TensorUtil::TensorData dy(Shape({ 1 }), Type::Dense, host, 1);
+        Compute::Initialize::Ones(dy);
+        TensorUtil::TensorData dx(x.TensorShape, Type::Dense, host,
+                                  batchSize);
+        Compute::Initialize::Ones(dx);
+        Compute::CrossEntropyBackward(dx, dy, x, labels, logSumExp);
+        for (std::size_t row = 0; row < numRows; ++row)
+        {
+            const float* input = x.DenseMatHost + row * x.PaddedHostColSize;
+            const double rowLogSumExp = ReferenceLogSumExp(input, cols);
+            for (unsigned int col = 0; col < cols; ++col)
+            {
+                const double gradient =
+                    (std::exp(input[col] - rowLogSumExp) -
+                     (col == labels[row] ? 1.0 : 0.0)) /
+                    static_cast<double>(numRows);
+                CHECK(std::abs(dx.DenseMatHost[row * dx.PaddedHostColSize +
+                                               col] -
+                               (1.0 + gradient)) < 1e-5);
+            }
+        }
+    }
+
+    TensorUtil::TensorData x(Shape({ 2, 4 }), Type::Dense, host, 1);
+    TensorUtil::TensorData loss(Shape({ 1 }), Type::Dense, host, 1);
+    const std::vector<std::size_t> outOfRange = { 0, 4 };
+    CHECK_THROWS_AS(Compute::CrossEntropyForward(loss, x, outOfRange),
+                    std::out_of_range);
+    const std::vector<std::size_t> tooFew = { 0 };
+    CHECK_THROWS_AS(Compute::CrossEntropyForward(loss, x, tooFew),
+                    std::invalid_argument);
+}
+
+void TestCrossEntropyGradient()
+{
+    const Device host("host");
+    const unsigned int numClasses = 6, batchSize = 4;
+    ModelManager::AddModel("CrossEntropyGradient");
+    ModelContext context("CrossEntropyGradient");
+    Model& model = ModelManager::GetCurrentModel();
+
+    const int xKey = model.RegisterTensorDescriptor(
+        Shape({ numClasses }), Type::Dense, host, batchSize, true);
+    const int labelKey = model.RegisterTensorDescriptor(
+        Shape({ 1 }), Type::Dense, host, batchSize, false);
+    const auto xData = model.GetDescriptor(xKey).ForwardData;
+    const auto labelData = model.GetDescriptor(labelKey).ForwardData;
+    Compute::Initialize::Normal(xData, 0, 1);
+    const float labels[batchSize] = { 0, 5, 2, 5 };
+    for (unsigned int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+        labelData.DenseMatHost[batchIdx * labelData.PaddedHostColSize] =
+            labels[batchIdx];
+
+    const auto loss = NN::Loss::CrossEntropy(
+        Tensor(Shape({ numClasses }), xKey), Tensor(Shape({ 1 }), labelKey));
+    const auto& lossData =
+        model.GetDescriptor(loss.TensorDescriptorKey()).ForwardData;
+    CHECK(lossData.TensorShape == Shape({ 1 }));
+
+    model.Backward(loss);
+    const auto& dx = model.GetDescriptor(xKey).BackwardData;
+    double expected = 0.0;
+    for (unsigned int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+    {
+        const float* input =
+            xData.DenseMatHost + batchIdx * xData.PaddedHostColSize;
+        const double rowLogSumExp = ReferenceLogSumExp(input, numClasses);
+        const auto label = static_cast<unsigned int>(labels[batchIdx]);
+        expected += rowLogSumExp - input[label];
+
+        //! Each row of the gradient sums to zero
+        double rowSum = 0.0;
+        for (unsigned int col = 0; col < numClasses; ++col)
+        {
+            const float gradient =
+                dx.DenseMatHost[batchIdx * dx.PaddedHostColSize + col];
+            const double reference =
+                (std::exp(input[col] - rowLogSumExp) -
+                 (col == label ? 1.0 : 0.0)) /
+                batchSize;
+            CHECK(std::abs(gradient - reference) < 1e-6);
+            rowSum += gradient;
+        }
+        CHECK(std::abs(rowSum) < 1e-6);
+    }
+    CHECK(std::abs(lossData.DenseMatHost[0] - expected / batchSize) < 1e-5);
+
+    //! Labels must be class indices
+    labelData.DenseMatHost[0] = 0.5f;
+    CHECK_THROWS_AS(NN::Loss::CrossEntropy(Tensor(Shape({ numClasses }), xKey),
+                                           Tensor(Shape({ 1 }), labelKey)),
+                    std::invalid_argument);
+
+    ModelManager::ClearModels();
+}
+}  // namespace Sapphire::Test
@@ -0,0 +1,377 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Interface/IndexingInterfaceDecl.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/Tests/ModelTest.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/operations/Backward/BackPropWrapper.hpp>
+#include <Sapphire/operations/Forward/Checkpoint.hpp>
+#include <Sapphire/operations/Forward/Linear.hpp>
+#include <Sapphire/util/MemoryManager.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+//! Builds a replica on the current model and returns its outputs
+static std::vector<float> RunReplica(unsigned int numIterations)
+{
+    const Device host("host");
+    const unsigned int batchSize = 4, inputs = 40, outputs = 24;
+    Model& model = ModelManager::GetCurrentModel();
+
+    const NN::Linear linear(inputs, outputs, host);
+    //! Linear unit is the first unit registered on the model
+    auto wrapper = model.GetUnitDataWrapper(0);
+    auto& weight = wrapper.TensorDataMap["weight"];
+    auto& bias = wrapper.TensorDataMap["bias"];
+    for (unsigned int i = 0; i < inputs; ++i)
+        for (unsigned int j = 0; j < outputs; ++j)
+            weight.DenseMatHost[i * weight.PaddedHostColSize + j] =
+                static_cast<float>((i * 7 + j * 3) % 11) - 5.0f;
+    for (unsigned int j = 0; j < outputs; ++j)
+        bias.DenseMatHost[j] = static_cast<float>(j);
+
+    const int xKey = model.RegisterTensorDescriptor(
+        Shape({ inputs }), Type::Dense, host, batchSize, true);
+    auto& x = model.GetDescriptor(xKey).ForwardData;
+    for (unsigned int i = 0; i < batchSize; ++i)
+        for (unsigned int j = 0; j < inputs; ++j)
+            x.DenseMatHost[i * x.PaddedHostColSize + j] =
+                static_cast<float>((i + j) % 5);
+
+    std::vector<float> result;
+    for (unsigned int iteration = 0; iteration < numIterations; ++iteration)
+    {
+        const Tensor y = linear(Tensor(Shape({ inputs }), xKey));
+        const auto& yData = model.GetDescriptor(y.TensorDescriptorKey())
+                                .ForwardData;
+        result.clear();
+        for (unsigned int i = 0; i < batchSize; ++i)
+            for (unsigned int j = 0; j < outputs; ++j)
+                result.emplace_back(
+                    yData.DenseMatHost[i * yData.PaddedHostColSize + j]);
+    }
+    return result;
+}
+
+void TestConcurrentModels()
+{
+    const unsigned int numReplicas = 4, numIterations = 20;
+
+    ModelManager::AddModel("ReplicaReference");
+    ModelContext context("ReplicaReference");
+    const auto expected = RunReplica(1);
+
+    std::vector<std::vector<float>> results(numReplicas);
+    std::vector<std::string> currentNames(numReplicas);
+    std::vector<std::thread> threads;
+    for (unsigned int idx = 0; idx < numReplicas; ++idx)
+        threads.emplace_back([&, idx]() {
+            const auto name = "Replica" + std::to_string(idx);
+            ModelManager::AddModel(name);
+            ModelContext context(name);
+            results[idx] = RunReplica(numIterations);
+            currentNames[idx] = ModelManager::GetCurrentModel().Name();
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    //! Contexts of the other threads do not change the model of this thread
+    CHECK(ModelManager::GetCurrentModel().Name() == "ReplicaReference");
+
+    //! New thread does not inherit the model of this thread
+    bool isThrown = false;
+    std::thread([&isThrown]() {
+        try
+        {
+            ModelManager::GetCurrentModel();
+        }
+        catch (const std::runtime_error&)
+        {
+            isThrown = true;
+        }
+    }).join();
+    CHECK(isThrown);
+
+    for (unsigned int idx = 0; idx < numReplicas; ++idx)
+    {
+        CHECK(currentNames[idx] == "Replica" + std::to_string(idx));
+        CHECK(results[idx] == expected);
+    }
+
+    ModelManager::ClearModels();
+}
+
+//! Passes gradient of the sum to every operand
+class SumBackProp : public BackProp::BackPropWrapper
+{
+ public:
+    SumBackProp(std::vector<TensorUtil::TensorData> gradientOutputs,
+                TensorUtil::TensorData dy)
+        : BackPropWrapper(std::move(gradientOutputs), { std::move(dy) })
+    {
+    }
+
+    bool InvokeBackProp(const TensorUtil::TensorData& input) override
+    {
+        for (auto& gradient : m_gradientOutputs)
+            Compute::Add(gradient, gradient, m_gradientInputs[0]);
+        return true;
+    }
+};
+
+void TestParallelBackward()
+{
+    const Device host("host");
+    const unsigned int numBranches = 8, batchSize = 3, inputs = 20,
+                       outputs = 12;
+    ModelManager::AddModel("ParallelBackward");
+    ModelContext context("ParallelBackward");
+    Model& model = ModelManager::GetCurrentModel();
+
+    const int xKey = model.RegisterTensorDescriptor(
+        Shape({ inputs }), Type::Dense, host, batchSize, true);
+    const Tensor x(Shape({ inputs }), xKey);
+
+    //! Every branch shares x, so gradients of x are accumulated concurrently
+    std::vector<float> expected(inputs, 0.0f);
+    std::vector<NN::Linear> branches;
+    std::vector<TensorUtil::TensorData> gradients;
+    std::vector<int> branchKeys;
+    for (unsigned int idx = 0; idx < numBranches; ++idx)
+    {
+        branches.emplace_back(inputs, outputs, host);
+        auto weight = model.GetUnitDataWrapper(static_cast<int>(idx))
+                          .TensorDataMap["weight"];
+        for (unsigned int i = 0; i < inputs; ++i)
+            for (unsigned int j = 0; j < outputs; ++j)
+            {
+                const float value =
+                    static_cast<float>((idx + i * 3 + j) % 7) * 0.25f - 0.75f;
+                weight.DenseMatHost[i * weight.PaddedHostColSize + j] = value;
+                expected[i] += value;
+            }
+
+        const Tensor y = branches.back()(x);
+        branchKeys.emplace_back(y.TensorDescriptorKey());
+        gradients.emplace_back(
+            model.GetDescriptor(y.TensorDescriptorKey()).BackwardData);
+    }
+
+    const int sumKey = model.RegisterTensorDescriptor(
+        Shape({ outputs }), Type::Dense, host, batchSize, true);
+    auto& sumDesc = model.GetDescriptor(sumKey);
+    for (auto key : branchKeys)
+        model.GetDescriptor(key).AppendOperandHistory(sumKey);
+    sumDesc.AppendOutputHistory(
+        std::make_unique<SumBackProp>(gradients, sumDesc.BackwardData), false);
+
+    model.Backward(Tensor(Shape({ outputs }), sumKey));
+
+    const auto& dx = model.GetDescriptor(xKey).BackwardData;
+    for (unsigned int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+        for (unsigned int i = 0; i < inputs; ++i)
+            CHECK(std::abs(dx.DenseMatHost[batchIdx * dx.PaddedHostColSize +
+                                           i] -
+                           expected[i]) < 1e-4f);
+    //! Every history is consumed
+    CHECK(!model.GetDescriptor(xKey).IsBackPropReady());
+    CHECK(!sumDesc.IsBackPropReady());
+
+    ModelManager::ClearModels();
+}
+
+void TestDeepBackward()
+{
+    const Device host("host");
+    const unsigned int depth = 20000;
+    ModelManager::AddModel("DeepBackward");
+    ModelContext context("DeepBackward");
+    Model& model = ModelManager::GetCurrentModel();
+
+    const int xKey = model.RegisterTensorDescriptor(Shape({ 4, 8 }),
+                                                    Type::Dense, host, 1, true);
+    int yKey = xKey;
+    for (unsigned int idx = 0; idx < depth; ++idx)
+        yKey = Reshape(Tensor(Shape({ 4, 8 }), yKey), Shape({ 4, 8 }))
+                   .TensorDescriptorKey();
+
+    model.Backward(Tensor(Shape({ 4, 8 }), yKey));
+
+    //! Views share the gradient buffer with x
+    const auto& dx = model.GetDescriptor(xKey).BackwardData;
+    for (unsigned int i = 0; i < 4; ++i)
+        for (unsigned int j = 0; j < 8; ++j)
+            CHECK(dx.DenseMatHost[i * dx.PaddedHostColSize + j] == 1.0f);
+    CHECK(!model.GetDescriptor(xKey).IsBackPropReady());
+
+    ModelManager::ClearModels();
+}
+
+void TestNoGrad()
+{
+    const Device host("host");
+    const unsigned int batchSize = 16, inputs = 64, outputs = 64;
+    ModelManager::AddModel("NoGrad");
+    ModelContext context("NoGrad");
+    Model& model = ModelManager::GetCurrentModel();
+
+    const NN::Linear linear(inputs, outputs, host);
+    const int xKey = model.RegisterTensorDescriptor(
+        Shape({ inputs }), Type::Dense, host, batchSize, true);
+    const Tensor x(Shape({ inputs }), xKey);
+
+    const auto initialBytes = Util::MemoryManager::GetAllocatedByteSizeHost();
+    const Tensor y = linear(x);
+    const auto gradBytes =
+        Util::MemoryManager::GetAllocatedByteSizeHost() - initialBytes;
+    CHECK(model.GetDescriptor(xKey).IsBackPropReady() == false);
+    CHECK(model.GetDescriptor(y.TensorDescriptorKey()).IsBackPropReady());
+
+    NoGradGuard guard;
+    const auto noGradInitialBytes =
+        Util::MemoryManager::GetAllocatedByteSizeHost();
+    const Tensor inferred = Reshape(linear(x), Shape({ 1, outputs }));
+    const auto noGradBytes =
+        Util::MemoryManager::GetAllocatedByteSizeHost() - noGradInitialBytes;
+
+    //! Only the forward output is allocated, without gradient and saved input
+    const auto& inferredDesc =
+        model.GetDescriptor(inferred.TensorDescriptorKey());
+    CHECK(inferredDesc.BackwardData.DenseMatHost == nullptr);
+    CHECK(!inferredDesc.IsBackPropReady());
+    CHECK(noGradBytes * 2 == gradBytes);
+
+    {
+        //! Guards can be nested, and the previous mode is restored
+        NoGradGuard nestedGuard;
+        CHECK(!GradMode::IsEnabled());
+    }
+    CHECK(!GradMode::IsEnabled());
+
+    ModelManager::ClearModels();
+}
+
+void TestSavedTensor()
+{
+    const Device host("host");
+    const unsigned int batchSize = 16, inputs = 64, outputs = 64;
+    ModelManager::AddModel("SavedTensor");
+    ModelContext context("SavedTensor");
+    Model& model = ModelManager::GetCurrentModel();
+
+    const NN::Linear linear(inputs, outputs, host);
+    const int xKey = model.RegisterTensorDescriptor(
+        Shape({ inputs }), Type::Dense, host, batchSize, true);
+    const Tensor x(Shape({ inputs }), xKey);
+    TensorUtil::TensorData xData = model.GetDescriptor(xKey).ForwardData;
+    Compute::Initialize::Ones(xData);
+
+    //! Only forward and backward data of the output are allocated
+    const auto initialBytes = Util::MemoryManager::GetAllocatedByteSizeHost();
+    const Tensor y = linear(x);
+    const auto savedBytes =
+        Util::MemoryManager::GetAllocatedByteSizeHost() - initialBytes;
+    CHECK(savedBytes == 2 * xData.DenseTotalLengthHost * sizeof(float));
+
+    //! Writing to the copy-on-write view detaches the view instead
+    BackProp::SavedTensor saved(xData, "x");
+    TensorUtil::TensorData view =
+        xData.CreateView(Shape({ 4, 16 }), batchSize, 0, 0, -1, true);
+    Compute::Scale(view, view, 2.0f);
+    CHECK(!saved.IsModified());
+
+    xData = model.GetDescriptor(xKey).ForwardData;
+    Compute::Scale(xData, xData, 2.0f);
+    CHECK(saved.IsModified());
+    CHECK_THROWS_AS(static_cast<void>(saved.Get()), std::runtime_error);
+    CHECK_THROWS_AS(model.Backward(y), std::runtime_error);
+
+    ModelManager::ClearModels();
+}
+
+//! Back propagates two linear units on the current model, and returns output
+//! followed by the gradients of the input and the weights
+static std::vector<float> RunSegment(bool recompute, std::size_t& savedBytes)
+{
+    const Device host("host");
+    const unsigned int batchSize = 4, inputs = 16, hidden = 32, outputs = 8;
+    Model& model = ModelManager::GetCurrentModel();
+
+    const NN::Linear first(inputs, hidden, host);
+    const NN::Linear second(hidden, outputs, host);
+    for (int unitKey = 0; unitKey < 2; ++unitKey)
+    {
+        auto weight =
+            model.GetUnitDataWrapper(unitKey).TensorDataMap["weight"];
+        for (unsigned int i = 0; i < weight.Rows(); ++i)
+            for (unsigned int j = 0; j < weight.Cols(); ++j)
+                weight.DenseMatHost[i * weight.PaddedHostColSize + j] =
+                    static_cast<float>((unitKey + i * 5 + j * 3) % 11) * 0.1f -
+                    0.5f;
+    }
+
+    const int xKey = model.RegisterTensorDescriptor(
+        Shape({ inputs }), Type::Dense, host, batchSize, true);
+    const auto xData = model.GetDescriptor(xKey).ForwardData;
+    for (unsigned int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+        for (unsigned int i = 0; i < inputs; ++i)
+            xData.DenseMatHost[batchIdx * xData.PaddedHostColSize + i] =
+                static_cast<float>((batchIdx + i) % 5) * 0.2f;
+
+    NN::Checkpoint segment(
+        [&](const Tensor& tensor) { return second(first(tensor)); },
+        recompute);
+    const Tensor y = segment(Tensor(Shape({ inputs }), xKey));
+    savedBytes = segment.SavedBytes();
+    model.Backward(y);
+
+    std::vector<float> result;
+    for (const auto& tensorData :
+         { model.GetDescriptor(y.TensorDescriptorKey()).ForwardData,
+           model.GetDescriptor(xKey).BackwardData,
+           model.GetUnitDataWrapper(0).GradientDataMap["weight"],
+           model.GetUnitDataWrapper(1).GradientDataMap["weight"] })
+        result.insert(
+            result.end(), tensorData.DenseMatHost,
+            tensorData.DenseMatHost + tensorData.DenseTotalLengthHost);
+    return result;
+}
+
+void TestCheckpoint()
+{
+    std::size_t savedBytes = 0;
+    std::vector<float> result;
+    {
+        ModelManager::AddModel("Checkpoint");
+        ModelContext context("Checkpoint");
+        result = RunSegment(true, savedBytes);
+    }
+    //! Output of the first unit is released
+    CHECK(savedBytes == 4 * 32 * sizeof(float));
+
+    std::vector<float> expected;
+    {
+        ModelManager::AddModel("CheckpointReference");
+        ModelContext context("CheckpointReference");
+        expected = RunSegment(false, savedBytes);
+    }
+    CHECK(savedBytes == 0);
+
+    REQUIRE(result.size() == expected.size());
+    for (std::size_t idx = 0; idx < result.size(); ++idx)
+        CHECK(std::abs(result[idx] - expected[idx]) < 1e-4f);
+
+    ModelManager::ClearModels();
+}
+}  // namespace Sapphire::Test
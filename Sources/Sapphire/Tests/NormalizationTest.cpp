@@ -0,0 +1,396 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/Tests/NormalizationTest.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/operations/Forward/Checkpoint.hpp>
+#include <Sapphire/operations/Forward/Normalization.hpp>
+#include <Sapphire/operations/Loss/CrossEntropy.hpp>
+#include <Sapphire/operations/Unit.hpp>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+namespace
+{
+bool IsClose(float value, double expected, double tolerance = 1e-4)
+{
+    return std::abs(value - expected) < tolerance * (1.0 + std::abs(expected));
+}
+
+//! Offset of element i of the group (sample or channel) in the host data
+using OffsetFunction = std::function<std::size_t(std::size_t, std::size_t)>;
+
+//! Normalizes each of numGroups groups with groupSize elements by the
+//! reference loops, and checks y, dx, dGamma and dBeta computed by the host
+//! kernels. Gradients are accumulated to ones
+//! \param parameterIdx : returns index of gamma and beta of the element
+void CheckNormalization(
+    std::size_t numGroups, std::size_t groupSize, const OffsetFunction& offset,
+    const std::function<std::size_t(std::size_t, std::size_t)>& parameterIdx,
+    const TensorUtil::TensorData& x, const TensorUtil::TensorData& y,
+    const TensorUtil::TensorData& dx, const TensorUtil::TensorData& dy,
+    const TensorUtil::TensorData& gamma, const TensorUtil::TensorData& beta,
+    const TensorUtil::TensorData& dGamma, const TensorUtil::TensorData& dBeta,
+    float epsilon)
+{
+    std::vector<double> expectedDGamma(gamma.TensorShape.Size(), 1.0);
+    std::vector<double> expectedDBeta(gamma.TensorShape.Size(), 1.0);
+    for (std::size_t group = 0; group < numGroups; ++group)
+    {
+        double mean = 0.0, variance = 0.0;
+        for (std::size_t i = 0; i < groupSize; ++i)
+            mean += x.DenseMatHost[offset(group, i)];
+        mean /= static_cast<double>(groupSize);
+        for (std::size_t i = 0; i < groupSize; ++i)
+        {
+            const double diff = x.DenseMatHost[offset(group, i)] - mean;
+            variance += diff * diff;
+        }
+        variance /= static_cast<double>(groupSize);
+        const double rstd = 1.0 / std::sqrt(variance + epsilon);
+
+        double gradientMean = 0.0, gradientDotMean = 0.0;
+        for (std::size_t i = 0; i < groupSize; ++i)
+        {
+            const auto idx = offset(group, i);
+            const auto paramIdx = parameterIdx(group, i);
+            const double normalized = (x.DenseMatHost[idx] - mean) * rstd;
+            CHECK(IsClose(y.DenseMatHost[idx],
+                          normalized * gamma.DenseMatHost[paramIdx] +
+                              beta.DenseMatHost[paramIdx]));
+
+            const double gradient =
+                static_cast<double>(dy.DenseMatHost[idx]) *
+                gamma.DenseMatHost[paramIdx];
+            gradientMean += gradient;
+            gradientDotMean += gradient * normalized;
+            expectedDGamma[paramIdx] += dy.DenseMatHost[idx] * normalized;
+            expectedDBeta[paramIdx] += dy.DenseMatHost[idx];
+        }
+        gradientMean /= static_cast<double>(groupSize);
+        gradientDotMean /= static_cast<double>(groupSize);
+
+        for (std::size_t i = 0; i < groupSize; ++i)
+        {
+            const auto idx = offset(group, i);
+            const double normalized = (x.DenseMatHost[idx] - mean) * rstd;
+            const double gradient =
+                static_cast<double>(dy.DenseMatHost[idx]) *
+                gamma.DenseMatHost[parameterIdx(group, i)];
+            CHECK(IsClose(dx.DenseMatHost[idx],
+                          1.0 + rstd * (gradient - gradientMean -
+                                        normalized * gradientDotMean)));
+        }
+    }
+
+    for (std::size_t idx = 0; idx < expectedDGamma.size(); ++idx)
+    {
+        CHECK(IsClose(dGamma.DenseMatHost[idx], expectedDGamma[idx]));
+        CHECK(IsClose(dBeta.DenseMatHost[idx], expectedDBeta[idx]));
+    }
+}
+
+struct NormOperands
+{
+    NormOperands(const Shape& shape, unsigned int batchSize,
+                 unsigned int parameterSize)
+        : X(shape, Type::Dense, Device("host"), batchSize),
+          Y(shape, Type::Dense, Device("host"), batchSize),
+          Dx(shape, Type::Dense, Device("host"), batchSize),
+          Dy(shape, Type::Dense, Device("host"), batchSize),
+          Gamma(Shape({ parameterSize }), Type::Dense, Device("host"), 1),
+          Beta(Shape({ parameterSize }), Type::Dense, Device("host"), 1),
+          DGamma(Shape({ parameterSize }), Type::Dense, Device("host"), 1),
+          DBeta(Shape({ parameterSize }), Type::Dense, Device("host"), 1)
+    {
+        //! Offset of the mean tests the numerical stability of the statistics
+        Compute::Initialize::Normal(X, 100, 2);
+        Compute::Initialize::Normal(Dy, 0, 1);
+        Compute::Initialize::Normal(Gamma, 1, 0.5);
+        Compute::Initialize::Normal(Beta, 0, 1);
+        Compute::Initialize::Ones(Dx);
+        Compute::Initialize::Ones(DGamma);
+        Compute::Initialize::Ones(DBeta);
+    }
+
+    TensorUtil::TensorData X, Y, Dx, Dy, Gamma, Beta, DGamma, DBeta;
+};
+
+void RunLayerNormCase(const Shape& shape, unsigned int batchSize)
+{
+    const float epsilon = 1e-5f;
+    const unsigned int cols = shape.Cols();
+    NormOperands operands(shape, batchSize, cols);
+
+    std::vector<float> mean, rstd;
+    Compute::LayerNormForward(operands.Y, operands.X, operands.Gamma,
+                              operands.Beta, epsilon, &mean, &rstd);
+    Compute::LayerNormBackward(operands.Dx, operands.DGamma, operands.DBeta,
+                               operands.Dy, operands.X, operands.Gamma, mean,
+                               rstd);
+
+    const std::size_t rows = shape.Size() / cols * batchSize;
+    const auto padded = operands.X.PaddedHostColSize;
+    CHECK(mean.size() == rows);
+    CheckNormalization(
+        rows, cols,
+        [padded](std::size_t row, std::size_t col) {
+            return row * padded + col;
+        },
+        [](std::size_t, std::size_t col) { return col; }, operands.X,
+        operands.Y, operands.Dx, operands.Dy, operands.Gamma, operands.Beta,
+        operands.DGamma, operands.DBeta, epsilon);
+}
+
+void RunBatchNormCase(const Shape& shape, unsigned int batchSize)
+{
+    const float epsilon = 1e-5f, momentum = 0.1f;
+    const bool isChannelLast = shape.Dim() == 1;
+    const unsigned int channels = shape.At(0);
+    NormOperands operands(shape, batchSize, channels);
+    TensorUtil::TensorData runningMean(Shape({ channels }), Type::Dense,
+                                       Device("host"), 1);
+    TensorUtil::TensorData runningVar(Shape({ channels }), Type::Dense,
+                                      Device("host"), 1);
+    Compute::Initialize::Zeros(runningMean);
+    Compute::Initialize::Ones(runningVar);
+
+    std::vector<float> mean, rstd;
+    Compute::BatchNormForward(operands.Y, operands.X, operands.Gamma,
+                              operands.Beta, runningMean, runningVar,
+                              momentum, epsilon, true, &mean, &rstd);
+    Compute::BatchNormBackward(operands.Dx, operands.DGamma, operands.DBeta,
+                               operands.Dy, operands.X, operands.Gamma, mean,
+                               rstd);
+
+    //! Element i of channel c is sample i / perSample at (i % perSample)
+    const auto padded = operands.X.PaddedHostColSize;
+    const unsigned int cols = isChannelLast ? 1 : shape.Cols();
+    const std::size_t perSample = isChannelLast ? 1 : shape.Size() / channels;
+    const std::size_t channelStride =
+        isChannelLast ? 1 : perSample / cols * padded;
+    const std::size_t batchStride =
+        isChannelLast ? padded : channels * channelStride;
+    const OffsetFunction offset = [=](std::size_t c, std::size_t i) {
+        const auto n = i / perSample, idx = i % perSample;
+        return n * batchStride + c * channelStride + (idx / cols) * padded +
+               idx % cols;
+    };
+    CheckNormalization(
+        channels, perSample * batchSize, offset,
+        [](std::size_t c, std::size_t) { return c; }, operands.X, operands.Y,
+        operands.Dx, operands.Dy, operands.Gamma, operands.Beta,
+        operands.DGamma, operands.DBeta, epsilon);
+
+    //! Running statistics are updated with the unbiased variance
+    const double count = static_cast<double>(perSample) * batchSize;
+    for (unsigned int c = 0; c < channels; ++c)
+    {
+        const double variance =
+            1.0 / (static_cast<double>(rstd[c]) * rstd[c]) - epsilon;
+        CHECK(IsClose(runningMean.DenseMatHost[c], momentum * mean[c]));
+        CHECK(IsClose(runningVar.DenseMatHost[c],
+                      1.0 - momentum +
+                          momentum * variance * count / (count - 1.0),
+                      1e-3));
+    }
+
+    //! Inference normalizes with the running statistics
+    Compute::BatchNormForward(operands.Y, operands.X, operands.Gamma,
+                              operands.Beta, runningMean, runningVar,
+                              momentum, epsilon, false);
+    for (unsigned int c = 0; c < channels; ++c)
+    {
+        const double scale =
+            operands.Gamma.DenseMatHost[c] /
+            std::sqrt(static_cast<double>(runningVar.DenseMatHost[c]) +
+                      epsilon);
+        const auto idx = offset(c, perSample * batchSize - 1);
+        CHECK(IsClose(operands.Y.DenseMatHost[idx],
+                      (operands.X.DenseMatHost[idx] -
+                       runningMean.DenseMatHost[c]) *
+                              scale +
+                          operands.Beta.DenseMatHost[c],
+                      1e-3));
+    }
+}
+}  // namespace
+
+void TestHostNormalization()
+{
+    //! Rows not multiple of the block size with padded columns
+    RunLayerNormCase(Shape({ 7, 37 }), 5);
+    //! Single wide row
+    RunLayerNormCase(Shape({ 1029 }), 1);
+
+    //! Channels are the columns of (C) inputs
+    RunBatchNormCase(Shape({ 13 }), 17);
+    //! Channels are the first dimension of (C, H, W) inputs
+    RunBatchNormCase(Shape({ 6, 3, 10 }), 4);
+}
+
+void TestBatchNormFolding()
+{
+    const Device host("host");
+    ModelManager::AddModel("BatchNormFolding");
+    ModelContext context("BatchNormFolding");
+    Model& model = ModelManager::GetCurrentModel();
+
+    const NN::Linear linear(7, 5, host);
+    const NN::BatchNorm batchNorm(5, host);
+    auto linearWrapper = model.GetUnitDataWrapper(linear.GetUnitKey());
+    auto normWrapper = model.GetUnitDataWrapper(batchNorm.GetUnitKey());
+    Compute::Initialize::Normal(linearWrapper.TensorDataMap["weight"], 0, 1);
+    Compute::Initialize::Normal(linearWrapper.TensorDataMap["bias"], 0, 1);
+    Compute::Initialize::Normal(normWrapper.TensorDataMap["gamma"], 1, 0.5);
+    Compute::Initialize::Normal(normWrapper.TensorDataMap["beta"], 0, 1);
+    Compute::Initialize::Normal(normWrapper.TensorDataMap["runningMean"], 0,
+                                1);
+    Compute::Initialize::Normal(normWrapper.TensorDataMap["runningVar"], 2,
+                                0.5);
+
+    NoGradGuard noGrad;
+    TrainingModeGuard eval(false);
+    const int xKey = model.RegisterTensorDescriptor(Shape({ 7 }), Type::Dense,
+                                                    host, 3, true);
+    Compute::Initialize::Normal(model.GetDescriptor(xKey).ForwardData, 0, 1);
+    const Tensor x(Shape({ 7 }), xKey);
+
+    const Tensor expected = batchNorm(linear(x));
+    NN::FoldBatchNorm(linear, batchNorm);
+    const Tensor folded = batchNorm(linear(x));
+
+    //! Folded BatchNorm passes the output of the linear through
+    CHECK(folded.TensorDescriptorKey() != expected.TensorDescriptorKey());
+    const auto& expectedData =
+        model.GetDescriptor(expected.TensorDescriptorKey()).ForwardData;
+    const auto& foldedData =
+        model.GetDescriptor(folded.TensorDescriptorKey()).ForwardData;
+    for (unsigned int n = 0; n < 3; ++n)
+        for (unsigned int col = 0; col < 5; ++col)
+        {
+            const auto idx = n * foldedData.PaddedHostColSize + col;
+            CHECK(IsClose(foldedData.DenseMatHost[idx],
+                          expectedData.DenseMatHost[idx], 1e-4));
+        }
+    CHECK_THROWS_AS(NN::FoldBatchNorm(linear, batchNorm), std::runtime_error);
+
+    ModelManager::ClearModels();
+}
+
+namespace
+{
+//! Outputs of a batch normalized segment trained by cross entropy
+struct BatchNormResult
+{
+    std::vector<float> Loss, Dx, RunningMean, RunningVar;
+};
+
+//! Trains NN::BatchNorm on fixed inputs and labels for a step, with or
+//! without checkpointing it
+BatchNormResult RunBatchNormStep(bool checkpointed)
+{
+    const Device host("host");
+    const unsigned int channels = 5, batchSize = 6;
+    ModelManager::AddModel("BatchNormStep");
+    ModelContext context("BatchNormStep");
+    Model& model = ModelManager::GetCurrentModel();
+
+    const NN::BatchNorm batchNorm(channels, host);
+    const int xKey = model.RegisterTensorDescriptor(
+        Shape({ channels }), Type::Dense, host, batchSize, true);
+    const int labelKey = model.RegisterTensorDescriptor(
+        Shape({ 1 }), Type::Dense, host, batchSize, false);
+    const auto& xData = model.GetDescriptor(xKey).ForwardData;
+    const auto& labelData = model.GetDescriptor(labelKey).ForwardData;
+    for (unsigned int n = 0; n < batchSize; ++n)
+    {
+        for (unsigned int c = 0; c < channels; ++c)
+            xData.DenseMatHost[n * xData.PaddedHostColSize + c] =
+                std::sin(static_cast<float>(n * channels + c)) * (c + 1);
+        labelData.DenseMatHost[n * labelData.PaddedHostColSize] =
+            static_cast<float>(n % channels);
+    }
+
+    const Tensor x(Shape({ channels }), xKey);
+    NN::Checkpoint checkpoint(
+        [&batchNorm](const Tensor& input) { return batchNorm(input); },
+        checkpointed);
+    const Tensor loss = NN::Loss::CrossEntropy(
+        checkpoint(x), Tensor(Shape({ 1 }), labelKey));
+    model.Backward(loss);
+
+    const auto wrapper = model.GetUnitDataWrapper(batchNorm.GetUnitKey());
+    const auto& dx = model.GetDescriptor(xKey).BackwardData;
+    BatchNormResult result;
+    result.Loss.emplace_back(
+        model.GetDescriptor(loss.TensorDescriptorKey()).ForwardData
+            .DenseMatHost[0]);
+    for (unsigned int n = 0; n < batchSize; ++n)
+        for (unsigned int c = 0; c < channels; ++c)
+            result.Dx.emplace_back(dx.DenseMatHost[n * dx.PaddedHostColSize +
+                                                   c]);
+    for (unsigned int c = 0; c < channels; ++c)
+    {
+        result.RunningMean.emplace_back(
+            wrapper.TensorDataMap.at("runningMean").DenseMatHost[c]);
+        result.RunningVar.emplace_back(
+            wrapper.TensorDataMap.at("runningVar").DenseMatHost[c]);
+    }
+
+    ModelManager::ClearModels();
+    return result;
+}
+
+void CheckSameValues(const std::vector<float>& values,
+                     const std::vector<float>& expected)
+{
+    REQUIRE(values.size() == expected.size());
+    for (std::size_t idx = 0; idx < values.size(); ++idx)
+        CHECK(IsClose(values[idx], expected[idx], 1e-5));
+}
+}  // namespace
+
+void TestCheckpointBatchNorm()
+{
+    const auto expected = RunBatchNormStep(false);
+    const auto checkpointed = RunBatchNormStep(true);
+
+    //! Replay uses the statistics of the batch as the forward pass, and the
+    //! running statistics are only updated once
+    CheckSameValues(checkpointed.Loss, expected.Loss);
+    CheckSameValues(checkpointed.Dx, expected.Dx);
+    CheckSameValues(checkpointed.RunningMean, expected.RunningMean);
+    CheckSameValues(checkpointed.RunningVar, expected.RunningVar);
+
+    //! Running statistics are updated from their initial values
+    bool isUpdated = false;
+    for (const auto value : expected.RunningMean)
+        isUpdated |= value != 0.0f;
+    CHECK(isUpdated);
+
+    //! Evaluation has no gradient through the running statistics
+    const Device host("host");
+    ModelManager::AddModel("BatchNormEval");
+    ModelContext context("BatchNormEval");
+    Model& model = ModelManager::GetCurrentModel();
+    const NN::BatchNorm batchNorm(3, host);
+    const int xKey = model.RegisterTensorDescriptor(Shape({ 3 }), Type::Dense,
+                                                    host, 2, true);
+    TrainingModeGuard eval(false);
+    CHECK_THROWS_AS(batchNorm(Tensor(Shape({ 3 }), xKey)),
+                    std::runtime_error);
+
+    ModelManager::ClearModels();
+}
+}  // namespace Sapphire::Test
@@ -0,0 +1,278 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/Tests/OptimizerTest.hpp>
+#include <Sapphire/Tests/TestUtil.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/operations/Forward/Linear.hpp>
+#include <Sapphire/operations/Optimizer/Optimizer.hpp>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+void TestGradientAccumulation()
+{
+    const Device host("host");
+    const unsigned int batchSize = 2, inputs = 8, outputs = 4;
+    ModelManager::AddModel("GradientAccumulation");
+    ModelContext context("GradientAccumulation");
+    Model& model = ModelManager::GetCurrentModel();
+
+    const NN::Linear linear(inputs, outputs, host);
+    const int xKey = model.RegisterTensorDescriptor(
+        Shape({ inputs }), Type::Dense, host, batchSize, true);
+    const auto xData = model.GetDescriptor(xKey).ForwardData;
+    for (unsigned int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+        for (unsigned int i = 0; i < inputs; ++i)
+            xData.DenseMatHost[batchIdx * xData.PaddedHostColSize + i] =
+                static_cast<float>(batchIdx + i);
+
+    model.Backward(linear(Tensor(Shape({ inputs }), xKey)));
+    const auto parameters = model.GetParameters();
+    //! Parameters of the unit are ordered by their names
+    REQUIRE(parameters.size() == 2);
+    const auto weightGradient = ToVector(parameters[1].Gradient);
+    const auto biasGradient = ToVector(parameters[0].Gradient);
+
+    //! Gradient of the weight is the sum of x over the batch for every output
+    for (unsigned int i = 0; i < inputs; ++i)
+        CHECK(weightGradient[i * parameters[1].Gradient.PaddedHostColSize] ==
+              static_cast<float>(2 * i + 1));
+    for (unsigned int j = 0; j < outputs; ++j)
+        CHECK(biasGradient[j] == static_cast<float>(batchSize));
+
+    //! Second back propagation is accumulated
+    model.Backward(linear(Tensor(Shape({ inputs }), xKey)));
+    const auto accumulated = ToVector(parameters[1].Gradient);
+    for (std::size_t idx = 0; idx < accumulated.size(); ++idx)
+        CHECK(accumulated[idx] == 2 * weightGradient[idx]);
+
+    //! Step is applied to the accumulated gradients and zeros them
+    const auto weight = ToVector(parameters[1].Data);
+    NN::SGD optimizer(0.5f);
+    optimizer.Step();
+    const auto updated = ToVector(parameters[1].Data);
+    for (std::size_t idx = 0; idx < updated.size(); ++idx)
+    {
+        CHECK(updated[idx] == weight[idx] - 0.5f * accumulated[idx]);
+        CHECK(parameters[1].Gradient.DenseMatHost[idx] == 0.0f);
+    }
+
+    model.ZeroGrad();
+    CHECK(parameters[0].Gradient.DenseMatHost[0] == 0.0f);
+
+    ModelManager::ClearModels();
+}
+
+void TestOptimizerUpdate()
+{
+    const Device host("host");
+    //! Large enough to be split into multiple blocks
+    const unsigned int rows = 70, cols = 40;
+    const float learningRate = 0.01f, beta1 = 0.9f, beta2 = 0.999f,
+                epsilon = 1e-8f, weightDecay = 0.1f, momentum = 0.9f;
+    ModelManager::AddModel("OptimizerUpdate");
+    ModelContext context("OptimizerUpdate");
+    Model& model = ModelManager::GetCurrentModel();
+
+    const NN::Linear linear(rows, cols, host);
+    //! Weight comes after the bias
+    const auto parameter = model.GetParameters()[1];
+    const auto size = parameter.Data.DenseTotalLengthHost;
+    const auto fill = [&](unsigned int step) {
+        for (unsigned long idx = 0; idx < size; ++idx)
+        {
+            parameter.Data.DenseMatHost[idx] =
+                static_cast<float>(idx % 13) * 0.1f - 0.6f;
+            parameter.Gradient.DenseMatHost[idx] =
+                static_cast<float>((idx + step) % 7) * 0.2f - 0.5f;
+        }
+    };
+
+    //! Reference update rules applied to each element
+    std::vector<float> data(size), velocity(size, 0.0f), first(size, 0.0f),
+        second(size, 0.0f);
+    const auto check = [&]() {
+        for (unsigned long idx = 0; idx < size; ++idx)
+            CHECK(std::abs(parameter.Data.DenseMatHost[idx] - data[idx]) <
+                  1e-5f);
+    };
+
+    NN::Momentum momentumOptimizer(learningRate, momentum, weightDecay);
+    for (unsigned int step = 1; step <= 2; ++step)
+    {
+        fill(step);
+        for (unsigned long idx = 0; idx < size; ++idx)
+        {
+            const float p = parameter.Data.DenseMatHost[idx];
+            velocity[idx] = momentum * velocity[idx] +
+                            parameter.Gradient.DenseMatHost[idx] +
+                            weightDecay * p;
+            data[idx] = p - learningRate * velocity[idx];
+        }
+        momentumOptimizer.Step();
+        check();
+    }
+
+    NN::AdamW adamOptimizer(learningRate, beta1, beta2, epsilon, weightDecay);
+    for (unsigned int step = 1; step <= 2; ++step)
+    {
+        fill(step);
+        for (unsigned long idx = 0; idx < size; ++idx)
+        {
+            const float g = parameter.Gradient.DenseMatHost[idx];
+            first[idx] = beta1 * first[idx] + (1.0f - beta1) * g;
+            second[idx] = beta2 * second[idx] + (1.0f - beta2) * g * g;
+            const float firstHat =
+                first[idx] / (1.0f - std::pow(beta1, static_cast<float>(step)));
+            const float secondHat =
+                second[idx] /
+                (1.0f - std::pow(beta2, static_cast<float>(step)));
+            data[idx] = parameter.Data.DenseMatHost[idx] *
+                            (1.0f - learningRate * weightDecay) -
+                        learningRate * firstHat /
+                            (std::sqrt(secondHat) + epsilon);
+        }
+        adamOptimizer.Step();
+        check();
+    }
+
+    ModelManager::ClearModels();
+}
+
+void TestFlattenParameters()
+{
+    const Device host("host");
+    const unsigned int batchSize = 3, inputs = 10, hidden = 6, outputs = 3;
+    ModelManager::AddModel("FlattenParameters");
+    ModelContext context("FlattenParameters");
+    Model& model = ModelManager::GetCurrentModel();
+
+    const NN::Linear first(inputs, hidden, host);
+    const NN::Linear second(hidden, outputs, host);
+    for (const auto& parameter : model.GetParameters())
+        Compute::Initialize::Normal(parameter.Data, 0, 0.5);
+
+    const int xKey = model.RegisterTensorDescriptor(
+        Shape({ inputs }), Type::Dense, host, batchSize, true);
+    Compute::Initialize::Normal(model.GetDescriptor(xKey).ForwardData, 0, 1);
+    const auto backward = [&]() {
+        model.Backward(second(first(Tensor(Shape({ inputs }), xKey))));
+    };
+
+    backward();
+    std::vector<std::vector<float>> data, gradients;
+    for (const auto& parameter : model.GetParameters())
+    {
+        data.emplace_back(ToVector(parameter.Data));
+        gradients.emplace_back(ToVector(parameter.Gradient));
+    }
+
+    model.FlattenParameters();
+    REQUIRE(model.IsFlattened());
+    const auto buffers = model.GetParameterBuffers();
+    REQUIRE(buffers.size() == 1);
+    const auto flat = buffers[0];
+
+    //! Every parameter is an aligned view of the flat buffer with its values
+    const auto parameters = model.GetParameters();
+    REQUIRE(parameters.size() == data.size());
+    for (std::size_t idx = 0; idx < parameters.size(); ++idx)
+    {
+        CHECK(parameters[idx].Data.GetBufferBase() ==
+              flat.Data.GetBufferBase());
+        CHECK(reinterpret_cast<std::uintptr_t>(
+                  parameters[idx].Data.DenseMatHost) %
+                  32 ==
+              0);
+        CHECK(ToVector(parameters[idx].Data) == data[idx]);
+        CHECK(ToVector(parameters[idx].Gradient) == gradients[idx]);
+    }
+
+    //! Gradients are accumulated to the flat buffer
+    model.ZeroGrad();
+    for (unsigned long idx = 0; idx < flat.Gradient.DenseTotalLengthHost;
+         ++idx)
+        CHECK(flat.Gradient.DenseMatHost[idx] == 0.0f);
+    backward();
+
+    double squaredSum = 0.0;
+    for (std::size_t idx = 0; idx < parameters.size(); ++idx)
+    {
+        CHECK(ToVector(parameters[idx].Gradient) == gradients[idx]);
+        for (const auto value : gradients[idx])
+            squaredSum += value * value;
+    }
+
+    //! Clipping to half of the norm halves every gradient
+    const auto norm = static_cast<float>(std::sqrt(squaredSum));
+    CHECK(std::abs(model.ClipGradientNorm(norm / 2) - norm) < 1e-4f * norm);
+    CHECK(std::abs(model.ClipGradientNorm(norm) - norm / 2) < 1e-4f * norm);
+
+    const auto flatData = ToVector(flat.Data);
+    const auto flatGradient = ToVector(flat.Gradient);
+    NN::SGD optimizer(0.1f);
+    optimizer.Step();
+    for (std::size_t idx = 0; idx < flatData.size(); ++idx)
+    {
+        CHECK(flat.Data.DenseMatHost[idx] ==
+              flatData[idx] - 0.1f * flatGradient[idx]);
+        CHECK(flat.Gradient.DenseMatHost[idx] == 0.0f);
+    }
+
+    ModelManager::ClearModels();
+}
+
+void TestFlattenOptimizerState()
+{
+    const Device host("host");
+    const unsigned int inputs = 10, hidden = 6, outputs = 3;
+    //! Runs two momentum steps on the same parameters and gradients, and
+    //! flattens the parameters between the steps if requested
+    const auto run = [&](const std::string& name, bool flatten) {
+        ModelManager::AddModel(name);
+        ModelContext context(name);
+        Model& model = ModelManager::GetCurrentModel();
+
+        const NN::Linear first(inputs, hidden, host);
+        const NN::Linear second(hidden, outputs, host);
+        NN::Momentum optimizer(0.1f, 0.9f);
+        for (unsigned int step = 0; step < 2; ++step)
+        {
+            if (flatten && step == 1)
+                model.FlattenParameters();
+            for (const auto& parameter : model.GetParameters())
+                for (unsigned long idx = 0;
+                     idx < parameter.Data.DenseTotalLengthHost; ++idx)
+                {
+                    if (step == 0)
+                        parameter.Data.DenseMatHost[idx] =
+                            static_cast<float>(idx % 11) * 0.1f - 0.5f;
+                    parameter.Gradient.DenseMatHost[idx] =
+                        static_cast<float>((idx + step) % 5) * 0.2f - 0.4f;
+                }
+            optimizer.Step();
+        }
+
+        std::vector<std::vector<float>> data;
+        for (const auto& parameter : model.GetParameters())
+            data.emplace_back(ToVector(parameter.Data));
+        return data;
+    };
+
+    //! Velocity of the first step must be carried over to the flat buffer
+    const auto separate = run("OptimizerStateSeparate", false);
+    const auto flattened = run("OptimizerStateFlattened", true);
+    CHECK(separate == flattened);
+
+    ModelManager::ClearModels();
+}
+}  // namespace Sapphire::Test
@@ -0,0 +1,198 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/Tests/PoolingTest.hpp>
+#include <Sapphire/Tests/TestUtil.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/operations/Forward/Pooling.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+namespace
+{
+struct PoolCase
+{
+    unsigned int N, C, H, W;
+    int WindowRow, WindowCol, StrideRow, StrideCol, PaddingRow, PaddingCol;
+};
+
+void RunPoolCase(const PoolCase& pool)
+{
+    const Device host("host");
+    const unsigned int P =
+        (pool.H + 2 * pool.PaddingRow - pool.WindowRow) / pool.StrideRow + 1;
+    const unsigned int Q =
+        (pool.W + 2 * pool.PaddingCol - pool.WindowCol) / pool.StrideCol + 1;
+    const Shape inputShape({ pool.C, pool.H, pool.W });
+    const Shape outputShape({ pool.C, P, Q });
+
+    TensorUtil::TensorData x(inputShape, Type::Dense, host, pool.N);
+    TensorUtil::TensorData maxDx(inputShape, Type::Dense, host, pool.N);
+    TensorUtil::TensorData avgDx(inputShape, Type::Dense, host, pool.N);
+    TensorUtil::TensorData maxY(outputShape, Type::Dense, host, pool.N);
+    TensorUtil::TensorData avgY(outputShape, Type::Dense, host, pool.N);
+    TensorUtil::TensorData dy(outputShape, Type::Dense, host, pool.N);
+    Compute::Initialize::Normal(x, 0, 1);
+    Compute::Initialize::Normal(dy, 0, 1);
+    Compute::Initialize::Ones(maxDx);
+    Compute::Initialize::Ones(avgDx);
+
+    //! Reference results. Gradients are accumulated to ones
+    std::vector<float> expectedMax, expectedAvg;
+    std::vector<float> expectedMaxDx(pool.N * pool.C * pool.H * pool.W, 1.0f);
+    std::vector<float> expectedAvgDx(expectedMaxDx);
+    for (unsigned int n = 0; n < pool.N; ++n)
+        for (unsigned int c = 0; c < pool.C; ++c)
+            for (unsigned int p = 0; p < P; ++p)
+                for (unsigned int q = 0; q < Q; ++q)
+                {
+                    float maxValue = -std::numeric_limits<float>::infinity();
+                    float sum = 0.0f;
+                    std::size_t maxIdx = 0;
+                    std::vector<std::size_t> window;
+                    for (int r = 0; r < pool.WindowRow; ++r)
+                        for (int s = 0; s < pool.WindowCol; ++s)
+                        {
+                            const int h = static_cast<int>(p) * pool.StrideRow +
+                                          r - pool.PaddingRow;
+                            const int w = static_cast<int>(q) * pool.StrideCol +
+                                          s - pool.PaddingCol;
+                            if (h < 0 || h >= static_cast<int>(pool.H) ||
+                                w < 0 || w >= static_cast<int>(pool.W))
+                                continue;
+                            const float value = ElementAt(x, n, c, h, w);
+                            const auto idx =
+                                ((n * pool.C + c) * pool.H + h) * pool.W + w;
+                            if (value > maxValue)
+                            {
+                                maxValue = value;
+                                maxIdx = idx;
+                            }
+                            sum += value;
+                            window.emplace_back(idx);
+                        }
+
+                    const float gradient = ElementAt(dy, n, c, p, q);
+                    expectedMax.emplace_back(maxValue);
+                    expectedAvg.emplace_back(sum / window.size());
+                    expectedMaxDx[maxIdx] += gradient;
+                    for (const auto idx : window)
+                        expectedAvgDx[idx] += gradient / window.size();
+                }
+
+    std::vector<std::uint8_t> indices;
+    Compute::MaxPool2DForward(maxY, x, pool.WindowRow, pool.WindowCol,
+                              pool.StrideRow, pool.StrideCol,
+                              pool.PaddingRow, pool.PaddingCol, &indices);
+    Compute::MaxPool2DBackward(maxDx, dy, indices, pool.WindowRow,
+                               pool.WindowCol, pool.StrideRow, pool.StrideCol,
+                               pool.PaddingRow, pool.PaddingCol);
+    Compute::AvgPool2DForward(avgY, x, pool.WindowRow, pool.WindowCol,
+                              pool.StrideRow, pool.StrideCol,
+                              pool.PaddingRow, pool.PaddingCol);
+    Compute::AvgPool2DBackward(avgDx, dy, pool.WindowRow, pool.WindowCol,
+                               pool.StrideRow, pool.StrideCol,
+                               pool.PaddingRow, pool.PaddingCol);
+
+    CHECK(indices.size() == pool.N * pool.C * P * Q);
+    CheckClose(maxY, expectedMax, 1e-5f);
+    CheckClose(maxDx, expectedMaxDx, 1e-5f);
+    CheckClose(avgY, expectedAvg, 1e-5f);
+    CheckClose(avgDx, expectedAvgDx, 1e-5f);
+}
+}  // namespace
+
+void TestHostPooling()
+{
+    //! Non-overlapping 2x2 windows with channels not multiple of 8
+    RunPoolCase({ 2, 11, 8, 10, 2, 2, 2, 2, 0, 0 });
+    //! Overlapping windows accumulate the gradient
+    RunPoolCase({ 1, 16, 9, 9, 3, 3, 1, 2, 1, 1 });
+    //! Rectangular window with padding and odd sizes
+    RunPoolCase({ 3, 5, 7, 13, 2, 4, 2, 3, 1, 2 });
+
+    //! Global average pooling averages each channel into (C)
+    const Device host("host");
+    TensorUtil::TensorData x(Shape({ 9, 5, 19 }), Type::Dense, host, 2);
+    TensorUtil::TensorData dx(Shape({ 9, 5, 19 }), Type::Dense, host, 2);
+    TensorUtil::TensorData y(Shape({ 9 }), Type::Dense, host, 2);
+    TensorUtil::TensorData dy(Shape({ 9 }), Type::Dense, host, 2);
+    Compute::Initialize::Normal(x, 0, 1);
+    Compute::Initialize::Normal(dy, 0, 1);
+    Compute::GlobalAvgPoolForward(y, x);
+    Compute::GlobalAvgPoolBackward(dx, dy);
+    for (unsigned int n = 0; n < 2; ++n)
+        for (unsigned int c = 0; c < 9; ++c)
+        {
+            float sum = 0.0f;
+            for (unsigned int h = 0; h < 5; ++h)
+                for (unsigned int w = 0; w < 19; ++w)
+                {
+                    sum += ElementAt(x, n, c, h, w);
+                    CHECK(std::abs(ElementAt(dx, n, c, h, w) -
+                                   dy.DenseMatHost[n * dy.PaddedHostColSize +
+                                                   c] /
+                                       95.0f) < 1e-6f);
+                }
+            CHECK(std::abs(y.DenseMatHost[n * y.PaddedHostColSize + c] -
+                           sum / 95.0f) < 1e-5f);
+        }
+}
+
+void TestPoolingUnits()
+{
+    const Device host("host");
+    ModelManager::AddModel("PoolingUnits");
+    ModelContext context("PoolingUnits");
+    Model& model = ModelManager::GetCurrentModel();
+
+    const int xKey = model.RegisterTensorDescriptor(
+        Shape({ 3, 4, 6 }), Type::Dense, host, 2, true);
+    auto& xDesc = model.GetDescriptor(xKey);
+    Compute::Initialize::Normal(xDesc.ForwardData, 0, 1);
+
+    const NN::MaxPool2D maxPool({ 2, 2 }, { 2, 2 });
+    const NN::GlobalAvgPool globalAvgPool;
+    const Tensor y =
+        globalAvgPool(maxPool(Tensor(Shape({ 3, 4, 6 }), xKey)));
+    CHECK(y.GetShape() == Shape({ 3 }));
+    model.Backward(y);
+
+    //! Gradient of each maximum is 1 / (number of windows in the channel)
+    const auto& x = xDesc.ForwardData;
+    const auto& dx = xDesc.BackwardData;
+    for (unsigned int n = 0; n < 2; ++n)
+        for (unsigned int c = 0; c < 3; ++c)
+            for (unsigned int p = 0; p < 2; ++p)
+                for (unsigned int q = 0; q < 3; ++q)
+                {
+                    float maxValue = -std::numeric_limits<float>::infinity();
+                    for (unsigned int h = 2 * p; h < 2 * p + 2; ++h)
+                        for (unsigned int w = 2 * q; w < 2 * q + 2; ++w)
+                            maxValue =
+                                std::max(maxValue, ElementAt(x, n, c, h, w));
+                    for (unsigned int h = 2 * p; h < 2 * p + 2; ++h)
+                        for (unsigned int w = 2 * q; w < 2 * q + 2; ++w)
+                        {
+                            const float expected =
+                                ElementAt(x, n, c, h, w) == maxValue
+                                    ? 1.0f / 6
+                                    : 0.0f;
+                            CHECK(std::abs(ElementAt(dx, n, c, h, w) -
+                                           expected) < 1e-6f);
+                        }
+                }
+
+    ModelManager::ClearModels();
+}
+}  // namespace Sapphire::Test
@@ -0,0 +1,86 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/Tests/QuantizationTest.hpp>
+#include <Sapphire/Tests/TestUtil.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/operations/Forward/Linear.hpp>
+#include <Sapphire/operations/Unit.hpp>
+#include <Sapphire/tensor/TensorData.hpp>
+#include <stdexcept>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+void TestInt8Linear()
+{
+    const Device host("host");
+    //! K is not a multiple of 32 to test both vector and scalar paths
+    const unsigned int batchSize = 5, N = 12, K = 70;
+    TensorUtil::TensorData x(Shape({ K }), Type::Dense, host, batchSize);
+    TensorUtil::TensorData expected(Shape({ N }), Type::Dense, host, batchSize);
+    TensorUtil::TensorData out(Shape({ N }), Type::Dense, host, batchSize);
+    FillQuantizable(x);
+
+    UnitDataWrapper wrapper;
+    wrapper.TensorDataMap["weight"] =
+        TensorUtil::TensorData(Shape({ K, N }), Type::Dense, host, 1);
+    wrapper.TensorDataMap["bias"] =
+        TensorUtil::TensorData(Shape({ N }), Type::Dense, host, 1);
+    FillQuantizable(wrapper.TensorDataMap["weight"]);
+    for (unsigned int j = 0; j < N; ++j)
+        wrapper.TensorDataMap["bias"].DenseMatHost[j] =
+            static_cast<float>(j) - 6.0f;
+
+    Compute::Gemm(expected, x, wrapper.TensorDataMap["weight"],
+                  wrapper.TensorDataMap["bias"]);
+
+    NN::QuantizeLinear(wrapper);
+    const auto& weight = wrapper.TensorDataMap["weight"];
+    CHECK(weight.GetDataType() == DataType::Int8);
+    CHECK(weight.TensorShape == Shape({ K, N }));
+    CHECK(wrapper.TensorDataMap["bias"].GetDataType() == DataType::Float32);
+
+    //! Integer products are accumulated in int32 without error
+    Compute::Gemm(out, x, weight, wrapper.TensorDataMap["bias"]);
+    for (unsigned int i = 0; i < batchSize; ++i)
+        for (unsigned int j = 0; j < N; ++j)
+            CHECK(out.DenseMatHost[i * out.PaddedHostColSize + j] ==
+                  expected.DenseMatHost[i * out.PaddedHostColSize + j]);
+
+    //! Quantized weight is not used for element-wise operations
+    auto quantizedX = x.ConvertTo(DataType::Int8);
+    CHECK_THROWS_AS(Compute::Add(quantizedX, quantizedX, quantizedX),
+                    std::invalid_argument);
+}
+
+void TestQuantizedLinearGradMode()
+{
+    const Device host("host");
+    const unsigned int batchSize = 3, inputs = 8, outputs = 4;
+    ModelManager::AddModel("QuantizedLinear");
+    ModelContext context("QuantizedLinear");
+    Model& model = ModelManager::GetCurrentModel();
+
+    const NN::Linear linear(inputs, outputs, host);
+    const int xKey = model.RegisterTensorDescriptor(
+        Shape({ inputs }), Type::Dense, host, batchSize, true);
+    const Tensor x(Shape({ inputs }), xKey);
+    linear.Quantize();
+
+    //! Quantized unit would silently stop the gradient of earlier units
+    CHECK_THROWS_AS(linear(x), std::runtime_error);
+
+    NoGradGuard guard;
+    const Tensor y = linear(x);
+    const auto& yDesc = model.GetDescriptor(y.TensorDescriptorKey());
+    CHECK(yDesc.BackwardData.DenseMatHost == nullptr);
+    CHECK(!yDesc.IsBackPropReady());
+
+    ModelManager::ClearModels();
+}
+}  // namespace Sapphire::Test
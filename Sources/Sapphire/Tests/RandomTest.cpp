@@ -0,0 +1,211 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/Tests/RandomTest.hpp>
+#include <Sapphire/Tests/TestUtil.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/compute/dense/naive/NaiveRandom.hpp>
+#include <Sapphire/operations/Forward/Checkpoint.hpp>
+#include <Sapphire/operations/Forward/Dropout.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <cmath>
+#include <vector>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+void TestPhilox()
+{
+    using Compute::Dense::Naive::Philox4x32;
+    using Words = std::array<std::uint32_t, 4>;
+    //! Known answers of Philox4x32-10 from Random123
+    const Words zero = Philox4x32({ 0, 0, 0, 0 }, { 0, 0 });
+    const Words ones = Philox4x32(
+        { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+        { 0xffffffff, 0xffffffff });
+    const Words pi =
+        Philox4x32({ 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 },
+                   { 0xa4093822, 0x299f31d0 });
+    const Words expectedZero = { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c,
+                                 0x9b00dbd8 };
+    const Words expectedOnes = { 0x408f276d, 0x41c83b0e, 0xa20bc7c6,
+                                 0x6d5451fd };
+    const Words expectedPi = { 0xd16cfe09, 0x94fdcceb, 0x5001e420,
+                               0x24126ea1 };
+    CHECK(zero == expectedZero);
+    CHECK(ones == expectedOnes);
+    CHECK(pi == expectedPi);
+
+    //! Counters cross the carry into the high word
+    const std::uint64_t seed = 0x0123456789abcdefULL;
+    const std::uint64_t firstCounter = 0xfffffffaULL;
+    const std::size_t numCounters = 37;
+    std::vector<std::uint32_t> bits(numCounters * 4);
+    Compute::Dense::Naive::GenerateRandomBits(bits.data(), firstCounter,
+                                              numCounters, seed);
+    for (std::size_t idx = 0; idx < numCounters; ++idx)
+    {
+        const auto counter = firstCounter + idx;
+        const auto expected = Philox4x32(
+            { static_cast<std::uint32_t>(counter),
+              static_cast<std::uint32_t>(counter >> 32), 0, 0 },
+            { static_cast<std::uint32_t>(seed),
+              static_cast<std::uint32_t>(seed >> 32) });
+        for (std::size_t word = 0; word < 4; ++word)
+            CHECK(bits[idx * 4 + word] == expected[word]);
+    }
+}
+
+void TestRandomInitialize()
+{
+    const Device host("host");
+    const auto budget = Util::ThreadPool::GetGlobalThreadBudget();
+    //! Odd number of columns places chunks in the middle of the rows
+    TensorUtil::TensorData data(Shape({ 301, 133 }), Type::Dense, host, 2);
+    const double size = 301.0 * 133.0 * 2.0;
+
+    Compute::Initialize::SetSeed(42);
+    Compute::Initialize::Normal(data, 1.0f, 2.0f);
+    const auto normal = GetValues(data);
+    double sum = 0.0, sumSquares = 0.0;
+    for (const auto value : normal)
+    {
+        sum += value;
+        sumSquares += static_cast<double>(value) * value;
+    }
+    const double mean = sum / size;
+    CHECK(std::abs(mean - 1.0) < 0.02);
+    CHECK(std::abs(sumSquares / size - mean * mean - 4.0) < 0.08);
+
+    Compute::Initialize::Uniform(data, -1.0f, 3.0f);
+    const auto uniform = GetValues(data);
+    sum = 0.0;
+    for (const auto value : uniform)
+    {
+        CHECK((value >= -1.0f && value <= 3.0f));
+        sum += value;
+    }
+    CHECK(std::abs(sum / size - 1.0) < 0.02);
+    //! Stream advances, so the next values are different
+    CHECK(uniform != normal);
+
+    //! Same values are drawn with a different number of threads
+    Util::ThreadPool::SetGlobalThreadBudget(budget + 3);
+    Compute::Initialize::SetSeed(42);
+    Compute::Initialize::Normal(data, 1.0f, 2.0f);
+    CHECK(GetValues(data) == normal);
+    Compute::Initialize::Uniform(data, -1.0f, 3.0f);
+    CHECK(GetValues(data) == uniform);
+    Util::ThreadPool::SetGlobalThreadBudget(budget);
+
+    Compute::Initialize::SetSeed(43);
+    Compute::Initialize::Normal(data, 1.0f, 2.0f);
+    CHECK(GetValues(data) != normal);
+}
+
+void TestDropout()
+{
+    const Device host("host");
+    const float rate = 0.3f;
+    const unsigned int cols = 45, batchSize = 8;
+    ModelManager::AddModel("DropoutTest");
+    ModelContext context("DropoutTest");
+    Model& model = ModelManager::GetCurrentModel();
+
+    const int xKey = model.RegisterTensorDescriptor(
+        Shape({ 17, cols }), Type::Dense, host, batchSize, true);
+    const auto xData = model.GetDescriptor(xKey).ForwardData;
+    Compute::Initialize::Uniform(xData, 1.0f, 2.0f);
+
+    const NN::Dropout dropout(rate);
+    const auto y = dropout(Tensor(Shape({ 17, cols }), xKey));
+    const auto& yData = model.GetDescriptor(y.TensorDescriptorKey())
+                            .ForwardData;
+    model.Backward(y);
+    const auto& dx = model.GetDescriptor(xKey).BackwardData;
+
+    const auto x = GetValues(xData);
+    const auto output = GetValues(yData);
+    const auto gradient = GetValues(dx);
+    const float scale = 1.0f / (1.0f - rate);
+    std::size_t dropped = 0;
+    for (std::size_t idx = 0; idx < x.size(); ++idx)
+    {
+        if (output[idx] == 0.0f)
+        {
+            ++dropped;
+            CHECK(gradient[idx] == 0.0f);
+        }
+        else
+        {
+            CHECK(output[idx] == x[idx] * scale);
+            CHECK(gradient[idx] == scale);
+        }
+    }
+    CHECK(std::abs(static_cast<double>(dropped) / x.size() - rate) < 0.03);
+
+    //! Mask is applied without gradient while training
+    {
+        NoGradGuard guard;
+        const auto masked = dropout(Tensor(Shape({ 17, cols }), xKey));
+        const auto& maskedDesc =
+            model.GetDescriptor(masked.TensorDescriptorKey());
+        CHECK(masked.TensorDescriptorKey() != xKey);
+        CHECK(maskedDesc.BackwardData.DenseMatHost == nullptr);
+    }
+
+    //! Input is passed through in evaluation
+    {
+        TrainingModeGuard eval(false);
+        const auto passed = dropout(Tensor(Shape({ 17, cols }), xKey));
+        CHECK(passed.TensorDescriptorKey() == xKey);
+    }
+
+    CHECK_THROWS_AS(NN::Dropout(1.5f), std::invalid_argument);
+
+    ModelManager::ClearModels();
+}
+
+void TestCheckpointDropout()
+{
+    const Device host("host");
+    const float rate = 0.5f;
+    const unsigned int cols = 37, batchSize = 6;
+    ModelManager::AddModel("CheckpointDropout");
+    ModelContext context("CheckpointDropout");
+    Model& model = ModelManager::GetCurrentModel();
+
+    const int xKey = model.RegisterTensorDescriptor(
+        Shape({ 3, cols }), Type::Dense, host, batchSize, true);
+    const auto xData = model.GetDescriptor(xKey).ForwardData;
+    Compute::Initialize::Ones(xData);
+
+    //! Two dropouts draw two streams, which are replayed in order
+    const NN::Dropout dropout(rate);
+    NN::Checkpoint checkpoint(
+        [&dropout](const Tensor& x) { return dropout(dropout(x)); });
+    const auto y = checkpoint(Tensor(Shape({ 3, cols }), xKey));
+    const auto output =
+        GetValues(model.GetDescriptor(y.TensorDescriptorKey()).ForwardData);
+    model.Backward(y);
+    const auto gradient = GetValues(model.GetDescriptor(xKey).BackwardData);
+
+    //! Gradient of the replay belongs to the mask of the forward output
+    std::size_t dropped = 0;
+    for (std::size_t idx = 0; idx < output.size(); ++idx)
+    {
+        CHECK(gradient[idx] == output[idx]);
+        if (output[idx] == 0.0f)
+            ++dropped;
+    }
+    CHECK(dropped > 0);
+    CHECK(dropped < output.size());
+
+    ModelManager::ClearModels();
+}
+}  // namespace Sapphire::Test
@@ -0,0 +1,232 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Tests/ReductionTest.hpp>
+#include <Sapphire/Tests/TestUtil.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+namespace
+{
+//! Returns the reduction of x over the dimensions with isReduced by the
+//! reference loops in double precision
+double ReferenceReduce(const TensorUtil::TensorData& x, unsigned int n,
+                       const unsigned int (&pos)[3], const bool (&isReduced)[3],
+                       Compute::ReduceOp op)
+{
+    const auto& shape = x.TensorShape;
+    unsigned int begin[3], end[3];
+    for (int dim = 0; dim < 3; ++dim)
+    {
+        begin[dim] = isReduced[dim] ? 0 : pos[dim];
+        end[dim] = isReduced[dim] ? shape.At(dim) : pos[dim] + 1;
+    }
+
+    double sum = 0.0, squareSum = 0.0;
+    double max = -std::numeric_limits<double>::infinity();
+    double min = std::numeric_limits<double>::infinity();
+    std::size_t count = 0, argMax = 0;
+    for (auto i = begin[0]; i < end[0]; ++i)
+        for (auto j = begin[1]; j < end[1]; ++j)
+            for (auto k = begin[2]; k < end[2]; ++k, ++count)
+            {
+                const double value = ElementAt(x, n, i, j, k);
+                sum += value;
+                squareSum += value * value;
+                if (value > max)
+                {
+                    max = value;
+                    argMax = count;
+                }
+                min = std::min(min, value);
+            }
+
+    switch (op)
+    {
+        case Compute::ReduceOp::Sum:
+            return sum;
+        case Compute::ReduceOp::Mean:
+            return sum / static_cast<double>(count);
+        case Compute::ReduceOp::Max:
+            return max;
+        case Compute::ReduceOp::Min:
+            return min;
+        case Compute::ReduceOp::Norm:
+            return std::sqrt(squareSum);
+        case Compute::ReduceOp::ArgMax:
+            return static_cast<double>(argMax);
+    }
+    return 0.0;
+}
+
+void CheckReduce(const TensorUtil::TensorData& x, const bool (&isReduced)[3],
+                 Compute::ReduceOp op)
+{
+    const Device host("host");
+    const auto& shape = x.TensorShape;
+    std::vector<int> dims;
+    unsigned int outputDims[3];
+    for (int dim = 0; dim < 3; ++dim)
+    {
+        outputDims[dim] = isReduced[dim] ? 1 : shape.At(dim);
+        if (isReduced[dim])
+            dims.emplace_back(dim);
+    }
+
+    //! Reduced dimensions are kept as 1, so the output has the same rank
+    TensorUtil::TensorData out(
+        Shape({ outputDims[0], outputDims[1], outputDims[2] }), Type::Dense,
+        host, x.BatchSize);
+    Compute::Reduce(out, x, dims, op);
+
+    for (unsigned int n = 0; n < x.BatchSize; ++n)
+        for (unsigned int i = 0; i < outputDims[0]; ++i)
+            for (unsigned int j = 0; j < outputDims[1]; ++j)
+                for (unsigned int k = 0; k < outputDims[2]; ++k)
+                {
+                    const double expected =
+                        ReferenceReduce(x, n, { i, j, k }, isReduced, op);
+                    CHECK(std::abs(ElementAt(out, n, i, j, k) - expected) <
+                          1e-4 * (1.0 + std::abs(expected)));
+                }
+}
+}  // namespace
+
+void TestReduction()
+{
+    const Device host("host");
+    //! Columns are not multiple of the vector width and rows are padded
+    TensorUtil::TensorData x(Shape({ 4, 5, 37 }), Type::Dense, host, 3);
+    Compute::Initialize::Normal(x, 0, 1);
+
+    using Compute::ReduceOp;
+    const ReduceOp ops[] = { ReduceOp::Sum, ReduceOp::Mean, ReduceOp::Max,
+                             ReduceOp::Min, ReduceOp::Norm,
+                             ReduceOp::ArgMax };
+    for (const auto op : ops)
+        for (int mask = 1; mask < 8; ++mask)
+        {
+            const bool isReduced[3] = { (mask & 4) != 0, (mask & 2) != 0,
+                                        (mask & 1) != 0 };
+            CheckReduce(x, isReduced, op);
+        }
+
+    //! Reduced dimensions can be removed from the output
+    TensorUtil::TensorData sum(Shape({ 4, 37 }), Type::Dense, host, 3);
+    Compute::Sum(sum, x, 1);
+    for (unsigned int n = 0; n < 3; ++n)
+        for (unsigned int i = 0; i < 4; ++i)
+            for (unsigned int k = 0; k < 37; ++k)
+            {
+                double expected = 0.0;
+                for (unsigned int j = 0; j < 5; ++j)
+                    expected += ElementAt(x, n, i, j, k);
+                CHECK(std::abs(sum.DenseMatHost[(n * 4 + i) *
+                                                    sum.PaddedHostColSize +
+                                                k] -
+                               expected) < 1e-4);
+            }
+
+    TensorUtil::TensorData wrongShape(Shape({ 5, 37 }), Type::Dense, host, 3);
+    CHECK_THROWS_AS(Compute::Sum(wrongShape, x, 1), std::invalid_argument);
+}
+
+void TestLongReduction()
+{
+    const Device host("host");
+
+    //! Contiguous reduction longer than a parallel chunk
+    TensorUtil::TensorData row(Shape({ 3, 100003 }), Type::Dense, host, 1);
+    TensorUtil::TensorData rowSum(Shape({ 3 }), Type::Dense, host, 1);
+    TensorUtil::TensorData rowArgMax(Shape({ 3 }), Type::Dense, host, 1);
+    Compute::Initialize::Normal(row, 1, 1);
+    row.DenseMatHost[row.PaddedHostColSize + 77777] = 100.0f;
+    Compute::Sum(rowSum, row, 1);
+    Compute::ArgMax(rowArgMax, row, 1);
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        double expected = 0.0;
+        for (unsigned int k = 0; k < 100003; ++k)
+            expected += row.DenseMatHost[i * row.PaddedHostColSize + k];
+        //! Pairwise summation keeps the error near the float precision
+        CHECK(std::abs(rowSum.DenseMatHost[i] - expected) <
+              1e-6 * std::abs(expected) + 1e-3);
+    }
+    CHECK(rowArgMax.DenseMatHost[1] == 77777.0f);
+
+    //! Strided reduction longer than a parallel chunk
+    TensorUtil::TensorData column(Shape({ 2000, 70 }), Type::Dense, host, 2);
+    TensorUtil::TensorData columnMax(Shape({ 70 }), Type::Dense, host, 2);
+    TensorUtil::TensorData columnMean(Shape({ 70 }), Type::Dense, host, 2);
+    Compute::Initialize::Normal(column, 0, 1);
+    Compute::Max(columnMax, column, 0);
+    Compute::Mean(columnMean, column, 0);
+    for (unsigned int n = 0; n < 2; ++n)
+        for (unsigned int k = 0; k < 70; ++k)
+        {
+            double sum = 0.0;
+            float max = -std::numeric_limits<float>::infinity();
+            for (unsigned int i = 0; i < 2000; ++i)
+            {
+                const float value =
+                    column.DenseMatHost[(n * 2000 + i) *
+                                            column.PaddedHostColSize +
+                                        k];
+                sum += value;
+                max = std::max(max, value);
+            }
+            const auto outputIdx = n * columnMax.PaddedHostColSize + k;
+            CHECK(columnMax.DenseMatHost[outputIdx] == max);
+            CHECK(std::abs(columnMean.DenseMatHost[outputIdx] - sum / 2000) <
+                  1e-5);
+        }
+
+    //! Mean of each sample overwrites the output
+    TensorUtil::TensorData mean(Shape({ 1 }), Type::Dense, host, 2);
+    Compute::Initialize::Ones(mean);
+    Compute::Mean(mean, column);
+    for (unsigned int n = 0; n < 2; ++n)
+    {
+        double sum = 0.0;
+        for (unsigned int i = 0; i < 2000; ++i)
+            for (unsigned int k = 0; k < 70; ++k)
+                sum += column.DenseMatHost[(n * 2000 + i) *
+                                               column.PaddedHostColSize +
+                                           k];
+        CHECK(std::abs(mean.DenseMatHost[n * mean.PaddedHostColSize] -
+                       sum / 140000) < 1e-5);
+    }
+}
+
+void TestColumnSum()
+{
+    const Device host("host");
+    TensorUtil::TensorData x(Shape({ 5, 19 }), Type::Dense, host, 3);
+    TensorUtil::TensorData sum(Shape({ 19 }), Type::Dense, host, 1);
+    Compute::Initialize::Normal(x, 0, 1);
+    Compute::Initialize::Ones(sum);
+
+    //! Rows of every sample are accumulated into the output
+    Compute::ColumnSum(sum, x);
+    for (unsigned int k = 0; k < 19; ++k)
+    {
+        double expected = 1.0;
+        for (unsigned int i = 0; i < 15; ++i)
+            expected += x.DenseMatHost[i * x.PaddedHostColSize + k];
+        CHECK(std::abs(sum.DenseMatHost[k] - expected) < 1e-5);
+    }
+
+    TensorUtil::TensorData wrongSum(Shape({ 18 }), Type::Dense, host, 1);
+    CHECK_THROWS_AS(Compute::ColumnSum(wrongSum, x), std::invalid_argument);
+}
+}  // namespace Sapphire::Test
@@ -0,0 +1,232 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Interface/IndexingInterfaceDecl.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/Tests/TensorViewTest.hpp>
+#include <Sapphire/Tests/TestUtil.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <thread>
+#include <vector>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+void TestReshapeView()
+{
+    ModelManager::AddModel("ViewTest");
+    ModelManager::SetCurrentModel("ViewTest");
+    Model& model = ModelManager::GetCurrentModel();
+    const Device host("host");
+
+    const int key = model.RegisterTensorDescriptor(Shape({ 4, 1, 8 }),
+                                                   Type::Dense, host, 2, true);
+    const Tensor x(Shape({ 4, 1, 8 }), key);
+    FillIndex(model.GetDescriptor(key).ForwardData);
+
+    //! Column size is preserved or a multiple of 8, so all of them are views
+    const Tensor squeezed = Squeeze(x);
+    const Tensor unSqueezed = UnSqueeze(x, 0);
+    const Tensor expanded = Expand(x, 5);
+    const Tensor flattened = Flatten(x);
+
+    const auto& xData = model.GetDescriptor(key).ForwardData;
+    for (const auto& tensor : { squeezed, unSqueezed, expanded, flattened })
+    {
+        const auto& data =
+            model.GetDescriptor(tensor.TensorDescriptorKey()).ForwardData;
+        CHECK(data.IsView());
+        CHECK(data.DenseMatHost == xData.DenseMatHost);
+        for (unsigned int i = 0; i < xData.TensorShape.Size() * 2; ++i)
+            CHECK(GetAt(data, i) == GetAt(xData, i));
+    }
+    CHECK(squeezed.GetShape() == Shape({ 4, 8 }));
+    CHECK(flattened.GetShape() == Shape({ 32 }));
+
+    //! Padding of the rows changes, so reshape falls back to copy
+    const Tensor reshaped = Reshape(x, Shape({ 8, 4 }));
+    const auto& reshapedData =
+        model.GetDescriptor(reshaped.TensorDescriptorKey()).ForwardData;
+    CHECK(reshapedData.DenseMatHost != xData.DenseMatHost);
+    for (unsigned int i = 0; i < xData.TensorShape.Size() * 2; ++i)
+        CHECK(GetAt(reshapedData, i) == GetAt(xData, i));
+
+    ModelManager::ClearModels();
+}
+
+void TestChunkView()
+{
+    ModelManager::AddModel("ChunkTest");
+    ModelManager::SetCurrentModel("ChunkTest");
+    Model& model = ModelManager::GetCurrentModel();
+    const Device host("host");
+
+    const int key = model.RegisterTensorDescriptor(Shape({ 5, 3 }),
+                                                   Type::Dense, host, 1, true);
+    const Tensor x(Shape({ 5, 3 }), key);
+    FillIndex(model.GetDescriptor(key).ForwardData);
+
+    //! Rows are contiguous, so every chunk is a view
+    const auto rowChunks = Chunk(x, 2, 0);
+    CHECK(rowChunks.size() == 2);
+    CHECK(rowChunks[0].GetShape() == Shape({ 3, 3 }));
+    CHECK(rowChunks[1].GetShape() == Shape({ 2, 3 }));
+    const auto& secondChunk =
+        model.GetDescriptor(rowChunks[1].TensorDescriptorKey()).ForwardData;
+    CHECK(secondChunk.IsView());
+    for (unsigned int i = 0; i < 6; ++i)
+        CHECK(GetAt(secondChunk, i) == static_cast<float>(9 + i));
+
+    //! Chunks along the columns are copied
+    const auto colChunks = Chunk(x, 3, 1);
+    CHECK(colChunks.size() == 3);
+    const auto& lastColumn =
+        model.GetDescriptor(colChunks[2].TensorDescriptorKey()).ForwardData;
+    CHECK(!lastColumn.IsView());
+    for (unsigned int i = 0; i < 5; ++i)
+        CHECK(GetAt(lastColumn, i) == static_cast<float>(i * 3 + 2));
+
+    ModelManager::ClearModels();
+}
+
+void TestViewCopyOnWrite()
+{
+    ModelManager::AddModel("CopyOnWriteTest");
+    ModelManager::SetCurrentModel("CopyOnWriteTest");
+    Model& model = ModelManager::GetCurrentModel();
+    const Device host("host");
+
+    const int key = model.RegisterTensorDescriptor(Shape({ 2, 8 }),
+                                                   Type::Dense, host, 1, true);
+    const Tensor x(Shape({ 2, 8 }), key);
+    FillIndex(model.GetDescriptor(key).ForwardData);
+
+    const Tensor view = Flatten(x);
+    auto& viewData =
+        model.GetDescriptor(view.TensorDescriptorKey()).ForwardData;
+    auto& xData = model.GetDescriptor(key).ForwardData;
+    CHECK(viewData.DenseMatHost == xData.DenseMatHost);
+
+    //! Writing to the view detaches it from the source
+    Compute::Scale(viewData, viewData, 2.0f);
+    CHECK(viewData.DenseMatHost != xData.DenseMatHost);
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+        CHECK(GetAt(xData, i) == static_cast<float>(i));
+        CHECK(GetAt(viewData, i) == static_cast<float>(2 * i));
+    }
+
+    //! Source is no longer shared with other views, so it is written in place
+    //! even while its copies (e.g. saved tensors) are alive
+    {
+        const auto saved = xData;
+        const float* buffer = xData.DenseMatHost;
+        Compute::Scale(xData, xData, 3.0f);
+        CHECK(xData.DenseMatHost == buffer);
+        CHECK(saved.DenseMatHost == buffer);
+        for (unsigned int i = 0; i < 16; ++i)
+            CHECK(GetAt(xData, i) == static_cast<float>(3 * i));
+    }
+
+    //! Gradient of the view is shared with the source
+    auto& viewGrad =
+        model.GetDescriptor(view.TensorDescriptorKey()).BackwardData;
+    auto& xGrad = model.GetDescriptor(key).BackwardData;
+    Compute::Initialize::Ones(viewGrad);
+    for (unsigned int i = 0; i < 16; ++i)
+        CHECK(GetAt(xGrad, i) == 1.0f);
+
+    ModelManager::ClearModels();
+}
+
+void TestTransposeView()
+{
+    const Device host("host");
+    TensorUtil::TensorData a(Shape({ 3, 5 }), Type::Dense, host, 2);
+    TensorUtil::TensorData b(Shape({ 3, 4 }), Type::Dense, host, 2);
+    TensorUtil::TensorData c(Shape({ 5, 4 }), Type::Dense, host, 2);
+    TensorUtil::TensorData transposedA(Shape({ 5, 3 }), Type::Dense, host, 2);
+    TensorUtil::TensorData expected(Shape({ 5, 4 }), Type::Dense, host, 2);
+    TensorUtil::TensorData out(Shape({ 5, 4 }), Type::Dense, host, 2);
+    FillIndex(a);
+    FillIndex(b);
+    Compute::Initialize::Zeros(c);
+
+    Compute::Transpose(transposedA, a);
+    Compute::Gemm(expected, transposedA, b, c);
+
+    //! Transposed view is consumed by gemm without being copied
+    const auto aView = a.CreateTransposeView(-1, false);
+    CHECK(!aView.IsContiguous());
+    CHECK(aView.IsMatrixContiguous());
+    CHECK(aView.DenseMatHost == a.DenseMatHost);
+    Compute::Gemm(out, aView, b, c);
+    for (unsigned int i = 0; i < 40; ++i)
+        CHECK(GetAt(out, i) == GetAt(expected, i));
+
+    //! Elementwise operations read the contiguous copy of the view
+    TensorUtil::TensorData sum(Shape({ 5, 3 }), Type::Dense, host, 2);
+    Compute::Add(sum, aView, transposedA);
+    for (unsigned int i = 0; i < 30; ++i)
+        CHECK(GetAt(sum, i) == 2 * GetAt(transposedA, i));
+}
+
+void TestPermuteView()
+{
+    ModelManager::AddModel("PermuteTest");
+    ModelManager::SetCurrentModel("PermuteTest");
+    Model& model = ModelManager::GetCurrentModel();
+    const Device host("host");
+
+    const int key = model.RegisterTensorDescriptor(Shape({ 2, 3, 4 }),
+                                                   Type::Dense, host, 1, true);
+    const Tensor x(Shape({ 2, 3, 4 }), key);
+    FillIndex(model.GetDescriptor(key).ForwardData);
+
+    const Tensor permuted = Permute(x, { 2, 0, 1 });
+    CHECK(permuted.GetShape() == Shape({ 4, 2, 3 }));
+    const auto& permutedData =
+        model.GetDescriptor(permuted.TensorDescriptorKey()).ForwardData;
+    CHECK(!permutedData.IsContiguous());
+    CHECK(permutedData.DenseMatHost ==
+          model.GetDescriptor(key).ForwardData.DenseMatHost);
+
+    const auto contiguous = permutedData.GetContiguous();
+    for (unsigned int k = 0; k < 4; ++k)
+        for (unsigned int i = 0; i < 2; ++i)
+            for (unsigned int j = 0; j < 3; ++j)
+                CHECK(GetAt(contiguous, k * 6 + i * 3 + j) ==
+                      static_cast<float>(i * 12 + j * 4 + k));
+
+    //! Threads reading the view at the same time get the same cached copy
+    {
+        const auto fresh =
+            model.GetDescriptor(Permute(x, { 2, 0, 1 }).TensorDescriptorKey())
+                .ForwardData;
+        std::vector<const float*> copies(4, nullptr);
+        std::vector<std::thread> threads;
+        for (std::size_t idx = 0; idx < copies.size(); ++idx)
+            threads.emplace_back([&fresh, &copies, idx]() {
+                copies[idx] = fresh.GetContiguous().DenseMatHost;
+            });
+        for (auto& thread : threads)
+            thread.join();
+        for (const auto* copy : copies)
+            CHECK(copy == fresh.GetContiguous().DenseMatHost);
+    }
+
+    //! Permuting back restores the contiguous layout
+    const Tensor restored = Permute(permuted, { 1, 2, 0 });
+    const auto& restoredData =
+        model.GetDescriptor(restored.TensorDescriptorKey()).ForwardData;
+    CHECK(restoredData.IsContiguous());
+    for (unsigned int i = 0; i < 24; ++i)
+        CHECK(GetAt(restoredData, i) == static_cast<float>(i));
+
+    ModelManager::ClearModels();
+}
+}  // namespace Sapphire::Test
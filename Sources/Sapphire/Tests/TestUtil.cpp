@@ -5,7 +5,10 @@
 // property of any third parties.
 
 #include <Sapphire/Tests/TestUtil.hpp>
+#include <Sapphire/tensor/TensorData.hpp>
+#include <cmath>
 #include <random>
+#include "doctest.h"
 
 namespace Sapphire::Test
 {
@@ -55,4 +58,117 @@ void InitRandomDenseMatrix(float* matrixPtr, const size_t m, const size_t n,
                               colIdx] = 0.0f;
             }
 }
-} // namespace Sapphire::Test
+
+float& ElementAt(const TensorUtil::TensorData& tensorData, unsigned int n,
+                 unsigned int c, unsigned int h, unsigned int w)
+{
+    const auto& shape = tensorData.TensorShape;
+    return tensorData.DenseMatHost[((static_cast<std::size_t>(n) *
+                                         shape.At(0) +
+                                     c) *
+                                        shape.At(1) +
+                                    h) *
+                                       tensorData.PaddedHostColSize +
+                                   w];
+}
+
+void CheckClose(const TensorUtil::TensorData& tensorData,
+                const std::vector<float>& expected, float tolerance)
+{
+    const auto& shape = tensorData.TensorShape;
+    std::size_t idx = 0;
+    for (unsigned int n = 0; n < tensorData.BatchSize; ++n)
+        for (unsigned int c = 0; c < shape.At(0); ++c)
+            for (unsigned int h = 0; h < shape.At(1); ++h)
+                for (unsigned int w = 0; w < shape.At(2); ++w, ++idx)
+                    CHECK(std::abs(ElementAt(tensorData, n, c, h, w) -
+                                   expected[idx]) <
+                          tolerance * (1.0f + std::abs(expected[idx])));
+}
+
+float& MatrixAt(const TensorUtil::TensorData& tensorData,
+                std::size_t matrixIdx, unsigned int row, unsigned int col)
+{
+    return tensorData.DenseMatHost[(matrixIdx * tensorData.Rows() + row) *
+                                       tensorData.PaddedHostColSize +
+                                   col];
+}
+
+float GetAt(const TensorUtil::TensorData& tensorData, unsigned int idx)
+{
+    const auto cols = tensorData.Cols();
+    return tensorData
+        .DenseMatHost[(idx / cols) * tensorData.PaddedHostColSize + idx % cols];
+}
+
+std::vector<float> GetValues(const TensorUtil::TensorData& tensorData)
+{
+    const auto cols = tensorData.Cols();
+    const auto rows = tensorData.TensorShape.Size() / cols *
+                      static_cast<std::size_t>(tensorData.BatchSize);
+    std::vector<float> values;
+    values.reserve(rows * cols);
+    for (std::size_t row = 0; row < rows; ++row)
+        for (unsigned int col = 0; col < cols; ++col)
+            values.emplace_back(
+                tensorData.DenseMatHost[row * tensorData.PaddedHostColSize +
+                                        col]);
+    return values;
+}
+
+std::vector<float> ToVector(const TensorUtil::TensorData& tensorData)
+{
+    return std::vector<float>(
+        tensorData.DenseMatHost,
+        tensorData.DenseMatHost + tensorData.DenseTotalLengthHost);
+}
+
+void Fill(const TensorUtil::TensorData& tensorData, unsigned int seed)
+{
+    const auto numMatrices = tensorData.TensorShape.Size() /
+                             (tensorData.Rows() * tensorData.Cols()) *
+                             tensorData.BatchSize;
+    for (std::size_t matrixIdx = 0; matrixIdx < numMatrices; ++matrixIdx)
+        for (unsigned int row = 0; row < tensorData.Rows(); ++row)
+            for (unsigned int col = 0; col < tensorData.Cols(); ++col)
+                MatrixAt(tensorData, matrixIdx, row, col) =
+                    static_cast<float>((matrixIdx * 7 + row * 3 + col * 5 +
+                                        seed) %
+                                       17) *
+                        0.125f -
+                    1.0f;
+}
+
+void FillIndex(const TensorUtil::TensorData& tensorData)
+{
+    const auto cols = tensorData.Cols();
+    const auto totalSize = tensorData.TensorShape.Size() * tensorData.BatchSize;
+    for (unsigned int i = 0; i < totalSize; ++i)
+        tensorData.DenseMatHost[(i / cols) * tensorData.PaddedHostColSize +
+                                i % cols] = static_cast<float>(i);
+}
+
+void FillSmallIntegers(const TensorUtil::TensorData& tensorData)
+{
+    const auto cols = tensorData.Cols();
+    const auto totalSize = tensorData.TensorShape.Size() * tensorData.BatchSize;
+    for (unsigned int i = 0; i < totalSize; ++i)
+        tensorData.DenseMatHost[(i / cols) * tensorData.PaddedHostColSize +
+                                i % cols] = static_cast<float>(i % 7) - 3.0f;
+}
+
+void FillQuantizable(const TensorUtil::TensorData& tensorData)
+{
+    const auto cols = tensorData.Cols();
+    const auto totalSize = tensorData.TensorShape.Size() * tensorData.BatchSize;
+    for (unsigned int i = 0; i < totalSize; ++i)
+    {
+        const auto row = i / cols;
+        const auto col = i % cols;
+        tensorData.DenseMatHost[row * tensorData.PaddedHostColSize + col] =
+            row == 0 || col == 0
+                ? 127.0f
+                : static_cast<float>(static_cast<int>((i * 37) % 255) - 127);
+    }
+}
+}  // namespace Sapphire::Test
@@ -0,0 +1,127 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Tests/ThreadPoolTest.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+void TestParallelFor()
+{
+    Util::ThreadPool threadPool(4);
+    std::vector<int> visited(10007, 0);
+
+    threadPool.ParallelFor(0, visited.size(), 16,
+                           [&](std::size_t begin, std::size_t end) {
+                               CHECK(end - begin <= 16);
+                               for (auto idx = begin; idx < end; ++idx)
+                                   ++visited[idx];
+                           });
+    for (auto count : visited)
+        CHECK(count == 1);
+
+    //! Nested parallel loops run on the same workers
+    std::atomic<unsigned long> sum = 0;
+    threadPool.ParallelFor(0, 64, 1, [&](std::size_t begin, std::size_t end) {
+        for (auto outer = begin; outer < end; ++outer)
+            threadPool.ParallelFor(
+                0, 100, 10, [&](std::size_t innerBegin, std::size_t innerEnd) {
+                    for (auto inner = innerBegin; inner < innerEnd; ++inner)
+                        sum += inner;
+                });
+    });
+    CHECK(sum == 64 * 4950);
+}
+
+void TestParallelForException()
+{
+    Util::ThreadPool threadPool(4);
+    const auto throwing = [](std::size_t begin, std::size_t end) {
+        for (auto idx = begin; idx < end; ++idx)
+            if (idx % 1000 == 777)
+                throw std::runtime_error("chunk failed");
+    };
+
+    //! Thrown on the workers and rethrown on the thread outside the pool
+    CHECK_THROWS_AS(threadPool.ParallelFor(0, 10000, 1, throwing),
+                    std::runtime_error);
+
+    //! Thrown by the nested loop of a worker and rethrown by the outer loop
+    CHECK_THROWS_AS(
+        threadPool.ParallelFor(0, 16, 1,
+                               [&](std::size_t, std::size_t) {
+                                   threadPool.ParallelFor(0, 10000, 7,
+                                                          throwing);
+                               }),
+        std::runtime_error);
+
+    //! Pool keeps working after the exceptions
+    std::atomic<unsigned long> sum = 0;
+    threadPool.ParallelFor(0, 1000, 3, [&](std::size_t begin, std::size_t end) {
+        for (auto idx = begin; idx < end; ++idx)
+            sum += idx;
+    });
+    CHECK(sum == 999 * 1000 / 2);
+}
+
+void TestTaskGroup()
+{
+    Util::ThreadPool threadPool(3);
+    std::atomic<int> count = 0;
+    {
+        Util::TaskGroup taskGroup(threadPool);
+        for (int i = 0; i < 100; ++i)
+            taskGroup.Run([&count]() { ++count; });
+        taskGroup.Wait();
+        CHECK(count == 100);
+
+        taskGroup.Run([]() { throw std::runtime_error("task failed"); });
+        CHECK_THROWS_AS(taskGroup.Wait(), std::runtime_error);
+    }
+}
+
+void TestThreadBudget()
+{
+    const auto previousBudget = Util::ThreadPool::GetGlobalThreadBudget();
+    Util::ThreadPool::SetGlobalThreadBudget(2);
+    CHECK(Util::ThreadPool::Global().NumThreads() == 2);
+
+    std::mutex mtx;
+    std::set<std::thread::id> threadIds;
+    std::atomic<unsigned long> sum = 0;
+
+    //! Two sessions running parallel loops at the same time
+    auto session = [&]() {
+        for (int iteration = 0; iteration < 20; ++iteration)
+            Util::ParallelFor(0, 1000, 10,
+                              [&](std::size_t begin, std::size_t end) {
+                                  {
+                                      std::lock_guard<std::mutex> lock(mtx);
+                                      threadIds.insert(
+                                          std::this_thread::get_id());
+                                  }
+                                  for (auto idx = begin; idx < end; ++idx)
+                                      sum += idx;
+                              });
+    };
+    std::thread sessionA(session);
+    std::thread sessionB(session);
+    sessionA.join();
+    sessionB.join();
+
+    CHECK(sum == 2 * 20 * 499500ul);
+    CHECK(threadIds.size() <= 2);
+
+    Util::ThreadPool::SetGlobalThreadBudget(previousBudget);
+}
+}  // namespace Sapphire::Test
@@ -0,0 +1,87 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Tests/TestUtil.hpp>
+#include <Sapphire/Tests/TransposeTest.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/tensor/TensorData.hpp>
+#include <stdexcept>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+void TestTranspose()
+{
+    const Device host("host");
+    const unsigned int sizes[][2] = { { 1, 1 },   { 8, 8 },   { 16, 16 },
+                                      { 3, 17 },  { 33, 9 },  { 64, 64 },
+                                      { 70, 130 }, { 129, 65 } };
+
+    for (const auto& size : sizes)
+        for (unsigned int inputBatch : { 1u, 3u })
+        {
+            const auto rows = size[0], cols = size[1];
+            const unsigned int batchSize = 3;
+            //! Input with a single batch holds one matrix which is broadcast
+            const auto inputShape = inputBatch == 1
+                                        ? Shape({ rows, cols })
+                                        : Shape({ 2, rows, cols });
+            TensorUtil::TensorData input(inputShape, Type::Dense, host,
+                                         inputBatch);
+            TensorUtil::TensorData output(Shape({ 2, cols, rows }),
+                                          Type::Dense, host, batchSize);
+            FillIndex(input);
+
+            Compute::Transpose(output, input);
+
+            for (unsigned int matrixIdx = 0; matrixIdx < 2 * batchSize;
+                 ++matrixIdx)
+                for (unsigned int row = 0; row < rows; ++row)
+                    for (unsigned int col = 0; col < cols; ++col)
+                        CHECK(MatrixAt(output, matrixIdx, col, row) ==
+                              MatrixAt(input, inputBatch == 1 ? 0 : matrixIdx,
+                                       row, col));
+        }
+}
+
+void TestTransposeInPlace()
+{
+    const Device host("host");
+    for (unsigned int size : { 1u, 7u, 16u, 37u, 80u })
+    {
+        const unsigned int batchSize = 2;
+        TensorUtil::TensorData data(Shape({ 3, size, size }), Type::Dense,
+                                    host, batchSize);
+        FillIndex(data);
+        const auto original = data.CreateCopy();
+
+        Compute::Transpose(data, data);
+        for (unsigned int matrixIdx = 0; matrixIdx < 3 * batchSize;
+             ++matrixIdx)
+            for (unsigned int row = 0; row < size; ++row)
+                for (unsigned int col = 0; col < size; ++col)
+                    CHECK(MatrixAt(data, matrixIdx, col, row) ==
+                          MatrixAt(original, matrixIdx, row, col));
+    }
+
+    TensorUtil::TensorData rectangle(Shape({ 4, 6 }), Type::Dense, host, 1);
+    CHECK_THROWS_AS(Compute::Transpose(rectangle, rectangle),
+                    std::invalid_argument);
+
+    //! Transposed view is made contiguous by the blocked transpose
+    TensorUtil::TensorData input(Shape({ 3, 21, 45 }), Type::Dense, host, 2);
+    FillIndex(input);
+    const auto contiguous = input.CreateTransposeView(-1, false)
+                                .GetContiguous();
+    REQUIRE(contiguous.IsContiguous());
+    REQUIRE(contiguous.TensorShape == Shape({ 3, 45, 21 }));
+    for (unsigned int matrixIdx = 0; matrixIdx < 6; ++matrixIdx)
+        for (unsigned int row = 0; row < 21; ++row)
+            for (unsigned int col = 0; col < 45; ++col)
+                CHECK(MatrixAt(contiguous, matrixIdx, col, row) ==
+                      MatrixAt(input, matrixIdx, row, col));
+}
+}  // namespace Sapphire::Test
@@ -5,17 +5,262 @@
 // property of any third parties.
 
 #include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/cudaUtil/Memory.hpp>
 #include <Sapphire/compute/cudaUtil/CudaParams.cuh>
 #include <Sapphire/compute/dense/cuda/Basic.cuh>
 #include <Sapphire/compute/dense/cuda/Gemm.cuh>
 #include <Sapphire/compute/dense/naive/NaiveBasic.hpp>
+#include <Sapphire/compute/dense/naive/NaiveBroadcast.hpp>
+#include <Sapphire/compute/dense/naive/NaiveConvolution.hpp>
+#include <Sapphire/compute/dense/naive/NaiveEmbedding.hpp>
 #include <Sapphire/compute/dense/naive/NaiveGemm.hpp>
+#include <Sapphire/compute/dense/naive/NaiveHalf.hpp>
+#include <Sapphire/compute/dense/naive/NaiveInt8.hpp>
+#include <Sapphire/compute/dense/naive/NaiveLoss.hpp>
+#include <Sapphire/compute/dense/naive/NaiveNormalization.hpp>
+#include <Sapphire/compute/dense/naive/NaivePooling.hpp>
+#include <Sapphire/compute/dense/naive/NaiveRandom.hpp>
+#include <Sapphire/compute/dense/naive/NaiveTranspose.hpp>
+#include <Sapphire/operations/Unit.hpp>
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
 
 namespace Sapphire::Compute
 {
+//! Returns true if element-wise operands are stored in 16 bits
+//! 16 bit operands must have the same data type and shape since broadcast is
+//! not supported for them
+static bool IsHalfElementWise(const TensorData& out, const TensorData& a,
+                              const TensorData& b)
+{
+    const auto dataType = out.GetDataType();
+    if (a.GetDataType() != dataType || b.GetDataType() != dataType)
+        throw std::invalid_argument("Data type mismatch between operands");
+
+    if (dataType == DataType::Float32)
+        return false;
+    if (dataType == DataType::Int8)
+        throw std::invalid_argument(
+            "Element-wise operation of Int8 data type is not implemented");
+
+    if (a.TensorShape != out.TensorShape || b.TensorShape != out.TensorShape ||
+        a.BatchSize != out.BatchSize || b.BatchSize != out.BatchSize)
+        throw std::invalid_argument(
+            "Broadcast of 16 bit data type is not implemented");
+    return true;
+}
+
+//! Throws invalid_argument unless every operand is stored in Float32
+//! Host data of 16 and 8 bit tensors is smaller than the Float32 kernels
+//! read and write, so they must be rejected before reaching the kernels
+static void CheckFloat32(const char* name,
+                         std::initializer_list<const TensorData*> operands)
+{
+    for (const auto* operand : operands)
+        if (operand->GetDataType() != DataType::Float32)
+            throw std::invalid_argument(
+                std::string("Compute::") + name +
+                " - Only Float32 tensors are supported");
+}
+
+//! Returns stride between the matrices of the gemm operand with numMatrices
+//! matrices. Operand with single matrix is broadcast
+static unsigned long GemmBroadcastStride(unsigned long numMatrices,
+                                         unsigned long numMatricesOut,
+                                         unsigned long matrixSize)
+{
+    if (numMatrices == 1)
+        return 0;
+    if (numMatrices != numMatricesOut)
+        throw std::invalid_argument("Gemm - Batch size mismatch");
+    return matrixSize;
+}
+
+//! Gemm with a and b stored in 16 bits accumulated in float
+//! out and c must be float tensors
+static void HalfGemm(TensorData& out, const TensorData& a, const TensorData& b,
+                     const TensorData& c)
+{
+    const auto dataType = a.GetDataType();
+    if (b.GetDataType() != dataType || out.GetDataType() != DataType::Float32 ||
+        c.GetDataType() != DataType::Float32)
+        throw std::invalid_argument(
+            "Gemm - a and b must have same data type with float out and c");
+
+    if (out.GetDevice().Type() != DeviceType::HOST)
+        throw std::invalid_argument(
+            "Gemm - 16 bit data type is only available on the host");
+
+    if (!c.IsContiguous())
+        return HalfGemm(out, a, b, c.GetContiguous());
+
+    out.CopyOnWrite();
+
+    const auto M = out.Rows();
+    const auto N = out.Cols();
+    const auto K = a.Cols();
+    if (a.Rows() != M || b.Rows() != K || b.Cols() != N || c.Rows() != M ||
+        c.Cols() != N)
+        throw std::invalid_argument("Gemm - Shape mismatch");
+
+    const auto numMatrices = out.TensorShape.Size() * out.BatchSize / (M * N);
+    const auto strideA = GemmBroadcastStride(
+        a.TensorShape.Size() * a.BatchSize / (M * K), numMatrices,
+        M * a.PaddedHostColSize);
+    const auto strideB = GemmBroadcastStride(
+        b.TensorShape.Size() * b.BatchSize / (K * N), numMatrices,
+        K * b.PaddedHostColSize);
+    const auto strideC = GemmBroadcastStride(
+        c.TensorShape.Size() * c.BatchSize / (M * N), numMatrices,
+        M * c.PaddedHostColSize);
+
+    Dense::Naive::HalfGemm(numMatrices, out.DenseMatHost, a.HalfMatHost(),
+                           b.HalfMatHost(), c.DenseMatHost, M, N,
+                           out.PaddedHostColSize, K, a.PaddedHostColSize,
+                           strideA, strideB, strideC, dataType);
+}
+
+//! Gemm with int8 weight b quantized for each column
+//! b must be a transposed view of the quantized weight so that each column is
+//! stored contiguously. Float a is quantized for each row before computation
+static void Int8Gemm(TensorData& out, const TensorData& a, const TensorData& b,
+                     const TensorData& c)
+{
+    if (out.GetDataType() != DataType::Float32 ||
+        c.GetDataType() != DataType::Float32)
+        throw std::invalid_argument("Gemm - out and c must be float tensors");
+
+    if (out.GetDevice().Type() != DeviceType::HOST)
+        throw std::invalid_argument(
+            "Gemm - Int8 data type is only available on the host");
+
+    if (b.TensorShape.Dim() != 2 || b.BatchSize != 1 || b.IsContiguous() ||
+        b.RowStride() != 1)
+        throw std::invalid_argument(
+            "Gemm - Int8 b must be transposed view of quantized weight");
+
+    if (a.GetDataType() != DataType::Int8)
+        return Int8Gemm(out, a.ConvertTo(DataType::Int8), b, c);
+
+    if (!c.IsContiguous())
+        return Int8Gemm(out, a, b, c.GetContiguous());
+
+    out.CopyOnWrite();
+
+    const auto N = out.Cols();
+    const auto K = a.Cols();
+    if (b.Rows() != K || b.Cols() != N || c.Cols() != N)
+        throw std::invalid_argument("Gemm - Shape mismatch");
+
+    const auto rows = out.TensorShape.Size() * out.BatchSize / N;
+    if (a.TensorShape.Size() * a.BatchSize / K != rows)
+        throw std::invalid_argument("Gemm - Batch size mismatch");
+    const auto strideC = GemmBroadcastStride(
+        c.TensorShape.Size() * c.BatchSize / N, rows, c.PaddedHostColSize);
+
+    Dense::Naive::Int8Gemm(rows, out.DenseMatHost, a.Int8MatHost(),
+                           a.ScaleHost(), b.Int8MatHost(), b.ScaleHost(),
+                           c.DenseMatHost, strideC, N, out.PaddedHostColSize,
+                           K, static_cast<unsigned int>(b.ColStride()));
+}
+
+//! Key of the cached broadcast plan
+struct BroadcastKey
+{
+    Shape ShapeOut, ShapeA, ShapeB;
+    unsigned int PaddedOut = 0, PaddedA = 0, PaddedB = 0;
+
+    bool operator==(const BroadcastKey& key) const
+    {
+        return ShapeOut == key.ShapeOut && ShapeA == key.ShapeA &&
+               ShapeB == key.ShapeB && PaddedOut == key.PaddedOut &&
+               PaddedA == key.PaddedA && PaddedB == key.PaddedB;
+    }
+};
+
+//! Returns the plan of the host element-wise operation broadcasting a and b
+//! to out
+//! Shapes have the batch size as the first dimension and the same number of
+//! dimensions. Padded sizes are the padded row sizes of each operand
+//! Plans are cached by the shapes on each thread in a direct mapped table, so
+//! repeated shapes neither rebuild the plan nor allocate. Plan is returned by
+//! value since the thread may run other operations replacing the entry while
+//! it waits for the workers
+static Dense::Naive::BroadcastPlan GetBroadcastPlan(
+    const Shape& shapeOut, const Shape& shapeA, const Shape& shapeB,
+    unsigned int paddedOut, unsigned int paddedA, unsigned int paddedB)
+{
+    struct CacheEntry
+    {
+        BroadcastKey Key;
+        Dense::Naive::BroadcastPlan Plan;
+        bool IsValid = false;
+    };
+    constexpr std::size_t cacheSize = 64;
+    thread_local std::array<CacheEntry, cacheSize> cache;
+
+    const BroadcastKey key{ shapeOut, shapeA, shapeB,
+                            paddedOut, paddedA, paddedB };
+    std::size_t hash = paddedOut * 31 + paddedA * 7 + paddedB;
+    for (const auto* shape : { &shapeOut, &shapeA, &shapeB })
+        for (unsigned int dim = 0; dim < shape->Dim(); ++dim)
+            hash = hash * 131 + shape->At(dim);
+
+    auto& entry = cache[hash % cacheSize];
+    if (entry.IsValid && entry.Key == key)
+        return entry.Plan;
+
+    const auto numDims = shapeOut.Dim();
+    std::array<std::size_t, Dense::Naive::MaxBroadcastDims> sizes[3]{},
+        strides[3]{};
+    const Shape* shapes[3] = { &shapeOut, &shapeA, &shapeB };
+    const unsigned int paddedCols[3] = { paddedOut, paddedA, paddedB };
+
+    //! Padding is computed as a part of the rows if every operand has the
+    //! same columns, so the rows can be coalesced
+    const bool isPaddingShared = shapeA.Cols() == shapeOut.Cols() &&
+                                 shapeB.Cols() == shapeOut.Cols() &&
+                                 paddedA == paddedOut && paddedB == paddedOut;
+    for (int operand = 0; operand < 3; ++operand)
+    {
+        std::size_t stride = 1;
+        for (auto dim = numDims; dim-- > 0;)
+        {
+            const bool isCol = dim == numDims - 1;
+            sizes[operand][dim] = isCol && isPaddingShared
+                                      ? paddedCols[operand]
+                                      : shapes[operand]->At(dim);
+            strides[operand][dim] = stride;
+            stride *= isCol ? paddedCols[operand] : sizes[operand][dim];
+        }
+    }
+
+    entry.Plan = Dense::Naive::MakeBroadcastPlan(
+        numDims, sizes[0].data(), sizes[1].data(), sizes[2].data(),
+        strides[0].data(), strides[1].data(), strides[2].data());
+    entry.Key = key;
+    entry.IsValid = true;
+    return entry.Plan;
+}
+
 void Add(TensorData& out, const TensorData& a, const TensorData& b)
 {
+    if (IsHalfElementWise(out, a, b))
+    {
+        out.CopyOnWrite();
+        Dense::Naive::HalfAdd(out.DenseTotalLengthHost, out.HalfMatHost(),
+                              a.HalfMatHost(), b.HalfMatHost(),
+                              out.GetDataType());
+        return;
+    }
+
+    if (!a.IsContiguous() || !b.IsContiguous())
+        return Add(out, a.GetContiguous(), b.GetContiguous());
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -64,22 +309,35 @@ void Add(TensorData& out, const TensorData& a, const TensorData& b)
     {
         BroadcastWith2Inputs(shapeOut, shapeA, shapeB, sizeOut, sizeA, sizeB,
                              out.DenseMatCuda, a.DenseMatCuda, b.DenseMatCuda,
-                             0, 0, Dense::Cuda::Add, 0, false, false);
+                             0, 0, false, Dense::Cuda::Add, 0, false, false);
     }
     else
     {
-        const auto paddedSizeOut = (sizeOut / N) * paddedN;
-        const auto paddedSizeA = (sizeA / N) * paddedN;
-        const auto paddedSizeB = (sizeB / N) * paddedN;
-        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, paddedSizeOut,
-                             paddedSizeA, paddedSizeB, out.DenseMatHost,
-                             a.DenseMatHost, b.DenseMatHost, 0, 0,
-                             Dense::Naive::Add, 0, false, false);
+        const auto plan = GetBroadcastPlan(shapeOut, shapeA, shapeB, paddedN,
+                                           a.PaddedHostColSize,
+                                           b.PaddedHostColSize);
+        Dense::Naive::BroadcastBinary(out.DenseMatHost, a.DenseMatHost,
+                                      b.DenseMatHost, plan,
+                                      Dense::Naive::BinaryOp::Add);
     }
 }
 
 void Sub(TensorData& out, const TensorData& a, const TensorData& b)
 {
+    if (IsHalfElementWise(out, a, b))
+    {
+        out.CopyOnWrite();
+        Dense::Naive::HalfSub(out.DenseTotalLengthHost, out.HalfMatHost(),
+                              a.HalfMatHost(), b.HalfMatHost(),
+                              out.GetDataType());
+        return;
+    }
+
+    if (!a.IsContiguous() || !b.IsContiguous())
+        return Sub(out, a.GetContiguous(), b.GetContiguous());
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -125,23 +383,106 @@ void Sub(TensorData& out, const TensorData& a, const TensorData& b)
     {
         BroadcastWith2Inputs(shapeOut, shapeA, shapeB, sizeOut, sizeA, sizeB,
                              out.DenseMatCuda, a.DenseMatCuda, b.DenseMatCuda,
-                             0, 0, Dense::Cuda::Sub, 0, false, false);
+                             0, 0, false, Dense::Cuda::Sub, 0, false, false);
     }
     else
     {
-        const auto paddedSizeOut = (sizeOut / N) * paddedN;
-        const auto paddedSizeA = (sizeA / N) * paddedN;
-        const auto paddedSizeB = (sizeB / N) * paddedN;
-        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, paddedSizeOut,
-                             paddedSizeA, paddedSizeB, out.DenseMatHost,
-                             a.DenseMatHost, b.DenseMatHost, 0, 1,
-                             Dense::Naive::Sub, 0, false, false);
+        const auto plan = GetBroadcastPlan(shapeOut, shapeA, shapeB, paddedN,
+                                           a.PaddedHostColSize,
+                                           b.PaddedHostColSize);
+        Dense::Naive::BroadcastBinary(out.DenseMatHost, a.DenseMatHost,
+                                      b.DenseMatHost, plan,
+                                      Dense::Naive::BinaryOp::Sub);
+    }
+}
+
+//! Batches of the host gemm up to this size are flattened into storage on the
+//! stack, so common gemm calls do not allocate
+constexpr std::size_t InlineGemmBatchSize = 64;
+
+//! Returns number of multiplications in the broadcast of the host gemm
+//! Each dimension iterates over the largest size among the operands
+static std::size_t GemmBatchSize(const Shape& shapeOut, const Shape& shapeA,
+                                 const Shape& shapeB, const Shape& shapeC)
+{
+    std::size_t numEntries = 1;
+    for (unsigned int dim = 0; dim + 2 < shapeOut.Dim(); ++dim)
+        numEntries *= std::max({ shapeOut.At(dim), shapeA.At(dim),
+                                 shapeB.At(dim), shapeC.At(dim) });
+    return numEntries;
+}
+
+//! Flattens the broadcast of the host gemm into the list of multiplications
+//! Operands with smaller size are indexed by the remainder as
+//! BroadcastWith3Inputs does, so outputs are shared if out is broadcast
+//! \param entries : GemmBatchSize entries to write
+//! \param matrixStrideOut : stride between the matrices of out and c
+static void MakeGemmBatch(Dense::Naive::GemmBatchEntry* entries,
+                          const Shape& shapeOut, const Shape& shapeA,
+                          const Shape& shapeB, const Shape& shapeC, float* out,
+                          const float* a, const float* b, const float* c,
+                          std::size_t matrixStrideOut,
+                          std::size_t matrixStrideA,
+                          std::size_t matrixStrideB)
+{
+    using Position = std::array<unsigned int, Shape::MaxDim>;
+    const auto batchDim = shapeOut.Dim() - 2;
+    Position sizes{};
+    for (unsigned int dim = 0; dim < batchDim; ++dim)
+        sizes[dim] = std::max({ shapeOut.At(dim), shapeA.At(dim),
+                                shapeB.At(dim), shapeC.At(dim) });
+    const auto numEntries = GemmBatchSize(shapeOut, shapeA, shapeB, shapeC);
+
+    //! Returns index of the matrix of the operand at given position
+    const auto matrixIndex = [&](const Shape& shape,
+                                 const Position& position) {
+        std::size_t index = 0;
+        for (unsigned int dim = 0; dim < batchDim; ++dim)
+            index = index * shape.At(dim) + position[dim] % shape.At(dim);
+        return index;
+    };
+
+    Position position{};
+    for (std::size_t idx = 0; idx < numEntries; ++idx)
+    {
+        auto& entry = entries[idx];
+        entry.Out = out + matrixIndex(shapeOut, position) * matrixStrideOut;
+        entry.A = a + matrixIndex(shapeA, position) * matrixStrideA;
+        entry.B = b + matrixIndex(shapeB, position) * matrixStrideB;
+        entry.C = c + matrixIndex(shapeC, position) * matrixStrideOut;
+
+        for (auto dim = batchDim; dim-- > 0;)
+        {
+            if (++position[dim] < sizes[dim])
+                break;
+            position[dim] = 0;
+        }
     }
 }
 
 void Gemm(TensorUtil::TensorData& out, const TensorUtil::TensorData& a,
           const TensorUtil::TensorData& b, const TensorUtil::TensorData& c)
 {
+    if (b.GetDataType() == DataType::Int8)
+        return Int8Gemm(out, a, b, c);
+    if (a.GetDataType() != DataType::Float32 ||
+        b.GetDataType() != DataType::Float32)
+        return HalfGemm(out, a, b, c);
+    CheckFloat32("Gemm", { &out, &c });
+
+    //! Host kernel reads transposed matrices directly from their strides
+    //! Other strided operands are read from their contiguous copy
+    const bool isHost = out.GetDevice().Type() == DeviceType::HOST;
+    const bool isReadableA =
+        isHost ? a.IsMatrixContiguous() : a.IsContiguous();
+    const bool isReadableB =
+        isHost ? b.IsMatrixContiguous() : b.IsContiguous();
+    if (!isReadableA || !isReadableB || !c.IsContiguous())
+        return Gemm(out, isReadableA ? a : a.GetContiguous(),
+                    isReadableB ? b : b.GetContiguous(), c.GetContiguous());
+
+    out.CopyOnWrite();
+
     auto shapeOut = out.TensorShape;
     auto shapeA = a.TensorShape;
     auto shapeB = b.TensorShape;
@@ -158,7 +499,6 @@ void Gemm(TensorUtil::TensorData& out, const TensorUtil::TensorData& a,
     const auto N = shapeOut.Cols();
     const auto K = shapeA.Cols();
     const auto paddedN = out.PaddedHostColSize;
-    const auto paddedK = a.PaddedHostColSize;
 
     //! Faster broadcast multiply for Cuda if all tensor dimensions are fixed to
     //! 2
@@ -204,28 +544,69 @@ void Gemm(TensorUtil::TensorData& out, const TensorUtil::TensorData& a,
 
         BroadcastWith3Inputs(shapeOut, shapeA, shapeB, shapeC, sizeOut, sizeA,
                              sizeB, sizeC, out.DenseMatCuda, a.DenseMatCuda,
-                             b.DenseMatCuda, c.DenseMatCuda, 0, 2,
+                             b.DenseMatCuda, c.DenseMatCuda, 0, 2, false,
                              Dense::Cuda::Gemm, M, N, K, &cublasHandle);
 
         cublasDestroy(cublasHandle);
     }
     else
     {
-        const auto paddedSizeOut = (sizeOut / N) * paddedN;
-        const auto paddedSizeA = (sizeA / K) * paddedK;
-        const auto paddedSizeB = (sizeB / N) * paddedN;
-        const auto paddedSizeC = (sizeC / N) * paddedN;
-
-        BroadcastWith3Inputs(shapeOut, shapeA, shapeB, shapeC, paddedSizeOut,
-                             paddedSizeA, paddedSizeB, paddedSizeC,
-                             out.DenseMatHost, a.DenseMatHost, b.DenseMatHost,
-                             c.DenseMatHost, 0, 2, Dense::Naive::NaiveGemm, M,
-                             N, paddedN, K, paddedK);
+        Dense::Naive::GemmBatchShape batchShape;
+        batchShape.M = M;
+        batchShape.N = N;
+        batchShape.K = K;
+        batchShape.RowStrideA = a.RowStride();
+        batchShape.ColStrideA = a.ColStride();
+        batchShape.RowStrideB = b.RowStride();
+        batchShape.ColStrideB = b.ColStride();
+        batchShape.LdOut = paddedN;
+        batchShape.LdC = paddedN;
+
+        //! Large batches are flattened into the heap, whose capacity is
+        //! reused by the following calls on the same thread
+        const auto numEntries =
+            GemmBatchSize(shapeOut, shapeA, shapeB, shapeC);
+        std::array<Dense::Naive::GemmBatchEntry, InlineGemmBatchSize>
+            inlineEntries;
+        thread_local std::vector<Dense::Naive::GemmBatchEntry> heapEntries;
+        auto* entries = inlineEntries.data();
+        if (numEntries > InlineGemmBatchSize)
+        {
+            heapEntries.resize(numEntries);
+            entries = heapEntries.data();
+        }
+        MakeGemmBatch(entries, shapeOut, shapeA, shapeB, shapeC,
+                      out.DenseMatHost, a.DenseMatHost, b.DenseMatHost,
+                      c.DenseMatHost, static_cast<std::size_t>(M) * paddedN,
+                      a.MatrixStride(), b.MatrixStride());
+
+        //! Multiplications writing to the same output are computed in order
+        const auto schedule =
+            numEntries * M * N != sizeOut
+                ? Dense::Naive::GemmSchedule::Matrix
+                : Dense::Naive::ChooseGemmSchedule(
+                      numEntries, M, N, K,
+                      Util::ThreadPool::Global().NumThreads());
+        Dense::Naive::BatchedGemm(batchShape, entries, numEntries, schedule);
     }
 }
 
 void Scale(TensorData& output, const TensorData& input, const float factor)
 {
+    if (IsHalfElementWise(output, input, input))
+    {
+        output.CopyOnWrite();
+        Dense::Naive::HalfScale(output.DenseTotalLengthHost,
+                                output.HalfMatHost(), input.HalfMatHost(),
+                                factor, output.GetDataType());
+        return;
+    }
+
+    if (!input.IsContiguous())
+        return Scale(output, input.GetContiguous(), factor);
+
+    output.CopyOnWrite();
+
     const auto device = output.GetDevice();
     const auto N = output.Cols();
     const auto paddedN = output.PaddedHostColSize;
@@ -246,6 +627,12 @@ void Scale(TensorData& output, const TensorData& input, const float factor)
 
 void Transpose(TensorData& output, const TensorData& input)
 {
+    CheckFloat32("Transpose", { &output, &input });
+    if (!input.IsContiguous())
+        return Transpose(output, input.GetContiguous());
+
+    output.CopyOnWrite();
+
     const auto device = output.GetDevice();
     const auto inputM = input.Rows();
     const auto inputN = input.Cols();
@@ -260,6 +647,15 @@ void Transpose(TensorData& output, const TensorData& input)
         Dense::Cuda::Transpose(output.DenseMatCuda, input.DenseMatCuda, inputM,
                                inputN, chunkSize, broadcast);
     }
+    else if (output.DenseMatHost == input.DenseMatHost)
+    {
+        if (inputM != inputN || paddedM != paddedN)
+            throw std::invalid_argument(
+                "Compute::Transpose - Only square matrices can be transposed "
+                "in place");
+        Dense::Naive::TransposeInPlace(output.DenseMatHost, inputM, paddedM,
+                                       chunkSize);
+    }
     else
     {
         Dense::Naive::Transpose(output.DenseMatHost, input.DenseMatHost, inputM,
@@ -267,8 +663,113 @@ void Transpose(TensorData& output, const TensorData& input)
     }
 }
 
+void Reshape(TensorData& output, const TensorData& input)
+{
+    CheckFloat32("Reshape", { &output, &input });
+    if (!input.IsContiguous())
+        return Reshape(output, input.GetContiguous());
+
+    output.CopyOnWrite();
+
+    const auto device = output.GetDevice();
+    const auto totalSize = output.TensorShape.Size() * output.BatchSize;
+
+    if (totalSize != input.TensorShape.Size() * input.BatchSize)
+        throw std::invalid_argument("Compute::Reshape - Size mismatch");
+
+    if (device.Type() == DeviceType::CUDA)
+    {
+        Cuda::CopyDeviceToDevice(output.DenseMatCuda, input.DenseMatCuda,
+                                 totalSize * sizeof(float));
+    }
+    else
+    {
+        Dense::Naive::Reshape(output.DenseMatHost, input.DenseMatHost,
+                              totalSize, output.Cols(),
+                              output.PaddedHostColSize, input.Cols(),
+                              input.PaddedHostColSize);
+    }
+}
+
+void CopySlice(TensorData& output, const TensorData& input, int dim,
+               unsigned int outputStart, unsigned int inputStart,
+               unsigned int length)
+{
+    CheckFloat32("CopySlice", { &output, &input });
+    if (!input.IsContiguous())
+        return CopySlice(output, input.GetContiguous(), dim, outputStart,
+                         inputStart, length);
+
+    output.CopyOnWrite();
+
+    const auto device = output.GetDevice();
+    const auto& shapeOut = output.TensorShape;
+    const auto& shapeIn = input.TensorShape;
+
+    if (dim < 0 || static_cast<unsigned int>(dim) >= shapeOut.Dim() ||
+        shapeOut.Dim() != shapeIn.Dim() || output.BatchSize != input.BatchSize)
+        throw std::invalid_argument("Compute::CopySlice - Shape mismatch");
+
+    unsigned int outerSize = output.BatchSize;
+    unsigned int innerSize = 1;
+    for (unsigned int i = 0; i < shapeOut.Dim(); ++i)
+    {
+        if (i != static_cast<unsigned int>(dim) &&
+            shapeOut.At(i) != shapeIn.At(i))
+            throw std::invalid_argument("Compute::CopySlice - Shape mismatch");
+        if (i < static_cast<unsigned int>(dim))
+            outerSize *= shapeOut.At(i);
+        if (i > static_cast<unsigned int>(dim))
+            innerSize *= shapeOut.At(i);
+    }
+
+    const auto outputDimSize = shapeOut.At(dim);
+    const auto inputDimSize = shapeIn.At(dim);
+
+    if (outputStart + length > outputDimSize ||
+        inputStart + length > inputDimSize)
+        throw std::invalid_argument(
+            "Compute::CopySlice - Slice exceeds dimension");
+
+    if (device.Type() == DeviceType::CUDA)
+    {
+        //! Each slice is contiguous on cuda since cuda data is not padded
+        for (unsigned int outerIdx = 0; outerIdx < outerSize; ++outerIdx)
+        {
+            Cuda::CopyDeviceToDevice(
+                output.DenseMatCuda +
+                    (outerIdx * outputDimSize + outputStart) * innerSize,
+                input.DenseMatCuda +
+                    (outerIdx * inputDimSize + inputStart) * innerSize,
+                length * innerSize * sizeof(float));
+        }
+    }
+    else
+    {
+        Dense::Naive::CopySlice(
+            output.DenseMatHost, input.DenseMatHost, outerSize, innerSize,
+            outputDimSize, inputDimSize, outputStart, inputStart, length,
+            output.Cols(), output.PaddedHostColSize, input.Cols(),
+            input.PaddedHostColSize);
+    }
+}
+
 void Dot(TensorData& out, const TensorData& a, const TensorData& b)
 {
+    if (IsHalfElementWise(out, a, b))
+    {
+        out.CopyOnWrite();
+        Dense::Naive::HalfDot(out.DenseTotalLengthHost, out.HalfMatHost(),
+                              a.HalfMatHost(), b.HalfMatHost(),
+                              out.GetDataType());
+        return;
+    }
+
+    if (!a.IsContiguous() || !b.IsContiguous())
+        return Dot(out, a.GetContiguous(), b.GetContiguous());
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -319,23 +820,28 @@ void Dot(TensorData& out, const TensorData& a, const TensorData& b)
     {
         BroadcastWith2Inputs(shapeOut, shapeA, shapeB, sizeOut, sizeA, sizeB,
                              out.DenseMatCuda, a.DenseMatCuda, b.DenseMatCuda,
-                             0, 0, Dense::Cuda::Dot, 0, false, false);
+                             0, 0, false, Dense::Cuda::Dot, 0, false, false);
     }
     else
     {
-        const auto paddedSizeOut = (sizeOut / N) * paddedN;
-        const auto paddedSizeA = (sizeA / N) * paddedN;
-        const auto paddedSizeB = (sizeB / N) * paddedN;
-        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, paddedSizeOut,
-                             paddedSizeA, paddedSizeB, out.DenseMatHost,
-                             a.DenseMatHost, b.DenseMatHost, 0, 1,
-                             Dense::Naive::Dot, 0, false, false);
+        const auto plan = GetBroadcastPlan(shapeOut, shapeA, shapeB, paddedN,
+                                           a.PaddedHostColSize,
+                                           b.PaddedHostColSize);
+        Dense::Naive::BroadcastBinary(out.DenseMatHost, a.DenseMatHost,
+                                      b.DenseMatHost, plan,
+                                      Dense::Naive::BinaryOp::Mul);
     }
 }
 
 //! Performs out = input^factor for each element
 void Pow(TensorData& out, const TensorData& input, const float factor)
 {
+    CheckFloat32("Pow", { &out, &input });
+    if (!input.IsContiguous())
+        return Pow(out, input.GetContiguous(), factor);
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -356,6 +862,12 @@ void Pow(TensorData& out, const TensorData& input, const float factor)
 
 void cos(TensorData& out, const TensorData& input)
 {
+    CheckFloat32("cos", { &out, &input });
+    if (!input.IsContiguous())
+        return cos(out, input.GetContiguous());
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -375,6 +887,12 @@ void cos(TensorData& out, const TensorData& input)
 
 void sin(TensorData& out, const TensorData& input)
 {
+    CheckFloat32("sin", { &out, &input });
+    if (!input.IsContiguous())
+        return sin(out, input.GetContiguous());
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -394,6 +912,12 @@ void sin(TensorData& out, const TensorData& input)
 
 void tan(TensorData& out, const TensorData& input)
 {
+    CheckFloat32("tan", { &out, &input });
+    if (!input.IsContiguous())
+        return tan(out, input.GetContiguous());
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -413,6 +937,12 @@ void tan(TensorData& out, const TensorData& input)
 
 void cosh(TensorData& out, const TensorData& input)
 {
+    CheckFloat32("cosh", { &out, &input });
+    if (!input.IsContiguous())
+        return cosh(out, input.GetContiguous());
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -432,6 +962,12 @@ void cosh(TensorData& out, const TensorData& input)
 
 void sinh(TensorData& out, const TensorData& input)
 {
+    CheckFloat32("sinh", { &out, &input });
+    if (!input.IsContiguous())
+        return sinh(out, input.GetContiguous());
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -451,6 +987,12 @@ void sinh(TensorData& out, const TensorData& input)
 
 void tanh(TensorData& out, const TensorData& input)
 {
+    CheckFloat32("tanh", { &out, &input });
+    if (!input.IsContiguous())
+        return tanh(out, input.GetContiguous());
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -470,6 +1012,12 @@ void tanh(TensorData& out, const TensorData& input)
 
 void log(TensorData& out, const TensorData& input)
 {
+    CheckFloat32("log", { &out, &input });
+    if (!input.IsContiguous())
+        return log(out, input.GetContiguous());
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -489,6 +1037,12 @@ void log(TensorData& out, const TensorData& input)
 
 void log10(TensorData& out, const TensorData& input)
 {
+    CheckFloat32("log10", { &out, &input });
+    if (!input.IsContiguous())
+        return log10(out, input.GetContiguous());
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -508,6 +1062,12 @@ void log10(TensorData& out, const TensorData& input)
 
 void ReLU(TensorData& out, const TensorData& input)
 {
+    CheckFloat32("ReLU", { &out, &input });
+    if (!input.IsContiguous())
+        return ReLU(out, input.GetContiguous());
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -527,6 +1087,12 @@ void ReLU(TensorData& out, const TensorData& input)
 
 void ReLUDerivative(TensorData& out, const TensorData& input)
 {
+    CheckFloat32("ReLUDerivative", { &out, &input });
+    if (!input.IsContiguous())
+        return ReLUDerivative(out, input.GetContiguous());
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -547,6 +1113,12 @@ void ReLUDerivative(TensorData& out, const TensorData& input)
 
 void LeakyReLU(TensorData& out, const TensorData& input, float a)
 {
+    CheckFloat32("LeakyReLU", { &out, &input });
+    if (!input.IsContiguous())
+        return LeakyReLU(out, input.GetContiguous(), a);
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -567,6 +1139,12 @@ void LeakyReLU(TensorData& out, const TensorData& input, float a)
 
 void LeakyReluDerivative(TensorData& out, const TensorData& input, float a)
 {
+    CheckFloat32("LeakyReluDerivative", { &out, &input });
+    if (!input.IsContiguous())
+        return LeakyReluDerivative(out, input.GetContiguous(), a);
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -587,6 +1165,12 @@ void LeakyReluDerivative(TensorData& out, const TensorData& input, float a)
 
 void Inverse(TensorData& out, const TensorData& input)
 {
+    CheckFloat32("Inverse", { &out, &input });
+    if (!input.IsContiguous())
+        return Inverse(out, input.GetContiguous());
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -606,27 +1190,172 @@ void Inverse(TensorData& out, const TensorData& input)
 
 void Mean(TensorData& out, const TensorData& x)
 {
-    const auto device = out.GetDevice();
-    const auto N = out.Cols();
-    const auto paddedN = out.PaddedHostColSize;
-    const auto unitSize = out.TensorShape.Size();
-    const auto totalSize = unitSize * out.BatchSize;
-    const auto totalSizeWithPadding = (totalSize / N) * paddedN;
+    CheckFloat32("Mean", { &out, &x });
+    if (!x.IsContiguous())
+        return Mean(out, x.GetContiguous());
 
-    if (device.Type() == DeviceType::CUDA)
+    if (out.GetDevice().Type() == DeviceType::CUDA)
     {
-        Dense::Cuda::Mean(out.DenseMatCuda, x.DenseMatCuda, totalSize,
-                          unitSize);
+        out.CopyOnWrite();
+        const auto unitSize = x.TensorShape.Size();
+        Dense::Cuda::Mean(out.DenseMatCuda, x.DenseMatCuda,
+                          unitSize * x.BatchSize, unitSize);
+        return;
     }
+
+    std::vector<int> dims(x.TensorShape.Dim());
+    for (unsigned int dim = 0; dim < x.TensorShape.Dim(); ++dim)
+        dims[dim] = static_cast<int>(dim);
+    Reduce(out, x, dims, ReduceOp::Mean);
+}
+
+void ColumnSum(TensorData& out, const TensorData& input)
+{
+    CheckFloat32("ColumnSum", { &out, &input });
+    if (!input.IsContiguous())
+        return ColumnSum(out, input.GetContiguous());
+
+    const auto cols = input.Cols();
+    if (out.TensorShape.Size() * out.BatchSize != cols)
+        throw std::invalid_argument(
+            "Compute::ColumnSum - Output size must match columns of input");
+
+    out.CopyOnWrite();
+    const auto rows = input.TensorShape.Size() * input.BatchSize / cols;
+    if (out.GetDevice().Type() == DeviceType::CUDA)
+        Dense::Cuda::ColumnSum(out.DenseMatCuda, input.DenseMatCuda, rows,
+                               cols);
     else
+        Dense::Naive::ColumnSum(out.DenseMatHost, input.DenseMatHost, rows,
+                                cols, input.PaddedHostColSize);
+}
+
+//! Returns dimensions of tensorData including the batch as the first one, and
+//! their strides in the padded host data
+static void GetHostLayout(const TensorData& tensorData,
+                          std::vector<std::size_t>& dims,
+                          std::vector<std::size_t>& strides)
+{
+    const auto& shape = tensorData.TensorShape;
+    dims.assign(shape.Dim() + 1, 1);
+    strides.assign(shape.Dim() + 1, 1);
+    dims[0] = tensorData.BatchSize;
+    for (unsigned int dim = 0; dim < shape.Dim(); ++dim)
+        dims[dim + 1] = shape.At(dim);
+
+    //! Last dimension is contiguous and the others are multiples of the
+    //! padded rows
+    std::size_t stride = tensorData.PaddedHostColSize;
+    for (auto dim = dims.size() - 1; dim > 0; --dim)
+    {
+        strides[dim - 1] = stride;
+        stride *= dims[dim - 1];
+    }
+}
+
+void Reduce(TensorData& out, const TensorData& input,
+            const std::vector<int>& dims, ReduceOp op)
+{
+    if (!input.IsContiguous())
+        return Reduce(out, input.GetContiguous(), dims, op);
+
+    if (out.GetDevice().Type() != DeviceType::HOST ||
+        input.GetDevice().Type() != DeviceType::HOST)
+        throw std::runtime_error(
+            "Compute::Reduce - Only host tensors are supported");
+    if (out.GetType() != Type::Dense || input.GetType() != Type::Dense ||
+        out.GetDataType() != DataType::Float32 ||
+        input.GetDataType() != DataType::Float32 || !out.IsContiguous())
+        throw std::invalid_argument(
+            "Compute::Reduce - Only contiguous dense Float32 tensors are "
+            "supported");
+
+    std::vector<std::size_t> inputDims, inputStrides, outputDims,
+        outputStrides;
+    GetHostLayout(input, inputDims, inputStrides);
+    GetHostLayout(out, outputDims, outputStrides);
+
+    std::vector<bool> isReduced(inputDims.size(), false);
+    for (const auto dim : dims)
+    {
+        if (dim < 0 ||
+            static_cast<unsigned int>(dim) >= input.TensorShape.Dim())
+            throw std::invalid_argument(
+                "Compute::Reduce - Dimension out of range");
+        isReduced[dim + 1] = true;
+    }
+
+    //! Kept dimensions are matched with the output ignoring the dimensions of
+    //! size 1, so the reduced dimensions may be removed or kept as 1
+    std::vector<std::size_t> keptStrides(inputDims.size(), 0);
+    std::size_t outputDim = 0;
+    for (std::size_t dim = 0; dim < inputDims.size(); ++dim)
     {
-        Dense::Naive::Mean(out.DenseMatHost, x.DenseMatHost,
-                           totalSizeWithPadding, unitSize);
+        if (isReduced[dim] || inputDims[dim] == 1)
+            continue;
+        while (outputDim < outputDims.size() && outputDims[outputDim] == 1)
+            ++outputDim;
+        if (outputDim == outputDims.size() ||
+            outputDims[outputDim] != inputDims[dim])
+            throw std::invalid_argument(
+                "Compute::Reduce - Output shape does not match the "
+                "reduction");
+        keptStrides[dim] = outputStrides[outputDim++];
     }
+    while (outputDim < outputDims.size() && outputDims[outputDim] == 1)
+        ++outputDim;
+    if (outputDim != outputDims.size() || out.BatchSize != input.BatchSize)
+        throw std::invalid_argument(
+            "Compute::Reduce - Output shape does not match the reduction");
+
+    const auto plan = Dense::Naive::MakeReducePlan(inputDims, inputStrides,
+                                                   keptStrides, isReduced);
+    if (op == ReduceOp::ArgMax && plan.ReduceSize > (1u << 24))
+        throw std::invalid_argument(
+            "Compute::Reduce - Index of ArgMax cannot be stored as float");
+
+    out.CopyOnWrite();
+    Dense::Naive::Reduce(out.DenseMatHost, input.DenseMatHost, plan, op);
+}
+
+void Sum(TensorData& out, const TensorData& input, int dim)
+{
+    Reduce(out, input, { dim }, ReduceOp::Sum);
+}
+
+void Mean(TensorData& out, const TensorData& input, int dim)
+{
+    Reduce(out, input, { dim }, ReduceOp::Mean);
+}
+
+void Max(TensorData& out, const TensorData& input, int dim)
+{
+    Reduce(out, input, { dim }, ReduceOp::Max);
+}
+
+void Min(TensorData& out, const TensorData& input, int dim)
+{
+    Reduce(out, input, { dim }, ReduceOp::Min);
+}
+
+void Norm(TensorData& out, const TensorData& input, int dim)
+{
+    Reduce(out, input, { dim }, ReduceOp::Norm);
+}
+
+void ArgMax(TensorData& out, const TensorData& input, int dim)
+{
+    Reduce(out, input, { dim }, ReduceOp::ArgMax);
 }
 
 void Softmax(TensorData& out, const TensorData& x)
 {
+    CheckFloat32("Softmax", { &out, &x });
+    if (!x.IsContiguous())
+        return Softmax(out, x.GetContiguous());
+
+    out.CopyOnWrite();
+
     const auto device = out.GetDevice();
     const auto N = out.Cols();
     const auto paddedN = out.PaddedHostColSize;
@@ -646,4 +1375,784 @@ void Softmax(TensorData& out, const TensorData& x)
     }
 }
 
+//! Checks operands of the convolution and returns its shape for the host
+//! kernels
+static Dense::Naive::ConvShape GetConvShape(const TensorData& x,
+                                            const TensorData& filter,
+                                            const TensorData& y, int strideRow,
+                                            int strideCol, int dilationRow,
+                                            int dilationCol, int paddingRow,
+                                            int paddingCol)
+{
+    for (const auto* tensorData : { &x, &filter, &y })
+    {
+        if (tensorData->GetDevice().Type() != DeviceType::HOST)
+            throw std::runtime_error(
+                "Conv2D - Cuda tensors must be convolved with the cudnn "
+                "metadata of the unit");
+        if (tensorData->GetType() != Type::Dense ||
+            tensorData->GetDataType() != DataType::Float32)
+            throw std::invalid_argument(
+                "Conv2D - Only dense Float32 tensors are supported");
+    }
+
+    if (x.TensorShape.Dim() != 3 || filter.TensorShape.Dim() != 4 ||
+        y.TensorShape.Dim() != 3)
+        throw std::invalid_argument(
+            "Conv2D - Input and output must have shape (C, H, W), and filter "
+            "must have shape (K, C, R, S)");
+    if (strideRow < 1 || strideCol < 1 || dilationRow < 1 || dilationCol < 1 ||
+        paddingRow < 0 || paddingCol < 0)
+        throw std::invalid_argument(
+            "Conv2D - Stride and dilation must be positive, and padding must "
+            "not be negative");
+
+    Dense::Naive::ConvShape shape;
+    shape.N = static_cast<unsigned int>(x.BatchSize);
+    shape.C = x.TensorShape.At(0);
+    shape.H = x.TensorShape.At(1);
+    shape.W = x.TensorShape.At(2);
+    shape.K = filter.TensorShape.At(0);
+    shape.R = filter.TensorShape.At(2);
+    shape.S = filter.TensorShape.At(3);
+    shape.StrideRow = static_cast<unsigned int>(strideRow);
+    shape.StrideCol = static_cast<unsigned int>(strideCol);
+    shape.DilationRow = static_cast<unsigned int>(dilationRow);
+    shape.DilationCol = static_cast<unsigned int>(dilationCol);
+    shape.PaddingRow = static_cast<unsigned int>(paddingRow);
+    shape.PaddingCol = static_cast<unsigned int>(paddingCol);
+    shape.PaddedW = static_cast<unsigned int>(x.PaddedHostColSize);
+    shape.PaddedS = static_cast<unsigned int>(filter.PaddedHostColSize);
+    shape.PaddedQ = static_cast<unsigned int>(y.PaddedHostColSize);
+
+    if (filter.TensorShape.At(1) != shape.C || filter.BatchSize != 1)
+        throw std::invalid_argument(
+            "Conv2D - Filter does not match channels of the input");
+
+    const auto extentRow = shape.DilationRow * (shape.R - 1) + 1;
+    const auto extentCol = shape.DilationCol * (shape.S - 1) + 1;
+    if (shape.R == 0 || shape.S == 0 ||
+        shape.H + 2 * shape.PaddingRow < extentRow ||
+        shape.W + 2 * shape.PaddingCol < extentCol)
+        throw std::invalid_argument("Conv2D - Filter is larger than the input");
+
+    shape.P = (shape.H + 2 * shape.PaddingRow - extentRow) / shape.StrideRow +
+              1;
+    shape.Q = (shape.W + 2 * shape.PaddingCol - extentCol) / shape.StrideCol +
+              1;
+    const Shape outputShape({ shape.K, shape.P, shape.Q });
+    if (y.TensorShape != outputShape || y.BatchSize != shape.N)
+        throw std::invalid_argument("Conv2D - Output shape must be " +
+                                    outputShape.ToString());
+
+    return shape;
+}
+
+void Conv2DForward(TensorData& y, const TensorData& x, const TensorData& filter,
+                   int strideRow, int strideCol, int dilationRow,
+                   int dilationCol, int paddingRow, int paddingCol)
+{
+    if (!x.IsContiguous() || !filter.IsContiguous())
+        return Conv2DForward(y, x.GetContiguous(), filter.GetContiguous(),
+                             strideRow, strideCol, dilationRow, dilationCol,
+                             paddingRow, paddingCol);
+
+    const auto shape =
+        GetConvShape(x, filter, y, strideRow, strideCol, dilationRow,
+                     dilationCol, paddingRow, paddingCol);
+    y.CopyOnWrite();
+    Dense::Naive::Conv2DForward(y.DenseMatHost, x.DenseMatHost,
+                                filter.DenseMatHost, shape);
+}
+
+unsigned int GetWinogradTileSize(const TensorData& x, const TensorData& filter,
+                                 const TensorData& y, int strideRow,
+                                 int strideCol, int dilationRow,
+                                 int dilationCol, int paddingRow,
+                                 int paddingCol)
+{
+    return Dense::Naive::GetWinogradTileSize(
+        GetConvShape(x, filter, y, strideRow, strideCol, dilationRow,
+                     dilationCol, paddingRow, paddingCol));
+}
+
+TensorData TransformWinogradFilter(const TensorData& filter,
+                                   unsigned int tileSize)
+{
+    if (!filter.IsContiguous())
+        return TransformWinogradFilter(filter.GetContiguous(), tileSize);
+    if (filter.GetDevice().Type() != DeviceType::HOST ||
+        filter.GetDataType() != DataType::Float32 ||
+        filter.TensorShape.Dim() != 4 || filter.TensorShape.At(2) != 3 ||
+        filter.TensorShape.At(3) != 3)
+        throw std::invalid_argument(
+            "TransformWinogradFilter - Filter must be a host Float32 tensor "
+            "with shape (K, C, 3, 3)");
+    if (tileSize != 2 && tileSize != 4)
+        throw std::invalid_argument(
+            "TransformWinogradFilter - Tile size must be 2 or 4");
+
+    Dense::Naive::ConvShape shape;
+    shape.K = filter.TensorShape.At(0);
+    shape.C = filter.TensorShape.At(1);
+    shape.R = 3;
+    shape.S = 3;
+    shape.PaddedS = static_cast<unsigned int>(filter.PaddedHostColSize);
+
+    const auto size = Dense::Naive::GetWinogradFilterSize(shape, tileSize);
+    TensorData transformed(Shape({ static_cast<unsigned int>(size) }),
+                           Type::Dense, filter.GetDevice(), 1);
+    Dense::Naive::WinogradTransformFilter(transformed.DenseMatHost,
+                                          filter.DenseMatHost, shape,
+                                          tileSize);
+    return transformed;
+}
+
+void Conv2DForwardWinograd(TensorData& y, const TensorData& x,
+                           const TensorData& filter,
+                           const TensorData& transformedFilter,
+                           unsigned int tileSize, int paddingRow,
+                           int paddingCol)
+{
+    if (!x.IsContiguous())
+        return Conv2DForwardWinograd(y, x.GetContiguous(), filter,
+                                     transformedFilter, tileSize, paddingRow,
+                                     paddingCol);
+
+    const auto shape =
+        GetConvShape(x, filter, y, 1, 1, 1, 1, paddingRow, paddingCol);
+    if (shape.R != 3 || shape.S != 3 || (tileSize != 2 && tileSize != 4) ||
+        transformedFilter.TensorShape.Size() !=
+            Dense::Naive::GetWinogradFilterSize(shape, tileSize))
+        throw std::invalid_argument(
+            "Conv2DForwardWinograd - Transformed filter does not match the "
+            "3x3 filter and the tile size");
+    y.CopyOnWrite();
+    Dense::Naive::Conv2DForwardWinograd(y.DenseMatHost, x.DenseMatHost,
+                                        transformedFilter.DenseMatHost, shape,
+                                        tileSize);
+}
+
+void Conv2DBackwardData(TensorData& dx, const TensorData& filter,
+                        const TensorData& dy, int strideRow, int strideCol,
+                        int dilationRow, int dilationCol, int paddingRow,
+                        int paddingCol)
+{
+    if (!filter.IsContiguous() || !dy.IsContiguous())
+        return Conv2DBackwardData(dx, filter.GetContiguous(),
+                                  dy.GetContiguous(), strideRow, strideCol,
+                                  dilationRow, dilationCol, paddingRow,
+                                  paddingCol);
+
+    const auto shape =
+        GetConvShape(dx, filter, dy, strideRow, strideCol, dilationRow,
+                     dilationCol, paddingRow, paddingCol);
+    dx.CopyOnWrite();
+    Dense::Naive::Conv2DBackwardData(dx.DenseMatHost, filter.DenseMatHost,
+                                     dy.DenseMatHost, shape);
+}
+
+void Conv2DBackwardFilter(TensorData& dFilter, const TensorData& x,
+                          const TensorData& dy, int strideRow, int strideCol,
+                          int dilationRow, int dilationCol, int paddingRow,
+                          int paddingCol)
+{
+    if (!x.IsContiguous() || !dy.IsContiguous())
+        return Conv2DBackwardFilter(dFilter, x.GetContiguous(),
+                                    dy.GetContiguous(), strideRow, strideCol,
+                                    dilationRow, dilationCol, paddingRow,
+                                    paddingCol);
+
+    const auto shape =
+        GetConvShape(x, dFilter, dy, strideRow, strideCol, dilationRow,
+                     dilationCol, paddingRow, paddingCol);
+    dFilter.CopyOnWrite();
+    Dense::Naive::Conv2DBackwardFilter(dFilter.DenseMatHost, x.DenseMatHost,
+                                       dy.DenseMatHost, shape);
+}
+
+//! Checks operands of the pooling and returns its shape for the host kernels
+static Dense::Naive::PoolShape GetPoolShape(const TensorData& x,
+                                            const TensorData& y, int windowRow,
+                                            int windowCol, int strideRow,
+                                            int strideCol, int paddingRow,
+                                            int paddingCol)
+{
+    for (const auto* tensorData : { &x, &y })
+    {
+        if (tensorData->GetDevice().Type() != DeviceType::HOST)
+            throw std::runtime_error(
+                "Pool2D - Only host tensors are supported");
+        if (tensorData->GetType() != Type::Dense ||
+            tensorData->GetDataType() != DataType::Float32)
+            throw std::invalid_argument(
+                "Pool2D - Only dense Float32 tensors are supported");
+    }
+
+    if (x.TensorShape.Dim() != 3 || y.TensorShape.Dim() != 3)
+        throw std::invalid_argument(
+            "Pool2D - Input and output must have shape (C, H, W)");
+    if (windowRow < 1 || windowCol < 1 || strideRow < 1 || strideCol < 1 ||
+        paddingRow < 0 || paddingCol < 0 || paddingRow >= windowRow ||
+        paddingCol >= windowCol)
+        throw std::invalid_argument(
+            "Pool2D - Window and stride must be positive, and padding must be "
+            "smaller than the window");
+
+    Dense::Naive::PoolShape shape;
+    shape.N = static_cast<unsigned int>(x.BatchSize);
+    shape.C = x.TensorShape.At(0);
+    shape.H = x.TensorShape.At(1);
+    shape.W = x.TensorShape.At(2);
+    shape.WindowRow = static_cast<unsigned int>(windowRow);
+    shape.WindowCol = static_cast<unsigned int>(windowCol);
+    shape.StrideRow = static_cast<unsigned int>(strideRow);
+    shape.StrideCol = static_cast<unsigned int>(strideCol);
+    shape.PaddingRow = static_cast<unsigned int>(paddingRow);
+    shape.PaddingCol = static_cast<unsigned int>(paddingCol);
+    shape.PaddedW = static_cast<unsigned int>(x.PaddedHostColSize);
+    shape.PaddedQ = static_cast<unsigned int>(y.PaddedHostColSize);
+
+    if (shape.H + 2 * shape.PaddingRow < shape.WindowRow ||
+        shape.W + 2 * shape.PaddingCol < shape.WindowCol)
+        throw std::invalid_argument("Pool2D - Window is larger than the input");
+
+    shape.P = (shape.H + 2 * shape.PaddingRow - shape.WindowRow) /
+                  shape.StrideRow +
+              1;
+    shape.Q = (shape.W + 2 * shape.PaddingCol - shape.WindowCol) /
+                  shape.StrideCol +
+              1;
+    const Shape outputShape({ shape.C, shape.P, shape.Q });
+    if (y.TensorShape != outputShape || y.BatchSize != shape.N)
+        throw std::invalid_argument("Pool2D - Output shape must be " +
+                                    outputShape.ToString());
+
+    return shape;
+}
+
+//! Returns number of indices of MaxPool2DForward
+static std::size_t GetPoolIndexSize(const Dense::Naive::PoolShape& shape)
+{
+    if (shape.WindowRow * shape.WindowCol > 256)
+        throw std::invalid_argument(
+            "MaxPool2D - Window must have at most 256 elements to store the "
+            "indices");
+    return static_cast<std::size_t>(shape.N) * shape.C * shape.P * shape.Q;
+}
+
+void MaxPool2DForward(TensorData& y, const TensorData& x, int windowRow,
+                      int windowCol, int strideRow, int strideCol,
+                      int paddingRow, int paddingCol,
+                      std::vector<std::uint8_t>* indices)
+{
+    if (!x.IsContiguous())
+        return MaxPool2DForward(y, x.GetContiguous(), windowRow, windowCol,
+                                strideRow, strideCol, paddingRow, paddingCol,
+                                indices);
+
+    const auto shape = GetPoolShape(x, y, windowRow, windowCol, strideRow,
+                                    strideCol, paddingRow, paddingCol);
+    if (indices)
+        indices->resize(GetPoolIndexSize(shape));
+    y.CopyOnWrite();
+    Dense::Naive::MaxPool2DForward(y.DenseMatHost,
+                                   indices ? indices->data() : nullptr,
+                                   x.DenseMatHost, shape);
+}
+
+void MaxPool2DBackward(TensorData& dx, const TensorData& dy,
+                       const std::vector<std::uint8_t>& indices, int windowRow,
+                       int windowCol, int strideRow, int strideCol,
+                       int paddingRow, int paddingCol)
+{
+    if (!dy.IsContiguous())
+        return MaxPool2DBackward(dx, dy.GetContiguous(), indices, windowRow,
+                                 windowCol, strideRow, strideCol, paddingRow,
+                                 paddingCol);
+
+    const auto shape = GetPoolShape(dx, dy, windowRow, windowCol, strideRow,
+                                    strideCol, paddingRow, paddingCol);
+    if (indices.size() != GetPoolIndexSize(shape))
+        throw std::invalid_argument(
+            "MaxPool2DBackward - Indices do not match the output");
+    dx.CopyOnWrite();
+    Dense::Naive::MaxPool2DBackward(dx.DenseMatHost, dy.DenseMatHost,
+                                    indices.data(), shape);
+}
+
+void AvgPool2DForward(TensorData& y, const TensorData& x, int windowRow,
+                      int windowCol, int strideRow, int strideCol,
+                      int paddingRow, int paddingCol)
+{
+    if (!x.IsContiguous())
+        return AvgPool2DForward(y, x.GetContiguous(), windowRow, windowCol,
+                                strideRow, strideCol, paddingRow, paddingCol);
+
+    const auto shape = GetPoolShape(x, y, windowRow, windowCol, strideRow,
+                                    strideCol, paddingRow, paddingCol);
+    y.CopyOnWrite();
+    Dense::Naive::AvgPool2DForward(y.DenseMatHost, x.DenseMatHost, shape);
+}
+
+void AvgPool2DBackward(TensorData& dx, const TensorData& dy, int windowRow,
+                       int windowCol, int strideRow, int strideCol,
+                       int paddingRow, int paddingCol)
+{
+    if (!dy.IsContiguous())
+        return AvgPool2DBackward(dx, dy.GetContiguous(), windowRow, windowCol,
+                                 strideRow, strideCol, paddingRow, paddingCol);
+
+    const auto shape = GetPoolShape(dx, dy, windowRow, windowCol, strideRow,
+                                    strideCol, paddingRow, paddingCol);
+    dx.CopyOnWrite();
+    Dense::Naive::AvgPool2DBackward(dx.DenseMatHost, dy.DenseMatHost, shape);
+}
+
+//! Checks operands of the global pooling and returns its shape for the host
+//! kernels
+static Dense::Naive::PoolShape GetGlobalPoolShape(const TensorData& x,
+                                                  const TensorData& y)
+{
+    for (const auto* tensorData : { &x, &y })
+    {
+        if (tensorData->GetDevice().Type() != DeviceType::HOST)
+            throw std::runtime_error(
+                "GlobalAvgPool - Only host tensors are supported");
+        if (tensorData->GetType() != Type::Dense ||
+            tensorData->GetDataType() != DataType::Float32)
+            throw std::invalid_argument(
+                "GlobalAvgPool - Only dense Float32 tensors are supported");
+    }
+    if (x.TensorShape.Dim() != 3 ||
+        y.TensorShape != Shape({ x.TensorShape.At(0) }) ||
+        y.BatchSize != x.BatchSize)
+        throw std::invalid_argument(
+            "GlobalAvgPool - Input must have shape (C, H, W) and output must "
+            "have shape (C)");
+
+    Dense::Naive::PoolShape shape;
+    shape.N = static_cast<unsigned int>(x.BatchSize);
+    shape.C = x.TensorShape.At(0);
+    shape.H = x.TensorShape.At(1);
+    shape.W = x.TensorShape.At(2);
+    shape.PaddedW = static_cast<unsigned int>(x.PaddedHostColSize);
+    return shape;
+}
+
+void GlobalAvgPoolForward(TensorData& y, const TensorData& x)
+{
+    if (!x.IsContiguous())
+        return GlobalAvgPoolForward(y, x.GetContiguous());
+
+    const auto shape = GetGlobalPoolShape(x, y);
+    y.CopyOnWrite();
+    Dense::Naive::GlobalAvgPoolForward(y.DenseMatHost, y.PaddedHostColSize,
+                                       x.DenseMatHost, shape);
+}
+
+void GlobalAvgPoolBackward(TensorData& dx, const TensorData& dy)
+{
+    if (!dy.IsContiguous())
+        return GlobalAvgPoolBackward(dx, dy.GetContiguous());
+
+    const auto shape = GetGlobalPoolShape(dx, dy);
+    dx.CopyOnWrite();
+    Dense::Naive::GlobalAvgPoolBackward(dx.DenseMatHost, dy.DenseMatHost,
+                                        dy.PaddedHostColSize, shape);
+}
+
+//! Returns number of rows of cols elements in the host data of tensorData
+static std::size_t GetHostRows(const TensorData& tensorData)
+{
+    return static_cast<std::size_t>(tensorData.TensorShape.Size() /
+                                    tensorData.Cols()) *
+           tensorData.BatchSize;
+}
+
+void EmbeddingForward(TensorData& y, const TensorData& table,
+                      const std::vector<std::size_t>& indices)
+{
+    CheckFloat32("EmbeddingForward", { &y, &table });
+    if (y.GetDevice().Type() != DeviceType::HOST ||
+        table.GetDevice().Type() != DeviceType::HOST)
+        throw std::runtime_error(
+            "Compute::EmbeddingForward - Only host tensors are supported");
+    if (table.TensorShape.Dim() != 2 || table.BatchSize != 1 ||
+        !table.IsContiguous() || !y.IsContiguous() ||
+        y.Cols() != table.Cols() || GetHostRows(y) != indices.size())
+        throw std::invalid_argument(
+            "Compute::EmbeddingForward - Shape mismatch");
+
+    const auto numRows = table.Rows();
+    for (const auto index : indices)
+        if (index >= numRows)
+            throw std::out_of_range(
+                "Compute::EmbeddingForward - Index out of range");
+
+    y.CopyOnWrite();
+    Dense::Naive::Gather(y.DenseMatHost, y.PaddedHostColSize,
+                         table.DenseMatHost, table.PaddedHostColSize,
+                         indices.data(), indices.size(), table.Cols());
+}
+
+void EmbeddingBackward(RowGradient& gradient, const TensorData& dy,
+                       const std::vector<std::size_t>& indices)
+{
+    CheckFloat32("EmbeddingBackward", { &dy });
+    if (!dy.IsContiguous())
+        return EmbeddingBackward(gradient, dy.GetContiguous(), indices);
+
+    if (dy.GetDevice().Type() != DeviceType::HOST)
+        throw std::runtime_error(
+            "Compute::EmbeddingBackward - Only host tensors are supported");
+    if (dy.Cols() != gradient.RowSize || GetHostRows(dy) != indices.size())
+        throw std::invalid_argument(
+            "Compute::EmbeddingBackward - Shape mismatch");
+
+    //! Rows are added before the accumulation so the buffer is not moved
+    std::vector<std::size_t> slots(indices.size());
+    for (std::size_t idx = 0; idx < indices.size(); ++idx)
+        slots[idx] = gradient.AddRow(indices[idx]);
+    Dense::Naive::ScatterAddRows(gradient.Rows.data(), gradient.Indices.size(),
+                                 slots.data(), dy.DenseMatHost,
+                                 dy.PaddedHostColSize, indices.size(),
+                                 gradient.RowSize);
+}
+
+//! Checks the operands of the cross entropy and returns number of rows
+static std::size_t CheckCrossEntropyOperands(
+    const char* name, std::initializer_list<const TensorData*> operands,
+    const TensorData& x, const std::vector<std::size_t>& labels)
+{
+    for (const auto* operand : operands)
+    {
+        if (operand->GetDevice().Type() != DeviceType::HOST)
+            throw std::runtime_error(std::string("Compute::") + name +
+                                     " - Only host tensors are supported");
+        if (operand->GetType() != Type::Dense ||
+            operand->GetDataType() != DataType::Float32)
+            throw std::invalid_argument(
+                std::string("Compute::") + name +
+                " - Only dense Float32 tensors are supported");
+    }
+
+    const auto rows = GetHostRows(x);
+    if (labels.size() != rows)
+        throw std::invalid_argument(std::string("Compute::") + name +
+                                    " - Number of labels must match rows");
+    const auto numClasses = x.Cols();
+    for (const auto label : labels)
+        if (label >= numClasses)
+            throw std::out_of_range(std::string("Compute::") + name +
+                                    " - Label out of range");
+    return rows;
+}
+
+void CrossEntropyForward(TensorData& loss, const TensorData& x,
+                         const std::vector<std::size_t>& labels,
+                         std::vector<float>* logSumExp)
+{
+    if (!x.IsContiguous())
+        return CrossEntropyForward(loss, x.GetContiguous(), labels,
+                                   logSumExp);
+
+    const auto rows =
+        CheckCrossEntropyOperands("CrossEntropyForward", { &loss, &x }, x,
+                                  labels);
+    if (loss.TensorShape.Size() != 1 || loss.BatchSize != 1)
+        throw std::invalid_argument(
+            "Compute::CrossEntropyForward - Loss must have a single element");
+
+    std::vector<float> rowLoss(rows);
+    if (logSumExp)
+        logSumExp->resize(rows);
+    Dense::Naive::CrossEntropyForward(
+        rowLoss.data(), logSumExp ? logSumExp->data() : nullptr,
+        x.DenseMatHost, labels.data(), rows, x.Cols(), x.PaddedHostColSize);
+
+    //! Rows are summed in order so the loss does not depend on the scheduling
+    double sum = 0.0;
+    for (const auto value : rowLoss)
+        sum += value;
+    loss.CopyOnWrite();
+    loss.DenseMatHost[0] =
+        rows > 0 ? static_cast<float>(sum / static_cast<double>(rows)) : 0.0f;
+}
+
+void CrossEntropyBackward(TensorData& dx, const TensorData& dy,
+                          const TensorData& x,
+                          const std::vector<std::size_t>& labels,
+                          const std::vector<float>& logSumExp)
+{
+    if (!x.IsContiguous())
+        return CrossEntropyBackward(dx, dy, x.GetContiguous(), labels,
+                                    logSumExp);
+
+    const auto rows =
+        CheckCrossEntropyOperands("CrossEntropyBackward", { &dx, &dy, &x },
+                                  x, labels);
+    if (!dx.IsContiguous() || dx.TensorShape != x.TensorShape ||
+        dx.BatchSize != x.BatchSize || dy.TensorShape.Size() != 1 ||
+        logSumExp.size() != rows)
+        throw std::invalid_argument(
+            "Compute::CrossEntropyBackward - Operands do not match the input");
+
+    const float scale =
+        rows > 0 ? dy.GetContiguous().DenseMatHost[0] /
+                       static_cast<float>(rows)
+                 : 0.0f;
+    dx.CopyOnWrite();
+    Dense::Naive::CrossEntropyBackward(dx.DenseMatHost, x.DenseMatHost,
+                                       logSumExp.data(), labels.data(), scale,
+                                       rows, x.Cols(), x.PaddedHostColSize);
+}
+
+//! Checks the operands of the dropout
+static void CheckDropoutOperands(const char* name, const TensorData& out,
+                                 const TensorData& in, float rate)
+{
+    CheckFloat32(name, { &out, &in });
+    if (out.GetDevice().Type() != DeviceType::HOST ||
+        in.GetDevice().Type() != DeviceType::HOST)
+        throw std::runtime_error(std::string("Compute::") + name +
+                                 " - Only host tensors are supported");
+    if (!(rate >= 0.0f && rate <= 1.0f))
+        throw std::invalid_argument(std::string("Compute::") + name +
+                                    " - Rate must be in [0, 1]");
+    if (!out.IsContiguous() || out.TensorShape != in.TensorShape ||
+        out.BatchSize != in.BatchSize)
+        throw std::invalid_argument(std::string("Compute::") + name +
+                                    " - Shape mismatch");
+}
+
+void DropoutForward(TensorData& y, const TensorData& x, float rate,
+                    std::uint64_t seed, std::uint64_t offset)
+{
+    if (!x.IsContiguous())
+        return DropoutForward(y, x.GetContiguous(), rate, seed, offset);
+
+    CheckDropoutOperands("DropoutForward", y, x, rate);
+    y.CopyOnWrite();
+    Dense::Naive::DropoutForward(y.DenseMatHost, x.DenseMatHost, rate,
+                                 GetHostRows(x), x.Cols(),
+                                 x.PaddedHostColSize, seed, offset);
+}
+
+void DropoutBackward(TensorData& dx, const TensorData& dy, float rate,
+                     std::uint64_t seed, std::uint64_t offset)
+{
+    if (!dy.IsContiguous())
+        return DropoutBackward(dx, dy.GetContiguous(), rate, seed, offset);
+
+    CheckDropoutOperands("DropoutBackward", dx, dy, rate);
+    dx.CopyOnWrite();
+    Dense::Naive::DropoutBackward(dx.DenseMatHost, dy.DenseMatHost, rate,
+                                  GetHostRows(dy), dy.Cols(),
+                                  dy.PaddedHostColSize, seed, offset);
+}
+
+//! Checks the operands of the normalization
+//! \param parameters : tensors with shape (size) and batch size 1
+static void CheckNormOperands(
+    const char* name, std::initializer_list<const TensorData*> operands,
+    std::initializer_list<const TensorData*> parameters, unsigned int size)
+{
+    for (const auto* tensorData : operands)
+    {
+        if (tensorData->GetDevice().Type() != DeviceType::HOST)
+            throw std::runtime_error(std::string(name) +
+                                     " - Only host tensors are supported");
+        if (tensorData->GetType() != Type::Dense ||
+            tensorData->GetDataType() != DataType::Float32 ||
+            !tensorData->IsContiguous())
+            throw std::invalid_argument(
+                std::string(name) +
+                " - Only contiguous dense Float32 tensors are supported");
+    }
+    for (const auto* parameter : parameters)
+        if (parameter->TensorShape != Shape({ size }) ||
+            parameter->BatchSize != 1)
+            throw std::invalid_argument(std::string(name) +
+                                        " - Parameters must have shape " +
+                                        Shape({ size }).ToString());
+}
+
+//! Returns shape of the layer normalization of x
+static Dense::Naive::LayerNormShape GetLayerNormShape(const TensorData& x)
+{
+    Dense::Naive::LayerNormShape shape;
+    shape.Cols = x.Cols();
+    shape.PaddedCols = x.PaddedHostColSize;
+    shape.Rows = static_cast<std::size_t>(x.TensorShape.Size() / shape.Cols) *
+                 x.BatchSize;
+    return shape;
+}
+
+void LayerNormForward(TensorData& y, const TensorData& x,
+                      const TensorData& gamma, const TensorData& beta,
+                      float epsilon, std::vector<float>* mean,
+                      std::vector<float>* rstd)
+{
+    if (!x.IsContiguous())
+        return LayerNormForward(y, x.GetContiguous(), gamma, beta, epsilon,
+                                mean, rstd);
+
+    CheckNormOperands("LayerNormForward", { &y, &x, &gamma, &beta },
+                      { &gamma, &beta }, x.Cols());
+    if (y.TensorShape != x.TensorShape || y.BatchSize != x.BatchSize)
+        throw std::invalid_argument(
+            "LayerNormForward - Output must have the shape of the input");
+
+    const auto shape = GetLayerNormShape(x);
+    if (mean)
+        mean->resize(shape.Rows);
+    if (rstd)
+        rstd->resize(shape.Rows);
+    y.CopyOnWrite();
+    Dense::Naive::LayerNormForward(
+        y.DenseMatHost, mean ? mean->data() : nullptr,
+        rstd ? rstd->data() : nullptr, x.DenseMatHost, gamma.DenseMatHost,
+        beta.DenseMatHost, shape, epsilon);
+}
+
+void LayerNormBackward(TensorData& dx, TensorData& dGamma, TensorData& dBeta,
+                       const TensorData& dy, const TensorData& x,
+                       const TensorData& gamma, const std::vector<float>& mean,
+                       const std::vector<float>& rstd)
+{
+    if (!dy.IsContiguous() || !x.IsContiguous())
+        return LayerNormBackward(dx, dGamma, dBeta, dy.GetContiguous(),
+                                 x.GetContiguous(), gamma, mean, rstd);
+
+    CheckNormOperands("LayerNormBackward", { &dx, &dGamma, &dBeta, &dy, &x },
+                      { &dGamma, &dBeta, &gamma }, x.Cols());
+    const auto shape = GetLayerNormShape(x);
+    if (dx.TensorShape != x.TensorShape || dy.TensorShape != x.TensorShape ||
+        mean.size() != shape.Rows || rstd.size() != shape.Rows)
+        throw std::invalid_argument(
+            "LayerNormBackward - Operands do not match the input");
+
+    dx.CopyOnWrite();
+    dGamma.CopyOnWrite();
+    dBeta.CopyOnWrite();
+    Dense::Naive::LayerNormBackward(
+        dx.DenseMatHost, dGamma.DenseMatHost, dBeta.DenseMatHost,
+        dy.DenseMatHost, x.DenseMatHost, gamma.DenseMatHost, mean.data(),
+        rstd.data(), shape);
+}
+
+//! Returns shape of the batch normalization of x
+static Dense::Naive::BatchNormShape GetBatchNormShape(const TensorData& x)
+{
+    Dense::Naive::BatchNormShape shape;
+    shape.N = static_cast<unsigned int>(x.BatchSize);
+    shape.PaddedCols = x.PaddedHostColSize;
+    if (x.TensorShape.Dim() == 1)
+    {
+        //! Channels are the columns
+        shape.C = x.Cols();
+        shape.ChannelStride = 1;
+        shape.BatchStride = shape.PaddedCols;
+        return shape;
+    }
+
+    shape.C = x.TensorShape.At(0);
+    shape.Cols = x.Cols();
+    shape.Rows = x.TensorShape.Size() / (shape.C * shape.Cols);
+    shape.ChannelStride = shape.Rows * shape.PaddedCols;
+    shape.BatchStride = shape.C * shape.ChannelStride;
+    return shape;
+}
+
+void BatchNormForward(TensorData& y, const TensorData& x,
+                      const TensorData& gamma, const TensorData& beta,
+                      TensorData& runningMean, TensorData& runningVar,
+                      float momentum, float epsilon, bool isTraining,
+                      std::vector<float>* mean, std::vector<float>* rstd)
+{
+    if (!x.IsContiguous())
+        return BatchNormForward(y, x.GetContiguous(), gamma, beta,
+                                runningMean, runningVar, momentum, epsilon,
+                                isTraining, mean, rstd);
+
+    const auto shape = GetBatchNormShape(x);
+    CheckNormOperands("BatchNormForward",
+                      { &y, &x, &gamma, &beta, &runningMean, &runningVar },
+                      { &gamma, &beta, &runningMean, &runningVar }, shape.C);
+    if (y.TensorShape != x.TensorShape || y.BatchSize != x.BatchSize)
+        throw std::invalid_argument(
+            "BatchNormForward - Output must have the shape of the input");
+
+    std::vector<float> statisticsMean(shape.C), statisticsRstd(shape.C);
+    if (isTraining)
+    {
+        std::vector<float> variance(shape.C);
+        Dense::Naive::BatchNormStatistics(statisticsMean.data(),
+                                          variance.data(), x.DenseMatHost,
+                                          shape);
+
+        const double count =
+            static_cast<double>(shape.N) * shape.Rows * shape.Cols;
+        const auto unbiasedScale =
+            static_cast<float>(count > 1.0 ? count / (count - 1.0) : 1.0);
+        runningMean.CopyOnWrite();
+        runningVar.CopyOnWrite();
+        for (unsigned int c = 0; c < shape.C; ++c)
+        {
+            statisticsRstd[c] = 1.0f / std::sqrt(variance[c] + epsilon);
+            runningMean.DenseMatHost[c] =
+                (1.0f - momentum) * runningMean.DenseMatHost[c] +
+                momentum * statisticsMean[c];
+            runningVar.DenseMatHost[c] =
+                (1.0f - momentum) * runningVar.DenseMatHost[c] +
+                momentum * variance[c] * unbiasedScale;
+        }
+    }
+    else
+    {
+        for (unsigned int c = 0; c < shape.C; ++c)
+        {
+            statisticsMean[c] = runningMean.DenseMatHost[c];
+            statisticsRstd[c] =
+                1.0f / std::sqrt(runningVar.DenseMatHost[c] + epsilon);
+        }
+    }
+
+    y.CopyOnWrite();
+    Dense::Naive::BatchNormNormalize(
+        y.DenseMatHost, x.DenseMatHost, statisticsMean.data(),
+        statisticsRstd.data(), gamma.DenseMatHost, beta.DenseMatHost, shape);
+    if (mean)
+        *mean = std::move(statisticsMean);
+    if (rstd)
+        *rstd = std::move(statisticsRstd);
+}
+
+void BatchNormBackward(TensorData& dx, TensorData& dGamma, TensorData& dBeta,
+                       const TensorData& dy, const TensorData& x,
+                       const TensorData& gamma, const std::vector<float>& mean,
+                       const std::vector<float>& rstd)
+{
+    if (!dy.IsContiguous() || !x.IsContiguous())
+        return BatchNormBackward(dx, dGamma, dBeta, dy.GetContiguous(),
+                                 x.GetContiguous(), gamma, mean, rstd);
+
+    const auto shape = GetBatchNormShape(x);
+    CheckNormOperands("BatchNormBackward", { &dx, &dGamma, &dBeta, &dy, &x },
+                      { &dGamma, &dBeta, &gamma }, shape.C);
+    if (dx.TensorShape != x.TensorShape || dy.TensorShape != x.TensorShape ||
+        mean.size() != shape.C || rstd.size() != shape.C)
+        throw std::invalid_argument(
+            "BatchNormBackward - Operands do not match the input");
+
+    dx.CopyOnWrite();
+    dGamma.CopyOnWrite();
+    dBeta.CopyOnWrite();
+    Dense::Naive::BatchNormBackward(
+        dx.DenseMatHost, dGamma.DenseMatHost, dBeta.DenseMatHost,
+        dy.DenseMatHost, x.DenseMatHost, gamma.DenseMatHost, mean.data(),
+        rstd.data(), shape);
+}
+
 }  // namespace Sapphire::Compute
\ No newline at end of file
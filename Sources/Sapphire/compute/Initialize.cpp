@@ -7,46 +7,147 @@
 #include <Sapphire/compute/Initialize.hpp>
 #include <Sapphire/compute/dense/cuda/Initialize.cuh>
 #include <Sapphire/compute/dense/naive/NaiveInitialize.hpp>
-#include <chrono>
 #include <cmath>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
 
 namespace Sapphire::Compute::Initialize
 {
+static std::mutex randomMtx;
+static bool isSeeded = false;
+static RandomStream randomStream;
+static thread_local RandomRecorder* currentRecorder = nullptr;
+static thread_local RandomReplayGuard* currentReplay = nullptr;
+
+void SetSeed(std::uint64_t seed)
+{
+    std::lock_guard<std::mutex> lock(randomMtx);
+    randomStream.Seed = seed;
+    randomStream.Offset = 0;
+    isSeeded = true;
+}
+
+//! Reserves count random values from the global stream
+static RandomStream ReserveGlobalRandom(std::size_t count)
+{
+    std::lock_guard<std::mutex> lock(randomMtx);
+    if (!isSeeded)
+    {
+        std::random_device rd;
+        randomStream.Seed =
+            (static_cast<std::uint64_t>(rd()) << 32) | rd();
+        isSeeded = true;
+    }
+
+    //! Each Philox counter gives 4 values
+    const auto stream = randomStream;
+    randomStream.Offset += (count + 3) / 4;
+    return stream;
+}
+
+RandomStream ReserveRandom(std::size_t count)
+{
+    RandomStream stream;
+    if (currentReplay)
+    {
+        if (currentReplay->m_next == currentReplay->m_streams.size())
+            throw std::runtime_error(
+                "Initialize::ReserveRandom - More streams are reserved than "
+                "recorded");
+        stream = currentReplay->m_streams[currentReplay->m_next++];
+    }
+    else
+        stream = ReserveGlobalRandom(count);
+
+    if (currentRecorder)
+        currentRecorder->m_streams.emplace_back(stream);
+    return stream;
+}
+
+RandomRecorder::RandomRecorder() : m_previous(currentRecorder)
+{
+    currentRecorder = this;
+}
+
+RandomRecorder::~RandomRecorder()
+{
+    currentRecorder = m_previous;
+    if (m_previous)
+        m_previous->m_streams.insert(m_previous->m_streams.end(),
+                                     m_streams.begin(), m_streams.end());
+}
+
+RandomReplayGuard::RandomReplayGuard(std::vector<RandomStream> streams)
+    : m_streams(std::move(streams)), m_previous(currentReplay)
+{
+    currentReplay = this;
+}
+
+RandomReplayGuard::~RandomReplayGuard()
+{
+    currentReplay = m_previous;
+}
+
+//! Throws invalid_argument unless data is stored in Float32
+//! Host data of 16 and 8 bit tensors is smaller than the initializers write
+static void CheckFloat32(const char* name, const TensorUtil::TensorData& data)
+{
+    if (data.GetDataType() != DataType::Float32)
+        throw std::invalid_argument(std::string("Initialize::") + name +
+                                    " - Only Float32 tensors are supported");
+}
+
 void Normal(const TensorUtil::TensorData& data, float mean, float sd)
 {
+    CheckFloat32("Normal", data);
     const auto device = data.GetDevice();
+    data.BumpVersion();
     if (device.Type() == DeviceType::CUDA)
     {
+        const auto stream = ReserveRandom(data.DenseTotalLengthCuda);
         Dense::Cuda::Normal(data.DenseMatCuda, mean, sd,
-                            data.DenseTotalLengthCuda,
-                            static_cast<int>(std::clock()));
+                            data.DenseTotalLengthCuda, stream.Seed,
+                            stream.Offset);
     }
     else
     {
+        const auto stream =
+            ReserveRandom(data.TensorShape.Size() * data.BatchSize);
         Dense::Naive::Normal(data.DenseMatHost, mean, sd, data.TensorShape,
-                      data.PaddedHostColSize, data.BatchSize);
+                             data.PaddedHostColSize, data.BatchSize,
+                             stream.Seed, stream.Offset);
     }
 }
 
 void Uniform(const TensorUtil::TensorData& data, float min, float max)
 {
+    CheckFloat32("Uniform", data);
     const auto device = data.GetDevice();
+    data.BumpVersion();
     if (device.Type() == DeviceType::CUDA)
     {
+        const auto stream = ReserveRandom(data.DenseTotalLengthCuda);
         Dense::Cuda::Uniform(data.DenseMatCuda, min, max,
-                             data.DenseTotalLengthCuda,
-                             static_cast<int>(std::clock()));
+                             data.DenseTotalLengthCuda, stream.Seed,
+                             stream.Offset);
     }
     else
     {
+        const auto stream =
+            ReserveRandom(data.TensorShape.Size() * data.BatchSize);
         Dense::Naive::Uniform(data.DenseMatHost, min, max, data.TensorShape,
-                       data.PaddedHostColSize, data.BatchSize);
+                              data.PaddedHostColSize, data.BatchSize,
+                              stream.Seed, stream.Offset);
     }
 }
 
 void Ones(const TensorUtil::TensorData& data)
 {
+    CheckFloat32("Ones", data);
     const auto device = data.GetDevice();
+    data.BumpVersion();
     if (device.Type() == DeviceType::CUDA)
     {
         Dense::Cuda::Scalar(data.DenseMatCuda, 1.0f, data.DenseTotalLengthCuda);
@@ -60,7 +161,9 @@ void Ones(const TensorUtil::TensorData& data)
 
 void Zeros(const TensorUtil::TensorData& data)
 {
+    CheckFloat32("Zeros", data);
     const auto device = data.GetDevice();
+    data.BumpVersion();
     if (device.Type() == DeviceType::CUDA)
     {
         Dense::Cuda::Scalar(data.DenseMatCuda, 0.0f, data.DenseTotalLengthCuda);
@@ -74,36 +177,11 @@ void Zeros(const TensorUtil::TensorData& data)
 
 void HeNormal(const TensorUtil::TensorData& data, int fanIn)
 {
-    const auto device = data.GetDevice();
-    if (device.Type() == DeviceType::CUDA)
-    {
-        Dense::Cuda::Normal(
-            data.DenseMatCuda, 0.0, 2.0f / std::sqrt(static_cast<float>(fanIn)),
-            data.DenseTotalLengthCuda, static_cast<int>(std::clock()));
-    }
-    else
-    {
-        Dense::Naive::Normal(data.DenseMatHost, 0.0,
-                      2.0f / std::sqrt(static_cast<float>(fanIn)),
-                      data.TensorShape, data.PaddedHostColSize, data.BatchSize);
-    }
+    Normal(data, 0.0f, 2.0f / std::sqrt(static_cast<float>(fanIn)));
 }
 
 void Xavier(const TensorUtil::TensorData& data, int fanIn, int fanOut)
 {
-    const auto device = data.GetDevice();
-    if (device.Type() == DeviceType::CUDA)
-    {
-        Dense::Cuda::Normal(
-            data.DenseMatCuda, 0.0,
-            1.0f / std::sqrt(static_cast<float>(fanIn + fanOut)),
-            data.DenseTotalLengthCuda, static_cast<int>(std::clock()));
-    }
-    else
-    {
-        Dense::Naive::Normal(data.DenseMatHost, 0.0,
-                      1.0f / std::sqrt(static_cast<float>(fanIn + fanOut)),
-                      data.TensorShape, data.PaddedHostColSize, data.BatchSize);
-    }
+    Normal(data, 0.0f, 1.0f / std::sqrt(static_cast<float>(fanIn + fanOut)));
 }
-}  // namespace Sapphire::Compute::Initialize
\ No newline at end of file
+}  // namespace Sapphire::Compute::Initialize
@@ -464,6 +464,15 @@ __host__ void Mean(float* output, const float* input, unsigned int totalSize,
     }
 }
 
+__host__ void ColumnSum(float* output, const float* input, unsigned int rows,
+                        unsigned int cols)
+{
+    const auto blockDim = (cols > MAX_THREAD_DIM_X) ? MAX_THREAD_DIM_X : cols;
+    const auto gridDim = (cols % blockDim == 0) ? cols / blockDim
+                                                : cols / blockDim + 1;
+    ColumnSumKernel<<<gridDim, blockDim>>>(output, input, rows, cols);
+}
+
 __host__ void Softmax(float* output, const float* input, unsigned int totalSize,
                       unsigned int unitSize)
 {
@@ -418,6 +418,20 @@ __global__ void MeanKernel(float* output, const float* input,
     }
 }
 
+__global__ void ColumnSumKernel(float* output, const float* input,
+                                unsigned int rows, unsigned int cols)
+{
+    const auto colIdx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (colIdx < cols)
+    {
+        float sum = 0;
+        for (unsigned int rowIdx = 0; rowIdx < rows; rowIdx++)
+            sum += input[cols * rowIdx + colIdx];
+        output[colIdx] += sum;
+    }
+}
+
 __global__ void SoftmaxKernel(float* output, const float* input,
                               unsigned int totalSize, unsigned int unitSize)
 {
@@ -9,7 +9,7 @@
 namespace Sapphire::Compute::Dense::Cuda
 {
 __host__ void Normal(float* data, float mean, float sd, unsigned int size,
-                     int seed)
+                     unsigned long long seed, unsigned long long offset)
 {
     const auto numLoops = 8;
     const auto threadDim = MAX_THREAD_DIM_X / numLoops;
@@ -19,16 +19,18 @@ __host__ void Normal(float* data, float mean, float sd, unsigned int size,
 
     if (firstLaunchSize > 0)
         NormalKernel<<<blockDim, threadDim>>>(data, mean, sd, firstLaunchSize,
-                                              seed);
+                                              seed, offset * 4);
+    //! Remainder starts after the values drawn by the first launch
     if (size > firstLaunchSize)
         NormalKernel<<<1, size - firstLaunchSize>>>(
-            data + firstLaunchSize, mean, sd, size - firstLaunchSize, seed);
+            data + firstLaunchSize, mean, sd, size - firstLaunchSize, seed,
+            offset * 4 + firstLaunchSize);
 
     cudaDeviceSynchronize();
 }
 
 __host__ void Uniform(float* data, float min, float max, unsigned int size,
-                      int seed)
+                      unsigned long long seed, unsigned long long offset)
 {
     const auto numLoops = 8;
     const auto threadDim = MAX_THREAD_DIM_X / numLoops;
@@ -38,10 +40,11 @@ __host__ void Uniform(float* data, float min, float max, unsigned int size,
 
     if (firstLaunchSize > 0)
         UniformKernel<<<blockDim, threadDim>>>(data, min, max, firstLaunchSize,
-                                               seed);
+                                               seed, offset * 4);
     if (size > firstLaunchSize)
         UniformKernel<<<1, size - firstLaunchSize>>>(
-            data + firstLaunchSize, min, max, size - firstLaunchSize, seed);
+            data + firstLaunchSize, min, max, size - firstLaunchSize, seed,
+            offset * 4 + firstLaunchSize);
 
     cudaDeviceSynchronize();
 }
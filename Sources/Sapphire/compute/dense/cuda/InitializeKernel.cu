@@ -12,33 +12,35 @@ namespace Sapphire::Compute::Dense::Cuda
 //! ByteSize should be divisible by gridDim.x*blockDim.x
 //! Both block and thread should be in one dimension
 __global__ void NormalKernel(float* data, float mean, float sd,
-                             unsigned int size, int seed)
+                             unsigned int size, unsigned long long seed,
+                             unsigned long long offset)
 {
     const auto id = blockDim.x * blockIdx.x + threadIdx.x;
     const auto sizePerBlock = size / gridDim.x;
     const auto numLoops = sizePerBlock / blockDim.x;
     const auto blockOffset = sizePerBlock * blockIdx.x;
 
-    curandState localState;
-    curand_init(seed, id, 0, &localState);
+    curandStatePhilox4_32_10_t localState;
+    curand_init(seed, id, offset, &localState);
 
     for (unsigned int i = 0; i < numLoops; i++)
     {
         data[blockOffset + blockDim.x * i + threadIdx.x] =
-            (curand_normal(&localState) + mean) / sd;
+            curand_normal(&localState) * sd + mean;
     }
 }
 
 __global__ void UniformKernel(float* data, float min, float max,
-                              unsigned int size, int seed)
+                              unsigned int size, unsigned long long seed,
+                              unsigned long long offset)
 {
     const auto id = blockDim.x * blockIdx.x + threadIdx.x;
     const auto sizePerBlock = size / gridDim.x;
     const auto numLoops = sizePerBlock / blockDim.x;
     const auto blockOffset = sizePerBlock * blockIdx.x;
 
-    curandState localState;
-    curand_init(seed, id, 0, &localState);
+    curandStatePhilox4_32_10_t localState;
+    curand_init(seed, id, offset, &localState);
 
     for (unsigned int i = 0; i < numLoops; i++)
     {
@@ -57,26 +57,66 @@ void Scale(float* output, const float* input, const float scaleFactor,
     }
 }
 
-void Transpose(float* output, const float* input, unsigned int inputRows,
-               unsigned int paddedInputRows, unsigned int inputCols,
-               unsigned int paddedInputCols, unsigned int batchSize,
-               bool broadcast)
-{
-    const auto leftOver = broadcast ? inputRows * paddedInputCols
-                                    : batchSize * inputRows * paddedInputCols;
-    for (unsigned int batchIdx = 0; batchIdx < batchSize; batchIdx++)
-        for (unsigned int i = 0; i < inputRows; i++)
-            for (unsigned int j = 0; j < inputCols; j++)
+void Reshape(float* output, const float* input, unsigned int totalSize,
+             unsigned int outputCols, unsigned int paddedOutputCols,
+             unsigned int inputCols, unsigned int paddedInputCols)
+{
+    for (unsigned int i = 0; i < totalSize; i++)
+    {
+        output[(i / outputCols) * paddedOutputCols + i % outputCols] =
+            input[(i / inputCols) * paddedInputCols + i % inputCols];
+    }
+}
+
+void CopySlice(float* output, const float* input, unsigned int outerSize,
+               unsigned int innerSize, unsigned int outputDimSize,
+               unsigned int inputDimSize, unsigned int outputStart,
+               unsigned int inputStart, unsigned int length,
+               unsigned int outputCols, unsigned int paddedOutputCols,
+               unsigned int inputCols, unsigned int paddedInputCols)
+{
+    for (unsigned int outerIdx = 0; outerIdx < outerSize; outerIdx++)
+        for (unsigned int dimIdx = 0; dimIdx < length; dimIdx++)
+            for (unsigned int innerIdx = 0; innerIdx < innerSize; innerIdx++)
             {
-                float* outputOffset =
-                    output + batchIdx * inputCols * paddedInputRows;
-                const float* inputOffset =
-                    input + batchIdx * inputRows * paddedInputCols;
-                outputOffset[j * paddedInputRows + i] =
-                    inputOffset[(i * paddedInputCols + j) % leftOver];
+                const auto outputIdx =
+                    (outerIdx * outputDimSize + outputStart + dimIdx) *
+                        innerSize +
+                    innerIdx;
+                const auto inputIdx =
+                    (outerIdx * inputDimSize + inputStart + dimIdx) *
+                        innerSize +
+                    innerIdx;
+                output[(outputIdx / outputCols) * paddedOutputCols +
+                       outputIdx % outputCols] =
+                    input[(inputIdx / inputCols) * paddedInputCols +
+                          inputIdx % inputCols];
             }
 }
 
+void StridedCopy(float* output, const float* input, const unsigned int* shape,
+                 const unsigned long* inputStrides, unsigned int dim,
+                 unsigned int paddedOutputCols)
+{
+    unsigned long totalSize = 1;
+    for (unsigned int i = 0; i < dim; ++i)
+        totalSize *= shape[i];
+
+    const auto cols = shape[dim - 1];
+    for (unsigned long idx = 0; idx < totalSize; ++idx)
+    {
+        unsigned long remaining = idx;
+        unsigned long inputOffset = 0;
+        for (int i = static_cast<int>(dim) - 1; i >= 0; --i)
+        {
+            inputOffset += (remaining % shape[i]) * inputStrides[i];
+            remaining /= shape[i];
+        }
+        output[(idx / cols) * paddedOutputCols + idx % cols] =
+            input[inputOffset];
+    }
+}
+
 void Pow(float* output, const float* input, const float scaleFactor,
          unsigned int totalSize)
 {
@@ -197,14 +237,26 @@ void Mean(float* output, const float* input, unsigned int totalSize,
 {
     for (unsigned int unitIdx = 0; unitIdx < totalSize / unitSize; unitIdx++)
     {
+        //! Output is overwritten instead of accumulated
+        float sum = 0.0f;
         for (unsigned int idx = 0; idx < unitSize; idx++)
         {
-            output[unitIdx] += input[unitIdx * unitSize + idx];
+            sum += input[unitIdx * unitSize + idx];
         }
-        output[unitIdx] /= static_cast<float>(unitSize);
+        output[unitIdx] = sum / static_cast<float>(unitSize);
     }
 }
 
+void ColumnSum(float* output, const float* input, unsigned int rows,
+               unsigned int cols, unsigned int padSize)
+{
+    //! Rows are added one by one, so the inner loop is vectorized over
+    //! contiguous columns
+    for (unsigned int rowIdx = 0; rowIdx < rows; ++rowIdx)
+        for (unsigned int colIdx = 0; colIdx < cols; ++colIdx)
+            output[colIdx] += input[padSize * rowIdx + colIdx];
+}
+
 void Softmax(float* output, const float* input, unsigned int totalSize,
              unsigned int unitSize, unsigned int padSize)
 {
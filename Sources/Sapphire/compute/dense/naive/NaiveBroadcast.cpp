@@ -0,0 +1,226 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaiveBroadcast.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace Sapphire::Compute::Dense::Naive
+{
+struct AddOp
+{
+    static float Apply(float a, float b)
+    {
+        return a + b;
+    }
+#ifdef __AVX2__
+    static __m256 Apply(__m256 a, __m256 b)
+    {
+        return _mm256_add_ps(a, b);
+    }
+#endif
+};
+
+struct SubOp
+{
+    static float Apply(float a, float b)
+    {
+        return a - b;
+    }
+#ifdef __AVX2__
+    static __m256 Apply(__m256 a, __m256 b)
+    {
+        return _mm256_sub_ps(a, b);
+    }
+#endif
+};
+
+struct MulOp
+{
+    static float Apply(float a, float b)
+    {
+        return a * b;
+    }
+#ifdef __AVX2__
+    static __m256 Apply(__m256 a, __m256 b)
+    {
+        return _mm256_mul_ps(a, b);
+    }
+#endif
+};
+
+//! Computes a run with contiguous out
+//! Operands which are not contiguous are broadcast, so their first element
+//! is used for every output
+template <typename Op, bool ContiguousA, bool ContiguousB>
+static void ContiguousRun(float* out, const float* a, const float* b,
+                          std::size_t size)
+{
+    std::size_t idx = 0;
+#ifdef __AVX2__
+    const auto scalarA = _mm256_set1_ps(a[0]);
+    const auto scalarB = _mm256_set1_ps(b[0]);
+    for (; idx + 8 <= size; idx += 8)
+    {
+        const auto valueA = ContiguousA ? _mm256_loadu_ps(a + idx) : scalarA;
+        const auto valueB = ContiguousB ? _mm256_loadu_ps(b + idx) : scalarB;
+        _mm256_storeu_ps(out + idx, Op::Apply(valueA, valueB));
+    }
+#endif
+    for (; idx < size; ++idx)
+        out[idx] =
+            Op::Apply(a[ContiguousA ? idx : 0], b[ContiguousB ? idx : 0]);
+}
+
+//! Computes a run of the innermost dimension
+template <typename Op>
+static void Run(float* out, const float* a, const float* b,
+                const BroadcastDim& dim)
+{
+    if (dim.StrideOut == 1 && dim.StrideA <= 1 && dim.StrideB <= 1)
+    {
+        if (dim.StrideA == 1 && dim.StrideB == 1)
+            ContiguousRun<Op, true, true>(out, a, b, dim.Size);
+        else if (dim.StrideA == 1)
+            ContiguousRun<Op, true, false>(out, a, b, dim.Size);
+        else if (dim.StrideB == 1)
+            ContiguousRun<Op, false, true>(out, a, b, dim.Size);
+        else
+            ContiguousRun<Op, false, false>(out, a, b, dim.Size);
+        return;
+    }
+
+    for (std::size_t idx = 0; idx < dim.Size; ++idx)
+        out[idx * dim.StrideOut] =
+            Op::Apply(a[idx * dim.StrideA], b[idx * dim.StrideB]);
+}
+
+template <typename Op>
+static void BroadcastWith(float* out, const float* a, const float* b,
+                          const BroadcastPlan& plan)
+{
+    const auto numOuter = plan.NumDims - 1;
+    const auto& inner = plan.Dims[numOuter];
+
+    const auto runRange = [&](std::size_t runBegin, std::size_t runEnd) {
+        //! Position of the first run in the outer dimensions, updated
+        //! incrementally for the following runs
+        std::array<std::size_t, MaxBroadcastDims> position{};
+        std::size_t offsetOut = 0, offsetA = 0, offsetB = 0;
+        auto remainder = runBegin;
+        for (auto dimIdx = numOuter; dimIdx-- > 0;)
+        {
+            const auto& dim = plan.Dims[dimIdx];
+            position[dimIdx] = remainder % dim.Size;
+            remainder /= dim.Size;
+            offsetOut += position[dimIdx] * dim.StrideOut;
+            offsetA += position[dimIdx] * dim.StrideA;
+            offsetB += position[dimIdx] * dim.StrideB;
+        }
+
+        for (auto runIdx = runBegin; runIdx < runEnd; ++runIdx)
+        {
+            Run<Op>(out + offsetOut, a + offsetA, b + offsetB, inner);
+
+            for (auto dimIdx = numOuter; dimIdx-- > 0;)
+            {
+                const auto& dim = plan.Dims[dimIdx];
+                offsetOut += dim.StrideOut;
+                offsetA += dim.StrideA;
+                offsetB += dim.StrideB;
+                if (++position[dimIdx] < dim.Size)
+                    break;
+                offsetOut -= dim.Size * dim.StrideOut;
+                offsetA -= dim.Size * dim.StrideA;
+                offsetB -= dim.Size * dim.StrideB;
+                position[dimIdx] = 0;
+            }
+        }
+    };
+
+    if (plan.SharesOutput)
+        runRange(0, plan.NumRuns);
+    else
+        Util::ParallelFor(0, plan.NumRuns, Util::GrainSize(inner.Size),
+                          runRange);
+}
+
+BroadcastPlan MakeBroadcastPlan(unsigned int numDims,
+                                const std::size_t* sizesOut,
+                                const std::size_t* sizesA,
+                                const std::size_t* sizesB,
+                                const std::size_t* stridesOut,
+                                const std::size_t* stridesA,
+                                const std::size_t* stridesB)
+{
+    if (numDims > MaxBroadcastDims)
+        throw std::invalid_argument(
+            "MakeBroadcastPlan - Too many dimensions to broadcast");
+
+    BroadcastPlan plan;
+    for (unsigned int idx = 0; idx < numDims; ++idx)
+    {
+        const auto size = std::max({ sizesOut[idx], sizesA[idx], sizesB[idx] });
+        if ((sizesOut[idx] != size && sizesOut[idx] != 1) ||
+            (sizesA[idx] != size && sizesA[idx] != 1) ||
+            (sizesB[idx] != size && sizesB[idx] != 1))
+            throw std::invalid_argument(
+                "MakeBroadcastPlan - Shapes cannot be broadcast");
+        if (size == 1)
+            continue;
+
+        const BroadcastDim dim{ size,
+                                sizesOut[idx] == 1 ? 0 : stridesOut[idx],
+                                sizesA[idx] == 1 ? 0 : stridesA[idx],
+                                sizesB[idx] == 1 ? 0 : stridesB[idx] };
+        plan.SharesOutput |= dim.StrideOut == 0;
+        if (plan.NumDims > 0)
+        {
+            auto& last = plan.Dims[plan.NumDims - 1];
+            if (last.StrideOut == dim.Size * dim.StrideOut &&
+                last.StrideA == dim.Size * dim.StrideA &&
+                last.StrideB == dim.Size * dim.StrideB)
+            {
+                last.Size *= dim.Size;
+                last.StrideOut = dim.StrideOut;
+                last.StrideA = dim.StrideA;
+                last.StrideB = dim.StrideB;
+                continue;
+            }
+        }
+        plan.Dims[plan.NumDims++] = dim;
+    }
+
+    //! Operation on single elements is a run of size 1
+    if (plan.NumDims == 0)
+        plan.Dims[plan.NumDims++] = BroadcastDim{ 1, 1, 1, 1 };
+    for (unsigned int idx = 0; idx + 1 < plan.NumDims; ++idx)
+        plan.NumRuns *= plan.Dims[idx].Size;
+    return plan;
+}
+
+void BroadcastBinary(float* out, const float* a, const float* b,
+                     const BroadcastPlan& plan, BinaryOp op)
+{
+    switch (op)
+    {
+        case BinaryOp::Add:
+            BroadcastWith<AddOp>(out, a, b, plan);
+            break;
+        case BinaryOp::Sub:
+            BroadcastWith<SubOp>(out, a, b, plan);
+            break;
+        case BinaryOp::Mul:
+            BroadcastWith<MulOp>(out, a, b, plan);
+            break;
+    }
+}
+}  // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,815 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaiveConvolution.hpp>
+#include <Sapphire/compute/dense/naive/NaiveGemm.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+//! Direct kernel uses fused multiply-add, which gcc and clang enable with -mfma
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#define SAPPHIRE_CONV_AVX2
+#endif
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Number of channels stored together in the NCHW8c layout
+constexpr unsigned int ChannelBlock = 8;
+//! Number of output columns computed together by the direct kernel
+constexpr unsigned int DirectTile = 8;
+
+//! Copies rows between buffers with different row sizes
+static void CopyRows(float* dst, std::size_t dstRowSize, const float* src,
+                     std::size_t srcRowSize, std::size_t rows,
+                     std::size_t cols, bool accumulate)
+{
+    Util::ParallelFor(0, rows, Util::GrainSize(cols),
+                      [&](std::size_t rowBegin, std::size_t rowEnd) {
+                          for (auto row = rowBegin; row < rowEnd; ++row)
+                          {
+                              float* dstRow = dst + row * dstRowSize;
+                              const float* srcRow = src + row * srcRowSize;
+                              for (std::size_t col = 0; col < cols; ++col)
+                                  dstRow[col] = accumulate
+                                                    ? dstRow[col] + srcRow[col]
+                                                    : srcRow[col];
+                          }
+                      });
+}
+
+//! Returns filter without the row padding as K x (C * R * S) matrix
+static std::vector<float> PackFilter(const float* filter,
+                                     const ConvShape& shape)
+{
+    const std::size_t rows = static_cast<std::size_t>(shape.K) * shape.C *
+                             shape.R;
+    std::vector<float> packed(rows * shape.S);
+    for (std::size_t row = 0; row < rows; ++row)
+        std::copy(filter + row * shape.PaddedS,
+                  filter + row * shape.PaddedS + shape.S,
+                  packed.begin() + row * shape.S);
+    return packed;
+}
+
+//! Returns true if columns of the image are the image itself
+//! (1x1 filter with unit stride, no padding and no row padding)
+static bool IsIdentityIm2Col(const ConvShape& shape)
+{
+    return shape.R == 1 && shape.S == 1 && shape.StrideRow == 1 &&
+           shape.StrideCol == 1 && shape.PaddingRow == 0 &&
+           shape.PaddingCol == 0 && shape.W == shape.PaddedW;
+}
+
+//! Unfolds an image into (C * R * S) x (P * Q) columns
+//! Each row holds the input elements multiplied by one element of the filter
+static void Im2Col(float* col, const float* image, const ConvShape& shape)
+{
+    const std::size_t rows =
+        static_cast<std::size_t>(shape.C) * shape.R * shape.S;
+    const std::size_t cols = static_cast<std::size_t>(shape.P) * shape.Q;
+
+    Util::ParallelFor(
+        0, rows, Util::GrainSize(cols),
+        [&](std::size_t rowBegin, std::size_t rowEnd) {
+            for (auto row = rowBegin; row < rowEnd; ++row)
+            {
+                const auto s = static_cast<unsigned int>(row % shape.S);
+                const auto r =
+                    static_cast<unsigned int>(row / shape.S % shape.R);
+                const auto c = row / (shape.S * shape.R);
+                const float* channel =
+                    image + c * shape.H * static_cast<std::size_t>(
+                                              shape.PaddedW);
+
+                for (unsigned int p = 0; p < shape.P; ++p)
+                {
+                    float* colRow = col + row * cols + p * shape.Q;
+                    const int h = static_cast<int>(p * shape.StrideRow +
+                                                   r * shape.DilationRow) -
+                                  static_cast<int>(shape.PaddingRow);
+                    if (h < 0 || h >= static_cast<int>(shape.H))
+                    {
+                        std::fill(colRow, colRow + shape.Q, 0.0f);
+                        continue;
+                    }
+
+                    const float* inputRow =
+                        channel + static_cast<std::size_t>(h) * shape.PaddedW;
+                    for (unsigned int q = 0; q < shape.Q; ++q)
+                    {
+                        const int w = static_cast<int>(q * shape.StrideCol +
+                                                       s * shape.DilationCol) -
+                                      static_cast<int>(shape.PaddingCol);
+                        colRow[q] = w >= 0 && w < static_cast<int>(shape.W)
+                                        ? inputRow[w]
+                                        : 0.0f;
+                    }
+                }
+            }
+        });
+}
+
+//! Adds the columns back to the image (reverse of Im2Col)
+//! Channels are distributed over the threads since columns of different
+//! channels never write to the same element
+static void Col2Im(float* image, const float* col, const ConvShape& shape)
+{
+    const std::size_t cols = static_cast<std::size_t>(shape.P) * shape.Q;
+
+    Util::ParallelFor(
+        0, shape.C, Util::GrainSize(shape.R * shape.S * cols),
+        [&](std::size_t channelBegin, std::size_t channelEnd) {
+            for (auto c = channelBegin; c < channelEnd; ++c)
+            {
+                float* channel =
+                    image + c * shape.H * static_cast<std::size_t>(
+                                              shape.PaddedW);
+                for (unsigned int r = 0; r < shape.R; ++r)
+                    for (unsigned int s = 0; s < shape.S; ++s)
+                    {
+                        const float* colRow =
+                            col + ((c * shape.R + r) * shape.S + s) * cols;
+                        for (unsigned int p = 0; p < shape.P; ++p)
+                        {
+                            const int h =
+                                static_cast<int>(p * shape.StrideRow +
+                                                 r * shape.DilationRow) -
+                                static_cast<int>(shape.PaddingRow);
+                            if (h < 0 || h >= static_cast<int>(shape.H))
+                                continue;
+
+                            float* inputRow =
+                                channel +
+                                static_cast<std::size_t>(h) * shape.PaddedW;
+                            for (unsigned int q = 0; q < shape.Q; ++q)
+                            {
+                                const int w =
+                                    static_cast<int>(q * shape.StrideCol +
+                                                     s * shape.DilationCol) -
+                                    static_cast<int>(shape.PaddingCol);
+                                if (w >= 0 && w < static_cast<int>(shape.W))
+                                    inputRow[w] += colRow[p * shape.Q + q];
+                            }
+                        }
+                    }
+            }
+        });
+}
+
+static void ForwardIm2Col(float* y, const float* x, const float* filter,
+                          const ConvShape& shape)
+{
+    const auto crs = shape.C * shape.R * shape.S;
+    const auto pq = shape.P * shape.Q;
+    const auto packedFilter = PackFilter(filter, shape);
+    const bool isIdentity = IsIdentityIm2Col(shape);
+    std::vector<float> col(isIdentity ? 0 : static_cast<std::size_t>(crs) * pq);
+    //! Result is written directly to y if y has no row padding
+    std::vector<float> result(
+        shape.Q == shape.PaddedQ ? 0 : static_cast<std::size_t>(shape.K) * pq);
+
+    for (unsigned int n = 0; n < shape.N; ++n)
+    {
+        const float* image = x + static_cast<std::size_t>(n) * shape.C *
+                                     shape.H * shape.PaddedW;
+        float* output = y + static_cast<std::size_t>(n) * shape.K * shape.P *
+                                shape.PaddedQ;
+        if (!isIdentity)
+            Im2Col(col.data(), image, shape);
+
+        BlockedGemm(shape.K, pq, crs, packedFilter.data(), crs, 1,
+                    isIdentity ? image : col.data(), pq, 1,
+                    result.empty() ? output : result.data(), pq, false);
+        if (!result.empty())
+            CopyRows(output, shape.PaddedQ, result.data(), shape.Q,
+                     static_cast<std::size_t>(shape.K) * shape.P, shape.Q,
+                     false);
+    }
+}
+
+//! Computes count (at most DirectTile) output columns of 8 output channels
+//! from the NCHW8c input
+//! \param input : start of the input rows for the output row in NCHW8c
+//! \param weight : filter of the output channel block in (C/8, R, S, 8c, 8k)
+//! \param result : DirectTile x 8 results
+//! Full tiles use constant count, so the accumulators stay in the registers
+template <bool IsFullTile>
+static void DirectTileKernel(float* result, const float* input,
+                             const float* weight, unsigned int count,
+                             unsigned int cBlocks, std::size_t cBlockStride,
+                             std::size_t rowStride, const ConvShape& shape)
+{
+    if constexpr (IsFullTile)
+        count = DirectTile;
+
+    const std::size_t colStep =
+        static_cast<std::size_t>(shape.StrideCol) * ChannelBlock;
+    const std::size_t dilationStep =
+        static_cast<std::size_t>(shape.DilationCol) * ChannelBlock;
+    const std::size_t dilationRowStep = shape.DilationRow * rowStride;
+
+#ifdef SAPPHIRE_CONV_AVX2
+    __m256 sum[DirectTile];
+    for (unsigned int t = 0; t < DirectTile; ++t)
+        sum[t] = _mm256_setzero_ps();
+
+    for (unsigned int cb = 0; cb < cBlocks; ++cb)
+        for (unsigned int r = 0; r < shape.R; ++r)
+            for (unsigned int s = 0; s < shape.S; ++s)
+            {
+                const float* inputPtr =
+                    input + cb * cBlockStride + r * dilationRowStep +
+                    s * dilationStep;
+                for (unsigned int c = 0; c < ChannelBlock; ++c)
+                {
+                    const auto w = _mm256_loadu_ps(weight);
+                    weight += ChannelBlock;
+                    for (unsigned int t = 0; t < count; ++t)
+                        sum[t] = _mm256_fmadd_ps(
+                            _mm256_broadcast_ss(inputPtr + t * colStep + c),
+                            w, sum[t]);
+                }
+            }
+
+    for (unsigned int t = 0; t < count; ++t)
+        _mm256_storeu_ps(result + t * ChannelBlock, sum[t]);
+#else
+    float sum[DirectTile][ChannelBlock] = {};
+    for (unsigned int cb = 0; cb < cBlocks; ++cb)
+        for (unsigned int r = 0; r < shape.R; ++r)
+            for (unsigned int s = 0; s < shape.S; ++s)
+            {
+                const float* inputPtr =
+                    input + cb * cBlockStride + r * dilationRowStep +
+                    s * dilationStep;
+                for (unsigned int c = 0; c < ChannelBlock; ++c)
+                {
+                    for (unsigned int t = 0; t < count; ++t)
+                        for (unsigned int k = 0; k < ChannelBlock; ++k)
+                            sum[t][k] += inputPtr[t * colStep + c] * weight[k];
+                    weight += ChannelBlock;
+                }
+            }
+
+    for (unsigned int t = 0; t < count; ++t)
+        std::copy(sum[t], sum[t] + ChannelBlock, result + t * ChannelBlock);
+#endif
+}
+
+static void ForwardDirect(float* y, const float* x, const float* filter,
+                          const ConvShape& shape)
+{
+    const auto cBlocks = (shape.C + ChannelBlock - 1) / ChannelBlock;
+    const auto kBlocks = (shape.K + ChannelBlock - 1) / ChannelBlock;
+    const std::size_t inputHeight = shape.H + 2 * shape.PaddingRow;
+    const std::size_t inputWidth = shape.W + 2 * shape.PaddingCol;
+    const std::size_t rowStride = inputWidth * ChannelBlock;
+    const std::size_t cBlockStride = inputHeight * rowStride;
+
+    //! Input is reordered into (N, C/8, H, W, 8c) with the padding filled
+    //! with zeros, so the kernel never checks the borders
+    std::vector<float> input(shape.N * cBlocks * cBlockStride, 0.0f);
+    Util::ParallelFor(
+        0, static_cast<std::size_t>(shape.N) * shape.C,
+        Util::GrainSize(shape.H * shape.W),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto idx = begin; idx < end; ++idx)
+            {
+                const auto n = idx / shape.C;
+                const auto c = idx % shape.C;
+                float* channel = input.data() +
+                                 (n * cBlocks + c / ChannelBlock) *
+                                     cBlockStride +
+                                 c % ChannelBlock;
+                for (unsigned int h = 0; h < shape.H; ++h)
+                {
+                    const float* inputRow =
+                        x + (idx * shape.H + h) * shape.PaddedW;
+                    float* packedRow =
+                        channel + (h + shape.PaddingRow) * rowStride +
+                        shape.PaddingCol * ChannelBlock;
+                    for (unsigned int w = 0; w < shape.W; ++w)
+                        packedRow[w * ChannelBlock] = inputRow[w];
+                }
+            }
+        });
+
+    //! Filter is reordered into (K/8, C/8, R, S, 8c, 8k)
+    const std::size_t filterBlockSize = static_cast<std::size_t>(cBlocks) *
+                                        shape.R * shape.S * ChannelBlock *
+                                        ChannelBlock;
+    std::vector<float> weight(kBlocks * filterBlockSize, 0.0f);
+    for (unsigned int k = 0; k < shape.K; ++k)
+        for (unsigned int c = 0; c < shape.C; ++c)
+            for (unsigned int r = 0; r < shape.R; ++r)
+                for (unsigned int s = 0; s < shape.S; ++s)
+                {
+                    const auto blockIdx =
+                        ((static_cast<std::size_t>(k / ChannelBlock) *
+                              cBlocks +
+                          c / ChannelBlock) *
+                             shape.R +
+                         r) *
+                            shape.S +
+                        s;
+                    weight[(blockIdx * ChannelBlock + c % ChannelBlock) *
+                               ChannelBlock +
+                           k % ChannelBlock] =
+                        filter[((static_cast<std::size_t>(k) * shape.C + c) *
+                                    shape.R +
+                                r) *
+                                   shape.PaddedS +
+                               s];
+                }
+
+    //! Each row of the output is computed for 8 output channels at once
+    Util::ParallelFor(
+        0, static_cast<std::size_t>(shape.N) * kBlocks * shape.P,
+        Util::GrainSize(static_cast<std::size_t>(shape.Q) * filterBlockSize),
+        [&](std::size_t begin, std::size_t end) {
+            float result[DirectTile * ChannelBlock];
+            for (auto idx = begin; idx < end; ++idx)
+            {
+                const auto p = static_cast<unsigned int>(idx % shape.P);
+                const auto kb =
+                    static_cast<unsigned int>(idx / shape.P % kBlocks);
+                const auto n = idx / shape.P / kBlocks;
+                const auto channels =
+                    std::min(ChannelBlock, shape.K - kb * ChannelBlock);
+                const float* inputRows = input.data() +
+                                         n * cBlocks * cBlockStride +
+                                         p * shape.StrideRow * rowStride;
+
+                for (unsigned int q = 0; q < shape.Q; q += DirectTile)
+                {
+                    const auto count = std::min(DirectTile, shape.Q - q);
+                    const float* inputPtr =
+                        inputRows + static_cast<std::size_t>(q) *
+                                        shape.StrideCol * ChannelBlock;
+                    const float* weightPtr =
+                        weight.data() + kb * filterBlockSize;
+                    if (count == DirectTile)
+                        DirectTileKernel<true>(result, inputPtr, weightPtr,
+                                               count, cBlocks, cBlockStride,
+                                               rowStride, shape);
+                    else
+                        DirectTileKernel<false>(result, inputPtr, weightPtr,
+                                                count, cBlocks, cBlockStride,
+                                                rowStride, shape);
+
+                    for (unsigned int k = 0; k < channels; ++k)
+                    {
+                        float* outputRow =
+                            y + ((n * shape.K + kb * ChannelBlock + k) *
+                                     shape.P +
+                                 p) *
+                                    shape.PaddedQ +
+                            q;
+                        for (unsigned int t = 0; t < count; ++t)
+                            outputRow[t] = result[t * ChannelBlock + k];
+                    }
+                }
+            }
+        });
+}
+
+//! Transform matrices of the Winograd convolution F(m x m, 3 x 3), where m is
+//! OutputTile. Output tile is computed as AT * [(G g GT) . (BT d B)] * A from
+//! (m + 2) x (m + 2) input tile d and 3 x 3 filter g
+template <unsigned int OutputTile>
+struct WinogradMatrices;
+
+template <>
+struct WinogradMatrices<2>
+{
+    static constexpr unsigned int Alpha = 4;
+    static constexpr float BT[4][4] = { { 1, 0, -1, 0 },
+                                        { 0, 1, 1, 0 },
+                                        { 0, -1, 1, 0 },
+                                        { 0, 1, 0, -1 } };
+    static constexpr float G[4][3] = { { 1, 0, 0 },
+                                       { 0.5f, 0.5f, 0.5f },
+                                       { 0.5f, -0.5f, 0.5f },
+                                       { 0, 0, 1 } };
+    static constexpr float AT[2][4] = { { 1, 1, 1, 0 }, { 0, 1, -1, -1 } };
+};
+
+template <>
+struct WinogradMatrices<4>
+{
+    static constexpr unsigned int Alpha = 6;
+    static constexpr float BT[6][6] = { { 4, 0, -5, 0, 1, 0 },
+                                        { 0, -4, -4, 1, 1, 0 },
+                                        { 0, 4, -4, -1, 1, 0 },
+                                        { 0, -2, -1, 2, 1, 0 },
+                                        { 0, 2, -1, -2, 1, 0 },
+                                        { 0, 4, 0, -5, 0, 1 } };
+    static constexpr float G[6][3] = {
+        { 1.0f / 4, 0, 0 },
+        { -1.0f / 6, -1.0f / 6, -1.0f / 6 },
+        { -1.0f / 6, 1.0f / 6, -1.0f / 6 },
+        { 1.0f / 24, 1.0f / 12, 1.0f / 6 },
+        { 1.0f / 24, -1.0f / 12, 1.0f / 6 },
+        { 0, 0, 1 }
+    };
+    static constexpr float AT[4][6] = { { 1, 1, 1, 1, 1, 0 },
+                                        { 0, 1, -1, 2, -2, 0 },
+                                        { 0, 1, 1, 4, 4, 0 },
+                                        { 0, 1, -1, 8, -8, 1 } };
+};
+
+//! Number of tiles (or filters) transformed together
+//! Each coefficient of the transform is applied to a row of WinogradLanes
+//! values, so the transforms are vectorized across the tiles
+constexpr unsigned int WinogradLanes = 8;
+//! Maximum number of tiles whose transforms are kept in memory at once
+constexpr std::size_t WinogradTileChunk = 512;
+//! Transforms cost more than the multiplications they save with fewer
+//! input or output channels than this
+constexpr unsigned int WinogradMinChannels = 64;
+//! F(4x4, 3x3) is used only if the sum over the channels is not longer than
+//! this, since its larger transform coefficients amplify the rounding error
+constexpr unsigned int WinogradMaxChannelsF4 = 256;
+
+//! Computes out = matrix * in * matrix^T on each lane
+template <unsigned int Rows, unsigned int Inner>
+static void WinogradTransform(float (&out)[Rows][Rows][WinogradLanes],
+                              const float (&matrix)[Rows][Inner],
+                              const float (&in)[Inner][Inner][WinogradLanes])
+{
+    float temp[Rows][Inner][WinogradLanes] = {};
+    for (unsigned int i = 0; i < Rows; ++i)
+        for (unsigned int k = 0; k < Inner; ++k)
+        {
+            const float coefficient = matrix[i][k];
+            if (coefficient == 0.0f)
+                continue;
+            for (unsigned int j = 0; j < Inner; ++j)
+                for (unsigned int lane = 0; lane < WinogradLanes; ++lane)
+                    temp[i][j][lane] += coefficient * in[k][j][lane];
+        }
+
+    for (unsigned int i = 0; i < Rows; ++i)
+        for (unsigned int j = 0; j < Rows; ++j)
+        {
+            float* result = out[i][j];
+            for (unsigned int lane = 0; lane < WinogradLanes; ++lane)
+                result[lane] = 0.0f;
+            for (unsigned int k = 0; k < Inner; ++k)
+            {
+                const float coefficient = matrix[j][k];
+                if (coefficient == 0.0f)
+                    continue;
+                for (unsigned int lane = 0; lane < WinogradLanes; ++lane)
+                    result[lane] += coefficient * temp[i][k][lane];
+            }
+        }
+}
+
+//! Transforms each 3 x 3 filter into U = G g GT laid out in
+//! (alpha * alpha, K, C)
+template <unsigned int OutputTile>
+static void WinogradFilter(float* transformed, const float* filter,
+                           const ConvShape& shape)
+{
+    using Matrices = WinogradMatrices<OutputTile>;
+    constexpr auto alpha = Matrices::Alpha;
+    const std::size_t filters = static_cast<std::size_t>(shape.K) * shape.C;
+    const auto groups = (filters + WinogradLanes - 1) / WinogradLanes;
+
+    Util::ParallelFor(
+        0, groups, Util::GrainSize(alpha * alpha * alpha * WinogradLanes),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto group = begin; group < end; ++group)
+            {
+                const auto first = group * WinogradLanes;
+                const auto count =
+                    std::min<std::size_t>(WinogradLanes, filters - first);
+                float g[3][3][WinogradLanes] = {};
+                for (std::size_t lane = 0; lane < count; ++lane)
+                    for (unsigned int r = 0; r < 3; ++r)
+                        for (unsigned int s = 0; s < 3; ++s)
+                            g[r][s][lane] =
+                                filter[((first + lane) * 3 + r) *
+                                           shape.PaddedS +
+                                       s];
+
+                float u[alpha][alpha][WinogradLanes];
+                WinogradTransform(u, Matrices::G, g);
+                for (unsigned int xi = 0; xi < alpha * alpha; ++xi)
+                    std::copy(u[xi / alpha][xi % alpha],
+                              u[xi / alpha][xi % alpha] + count,
+                              transformed + xi * filters + first);
+            }
+        });
+}
+
+//! Transforms input tiles [tileBegin, tileEnd) into V = BT d B laid out in
+//! (alpha * alpha, C, tileEnd - tileBegin)
+//! Tiles are numbered in (N, tilesRow, tilesCol) order
+template <unsigned int OutputTile>
+static void WinogradInput(float* v, const float* x, const ConvShape& shape,
+                          std::size_t tileBegin, std::size_t tileEnd,
+                          unsigned int tilesRow, unsigned int tilesCol)
+{
+    using Matrices = WinogradMatrices<OutputTile>;
+    constexpr auto alpha = Matrices::Alpha;
+    const auto tiles = tileEnd - tileBegin;
+    const auto groups = (tiles + WinogradLanes - 1) / WinogradLanes;
+    const std::size_t tilesPerImage =
+        static_cast<std::size_t>(tilesRow) * tilesCol;
+
+    Util::ParallelFor(
+        0, shape.C * groups,
+        Util::GrainSize(alpha * alpha * alpha * WinogradLanes),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto idx = begin; idx < end; ++idx)
+            {
+                const auto c = idx / groups;
+                const auto first = (idx % groups) * WinogradLanes;
+                const auto count =
+                    std::min<std::size_t>(WinogradLanes, tiles - first);
+
+                //! Elements outside the input are the zero padding
+                float d[alpha][alpha][WinogradLanes] = {};
+                for (std::size_t lane = 0; lane < count; ++lane)
+                {
+                    const auto tile = tileBegin + first + lane;
+                    const auto n = tile / tilesPerImage;
+                    const auto tileRow = (tile % tilesPerImage) / tilesCol;
+                    const auto tileCol = tile % tilesCol;
+                    const float* image =
+                        x + (n * shape.C + c) * shape.H * shape.PaddedW;
+                    const auto rowOrigin =
+                        static_cast<long>(tileRow * OutputTile) -
+                        static_cast<long>(shape.PaddingRow);
+                    const auto colOrigin =
+                        static_cast<long>(tileCol * OutputTile) -
+                        static_cast<long>(shape.PaddingCol);
+
+                    for (unsigned int i = 0; i < alpha; ++i)
+                    {
+                        const auto row = rowOrigin + i;
+                        if (row < 0 || row >= static_cast<long>(shape.H))
+                            continue;
+                        for (unsigned int j = 0; j < alpha; ++j)
+                        {
+                            const auto col = colOrigin + j;
+                            if (col >= 0 && col < static_cast<long>(shape.W))
+                                d[i][j][lane] =
+                                    image[row * shape.PaddedW + col];
+                        }
+                    }
+                }
+
+                float transformed[alpha][alpha][WinogradLanes];
+                WinogradTransform(transformed, Matrices::BT, d);
+                for (unsigned int xi = 0; xi < alpha * alpha; ++xi)
+                    std::copy(transformed[xi / alpha][xi % alpha],
+                              transformed[xi / alpha][xi % alpha] + count,
+                              v + (xi * shape.C + c) * tiles + first);
+            }
+        });
+}
+
+//! Transforms M laid out in (alpha * alpha, K, tileEnd - tileBegin) into the
+//! output tiles AT M A, and writes them to y
+template <unsigned int OutputTile>
+static void WinogradOutput(float* y, const float* m, const ConvShape& shape,
+                           std::size_t tileBegin, std::size_t tileEnd,
+                           unsigned int tilesRow, unsigned int tilesCol)
+{
+    using Matrices = WinogradMatrices<OutputTile>;
+    constexpr auto alpha = Matrices::Alpha;
+    const auto tiles = tileEnd - tileBegin;
+    const auto groups = (tiles + WinogradLanes - 1) / WinogradLanes;
+    const std::size_t tilesPerImage =
+        static_cast<std::size_t>(tilesRow) * tilesCol;
+
+    Util::ParallelFor(
+        0, shape.K * groups,
+        Util::GrainSize(alpha * alpha * alpha * WinogradLanes),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto idx = begin; idx < end; ++idx)
+            {
+                const auto k = idx / groups;
+                const auto first = (idx % groups) * WinogradLanes;
+                const auto count =
+                    std::min<std::size_t>(WinogradLanes, tiles - first);
+
+                float tile[alpha][alpha][WinogradLanes] = {};
+                for (unsigned int xi = 0; xi < alpha * alpha; ++xi)
+                {
+                    const float* src = m + (xi * shape.K + k) * tiles + first;
+                    std::copy(src, src + count, tile[xi / alpha][xi % alpha]);
+                }
+
+                float result[OutputTile][OutputTile][WinogradLanes];
+                WinogradTransform(result, Matrices::AT, tile);
+                for (std::size_t lane = 0; lane < count; ++lane)
+                {
+                    const auto tileIdx = tileBegin + first + lane;
+                    const auto n = tileIdx / tilesPerImage;
+                    const auto rowOrigin =
+                        (tileIdx % tilesPerImage) / tilesCol * OutputTile;
+                    const auto colOrigin = tileIdx % tilesCol * OutputTile;
+                    float* output =
+                        y + (n * shape.K + k) * shape.P * shape.PaddedQ;
+                    for (unsigned int i = 0;
+                         i < OutputTile && rowOrigin + i < shape.P; ++i)
+                        for (unsigned int j = 0;
+                             j < OutputTile && colOrigin + j < shape.Q; ++j)
+                            output[(rowOrigin + i) * shape.PaddedQ +
+                                   colOrigin + j] = result[i][j][lane];
+                }
+            }
+        });
+}
+
+//! Computes the convolution with the filter transformed by WinogradFilter
+//! Tiles are processed in chunks. Each chunk is transformed, multiplied with
+//! the filter by alpha * alpha GEMMs of (K x C) * (C x tiles), and transformed
+//! back to the output
+template <unsigned int OutputTile>
+static void ForwardWinograd(float* y, const float* x, const float* transformed,
+                            const ConvShape& shape)
+{
+    constexpr auto alpha = WinogradMatrices<OutputTile>::Alpha;
+    const auto tilesRow = (shape.P + OutputTile - 1) / OutputTile;
+    const auto tilesCol = (shape.Q + OutputTile - 1) / OutputTile;
+    const auto totalTiles =
+        static_cast<std::size_t>(shape.N) * tilesRow * tilesCol;
+    const auto chunk = std::min(totalTiles, WinogradTileChunk);
+
+    std::vector<float> v(alpha * alpha * shape.C * chunk);
+    std::vector<float> m(alpha * alpha * shape.K * chunk);
+    for (std::size_t tileBegin = 0; tileBegin < totalTiles; tileBegin += chunk)
+    {
+        const auto tileEnd = std::min(totalTiles, tileBegin + chunk);
+        const auto tiles = tileEnd - tileBegin;
+        WinogradInput<OutputTile>(v.data(), x, shape, tileBegin, tileEnd,
+                                  tilesRow, tilesCol);
+        for (std::size_t xi = 0; xi < alpha * alpha; ++xi)
+            BlockedGemm(shape.K, static_cast<unsigned int>(tiles), shape.C,
+                        transformed + xi * shape.K * shape.C, shape.C, 1,
+                        v.data() + xi * shape.C * tiles, tiles, 1,
+                        m.data() + xi * shape.K * tiles, tiles, false);
+        WinogradOutput<OutputTile>(y, m.data(), shape, tileBegin, tileEnd,
+                                   tilesRow, tilesCol);
+    }
+}
+
+//! Returns true if the Winograd convolution computes the shape
+static bool IsWinogradShape(const ConvShape& shape)
+{
+    return shape.R == 3 && shape.S == 3 && shape.StrideRow == 1 &&
+           shape.StrideCol == 1 && shape.DilationRow == 1 &&
+           shape.DilationCol == 1;
+}
+
+unsigned int GetWinogradTileSize(const ConvShape& shape)
+{
+    if (!IsWinogradShape(shape))
+        return 0;
+    if (shape.C < WinogradMinChannels || shape.K < WinogradMinChannels)
+        return 0;
+    if (shape.P >= 4 && shape.Q >= 4 && shape.C <= WinogradMaxChannelsF4)
+        return 4;
+    return 2;
+}
+
+std::size_t GetWinogradFilterSize(const ConvShape& shape,
+                                  unsigned int tileSize)
+{
+    const std::size_t alpha = tileSize + 2;
+    return alpha * alpha * shape.K * shape.C;
+}
+
+void WinogradTransformFilter(float* transformed, const float* filter,
+                             const ConvShape& shape, unsigned int tileSize)
+{
+    if (tileSize == 4)
+        WinogradFilter<4>(transformed, filter, shape);
+    else
+        WinogradFilter<2>(transformed, filter, shape);
+}
+
+void Conv2DForwardWinograd(float* y, const float* x, const float* transformed,
+                           const ConvShape& shape, unsigned int tileSize)
+{
+    if (tileSize == 4)
+        ForwardWinograd<4>(y, x, transformed, shape);
+    else
+        ForwardWinograd<2>(y, x, transformed, shape);
+}
+
+void Conv2DForward(float* y, const float* x, const float* filter,
+                   const ConvShape& shape, ConvAlgorithm algorithm)
+{
+    if (algorithm == ConvAlgorithm::Winograd && !IsWinogradShape(shape))
+        algorithm = ConvAlgorithm::Auto;
+    if (algorithm == ConvAlgorithm::Auto)
+    {
+        if (GetWinogradTileSize(shape) != 0)
+            algorithm = ConvAlgorithm::Winograd;
+        else
+            algorithm = shape.R * shape.S <= 9 && shape.C >= ChannelBlock &&
+                                shape.K >= ChannelBlock
+                            ? ConvAlgorithm::Direct
+                            : ConvAlgorithm::Im2ColGemm;
+    }
+
+    if (algorithm == ConvAlgorithm::Winograd)
+    {
+        //! Requested Winograd uses F(2x2, 3x3) for shapes Auto would not choose
+        const auto tileSize = std::max(GetWinogradTileSize(shape), 2u);
+        std::vector<float> transformed(GetWinogradFilterSize(shape, tileSize));
+        WinogradTransformFilter(transformed.data(), filter, shape, tileSize);
+        Conv2DForwardWinograd(y, x, transformed.data(), shape, tileSize);
+    }
+    else if (algorithm == ConvAlgorithm::Direct)
+        ForwardDirect(y, x, filter, shape);
+    else
+        ForwardIm2Col(y, x, filter, shape);
+}
+
+void Conv2DBackwardData(float* dx, const float* filter, const float* dy,
+                        const ConvShape& shape)
+{
+    const auto crs = shape.C * shape.R * shape.S;
+    const auto pq = shape.P * shape.Q;
+    const auto packedFilter = PackFilter(filter, shape);
+    std::vector<float> col(static_cast<std::size_t>(crs) * pq);
+    std::vector<float> gradient(
+        shape.Q == shape.PaddedQ ? 0 : static_cast<std::size_t>(shape.K) * pq);
+
+    for (unsigned int n = 0; n < shape.N; ++n)
+    {
+        const float* dyImage = dy + static_cast<std::size_t>(n) * shape.K *
+                                        shape.P * shape.PaddedQ;
+        if (!gradient.empty())
+        {
+            CopyRows(gradient.data(), shape.Q, dyImage, shape.PaddedQ,
+                     static_cast<std::size_t>(shape.K) * shape.P, shape.Q,
+                     false);
+            dyImage = gradient.data();
+        }
+
+        //! Columns of the gradient are filter^T * dy
+        BlockedGemm(crs, pq, shape.K, packedFilter.data(), 1, crs, dyImage,
+                    pq, 1, col.data(), pq, false);
+        Col2Im(dx + static_cast<std::size_t>(n) * shape.C * shape.H *
+                        shape.PaddedW,
+               col.data(), shape);
+    }
+}
+
+void Conv2DBackwardFilter(float* dFilter, const float* x, const float* dy,
+                          const ConvShape& shape)
+{
+    const auto crs = shape.C * shape.R * shape.S;
+    const auto pq = shape.P * shape.Q;
+    const bool isIdentity = IsIdentityIm2Col(shape);
+    std::vector<float> col(isIdentity ? 0 : static_cast<std::size_t>(crs) * pq);
+    std::vector<float> gradient(
+        shape.Q == shape.PaddedQ ? 0 : static_cast<std::size_t>(shape.K) * pq);
+    //! Gradient of every image is summed without the row padding of filter
+    std::vector<float> filterGradient(static_cast<std::size_t>(shape.K) * crs,
+                                      0.0f);
+
+    for (unsigned int n = 0; n < shape.N; ++n)
+    {
+        const float* image = x + static_cast<std::size_t>(n) * shape.C *
+                                     shape.H * shape.PaddedW;
+        const float* dyImage = dy + static_cast<std::size_t>(n) * shape.K *
+                                        shape.P * shape.PaddedQ;
+        if (!isIdentity)
+            Im2Col(col.data(), image, shape);
+        if (!gradient.empty())
+        {
+            CopyRows(gradient.data(), shape.Q, dyImage, shape.PaddedQ,
+                     static_cast<std::size_t>(shape.K) * shape.P, shape.Q,
+                     false);
+            dyImage = gradient.data();
+        }
+
+        //! Gradient of the filter is dy * columns^T
+        BlockedGemm(shape.K, crs, pq, dyImage, pq, 1,
+                    isIdentity ? image : col.data(), 1, pq,
+                    filterGradient.data(), crs, true);
+    }
+
+    CopyRows(dFilter, shape.PaddedS, filterGradient.data(), shape.S,
+             static_cast<std::size_t>(shape.K) * shape.C * shape.R, shape.S,
+             true);
+}
+}  // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,91 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaiveEmbedding.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Number of rows gathered ahead of the row being copied
+constexpr std::size_t PrefetchDistance = 4;
+
+void Gather(float* output, std::size_t outputStride, const float* table,
+            std::size_t tableStride, const std::size_t* indices,
+            std::size_t count, unsigned int rowSize)
+{
+    Util::ParallelFor(
+        0, count, Util::GrainSize(rowSize * 2),
+        [=](std::size_t begin, std::size_t end) {
+            for (auto idx = begin; idx < end; ++idx)
+            {
+                const float* source = table + indices[idx] * tableStride;
+                float* destination = output + idx * outputStride;
+#ifdef __AVX2__
+                if (idx + PrefetchDistance < end)
+                {
+                    const auto* ahead = reinterpret_cast<const char*>(
+                        table +
+                        indices[idx + PrefetchDistance] * tableStride);
+                    for (std::size_t offset = 0;
+                         offset < rowSize * sizeof(float); offset += 64)
+                        _mm_prefetch(ahead + offset, _MM_HINT_T0);
+                }
+#endif
+                unsigned int col = 0;
+#ifdef __AVX2__
+                for (; col + 8 <= rowSize; col += 8)
+                    _mm256_storeu_ps(destination + col,
+                                     _mm256_loadu_ps(source + col));
+#endif
+                for (; col < rowSize; ++col)
+                    destination[col] = source[col];
+            }
+        });
+}
+
+void ScatterAddRows(float* rows, std::size_t numSlots,
+                    const std::size_t* slots, const float* gradient,
+                    std::size_t gradientStride, std::size_t count,
+                    unsigned int rowSize)
+{
+    if (count == 0)
+        return;
+
+    //! Gradient rows are grouped by their slots in the order of i
+    std::vector<std::size_t> offsets(numSlots + 1, 0);
+    for (std::size_t idx = 0; idx < count; ++idx)
+        ++offsets[slots[idx] + 1];
+    for (std::size_t slot = 0; slot < numSlots; ++slot)
+        offsets[slot + 1] += offsets[slot];
+    std::vector<std::size_t> order(count);
+    {
+        auto next = offsets;
+        for (std::size_t idx = 0; idx < count; ++idx)
+            order[next[slots[idx]]++] = idx;
+    }
+
+    Util::ParallelFor(
+        0, numSlots, Util::GrainSize(rowSize * (count / numSlots + 1)),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto slot = begin; slot < end; ++slot)
+            {
+                float* row = rows + slot * rowSize;
+                for (auto pos = offsets[slot]; pos < offsets[slot + 1]; ++pos)
+                {
+                    const float* source =
+                        gradient + order[pos] * gradientStride;
+                    for (unsigned int col = 0; col < rowSize; ++col)
+                        row[col] += source[col];
+                }
+            }
+        });
+}
+}  // namespace Sapphire::Compute::Dense::Naive
@@ -5,7 +5,19 @@
 // property of any third parties.
 
 #include <Sapphire/compute/dense/naive/NaiveGemm.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <algorithm>
 #include <cstdlib>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+//! Micro kernel uses fused multiply-add, which gcc and clang enable with -mfma
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#define SAPPHIRE_GEMM_AVX2
+#endif
 
 namespace Sapphire::Compute::Dense::Naive
 {
@@ -13,32 +25,51 @@ void NaiveGemm(unsigned int paddedSizeOut, float* out, float* A, float* B,
                float* C, unsigned int M, unsigned int N, unsigned int paddedN,
                unsigned int K, unsigned int paddedK)
 {
-    const auto strideA = M * paddedK;
-    const auto strideB = K * paddedN;
+    StridedGemm(paddedSizeOut, out, A, B, C, M, N, paddedN, K, M * paddedK,
+                paddedK, 1, K * paddedN, paddedN, 1);
+}
+
+void StridedGemm(unsigned int paddedSizeOut, float* out, float* A, float* B,
+                 float* C, unsigned int M, unsigned int N, unsigned int paddedN,
+                 unsigned int K, unsigned int matrixStrideA,
+                 unsigned int rowStrideA, unsigned int colStrideA,
+                 unsigned int matrixStrideB, unsigned int rowStrideB,
+                 unsigned int colStrideB)
+{
     const auto strideC = M * paddedN;
     const auto strideOut = M * paddedN;
 
-#pragma omp parallel for default(none) schedule(static)            \
-    shared(paddedSizeOut, strideOut, M, N, paddedN, K, paddedK, A, B, C, out, \
-           strideA, strideB, strideC)
-    for (long chunkIdx = 0; chunkIdx < static_cast<long>(
-                                paddedSizeOut / strideOut); ++chunkIdx)
-        for (size_t mIdx = 0; mIdx < M; ++mIdx)
-            for (size_t nIdx = 0; nIdx < N; ++nIdx)
+    //! Rows of every matrix are distributed over the thread pool
+    const std::size_t numRows =
+        static_cast<size_t>(paddedSizeOut / strideOut) * M;
+
+    Util::ParallelFor(
+        0, numRows, Util::GrainSize(static_cast<size_t>(N) * K),
+        [&](std::size_t rowBegin, std::size_t rowEnd) {
+            for (auto rowIdx = rowBegin; rowIdx < rowEnd; ++rowIdx)
             {
-                auto* batchPtrA = A + static_cast<size_t>(strideA) * chunkIdx;
-                auto* batchPtrB = B + static_cast<size_t>(strideB) * chunkIdx;
+                const auto chunkIdx = rowIdx / M;
+                const auto mIdx = rowIdx % M;
+                auto* batchPtrA =
+                    A + static_cast<size_t>(matrixStrideA) * chunkIdx;
+                auto* batchPtrB =
+                    B + static_cast<size_t>(matrixStrideB) * chunkIdx;
                 auto* batchPtrC = C + static_cast<size_t>(strideC) * chunkIdx;
                 auto* batchPtrOut =
                     out + static_cast<size_t>(strideOut) * chunkIdx;
 
-                float sum = batchPtrC[paddedN * mIdx + nIdx];
-                for (size_t kIdx = 0; kIdx < K; ++kIdx)
-                    sum += batchPtrA[paddedK * mIdx + kIdx] *
-                        batchPtrB[paddedN * kIdx + nIdx];
+                for (size_t nIdx = 0; nIdx < N; ++nIdx)
+                {
+                    float sum = batchPtrC[paddedN * mIdx + nIdx];
+                    for (size_t kIdx = 0; kIdx < K; ++kIdx)
+                        sum +=
+                            batchPtrA[rowStrideA * mIdx + colStrideA * kIdx] *
+                            batchPtrB[rowStrideB * kIdx + colStrideB * nIdx];
 
-                batchPtrOut[paddedN * mIdx + nIdx] = sum;
+                    batchPtrOut[paddedN * mIdx + nIdx] = sum;
+                }
             }
+        });
 }
 
 void Gemm(float* out, float* A, float* B, float* C, unsigned int M,
@@ -73,4 +104,319 @@ void Gemm(float* out, float* A, float* B, float* C, unsigned int M,
                     batchPtrOut[paddedN * mIdx + nIdx] = sum;
                 }
 }
+
+//! Micro kernel computes GemmMR x GemmNR tile of out
+//! Packed blocks of A (GemmMC x GemmKC) and B (GemmKC x GemmNC) are sized to
+//! stay in the L2 cache
+constexpr unsigned int GemmMR = 6;
+constexpr unsigned int GemmNR = 16;
+constexpr unsigned int GemmMC = 72;
+constexpr unsigned int GemmKC = 256;
+constexpr unsigned int GemmNC = 256;
+
+//! Packs mc x kc block of A into panels of GemmMR rows
+//! Each panel stores GemmMR elements of every column contiguously, and rows
+//! beyond mc are filled with zero
+static void PackA(float* packed, const float* A, std::size_t rowStride,
+                  std::size_t colStride, unsigned int mc, unsigned int kc)
+{
+    for (unsigned int i = 0; i < mc; i += GemmMR)
+    {
+        const auto rows = std::min(GemmMR, mc - i);
+        for (unsigned int k = 0; k < kc; ++k)
+        {
+            for (unsigned int r = 0; r < rows; ++r)
+                packed[r] = A[(i + r) * rowStride + k * colStride];
+            for (unsigned int r = rows; r < GemmMR; ++r)
+                packed[r] = 0.0f;
+            packed += GemmMR;
+        }
+    }
+}
+
+//! Packs kc x nc block of B into panels of GemmNR columns
+//! Each panel stores GemmNR elements of every row contiguously, and columns
+//! beyond nc are filled with zero
+static void PackB(float* packed, const float* B, std::size_t rowStride,
+                  std::size_t colStride, unsigned int kc, unsigned int nc)
+{
+    for (unsigned int j = 0; j < nc; j += GemmNR)
+    {
+        const auto cols = std::min(GemmNR, nc - j);
+        for (unsigned int k = 0; k < kc; ++k)
+        {
+            for (unsigned int c = 0; c < cols; ++c)
+                packed[c] = B[k * rowStride + (j + c) * colStride];
+            for (unsigned int c = cols; c < GemmNR; ++c)
+                packed[c] = 0.0f;
+            packed += GemmNR;
+        }
+    }
+}
+
+//! Computes GemmMR x GemmNR tile from the packed panels
+//! Tile is added to out if accumulate is true, and overwrites out otherwise
+static void MicroKernel(unsigned int kc, const float* packedA,
+                        const float* packedB, float* out, std::size_t ldOut,
+                        bool accumulate)
+{
+#ifdef SAPPHIRE_GEMM_AVX2
+    //! 12 accumulators, 2 columns of B and broadcast of A fit in 16 registers
+    auto c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+    auto c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+    auto c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+    auto c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+    auto c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+    auto c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+    for (unsigned int k = 0; k < kc; ++k)
+    {
+        const auto b0 = _mm256_loadu_ps(packedB);
+        const auto b1 = _mm256_loadu_ps(packedB + 8);
+        auto a = _mm256_broadcast_ss(packedA);
+        c00 = _mm256_fmadd_ps(a, b0, c00);
+        c01 = _mm256_fmadd_ps(a, b1, c01);
+        a = _mm256_broadcast_ss(packedA + 1);
+        c10 = _mm256_fmadd_ps(a, b0, c10);
+        c11 = _mm256_fmadd_ps(a, b1, c11);
+        a = _mm256_broadcast_ss(packedA + 2);
+        c20 = _mm256_fmadd_ps(a, b0, c20);
+        c21 = _mm256_fmadd_ps(a, b1, c21);
+        a = _mm256_broadcast_ss(packedA + 3);
+        c30 = _mm256_fmadd_ps(a, b0, c30);
+        c31 = _mm256_fmadd_ps(a, b1, c31);
+        a = _mm256_broadcast_ss(packedA + 4);
+        c40 = _mm256_fmadd_ps(a, b0, c40);
+        c41 = _mm256_fmadd_ps(a, b1, c41);
+        a = _mm256_broadcast_ss(packedA + 5);
+        c50 = _mm256_fmadd_ps(a, b0, c50);
+        c51 = _mm256_fmadd_ps(a, b1, c51);
+        packedA += GemmMR;
+        packedB += GemmNR;
+    }
+
+    const auto store = [=](float* row, __m256 low, __m256 high) {
+        if (accumulate)
+        {
+            low = _mm256_add_ps(low, _mm256_loadu_ps(row));
+            high = _mm256_add_ps(high, _mm256_loadu_ps(row + 8));
+        }
+        _mm256_storeu_ps(row, low);
+        _mm256_storeu_ps(row + 8, high);
+    };
+    store(out, c00, c01);
+    store(out + ldOut, c10, c11);
+    store(out + 2 * ldOut, c20, c21);
+    store(out + 3 * ldOut, c30, c31);
+    store(out + 4 * ldOut, c40, c41);
+    store(out + 5 * ldOut, c50, c51);
+#else
+    float sum[GemmMR][GemmNR] = {};
+    for (unsigned int k = 0; k < kc; ++k)
+    {
+        for (unsigned int r = 0; r < GemmMR; ++r)
+            for (unsigned int c = 0; c < GemmNR; ++c)
+                sum[r][c] += packedA[r] * packedB[c];
+        packedA += GemmMR;
+        packedB += GemmNR;
+    }
+
+    for (unsigned int r = 0; r < GemmMR; ++r)
+        for (unsigned int c = 0; c < GemmNR; ++c)
+            out[r * ldOut + c] =
+                accumulate ? out[r * ldOut + c] + sum[r][c] : sum[r][c];
+#endif
+}
+
+//! Computes mc x nc block of out from the packed blocks of A and B
+static void ComputeBlock(const float* packedA, const float* packedB,
+                         unsigned int mc, unsigned int nc, unsigned int kc,
+                         float* out, std::size_t ldOut, bool accumulate)
+{
+    for (unsigned int j = 0; j < nc; j += GemmNR)
+        for (unsigned int i = 0; i < mc; i += GemmMR)
+        {
+            const float* panelA = packedA + i * kc;
+            const float* panelB = packedB + j * kc;
+            float* tile = out + i * ldOut + j;
+            const auto rows = std::min(GemmMR, mc - i);
+            const auto cols = std::min(GemmNR, nc - j);
+            if (rows == GemmMR && cols == GemmNR)
+            {
+                MicroKernel(kc, panelA, panelB, tile, ldOut, accumulate);
+                continue;
+            }
+
+            //! Partial tile is computed aside and only its valid part is
+            //! written
+            float buffer[GemmMR * GemmNR];
+            MicroKernel(kc, panelA, panelB, buffer, GemmNR, false);
+            for (unsigned int r = 0; r < rows; ++r)
+                for (unsigned int c = 0; c < cols; ++c)
+                {
+                    const float value = buffer[r * GemmNR + c];
+                    tile[r * ldOut + c] =
+                        accumulate ? tile[r * ldOut + c] + value : value;
+                }
+        }
+}
+
+//! Computes tiles [tileBegin, tileEnd) of out on the calling thread
+//! Tiles are numbered in row major order over tilesN tiles in each row
+static void ComputeTiles(std::size_t tileBegin, std::size_t tileEnd,
+                         unsigned int tilesN, unsigned int M, unsigned int N,
+                         unsigned int K, const float* A,
+                         std::size_t rowStrideA, std::size_t colStrideA,
+                         const float* B, std::size_t rowStrideB,
+                         std::size_t colStrideB, float* out,
+                         std::size_t ldOut, bool accumulate)
+{
+    //! Packing buffers are reused by each thread
+    thread_local std::vector<float> packedA, packedB;
+    packedA.resize(GemmMC * GemmKC);
+    packedB.resize(GemmKC * GemmNC);
+
+    for (auto tileIdx = tileBegin; tileIdx < tileEnd; ++tileIdx)
+    {
+        const auto mBegin =
+            static_cast<unsigned int>(tileIdx / tilesN) * GemmMC;
+        const auto nBegin =
+            static_cast<unsigned int>(tileIdx % tilesN) * GemmNC;
+        const auto mc = std::min(GemmMC, M - mBegin);
+        const auto nc = std::min(GemmNC, N - nBegin);
+
+        for (unsigned int kBegin = 0; kBegin < K; kBegin += GemmKC)
+        {
+            const auto kc = std::min(GemmKC, K - kBegin);
+            PackA(packedA.data(),
+                  A + mBegin * rowStrideA + kBegin * colStrideA, rowStrideA,
+                  colStrideA, mc, kc);
+            PackB(packedB.data(),
+                  B + kBegin * rowStrideB + nBegin * colStrideB, rowStrideB,
+                  colStrideB, kc, nc);
+            //! Blocks after the first one are added to the first
+            ComputeBlock(packedA.data(), packedB.data(), mc, nc, kc,
+                         out + mBegin * ldOut + nBegin, ldOut,
+                         accumulate || kBegin > 0);
+        }
+    }
+}
+
+void BlockedGemm(unsigned int M, unsigned int N, unsigned int K,
+                 const float* A, std::size_t rowStrideA,
+                 std::size_t colStrideA, const float* B,
+                 std::size_t rowStrideB, std::size_t colStrideB, float* out,
+                 std::size_t ldOut, bool accumulate)
+{
+    if (K == 0 && !accumulate)
+        for (unsigned int mIdx = 0; mIdx < M; ++mIdx)
+            std::fill(out + mIdx * ldOut, out + mIdx * ldOut + N, 0.0f);
+    if (M == 0 || N == 0 || K == 0)
+        return;
+
+    const auto tilesM = (M + GemmMC - 1) / GemmMC;
+    const auto tilesN = (N + GemmNC - 1) / GemmNC;
+
+    Util::ParallelFor(
+        0, static_cast<std::size_t>(tilesM) * tilesN,
+        Util::GrainSize(static_cast<std::size_t>(GemmMC) * GemmNC * K),
+        [&](std::size_t tileBegin, std::size_t tileEnd) {
+            ComputeTiles(tileBegin, tileEnd, tilesN, M, N, K, A, rowStrideA,
+                         colStrideA, B, rowStrideB, colStrideB, out, ldOut,
+                         accumulate);
+        });
+}
+
+//! Multiplications smaller than this are computed by dot products, since
+//! packing costs more than it saves
+constexpr std::size_t SmallGemmSize = 16 * 16 * 16;
+
+//! Performs out = A*B + C of the entry on the calling thread
+//! Out is computed in place if C is the same as Out
+static void EntryGemm(const GemmBatchShape& shape, const GemmBatchEntry& entry,
+                      bool parallel)
+{
+    const auto M = shape.M, N = shape.N, K = shape.K;
+    if (static_cast<std::size_t>(M) * N * K < SmallGemmSize)
+    {
+        for (unsigned int mIdx = 0; mIdx < M; ++mIdx)
+            for (unsigned int nIdx = 0; nIdx < N; ++nIdx)
+            {
+                float sum = entry.C[shape.LdC * mIdx + nIdx];
+                for (unsigned int kIdx = 0; kIdx < K; ++kIdx)
+                    sum += entry.A[shape.RowStrideA * mIdx +
+                                   shape.ColStrideA * kIdx] *
+                           entry.B[shape.RowStrideB * kIdx +
+                                   shape.ColStrideB * nIdx];
+                entry.Out[shape.LdOut * mIdx + nIdx] = sum;
+            }
+        return;
+    }
+
+    if (entry.C != entry.Out)
+        for (unsigned int mIdx = 0; mIdx < M; ++mIdx)
+            std::copy(entry.C + shape.LdC * mIdx,
+                      entry.C + shape.LdC * mIdx + N,
+                      entry.Out + shape.LdOut * mIdx);
+
+    if (parallel)
+    {
+        BlockedGemm(M, N, K, entry.A, shape.RowStrideA, shape.ColStrideA,
+                    entry.B, shape.RowStrideB, shape.ColStrideB, entry.Out,
+                    shape.LdOut, true);
+        return;
+    }
+
+    if (K == 0)
+        return;
+    const auto tilesM = (M + GemmMC - 1) / GemmMC;
+    const auto tilesN = (N + GemmNC - 1) / GemmNC;
+    ComputeTiles(0, static_cast<std::size_t>(tilesM) * tilesN, tilesN, M, N,
+                 K, entry.A, shape.RowStrideA, shape.ColStrideA, entry.B,
+                 shape.RowStrideB, shape.ColStrideB, entry.Out, shape.LdOut,
+                 true);
+}
+
+GemmSchedule ChooseGemmSchedule(std::size_t numMatrices, unsigned int M,
+                                unsigned int N, unsigned int K,
+                                unsigned int numThreads)
+{
+    if (numMatrices <= 1)
+        return GemmSchedule::Matrix;
+
+    //! Number of tasks each schedule can run in parallel. Small
+    //! multiplications are not split by BlockedGemm
+    const auto size = static_cast<std::size_t>(M) * N * K;
+    const auto tiles =
+        size < SmallGemmSize
+            ? std::size_t{ 1 }
+            : static_cast<std::size_t>((M + GemmMC - 1) / GemmMC) *
+                  ((N + GemmNC - 1) / GemmNC);
+    const auto batchTasks = std::min<std::size_t>(numMatrices, numThreads);
+    const auto matrixTasks = std::min<std::size_t>(tiles, numThreads);
+    return batchTasks >= matrixTasks ? GemmSchedule::Batch
+                                     : GemmSchedule::Matrix;
+}
+
+void BatchedGemm(const GemmBatchShape& shape, const GemmBatchEntry* entries,
+                 std::size_t numEntries, GemmSchedule schedule)
+{
+    if (shape.M == 0 || shape.N == 0)
+        return;
+
+    if (schedule == GemmSchedule::Matrix)
+    {
+        for (std::size_t idx = 0; idx < numEntries; ++idx)
+            EntryGemm(shape, entries[idx], true);
+        return;
+    }
+
+    const auto size =
+        static_cast<std::size_t>(shape.M) * shape.N * (shape.K + 1);
+    Util::ParallelFor(0, numEntries, Util::GrainSize(size),
+                      [&](std::size_t begin, std::size_t end) {
+                          for (auto idx = begin; idx < end; ++idx)
+                              EntryGemm(shape, entries[idx], false);
+                      });
+}
 } // namespace Sapphire::Compute::Naive::Dense
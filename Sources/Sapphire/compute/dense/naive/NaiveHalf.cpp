@@ -0,0 +1,444 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaiveHalf.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+//! Every processor supporting AVX2 supports F16C as well, but gcc and clang
+//! require it to be enabled separately (-mf16c)
+#if defined(__AVX2__) && (defined(__F16C__) || defined(_MSC_VER))
+#define SAPPHIRE_HALF_AVX2
+#endif
+
+namespace Sapphire::Compute::Dense::Naive
+{
+static std::uint32_t FloatBits(float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(float));
+    return bits;
+}
+
+static float BitsToFloat(std::uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(float));
+    return value;
+}
+
+static std::uint16_t FloatToHalf(float value)
+{
+#ifdef SAPPHIRE_HALF_AVX2
+    return static_cast<std::uint16_t>(
+        _cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT));
+#else
+    const std::uint32_t bits = FloatBits(value);
+    const auto sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000);
+    const std::uint32_t absBits = bits & 0x7fffffff;
+
+    //! Infinity and NaN (NaN is quieted keeping the upper bits of payload)
+    if (absBits > 0x7f800000)
+        return sign | 0x7e00 | ((absBits >> 13) & 0x03ff);
+    if (absBits == 0x7f800000)
+        return sign | 0x7c00;
+    //! Rounds to infinity if larger than or equal to 65520
+    if (absBits >= 0x477ff000)
+        return sign | 0x7c00;
+    //! Subnormal numbers of half (smaller than 2^-14)
+    if (absBits < 0x38800000)
+    {
+        //! Rounds to zero if smaller than or equal to 2^-25
+        if (absBits <= 0x33000000)
+            return sign;
+
+        const std::uint32_t mantissa = (absBits & 0x7fffff) | 0x800000;
+        const std::uint32_t shift = 126 - (absBits >> 23);
+        const std::uint32_t remainder = mantissa & ((1u << shift) - 1);
+        const std::uint32_t halfway = 1u << (shift - 1);
+        std::uint32_t halfMantissa = mantissa >> shift;
+        if (remainder > halfway ||
+            (remainder == halfway && (halfMantissa & 1)))
+            ++halfMantissa;
+        return sign | static_cast<std::uint16_t>(halfMantissa);
+    }
+
+    //! Re-bias the exponent and round to nearest even. Carry of the mantissa
+    //! is propagated to the exponent
+    std::uint32_t rounded = absBits - (112u << 23);
+    rounded += 0x0fff + ((rounded >> 13) & 1);
+    return sign | static_cast<std::uint16_t>(rounded >> 13);
+#endif
+}
+
+static float HalfToFloat(std::uint16_t value)
+{
+#ifdef SAPPHIRE_HALF_AVX2
+    return _cvtsh_ss(value);
+#else
+    const std::uint32_t sign = static_cast<std::uint32_t>(value & 0x8000)
+                               << 16;
+    std::uint32_t exponent = (value >> 10) & 0x1f;
+    std::uint32_t mantissa = value & 0x03ff;
+
+    //! Infinity and NaN (NaN is quieted)
+    if (exponent == 0x1f)
+        return BitsToFloat(sign | 0x7f800000 | (mantissa ? 0x400000 : 0) |
+                           (mantissa << 13));
+    if (exponent != 0)
+        return BitsToFloat(sign | ((exponent + 112) << 23) | (mantissa << 13));
+    if (mantissa == 0)
+        return BitsToFloat(sign);
+
+    //! Normalizes subnormal numbers
+    exponent = 113;
+    while (!(mantissa & 0x0400))
+    {
+        mantissa <<= 1;
+        --exponent;
+    }
+    return BitsToFloat(sign | (exponent << 23) | ((mantissa & 0x03ff) << 13));
+#endif
+}
+
+static std::uint16_t FloatToBFloat16(float value)
+{
+    const std::uint32_t bits = FloatBits(value);
+
+    //! NaN must stay NaN after rounding
+    if ((bits & 0x7fffffff) > 0x7f800000)
+        return static_cast<std::uint16_t>((bits >> 16) | 0x0040);
+
+    const std::uint32_t rounded = bits + 0x7fff + ((bits >> 16) & 1);
+    return static_cast<std::uint16_t>(rounded >> 16);
+}
+
+static float BFloat16ToFloat(std::uint16_t value)
+{
+    return BitsToFloat(static_cast<std::uint32_t>(value) << 16);
+}
+
+template <DataType dataType>
+static float ToFloat(std::uint16_t value)
+{
+    if constexpr (dataType == DataType::Float16)
+        return HalfToFloat(value);
+    else
+        return BFloat16ToFloat(value);
+}
+
+template <DataType dataType>
+static std::uint16_t FromFloat(float value)
+{
+    if constexpr (dataType == DataType::Float16)
+        return FloatToHalf(value);
+    else
+        return FloatToBFloat16(value);
+}
+
+#ifdef SAPPHIRE_HALF_AVX2
+//! Loads 8 elements and converts them into float
+template <DataType dataType>
+static __m256 Load8(const std::uint16_t* ptr)
+{
+    const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+    if constexpr (dataType == DataType::Float16)
+        return _mm256_cvtph_ps(data);
+    else
+        return _mm256_castsi256_ps(
+            _mm256_slli_epi32(_mm256_cvtepu16_epi32(data), 16));
+}
+
+//! Converts 8 floats and stores them
+template <DataType dataType>
+static void Store8(std::uint16_t* ptr, __m256 value)
+{
+    __m128i data;
+    if constexpr (dataType == DataType::Float16)
+    {
+        data = _mm256_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT);
+    }
+    else
+    {
+        const __m256i bits = _mm256_castps_si256(value);
+        const __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16),
+                                             _mm256_set1_epi32(1));
+        const __m256i rounded = _mm256_srli_epi32(
+            _mm256_add_epi32(
+                bits, _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7fff))),
+            16);
+        const __m256i nan = _mm256_or_si256(_mm256_srli_epi32(bits, 16),
+                                            _mm256_set1_epi32(0x0040));
+        const __m256 isNan = _mm256_cmp_ps(value, value, _CMP_UNORD_Q);
+        const __m256i result =
+            _mm256_blendv_epi8(rounded, nan, _mm256_castps_si256(isNan));
+
+        //! Packs 32 bit lanes into 16 bits and gathers the lower half of
+        //! each 128 bit lane
+        const __m256i packed = _mm256_packus_epi32(result, result);
+        data = _mm256_castsi256_si128(
+            _mm256_permute4x64_epi64(packed, 0x08));
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), data);
+}
+#endif
+
+template <DataType dataType>
+static void ConvertFromFloatImpl(std::uint16_t* output, const float* input,
+                                 unsigned long totalSize)
+{
+    unsigned long idx = 0;
+#ifdef __AVX512BF16__
+    if constexpr (dataType == DataType::BFloat16)
+        for (; idx + 16 <= totalSize; idx += 16)
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(output + idx),
+                (__m256i)_mm512_cvtneps_pbh(_mm512_loadu_ps(input + idx)));
+#endif
+#ifdef SAPPHIRE_HALF_AVX2
+    for (; idx + 8 <= totalSize; idx += 8)
+        Store8<dataType>(output + idx, _mm256_loadu_ps(input + idx));
+#endif
+    for (; idx < totalSize; ++idx)
+        output[idx] = FromFloat<dataType>(input[idx]);
+}
+
+template <DataType dataType>
+static void ConvertToFloatImpl(float* output, const std::uint16_t* input,
+                               unsigned long totalSize)
+{
+    unsigned long idx = 0;
+#ifdef SAPPHIRE_HALF_AVX2
+    for (; idx + 8 <= totalSize; idx += 8)
+        _mm256_storeu_ps(output + idx, Load8<dataType>(input + idx));
+#endif
+    for (; idx < totalSize; ++idx)
+        output[idx] = ToFloat<dataType>(input[idx]);
+}
+
+template <DataType dataType>
+static void HalfGemmImpl(unsigned int numMatrices, float* out,
+                         const std::uint16_t* A, const std::uint16_t* B,
+                         const float* C, unsigned int M, unsigned int N,
+                         unsigned int paddedN, unsigned int K,
+                         unsigned int paddedK, unsigned long strideA,
+                         unsigned long strideB, unsigned long strideC)
+{
+    const auto strideOut = static_cast<unsigned long>(M) * paddedN;
+    const auto numRows = static_cast<std::size_t>(numMatrices) * M;
+
+    Util::ParallelFor(
+        0, numRows, Util::GrainSize(static_cast<std::size_t>(N) * K),
+        [&](std::size_t rowBegin, std::size_t rowEnd) {
+            for (auto rowIdx = rowBegin; rowIdx < rowEnd; ++rowIdx)
+            {
+                const auto matrixIdx = rowIdx / M;
+                const auto mIdx = rowIdx % M;
+                const auto* rowA = A + strideA * matrixIdx + paddedK * mIdx;
+                const auto* matrixB = B + strideB * matrixIdx;
+                const auto* rowC = C + strideC * matrixIdx + paddedN * mIdx;
+                auto* rowOut = out + strideOut * matrixIdx + paddedN * mIdx;
+
+                unsigned int nIdx = 0;
+#ifdef SAPPHIRE_HALF_AVX2
+                for (; nIdx + 8 <= N; nIdx += 8)
+                {
+                    __m256 sum = _mm256_loadu_ps(rowC + nIdx);
+                    for (unsigned int kIdx = 0; kIdx < K; ++kIdx)
+                    {
+                        const __m256 a =
+                            _mm256_set1_ps(ToFloat<dataType>(rowA[kIdx]));
+                        const __m256 b = Load8<dataType>(
+                            matrixB +
+                            static_cast<unsigned long>(paddedN) * kIdx + nIdx);
+                        sum = _mm256_add_ps(sum, _mm256_mul_ps(a, b));
+                    }
+                    _mm256_storeu_ps(rowOut + nIdx, sum);
+                }
+#endif
+                for (; nIdx < N; ++nIdx)
+                {
+                    float sum = rowC[nIdx];
+                    for (unsigned int kIdx = 0; kIdx < K; ++kIdx)
+                        sum += ToFloat<dataType>(rowA[kIdx]) *
+                               ToFloat<dataType>(matrixB
+                                   [static_cast<unsigned long>(paddedN) *
+                                        kIdx +
+                                    nIdx]);
+                    rowOut[nIdx] = sum;
+                }
+            }
+        });
+}
+
+struct AddOp
+{
+#ifdef SAPPHIRE_HALF_AVX2
+    __m256 operator()(__m256 a, __m256 b) const
+    {
+        return _mm256_add_ps(a, b);
+    }
+#endif
+    float operator()(float a, float b) const
+    {
+        return a + b;
+    }
+};
+
+struct SubOp
+{
+#ifdef SAPPHIRE_HALF_AVX2
+    __m256 operator()(__m256 a, __m256 b) const
+    {
+        return _mm256_sub_ps(a, b);
+    }
+#endif
+    float operator()(float a, float b) const
+    {
+        return a - b;
+    }
+};
+
+struct DotOp
+{
+#ifdef SAPPHIRE_HALF_AVX2
+    __m256 operator()(__m256 a, __m256 b) const
+    {
+        return _mm256_mul_ps(a, b);
+    }
+#endif
+    float operator()(float a, float b) const
+    {
+        return a * b;
+    }
+};
+
+template <DataType dataType, typename Op>
+static void ElementWise(unsigned long totalSize, std::uint16_t* output,
+                        const std::uint16_t* inputA,
+                        const std::uint16_t* inputB, Op op)
+{
+    unsigned long idx = 0;
+#ifdef SAPPHIRE_HALF_AVX2
+    for (; idx + 8 <= totalSize; idx += 8)
+        Store8<dataType>(output + idx, op(Load8<dataType>(inputA + idx),
+                                          Load8<dataType>(inputB + idx)));
+#endif
+    for (; idx < totalSize; ++idx)
+        output[idx] = FromFloat<dataType>(
+            op(ToFloat<dataType>(inputA[idx]), ToFloat<dataType>(inputB[idx])));
+}
+
+template <typename Op>
+static void DispatchElementWise(unsigned long totalSize, std::uint16_t* output,
+                                const std::uint16_t* inputA,
+                                const std::uint16_t* inputB, DataType dataType,
+                                Op op)
+{
+    if (dataType == DataType::Float16)
+        ElementWise<DataType::Float16>(totalSize, output, inputA, inputB, op);
+    else if (dataType == DataType::BFloat16)
+        ElementWise<DataType::BFloat16>(totalSize, output, inputA, inputB, op);
+    else
+        throw std::invalid_argument(
+            "Naive::ElementWise - Data type must be Float16 or BFloat16");
+}
+
+void ConvertFromFloat(std::uint16_t* output, const float* input,
+                      unsigned long totalSize, DataType dataType)
+{
+    if (dataType == DataType::Float16)
+        ConvertFromFloatImpl<DataType::Float16>(output, input, totalSize);
+    else if (dataType == DataType::BFloat16)
+        ConvertFromFloatImpl<DataType::BFloat16>(output, input, totalSize);
+    else
+        throw std::invalid_argument(
+            "Naive::ConvertFromFloat - Data type must be Float16 or BFloat16");
+}
+
+void ConvertToFloat(float* output, const std::uint16_t* input,
+                    unsigned long totalSize, DataType dataType)
+{
+    if (dataType == DataType::Float16)
+        ConvertToFloatImpl<DataType::Float16>(output, input, totalSize);
+    else if (dataType == DataType::BFloat16)
+        ConvertToFloatImpl<DataType::BFloat16>(output, input, totalSize);
+    else
+        throw std::invalid_argument(
+            "Naive::ConvertToFloat - Data type must be Float16 or BFloat16");
+}
+
+void HalfGemm(unsigned int numMatrices, float* out, const std::uint16_t* A,
+              const std::uint16_t* B, const float* C, unsigned int M,
+              unsigned int N, unsigned int paddedN, unsigned int K,
+              unsigned int paddedK, unsigned long strideA,
+              unsigned long strideB, unsigned long strideC,
+              DataType dataType)
+{
+    if (dataType == DataType::Float16)
+        HalfGemmImpl<DataType::Float16>(numMatrices, out, A, B, C, M, N,
+                                        paddedN, K, paddedK, strideA, strideB,
+                                        strideC);
+    else if (dataType == DataType::BFloat16)
+        HalfGemmImpl<DataType::BFloat16>(numMatrices, out, A, B, C, M, N,
+                                         paddedN, K, paddedK, strideA, strideB,
+                                         strideC);
+    else
+        throw std::invalid_argument(
+            "Naive::HalfGemm - Data type must be Float16 or BFloat16");
+}
+
+void HalfAdd(unsigned long totalSize, std::uint16_t* output,
+             const std::uint16_t* inputA, const std::uint16_t* inputB,
+             DataType dataType)
+{
+    DispatchElementWise(totalSize, output, inputA, inputB, dataType, AddOp());
+}
+
+void HalfSub(unsigned long totalSize, std::uint16_t* output,
+             const std::uint16_t* inputA, const std::uint16_t* inputB,
+             DataType dataType)
+{
+    DispatchElementWise(totalSize, output, inputA, inputB, dataType, SubOp());
+}
+
+void HalfDot(unsigned long totalSize, std::uint16_t* output,
+             const std::uint16_t* inputA, const std::uint16_t* inputB,
+             DataType dataType)
+{
+    DispatchElementWise(totalSize, output, inputA, inputB, dataType, DotOp());
+}
+
+void HalfScale(unsigned long totalSize, std::uint16_t* output,
+               const std::uint16_t* input, float scaleFactor,
+               DataType dataType)
+{
+    //! Scale is computed as the product with the input itself, where the
+    //! second operand is replaced by the scale factor
+    struct ScaleOp
+    {
+        float Factor;
+#ifdef SAPPHIRE_HALF_AVX2
+        __m256 operator()(__m256 a, __m256) const
+        {
+            return _mm256_mul_ps(a, _mm256_set1_ps(Factor));
+        }
+#endif
+        float operator()(float a, float) const
+        {
+            return a * Factor;
+        }
+    };
+
+    DispatchElementWise(totalSize, output, input, input, dataType,
+                        ScaleOp{ scaleFactor });
+}
+}  // namespace Sapphire::Compute::Dense::Naive
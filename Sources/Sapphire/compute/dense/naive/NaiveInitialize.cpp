@@ -5,40 +5,88 @@
 // property of any third parties.
 
 #include <Sapphire/compute/dense/naive/NaiveInitialize.hpp>
-#include <random>
+#include <Sapphire/compute/dense/naive/NaiveRandom.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <algorithm>
+#include <cmath>
 
 namespace Sapphire::Compute::Dense::Naive
 {
+//! Fills the rows with the values transformed from the random bits
+//! Random bits of each chunk are generated from its position, so the result
+//! does not depend on how chunks are split between the threads
+//! \param transform : transform(values, bits, size) converts size random
+//! words to values. size is a multiple of 4
+template <typename Transform>
+static void FillRandom(float* data, Transform transform, const Shape& shape,
+                       size_t paddedCols, size_t batchSize, std::uint64_t seed,
+                       std::uint64_t offset)
+{
+    const size_t totalSize = shape.Size() * batchSize;
+    const size_t cols = shape.At(shape.Dim() - 1);
+    const size_t numChunks =
+        (totalSize + RandomChunkSize - 1) / RandomChunkSize;
+
+    Util::ParallelFor(
+        0, numChunks, Util::GrainSize(RandomChunkSize * 16),
+        [&](size_t chunkBegin, size_t chunkEnd) {
+            std::uint32_t bits[RandomChunkSize];
+            float values[RandomChunkSize];
+            for (auto chunkIdx = chunkBegin; chunkIdx < chunkEnd; ++chunkIdx)
+            {
+                const auto begin = chunkIdx * RandomChunkSize;
+                const auto size = std::min(RandomChunkSize, totalSize - begin);
+                const auto numCounters = (size + 3) / 4;
+                GenerateRandomBits(bits, offset + begin / 4, numCounters,
+                                   seed);
+                transform(values, bits, numCounters * 4);
+
+                auto row = begin / cols;
+                auto col = begin % cols;
+                for (size_t idx = 0; idx < size; ++idx)
+                {
+                    data[paddedCols * row + col] = values[idx];
+                    if (++col == cols)
+                    {
+                        col = 0;
+                        ++row;
+                    }
+                }
+            }
+        });
+}
+
 void Normal(float* data, float mean, float sd, const Shape& shape,
-            size_t paddedCols, size_t batchSize)
+            size_t paddedCols, size_t batchSize, std::uint64_t seed,
+            std::uint64_t offset)
 {
-    const auto totalSize = shape.Size() * batchSize;
-    const auto cols = shape.At(shape.Dim() - 1);
-    std::random_device rd{};
-    std::mt19937 gen{ rd() };
-    std::normal_distribution<float> dist(mean, sd);
-
-#pragma omp parallel for default(none) shared( \
-    totalSize, cols, paddedCols, data, dist, gen) schedule(static)
-    for (long i = 0; i < static_cast<long>(totalSize / cols); ++i)
-        for (size_t j = 0; j < cols; ++j)
-            data[paddedCols * i + j] = dist(gen);
+    constexpr float twoPi = 6.28318530717958647692f;
+    //! Each pair of words gives two values by the Box-Muller transform
+    const auto transform = [=](float* values, const std::uint32_t* bits,
+                               size_t size) {
+        for (size_t idx = 0; idx < size; idx += 2)
+        {
+            //! First uniform is in (0, 1] so its logarithm is finite
+            const float radius =
+                sd * std::sqrt(-2.0f * std::log(1.0f - ToUniform(bits[idx])));
+            const float angle = twoPi * ToUniform(bits[idx + 1]);
+            values[idx] = mean + radius * std::cos(angle);
+            values[idx + 1] = mean + radius * std::sin(angle);
+        }
+    };
+    FillRandom(data, transform, shape, paddedCols, batchSize, seed, offset);
 }
 
 void Uniform(float* data, float min, float max, const Shape& shape,
-             size_t paddedCols, size_t batchSize)
+             size_t paddedCols, size_t batchSize, std::uint64_t seed,
+             std::uint64_t offset)
 {
-    const auto totalSize = shape.Size() * batchSize;
-    const auto cols = shape.At(shape.Dim() - 1);
-    std::random_device rd{};
-    std::mt19937 gen{ rd() };
-    std::uniform_real_distribution<float> dist(min, max);
-
-#pragma omp parallel for default(none) shared( \
-    totalSize, cols, paddedCols, data, dist, gen) schedule(static)
-    for (long i = 0; i < static_cast<long>(totalSize / cols); ++i)
-        for (size_t j = 0; j < cols; ++j)
-            data[paddedCols * i + j] = dist(gen);
+    const auto transform = [=](float* values, const std::uint32_t* bits,
+                               size_t size) {
+        for (size_t idx = 0; idx < size; ++idx)
+            values[idx] = min + (max - min) * ToUniform(bits[idx]);
+    };
+    FillRandom(data, transform, shape, paddedCols, batchSize, seed, offset);
 }
 
 void Scalar(float* data, float value, const Shape& shape, size_t paddedCols,
@@ -47,10 +95,12 @@ void Scalar(float* data, float value, const Shape& shape, size_t paddedCols,
     const auto totalSize = shape.Size() * batchSize;
     const auto cols = shape.At(shape.Dim() - 1);
 
-#pragma omp parallel for default(none) shared( \
-    totalSize, cols, paddedCols, data, value) schedule(static)
-    for (long i = 0; i < static_cast<long>(totalSize / cols); ++i)
-        for (size_t j = 0; j < cols; ++j)
-            data[paddedCols * i + j] = value;
+    Util::ParallelFor(
+        0, totalSize / cols, Util::GrainSize(cols),
+        [&](size_t rowBegin, size_t rowEnd) {
+            for (auto i = rowBegin; i < rowEnd; ++i)
+                for (size_t j = 0; j < cols; ++j)
+                    data[paddedCols * i + j] = value;
+        });
 }
 } // namespace Sapphire::Compute::Dense::Naive
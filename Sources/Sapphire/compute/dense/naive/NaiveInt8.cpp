@@ -0,0 +1,149 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaiveInt8.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <algorithm>
+#include <cmath>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace Sapphire::Compute::Dense::Naive
+{
+#ifdef __AVX2__
+static std::int32_t HorizontalSum(__m256i value)
+{
+    __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(value),
+                                _mm256_extracti128_si256(value, 1));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(sum);
+}
+#endif
+
+//! Inner product of two int8 vectors accumulated in int32
+//! Unsigned by signed multiplication of vpdpbusd and vpmaddubsw is used by
+//! moving the sign of a into b, which is exact since values are in
+//! [-127, 127]
+static std::int32_t DotInt8(const std::int8_t* a, const std::int8_t* b,
+                            unsigned int size)
+{
+    unsigned int idx = 0;
+    std::int32_t sum = 0;
+
+#if defined(__AVX512VNNI__) && defined(__AVX512VL__)
+    __m256i acc = _mm256_setzero_si256();
+    for (; idx + 32 <= size; idx += 32)
+    {
+        const __m256i va =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + idx));
+        const __m256i vb =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + idx));
+        acc = _mm256_dpbusd_epi32(acc, _mm256_sign_epi8(va, va),
+                                  _mm256_sign_epi8(vb, va));
+    }
+    sum = HorizontalSum(acc);
+#elif defined(__AVX2__)
+    const __m256i ones = _mm256_set1_epi16(1);
+    __m256i acc = _mm256_setzero_si256();
+    for (; idx + 32 <= size; idx += 32)
+    {
+        const __m256i va =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + idx));
+        const __m256i vb =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + idx));
+        //! Sum of two products is at most 2 * 127 * 127, which fits in 16 bits
+        const __m256i products = _mm256_maddubs_epi16(
+            _mm256_sign_epi8(va, va), _mm256_sign_epi8(vb, va));
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(products, ones));
+    }
+    sum = HorizontalSum(acc);
+#endif
+
+    for (; idx < size; ++idx)
+        sum += static_cast<std::int32_t>(a[idx]) * b[idx];
+    return sum;
+}
+
+void QuantizeRows(std::int8_t* output, float* scales, const float* input,
+                  unsigned int rows, unsigned int cols,
+                  unsigned int paddedCols)
+{
+    const auto quantizeRows = [&](std::size_t rowBegin, std::size_t rowEnd) {
+        for (auto rowIdx = rowBegin; rowIdx < rowEnd; ++rowIdx)
+        {
+            const float* inputRow = input + rowIdx * paddedCols;
+            std::int8_t* outputRow = output + rowIdx * paddedCols;
+
+            float maxAbs = 0.0f;
+            for (unsigned int colIdx = 0; colIdx < cols; ++colIdx)
+                maxAbs = std::max(maxAbs, std::abs(inputRow[colIdx]));
+
+            const float scale = maxAbs / 127.0f;
+            const float inverseScale =
+                maxAbs > 0.0f ? 127.0f / maxAbs : 0.0f;
+            scales[rowIdx] = scale;
+
+            for (unsigned int colIdx = 0; colIdx < cols; ++colIdx)
+            {
+                const float value =
+                    std::nearbyint(inputRow[colIdx] * inverseScale);
+                outputRow[colIdx] = static_cast<std::int8_t>(
+                    std::min(127.0f, std::max(-127.0f, value)));
+            }
+            for (unsigned int colIdx = cols; colIdx < paddedCols; ++colIdx)
+                outputRow[colIdx] = 0;
+        }
+    };
+
+    Util::ParallelFor(0, rows, Util::GrainSize(paddedCols), quantizeRows);
+}
+
+void DequantizeRows(float* output, const std::int8_t* input,
+                    const float* scales, unsigned int rows, unsigned int cols,
+                    unsigned int paddedCols)
+{
+    for (unsigned long rowIdx = 0; rowIdx < rows; ++rowIdx)
+        for (unsigned int colIdx = 0; colIdx < cols; ++colIdx)
+            output[rowIdx * paddedCols + colIdx] =
+                static_cast<float>(input[rowIdx * paddedCols + colIdx]) *
+                scales[rowIdx];
+}
+
+void Int8Gemm(unsigned int rows, float* out, const std::int8_t* A,
+              const float* scaleA, const std::int8_t* transposedB,
+              const float* scaleB, const float* C, unsigned long strideC,
+              unsigned int N, unsigned int paddedN, unsigned int K,
+              unsigned int paddedK)
+{
+    const auto computeRows = [&](std::size_t rowBegin, std::size_t rowEnd) {
+        for (auto rowIdx = rowBegin; rowIdx < rowEnd; ++rowIdx)
+        {
+            const std::int8_t* rowA = A + rowIdx * paddedK;
+            const float* rowC = C + rowIdx * strideC;
+            float* rowOut = out + rowIdx * paddedN;
+
+            //! Dequantization and addition of C are fused to the accumulation
+            for (unsigned int nIdx = 0; nIdx < N; ++nIdx)
+            {
+                const std::int32_t sum = DotInt8(
+                    rowA,
+                    transposedB + static_cast<unsigned long>(nIdx) * paddedK,
+                    K);
+                rowOut[nIdx] = static_cast<float>(sum) * scaleA[rowIdx] *
+                                   scaleB[nIdx] +
+                               rowC[nIdx];
+            }
+        }
+    };
+
+    Util::ParallelFor(0, rows,
+                      Util::GrainSize(static_cast<std::size_t>(N) * K),
+                      computeRows);
+}
+}  // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,94 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaiveLoss.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Number of running maximums and sums kept for each row
+constexpr unsigned int LogSumExpLanes = 8;
+
+//! Adds value to the running sum of exp(x - max)
+static void OnlineUpdate(float& max, float& sum, float value)
+{
+    if (value > max)
+    {
+        sum = sum * std::exp(max - value) + 1.0f;
+        max = value;
+    }
+    else
+        sum += std::exp(value - max);
+}
+
+//! Returns log(sum(exp(x))) of contiguous values in a single pass
+//! Each lane keeps the running maximum and sum of every LogSumExpLanes-th
+//! value, and lanes are merged after the row has been read
+static float LogSumExp(const float* x, unsigned int size)
+{
+    float max[LogSumExpLanes];
+    float sum[LogSumExpLanes] = {};
+    std::fill(max, max + LogSumExpLanes, std::numeric_limits<float>::lowest());
+
+    unsigned int idx = 0;
+    for (; idx + LogSumExpLanes <= size; idx += LogSumExpLanes)
+        for (unsigned int lane = 0; lane < LogSumExpLanes; ++lane)
+            OnlineUpdate(max[lane], sum[lane], x[idx + lane]);
+
+    float rowMax = *std::max_element(max, max + LogSumExpLanes);
+    for (; idx < size; ++idx)
+        rowMax = std::max(rowMax, x[idx]);
+
+    float rowSum = 0.0f;
+    for (unsigned int lane = 0; lane < LogSumExpLanes; ++lane)
+        rowSum += sum[lane] * std::exp(max[lane] - rowMax);
+    for (idx = size - size % LogSumExpLanes; idx < size; ++idx)
+        rowSum += std::exp(x[idx] - rowMax);
+    return rowMax + std::log(rowSum);
+}
+
+void CrossEntropyForward(float* loss, float* logSumExp, const float* x,
+                         const std::size_t* labels, std::size_t rows,
+                         unsigned int cols, std::size_t paddedCols)
+{
+    Util::ParallelFor(0, rows, Util::GrainSize(cols * 16),
+                      [&](std::size_t begin, std::size_t end) {
+                          for (auto row = begin; row < end; ++row)
+                          {
+                              const float* input = x + row * paddedCols;
+                              const float rowLogSumExp =
+                                  LogSumExp(input, cols);
+                              loss[row] = rowLogSumExp - input[labels[row]];
+                              if (logSumExp)
+                                  logSumExp[row] = rowLogSumExp;
+                          }
+                      });
+}
+
+void CrossEntropyBackward(float* dx, const float* x, const float* logSumExp,
+                          const std::size_t* labels, float scale,
+                          std::size_t rows, unsigned int cols,
+                          std::size_t paddedCols)
+{
+    Util::ParallelFor(0, rows, Util::GrainSize(cols * 16),
+                      [&](std::size_t begin, std::size_t end) {
+                          for (auto row = begin; row < end; ++row)
+                          {
+                              const float* input = x + row * paddedCols;
+                              float* output = dx + row * paddedCols;
+                              const float rowLogSumExp = logSumExp[row];
+                              for (unsigned int col = 0; col < cols; ++col)
+                                  output[col] +=
+                                      scale *
+                                      std::exp(input[col] - rowLogSumExp);
+                              output[labels[row]] -= scale;
+                          }
+                      });
+}
+}  // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,280 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaiveNormalization.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Number of running statistics kept for each contiguous row
+constexpr unsigned int WelfordLanes = 8;
+//! Number of rows of layer normalization whose gradients of gamma and beta
+//! are accumulated together
+constexpr std::size_t LayerNormRowBlock = 32;
+
+//! Count, mean and sum of squared deviations of a set of values
+struct WelfordState
+{
+    double Count = 0.0;
+    double Mean = 0.0;
+    double M2 = 0.0;
+};
+
+//! Returns statistics of the union of two disjoint sets (Chan et al.)
+static WelfordState Merge(const WelfordState& a, const WelfordState& b)
+{
+    const double count = a.Count + b.Count;
+    if (count == 0.0)
+        return a;
+    const double delta = b.Mean - a.Mean;
+    return { count, a.Mean + delta * b.Count / count,
+             a.M2 + b.M2 + delta * delta * a.Count * b.Count / count };
+}
+
+//! Computes statistics of contiguous values by the Welford update
+//! Each lane keeps the statistics of every WelfordLanes-th value, so lanes
+//! share the count and are updated together by vector instructions
+static WelfordState WelfordRow(const float* data, std::size_t size)
+{
+    float mean[WelfordLanes] = {};
+    float m2[WelfordLanes] = {};
+    float count = 0.0f;
+    std::size_t idx = 0;
+    for (; idx + WelfordLanes <= size; idx += WelfordLanes)
+    {
+        count += 1.0f;
+        const float inverse = 1.0f / count;
+        for (unsigned int lane = 0; lane < WelfordLanes; ++lane)
+        {
+            const float delta = data[idx + lane] - mean[lane];
+            mean[lane] += delta * inverse;
+            m2[lane] += delta * (data[idx + lane] - mean[lane]);
+        }
+    }
+
+    WelfordState state;
+    if (count > 0.0f)
+        for (unsigned int lane = 0; lane < WelfordLanes; ++lane)
+            state = Merge(state, { count, mean[lane], m2[lane] });
+    for (; idx < size; ++idx)
+        state = Merge(state, { 1.0, data[idx], 0.0 });
+    return state;
+}
+
+void LayerNormForward(float* y, float* mean, float* rstd, const float* x,
+                      const float* gamma, const float* beta,
+                      const LayerNormShape& shape, float epsilon)
+{
+    Util::ParallelFor(
+        0, shape.Rows, Util::GrainSize(shape.Cols * 8),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto row = begin; row < end; ++row)
+            {
+                const float* input = x + row * shape.PaddedCols;
+                float* output = y + row * shape.PaddedCols;
+                const auto state = WelfordRow(input, shape.Cols);
+                const auto rowMean = static_cast<float>(state.Mean);
+                const float rowRstd =
+                    1.0f / std::sqrt(static_cast<float>(state.M2 /
+                                                        shape.Cols) +
+                                     epsilon);
+
+                for (unsigned int col = 0; col < shape.Cols; ++col)
+                    output[col] = (input[col] - rowMean) * rowRstd *
+                                      gamma[col] +
+                                  beta[col];
+                if (mean)
+                    mean[row] = rowMean;
+                if (rstd)
+                    rstd[row] = rowRstd;
+            }
+        });
+}
+
+void LayerNormBackward(float* dx, float* dGamma, float* dBeta, const float* dy,
+                       const float* x, const float* gamma, const float* mean,
+                       const float* rstd, const LayerNormShape& shape)
+{
+    //! Each block of rows accumulates its own gradients of gamma and beta,
+    //! which are added in the order of the blocks so the result does not
+    //! depend on the scheduling
+    const auto blocks = (shape.Rows + LayerNormRowBlock - 1) /
+                        LayerNormRowBlock;
+    std::vector<float> partialGamma(blocks * shape.Cols, 0.0f);
+    std::vector<float> partialBeta(blocks * shape.Cols, 0.0f);
+
+    Util::ParallelFor(
+        0, blocks, Util::GrainSize(LayerNormRowBlock * shape.Cols * 16),
+        [&](std::size_t blockBegin, std::size_t blockEnd) {
+            for (auto block = blockBegin; block < blockEnd; ++block)
+            {
+                float* blockGamma = partialGamma.data() + block * shape.Cols;
+                float* blockBeta = partialBeta.data() + block * shape.Cols;
+                const auto rowEnd = std::min(shape.Rows,
+                                             (block + 1) * LayerNormRowBlock);
+                for (auto row = block * LayerNormRowBlock; row < rowEnd; ++row)
+                {
+                    const float* input = x + row * shape.PaddedCols;
+                    const float* gradient = dy + row * shape.PaddedCols;
+                    float* output = dx + row * shape.PaddedCols;
+                    const float rowMean = mean[row];
+                    const float rowRstd = rstd[row];
+
+                    float sum = 0.0f;
+                    float sumNormalized = 0.0f;
+                    for (unsigned int col = 0; col < shape.Cols; ++col)
+                    {
+                        const float normalized =
+                            (input[col] - rowMean) * rowRstd;
+                        const float scaled = gradient[col] * gamma[col];
+                        sum += scaled;
+                        sumNormalized += scaled * normalized;
+                        blockGamma[col] += gradient[col] * normalized;
+                        blockBeta[col] += gradient[col];
+                    }
+
+                    const float meanScaled = sum / shape.Cols;
+                    const float meanNormalized = sumNormalized / shape.Cols;
+                    for (unsigned int col = 0; col < shape.Cols; ++col)
+                    {
+                        const float normalized =
+                            (input[col] - rowMean) * rowRstd;
+                        output[col] +=
+                            rowRstd * (gradient[col] * gamma[col] -
+                                       meanScaled -
+                                       normalized * meanNormalized);
+                    }
+                }
+            }
+        });
+
+    for (std::size_t block = 0; block < blocks; ++block)
+        for (unsigned int col = 0; col < shape.Cols; ++col)
+        {
+            dGamma[col] += partialGamma[block * shape.Cols + col];
+            dBeta[col] += partialBeta[block * shape.Cols + col];
+        }
+}
+
+//! Returns pointer to row r of channel c in sample n
+template <typename T>
+static T* ChannelRow(T* data, const BatchNormShape& shape, std::size_t n,
+                     std::size_t c, std::size_t r)
+{
+    return data + n * shape.BatchStride + c * shape.ChannelStride +
+           r * shape.PaddedCols;
+}
+
+void BatchNormStatistics(float* mean, float* variance, const float* x,
+                         const BatchNormShape& shape)
+{
+    Util::ParallelFor(
+        0, shape.C,
+        Util::GrainSize(static_cast<std::size_t>(shape.N) * shape.Rows *
+                        shape.Cols * 8),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto c = begin; c < end; ++c)
+            {
+                WelfordState state;
+                for (unsigned int n = 0; n < shape.N; ++n)
+                    for (unsigned int r = 0; r < shape.Rows; ++r)
+                        state = Merge(state,
+                                      WelfordRow(ChannelRow(x, shape, n, c, r),
+                                                 shape.Cols));
+                mean[c] = static_cast<float>(state.Mean);
+                variance[c] = static_cast<float>(state.M2 / state.Count);
+            }
+        });
+}
+
+void BatchNormNormalize(float* y, const float* x, const float* mean,
+                        const float* rstd, const float* gamma,
+                        const float* beta, const BatchNormShape& shape)
+{
+    //! Consecutive items are the channels of the same sample, which are
+    //! adjacent if the channels are the columns
+    Util::ParallelFor(
+        0, static_cast<std::size_t>(shape.N) * shape.C,
+        Util::GrainSize(shape.Rows * shape.Cols),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto idx = begin; idx < end; ++idx)
+            {
+                const auto n = idx / shape.C;
+                const auto c = idx % shape.C;
+                const float scale = rstd[c] * gamma[c];
+                const float shift = beta[c] - mean[c] * scale;
+                for (unsigned int r = 0; r < shape.Rows; ++r)
+                {
+                    const float* input = ChannelRow(x, shape, n, c, r);
+                    float* output = ChannelRow(y, shape, n, c, r);
+                    for (unsigned int col = 0; col < shape.Cols; ++col)
+                        output[col] = input[col] * scale + shift;
+                }
+            }
+        });
+}
+
+void BatchNormBackward(float* dx, float* dGamma, float* dBeta, const float* dy,
+                       const float* x, const float* gamma, const float* mean,
+                       const float* rstd, const BatchNormShape& shape)
+{
+    const double count =
+        static_cast<double>(shape.N) * shape.Rows * shape.Cols;
+    Util::ParallelFor(
+        0, shape.C,
+        Util::GrainSize(static_cast<std::size_t>(shape.N) * shape.Rows *
+                        shape.Cols * 8),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto c = begin; c < end; ++c)
+            {
+                //! Rows are summed in float and accumulated in double
+                double sum = 0.0;
+                double sumNormalized = 0.0;
+                for (unsigned int n = 0; n < shape.N; ++n)
+                    for (unsigned int r = 0; r < shape.Rows; ++r)
+                    {
+                        const float* input = ChannelRow(x, shape, n, c, r);
+                        const float* gradient = ChannelRow(dy, shape, n, c, r);
+                        float rowSum = 0.0f;
+                        float rowSumNormalized = 0.0f;
+                        for (unsigned int col = 0; col < shape.Cols; ++col)
+                        {
+                            rowSum += gradient[col];
+                            rowSumNormalized +=
+                                gradient[col] * (input[col] - mean[c]);
+                        }
+                        sum += rowSum;
+                        sumNormalized += rowSumNormalized * rstd[c];
+                    }
+                dGamma[c] += static_cast<float>(sumNormalized);
+                dBeta[c] += static_cast<float>(sum);
+
+                const float scale = gamma[c] * rstd[c];
+                const auto meanGradient = static_cast<float>(sum / count);
+                const auto meanNormalized =
+                    static_cast<float>(sumNormalized / count);
+                for (unsigned int n = 0; n < shape.N; ++n)
+                    for (unsigned int r = 0; r < shape.Rows; ++r)
+                    {
+                        const float* input = ChannelRow(x, shape, n, c, r);
+                        const float* gradient = ChannelRow(dy, shape, n, c, r);
+                        float* output = ChannelRow(dx, shape, n, c, r);
+                        for (unsigned int col = 0; col < shape.Cols; ++col)
+                        {
+                            const float normalized =
+                                (input[col] - mean[c]) * rstd[c];
+                            output[col] +=
+                                scale * (gradient[col] - meanGradient -
+                                         normalized * meanNormalized);
+                        }
+                    }
+            }
+        });
+}
+}  // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,253 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaiveOptimizer.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+//! Kernels use fused multiply-add, which gcc and clang enable with -mfma
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#define SAPPHIRE_OPTIMIZER_AVX2
+#endif
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Number of elements in each block distributed to the threads
+constexpr std::size_t BlockSize = 1024;
+
+//! Returns index of the first block of each parameter followed by total
+//! number of blocks
+static std::vector<std::size_t> GetBlockOffsets(
+    const OptimizerParameter* parameters, std::size_t count)
+{
+    std::vector<std::size_t> blockOffsets(count + 1, 0);
+    for (std::size_t idx = 0; idx < count; ++idx)
+        blockOffsets[idx + 1] =
+            blockOffsets[idx] +
+            (parameters[idx].Size + BlockSize - 1) / BlockSize;
+    return blockOffsets;
+}
+
+//! Invokes func(parameter, begin, end, blockIdx) on every block of every
+//! parameter
+//! Blocks of all parameters are distributed in one parallel loop, so small
+//! parameters don't need their own loop
+template <typename Func>
+static void ForEachBlock(const OptimizerParameter* parameters,
+                         std::size_t count, std::size_t costPerElement,
+                         Func func)
+{
+    const auto blockOffsets = GetBlockOffsets(parameters, count);
+
+    Util::ParallelFor(
+        0, blockOffsets.back(), Util::GrainSize(BlockSize * costPerElement),
+        [&](std::size_t begin, std::size_t end) {
+            auto paramIdx = static_cast<std::size_t>(
+                std::upper_bound(blockOffsets.begin(), blockOffsets.end(),
+                                 begin) -
+                blockOffsets.begin() - 1);
+            for (auto blockIdx = begin; blockIdx < end; ++blockIdx)
+            {
+                while (blockOffsets[paramIdx + 1] <= blockIdx)
+                    ++paramIdx;
+                const auto& parameter = parameters[paramIdx];
+                const auto elementBegin =
+                    (blockIdx - blockOffsets[paramIdx]) * BlockSize;
+                const auto elementEnd =
+                    std::min(elementBegin + BlockSize, parameter.Size);
+                func(parameter, elementBegin, elementEnd, blockIdx);
+            }
+        });
+}
+
+void SgdUpdate(const OptimizerParameter* parameters, std::size_t count,
+               float learningRate, float weightDecay, bool zeroGradient)
+{
+    ForEachBlock(
+        parameters, count, 3,
+        [=](const OptimizerParameter& parameter, std::size_t begin,
+            std::size_t end, std::size_t) {
+            float* data = parameter.Data;
+            float* gradient = parameter.Gradient;
+            auto idx = begin;
+#ifdef SAPPHIRE_OPTIMIZER_AVX2
+            const auto lr = _mm256_set1_ps(learningRate);
+            const auto decay = _mm256_set1_ps(weightDecay);
+            for (; idx + 8 <= end; idx += 8)
+            {
+                const auto p = _mm256_loadu_ps(data + idx);
+                const auto g =
+                    _mm256_fmadd_ps(decay, p, _mm256_loadu_ps(gradient + idx));
+                _mm256_storeu_ps(data + idx, _mm256_fnmadd_ps(lr, g, p));
+                if (zeroGradient)
+                    _mm256_storeu_ps(gradient + idx, _mm256_setzero_ps());
+            }
+#endif
+            for (; idx < end; ++idx)
+            {
+                data[idx] -=
+                    learningRate * (gradient[idx] + weightDecay * data[idx]);
+                if (zeroGradient)
+                    gradient[idx] = 0.0f;
+            }
+        });
+}
+
+void MomentumUpdate(const OptimizerParameter* parameters, std::size_t count,
+                    float learningRate, float momentum, float weightDecay,
+                    bool zeroGradient)
+{
+    ForEachBlock(
+        parameters, count, 4,
+        [=](const OptimizerParameter& parameter, std::size_t begin,
+            std::size_t end, std::size_t) {
+            float* data = parameter.Data;
+            float* gradient = parameter.Gradient;
+            float* velocity = parameter.FirstState;
+            auto idx = begin;
+#ifdef SAPPHIRE_OPTIMIZER_AVX2
+            const auto lr = _mm256_set1_ps(learningRate);
+            const auto mu = _mm256_set1_ps(momentum);
+            const auto decay = _mm256_set1_ps(weightDecay);
+            for (; idx + 8 <= end; idx += 8)
+            {
+                const auto p = _mm256_loadu_ps(data + idx);
+                const auto g =
+                    _mm256_fmadd_ps(decay, p, _mm256_loadu_ps(gradient + idx));
+                const auto v =
+                    _mm256_fmadd_ps(mu, _mm256_loadu_ps(velocity + idx), g);
+                _mm256_storeu_ps(velocity + idx, v);
+                _mm256_storeu_ps(data + idx, _mm256_fnmadd_ps(lr, v, p));
+                if (zeroGradient)
+                    _mm256_storeu_ps(gradient + idx, _mm256_setzero_ps());
+            }
+#endif
+            for (; idx < end; ++idx)
+            {
+                velocity[idx] = momentum * velocity[idx] + gradient[idx] +
+                                weightDecay * data[idx];
+                data[idx] -= learningRate * velocity[idx];
+                if (zeroGradient)
+                    gradient[idx] = 0.0f;
+            }
+        });
+}
+
+void AdamUpdate(const OptimizerParameter* parameters, std::size_t count,
+                float learningRate, float beta1, float beta2, float epsilon,
+                float weightDecay, bool decoupled, unsigned long step,
+                bool zeroGradient)
+{
+    const auto exponent = static_cast<float>(step);
+    const float stepSize = learningRate / (1.0f - std::pow(beta1, exponent));
+    const float secondCorrection =
+        1.0f / std::sqrt(1.0f - std::pow(beta2, exponent));
+    //! Decoupled weight decay is applied to the data before the update
+    const float dataScale =
+        decoupled ? 1.0f - learningRate * weightDecay : 1.0f;
+    const float gradientDecay = decoupled ? 0.0f : weightDecay;
+
+    ForEachBlock(
+        parameters, count, 12,
+        [=](const OptimizerParameter& parameter, std::size_t begin,
+            std::size_t end, std::size_t) {
+            float* data = parameter.Data;
+            float* gradient = parameter.Gradient;
+            float* firstMoment = parameter.FirstState;
+            float* secondMoment = parameter.SecondState;
+            auto idx = begin;
+#ifdef SAPPHIRE_OPTIMIZER_AVX2
+            const auto b1 = _mm256_set1_ps(beta1);
+            const auto b2 = _mm256_set1_ps(beta2);
+            const auto oneMinusB1 = _mm256_set1_ps(1.0f - beta1);
+            const auto oneMinusB2 = _mm256_set1_ps(1.0f - beta2);
+            const auto eps = _mm256_set1_ps(epsilon);
+            const auto size = _mm256_set1_ps(stepSize);
+            const auto correction = _mm256_set1_ps(secondCorrection);
+            const auto scale = _mm256_set1_ps(dataScale);
+            const auto decay = _mm256_set1_ps(gradientDecay);
+            for (; idx + 8 <= end; idx += 8)
+            {
+                const auto p = _mm256_loadu_ps(data + idx);
+                const auto g =
+                    _mm256_fmadd_ps(decay, p, _mm256_loadu_ps(gradient + idx));
+                const auto m =
+                    _mm256_fmadd_ps(b1, _mm256_loadu_ps(firstMoment + idx),
+                                    _mm256_mul_ps(oneMinusB1, g));
+                const auto v = _mm256_fmadd_ps(
+                    b2, _mm256_loadu_ps(secondMoment + idx),
+                    _mm256_mul_ps(oneMinusB2, _mm256_mul_ps(g, g)));
+                const auto denominator = _mm256_fmadd_ps(
+                    _mm256_sqrt_ps(v), correction, eps);
+                const auto update =
+                    _mm256_mul_ps(size, _mm256_div_ps(m, denominator));
+                _mm256_storeu_ps(firstMoment + idx, m);
+                _mm256_storeu_ps(secondMoment + idx, v);
+                _mm256_storeu_ps(data + idx,
+                                 _mm256_fmsub_ps(scale, p, update));
+                if (zeroGradient)
+                    _mm256_storeu_ps(gradient + idx, _mm256_setzero_ps());
+            }
+#endif
+            for (; idx < end; ++idx)
+            {
+                const float g = gradient[idx] + gradientDecay * data[idx];
+                const float m =
+                    beta1 * firstMoment[idx] + (1.0f - beta1) * g;
+                const float v =
+                    beta2 * secondMoment[idx] + (1.0f - beta2) * g * g;
+                firstMoment[idx] = m;
+                secondMoment[idx] = v;
+                data[idx] = dataScale * data[idx] -
+                            stepSize * m /
+                                (std::sqrt(v) * secondCorrection + epsilon);
+                if (zeroGradient)
+                    gradient[idx] = 0.0f;
+            }
+        });
+}
+
+float GradientSquaredSum(const OptimizerParameter* parameters,
+                         std::size_t count)
+{
+    //! Partial sums are added in the order of the blocks, so the result does
+    //! not depend on the scheduling
+    std::vector<double> partialSums(GetBlockOffsets(parameters, count).back(),
+                                    0.0);
+    ForEachBlock(parameters, count, 2,
+                 [&](const OptimizerParameter& parameter, std::size_t begin,
+                     std::size_t end, std::size_t blockIdx) {
+                     const float* gradient = parameter.Gradient;
+                     float sum = 0.0f;
+                     for (auto idx = begin; idx < end; ++idx)
+                         sum += gradient[idx] * gradient[idx];
+                     partialSums[blockIdx] = sum;
+                 });
+
+    double sum = 0.0;
+    for (const auto partialSum : partialSums)
+        sum += partialSum;
+    return static_cast<float>(sum);
+}
+
+void ScaleGradient(const OptimizerParameter* parameters, std::size_t count,
+                   float factor)
+{
+    ForEachBlock(parameters, count, 1,
+                 [=](const OptimizerParameter& parameter, std::size_t begin,
+                     std::size_t end, std::size_t) {
+                     float* gradient = parameter.Gradient;
+                     for (auto idx = begin; idx < end; ++idx)
+                         gradient[idx] *= factor;
+                 });
+}
+}  // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,286 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaivePooling.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Number of channels pooled together
+//! Input is reordered into (H, W, 8c) blocks, so each element of the window
+//! is a contiguous vector of 8 channels
+constexpr unsigned int PoolChannelBlock = 8;
+
+//! Range of the window at (p, q) clipped to the input
+struct WindowRange
+{
+    int RowBegin, RowEnd, ColBegin, ColEnd;
+
+    [[nodiscard]] unsigned int Size() const
+    {
+        return RowEnd > RowBegin && ColEnd > ColBegin
+                   ? static_cast<unsigned int>((RowEnd - RowBegin) *
+                                               (ColEnd - ColBegin))
+                   : 0;
+    }
+};
+
+static WindowRange GetWindowRange(const PoolShape& shape, unsigned int p,
+                                  unsigned int q)
+{
+    const auto rowBegin = static_cast<int>(p * shape.StrideRow) -
+                          static_cast<int>(shape.PaddingRow);
+    const auto colBegin = static_cast<int>(q * shape.StrideCol) -
+                          static_cast<int>(shape.PaddingCol);
+    return { std::max(rowBegin, 0),
+             std::min(rowBegin + static_cast<int>(shape.WindowRow),
+                      static_cast<int>(shape.H)),
+             std::max(colBegin, 0),
+             std::min(colBegin + static_cast<int>(shape.WindowCol),
+                      static_cast<int>(shape.W)) };
+}
+
+//! Pools each block of 8 channels reordered into (H, W, 8c) with the padding
+//! filled, so the window is read without checking the borders
+template <bool IsMax>
+static void PoolForward(float* y, std::uint8_t* indices, const float* x,
+                        const PoolShape& shape)
+{
+    const auto cBlocks = (shape.C + PoolChannelBlock - 1) / PoolChannelBlock;
+    const std::size_t inputHeight = shape.H + 2 * shape.PaddingRow;
+    const std::size_t inputWidth = shape.W + 2 * shape.PaddingCol;
+    const float fill = IsMax ? -std::numeric_limits<float>::infinity() : 0.0f;
+    const std::size_t windowCost = static_cast<std::size_t>(shape.WindowRow) *
+                                   shape.WindowCol * PoolChannelBlock;
+
+    Util::ParallelFor(
+        0, static_cast<std::size_t>(shape.N) * cBlocks,
+        Util::GrainSize(windowCost * shape.P * shape.Q),
+        [&](std::size_t begin, std::size_t end) {
+            std::vector<float> packed(inputHeight * inputWidth *
+                                      PoolChannelBlock);
+            for (auto idx = begin; idx < end; ++idx)
+            {
+                const auto n = idx / cBlocks;
+                const auto channelBegin = (idx % cBlocks) * PoolChannelBlock;
+                const auto count = std::min<std::size_t>(
+                    PoolChannelBlock, shape.C - channelBegin);
+
+                std::fill(packed.begin(), packed.end(), fill);
+                for (std::size_t lane = 0; lane < count; ++lane)
+                {
+                    const float* plane =
+                        x + (n * shape.C + channelBegin + lane) * shape.H *
+                                shape.PaddedW;
+                    for (unsigned int h = 0; h < shape.H; ++h)
+                    {
+                        const float* inputRow = plane + h * shape.PaddedW;
+                        float* packedRow =
+                            packed.data() +
+                            ((h + shape.PaddingRow) * inputWidth +
+                             shape.PaddingCol) *
+                                PoolChannelBlock +
+                            lane;
+                        for (unsigned int w = 0; w < shape.W; ++w)
+                            packedRow[w * PoolChannelBlock] = inputRow[w];
+                    }
+                }
+
+                for (unsigned int p = 0; p < shape.P; ++p)
+                    for (unsigned int q = 0; q < shape.Q; ++q)
+                    {
+                        const float* window =
+                            packed.data() +
+                            (p * shape.StrideRow * inputWidth +
+                             q * shape.StrideCol) *
+                                PoolChannelBlock;
+                        float result[PoolChannelBlock];
+                        std::uint8_t position[PoolChannelBlock] = {};
+                        std::fill(result, result + PoolChannelBlock, fill);
+
+                        for (unsigned int r = 0; r < shape.WindowRow; ++r)
+                            for (unsigned int s = 0; s < shape.WindowCol; ++s)
+                            {
+                                const float* element =
+                                    window +
+                                    (r * inputWidth + s) * PoolChannelBlock;
+                                const auto code = static_cast<std::uint8_t>(
+                                    r * shape.WindowCol + s);
+                                for (unsigned int lane = 0;
+                                     lane < PoolChannelBlock; ++lane)
+                                {
+                                    if constexpr (IsMax)
+                                    {
+                                        const bool isGreater =
+                                            element[lane] > result[lane];
+                                        result[lane] = isGreater
+                                                           ? element[lane]
+                                                           : result[lane];
+                                        position[lane] = isGreater
+                                                             ? code
+                                                             : position[lane];
+                                    }
+                                    else
+                                        result[lane] += element[lane];
+                                }
+                            }
+
+                        if constexpr (!IsMax)
+                        {
+                            const float scale =
+                                1.0f / static_cast<float>(
+                                           GetWindowRange(shape, p, q).Size());
+                            for (unsigned int lane = 0;
+                                 lane < PoolChannelBlock; ++lane)
+                                result[lane] *= scale;
+                        }
+
+                        for (std::size_t lane = 0; lane < count; ++lane)
+                        {
+                            const auto plane = n * shape.C + channelBegin +
+                                               lane;
+                            y[(plane * shape.P + p) * shape.PaddedQ + q] =
+                                result[lane];
+                            if (indices)
+                                indices[(plane * shape.P + p) * shape.Q + q] =
+                                    position[lane];
+                        }
+                    }
+            }
+        });
+}
+
+void MaxPool2DForward(float* y, std::uint8_t* indices, const float* x,
+                      const PoolShape& shape)
+{
+    PoolForward<true>(y, indices, x, shape);
+}
+
+void MaxPool2DBackward(float* dx, const float* dy, const std::uint8_t* indices,
+                       const PoolShape& shape)
+{
+    //! Each plane is written by a single task, so overlapping windows do not
+    //! race
+    Util::ParallelFor(
+        0, static_cast<std::size_t>(shape.N) * shape.C,
+        Util::GrainSize(shape.P * shape.Q),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto plane = begin; plane < end; ++plane)
+            {
+                float* dxPlane = dx + plane * shape.H * shape.PaddedW;
+                for (unsigned int p = 0; p < shape.P; ++p)
+                    for (unsigned int q = 0; q < shape.Q; ++q)
+                    {
+                        const auto position =
+                            indices[(plane * shape.P + p) * shape.Q + q];
+                        const auto h =
+                            static_cast<int>(p * shape.StrideRow +
+                                             position / shape.WindowCol) -
+                            static_cast<int>(shape.PaddingRow);
+                        const auto w =
+                            static_cast<int>(q * shape.StrideCol +
+                                             position % shape.WindowCol) -
+                            static_cast<int>(shape.PaddingCol);
+                        if (h < 0 || h >= static_cast<int>(shape.H) || w < 0 ||
+                            w >= static_cast<int>(shape.W))
+                            continue;
+                        dxPlane[h * shape.PaddedW + w] +=
+                            dy[(plane * shape.P + p) * shape.PaddedQ + q];
+                    }
+            }
+        });
+}
+
+void AvgPool2DForward(float* y, const float* x, const PoolShape& shape)
+{
+    PoolForward<false>(y, nullptr, x, shape);
+}
+
+void AvgPool2DBackward(float* dx, const float* dy, const PoolShape& shape)
+{
+    Util::ParallelFor(
+        0, static_cast<std::size_t>(shape.N) * shape.C,
+        Util::GrainSize(static_cast<std::size_t>(shape.P) * shape.Q *
+                        shape.WindowRow * shape.WindowCol),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto plane = begin; plane < end; ++plane)
+            {
+                float* dxPlane = dx + plane * shape.H * shape.PaddedW;
+                for (unsigned int p = 0; p < shape.P; ++p)
+                    for (unsigned int q = 0; q < shape.Q; ++q)
+                    {
+                        const auto range = GetWindowRange(shape, p, q);
+                        if (range.Size() == 0)
+                            continue;
+                        const float gradient =
+                            dy[(plane * shape.P + p) * shape.PaddedQ + q] /
+                            static_cast<float>(range.Size());
+                        for (auto h = range.RowBegin; h < range.RowEnd; ++h)
+                            for (auto w = range.ColBegin; w < range.ColEnd;
+                                 ++w)
+                                dxPlane[h * shape.PaddedW + w] += gradient;
+                    }
+            }
+        });
+}
+
+void GlobalAvgPoolForward(float* y, std::size_t paddedC, const float* x,
+                          const PoolShape& shape)
+{
+    const float scale = 1.0f / static_cast<float>(shape.H * shape.W);
+    Util::ParallelFor(
+        0, static_cast<std::size_t>(shape.N) * shape.C,
+        Util::GrainSize(shape.H * shape.W),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto plane = begin; plane < end; ++plane)
+            {
+                //! Partial sums over the lanes keep the loop vectorized
+                float partialSum[PoolChannelBlock] = {};
+                const float* inputPlane = x + plane * shape.H * shape.PaddedW;
+                for (unsigned int h = 0; h < shape.H; ++h)
+                {
+                    const float* row = inputPlane + h * shape.PaddedW;
+                    unsigned int w = 0;
+                    for (; w + PoolChannelBlock <= shape.W;
+                         w += PoolChannelBlock)
+                        for (unsigned int lane = 0; lane < PoolChannelBlock;
+                             ++lane)
+                            partialSum[lane] += row[w + lane];
+                    for (; w < shape.W; ++w)
+                        partialSum[w % PoolChannelBlock] += row[w];
+                }
+
+                float sum = 0.0f;
+                for (const auto value : partialSum)
+                    sum += value;
+                y[plane / shape.C * paddedC + plane % shape.C] = sum * scale;
+            }
+        });
+}
+
+void GlobalAvgPoolBackward(float* dx, const float* dy, std::size_t paddedC,
+                           const PoolShape& shape)
+{
+    const float scale = 1.0f / static_cast<float>(shape.H * shape.W);
+    Util::ParallelFor(
+        0, static_cast<std::size_t>(shape.N) * shape.C,
+        Util::GrainSize(shape.H * shape.W),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto plane = begin; plane < end; ++plane)
+            {
+                const float gradient =
+                    dy[plane / shape.C * paddedC + plane % shape.C] * scale;
+                float* dxPlane = dx + plane * shape.H * shape.PaddedW;
+                for (unsigned int h = 0; h < shape.H; ++h)
+                    for (unsigned int w = 0; w < shape.W; ++w)
+                        dxPlane[h * shape.PaddedW + w] += gradient;
+            }
+        });
+}
+}  // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,193 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaiveRandom.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <algorithm>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Multipliers and key increments of Philox4x32
+constexpr std::uint32_t PhiloxM0 = 0xD2511F53;
+constexpr std::uint32_t PhiloxM1 = 0xCD9E8D57;
+constexpr std::uint32_t PhiloxW0 = 0x9E3779B9;
+constexpr std::uint32_t PhiloxW1 = 0xBB67AE85;
+constexpr int PhiloxRounds = 10;
+
+std::array<std::uint32_t, 4> Philox4x32(
+    const std::array<std::uint32_t, 4>& counter,
+    const std::array<std::uint32_t, 2>& key)
+{
+    auto c = counter;
+    auto k = key;
+    for (int round = 0; round < PhiloxRounds; ++round)
+    {
+        const std::uint64_t product0 =
+            static_cast<std::uint64_t>(PhiloxM0) * c[0];
+        const std::uint64_t product1 =
+            static_cast<std::uint64_t>(PhiloxM1) * c[2];
+        c = { static_cast<std::uint32_t>(product1 >> 32) ^ c[1] ^ k[0],
+              static_cast<std::uint32_t>(product1),
+              static_cast<std::uint32_t>(product0 >> 32) ^ c[3] ^ k[1],
+              static_cast<std::uint32_t>(product0) };
+        k[0] += PhiloxW0;
+        k[1] += PhiloxW1;
+    }
+    return c;
+}
+
+#ifdef __AVX2__
+//! Number of counters computed together by the vector registers
+constexpr std::size_t PhiloxLanes = 8;
+
+//! Computes high and low 32 bits of the products of each lane of a with
+//! multiplier
+static void MulHiLo(__m256i a, __m256i multiplier, __m256i& hi, __m256i& lo)
+{
+    const __m256i even = _mm256_mul_epu32(a, multiplier);
+    const __m256i odd =
+        _mm256_mul_epu32(_mm256_srli_epi64(a, 32), multiplier);
+    lo = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+    hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+}
+
+//! Computes Philox4x32 of PhiloxLanes consecutive counters
+static void Philox4x32Lanes(std::uint32_t* bits, std::uint64_t firstCounter,
+                            std::uint64_t seed)
+{
+    alignas(32) std::uint32_t low[PhiloxLanes], high[PhiloxLanes];
+    for (std::size_t lane = 0; lane < PhiloxLanes; ++lane)
+    {
+        const auto counter = firstCounter + lane;
+        low[lane] = static_cast<std::uint32_t>(counter);
+        high[lane] = static_cast<std::uint32_t>(counter >> 32);
+    }
+
+    __m256i c0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(low));
+    __m256i c1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(high));
+    __m256i c2 = _mm256_setzero_si256();
+    __m256i c3 = _mm256_setzero_si256();
+    std::uint32_t k0 = static_cast<std::uint32_t>(seed);
+    std::uint32_t k1 = static_cast<std::uint32_t>(seed >> 32);
+    const __m256i m0 = _mm256_set1_epi32(static_cast<int>(PhiloxM0));
+    const __m256i m1 = _mm256_set1_epi32(static_cast<int>(PhiloxM1));
+
+    for (int round = 0; round < PhiloxRounds; ++round)
+    {
+        __m256i hi0, lo0, hi1, lo1;
+        MulHiLo(c0, m0, hi0, lo0);
+        MulHiLo(c2, m1, hi1, lo1);
+        c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1),
+                              _mm256_set1_epi32(static_cast<int>(k0)));
+        c1 = lo1;
+        c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3),
+                              _mm256_set1_epi32(static_cast<int>(k1)));
+        c3 = lo0;
+        k0 += PhiloxW0;
+        k1 += PhiloxW1;
+    }
+
+    alignas(32) std::uint32_t words[4][PhiloxLanes];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(words[0]), c0);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(words[1]), c1);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(words[2]), c2);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(words[3]), c3);
+    for (std::size_t lane = 0; lane < PhiloxLanes; ++lane)
+        for (std::size_t word = 0; word < 4; ++word)
+            bits[lane * 4 + word] = words[word][lane];
+}
+#endif
+
+void GenerateRandomBits(std::uint32_t* bits, std::uint64_t firstCounter,
+                        std::size_t numCounters, std::uint64_t seed)
+{
+    std::size_t idx = 0;
+#ifdef __AVX2__
+    for (; idx + PhiloxLanes <= numCounters; idx += PhiloxLanes)
+        Philox4x32Lanes(bits + idx * 4, firstCounter + idx, seed);
+#endif
+    const std::array<std::uint32_t, 2> key = {
+        static_cast<std::uint32_t>(seed),
+        static_cast<std::uint32_t>(seed >> 32)
+    };
+    for (; idx < numCounters; ++idx)
+    {
+        const auto counter = firstCounter + idx;
+        const auto words =
+            Philox4x32({ static_cast<std::uint32_t>(counter),
+                         static_cast<std::uint32_t>(counter >> 32), 0, 0 },
+                       key);
+        std::copy(words.begin(), words.end(), bits + idx * 4);
+    }
+}
+
+//! Invokes func(position, keep) on each element of the dropout operand with
+//! position of the element in the padded data
+template <typename Func>
+static void ForEachDropoutMask(float rate, std::size_t rows, unsigned int cols,
+                               std::size_t paddedCols, std::uint64_t seed,
+                               std::uint64_t offset, Func func)
+{
+    //! Element is kept if its 24 random bits are not below the threshold
+    const auto threshold =
+        static_cast<std::uint32_t>(static_cast<double>(rate) * 16777216.0);
+    const std::size_t totalSize = rows * cols;
+    const std::size_t numChunks =
+        (totalSize + RandomChunkSize - 1) / RandomChunkSize;
+
+    Util::ParallelFor(
+        0, numChunks, Util::GrainSize(RandomChunkSize * 8),
+        [&](std::size_t chunkBegin, std::size_t chunkEnd) {
+            std::uint32_t bits[RandomChunkSize];
+            for (auto chunkIdx = chunkBegin; chunkIdx < chunkEnd; ++chunkIdx)
+            {
+                const auto begin = chunkIdx * RandomChunkSize;
+                const auto size = std::min(RandomChunkSize, totalSize - begin);
+                GenerateRandomBits(bits, offset + begin / 4, (size + 3) / 4,
+                                   seed);
+
+                auto row = begin / cols;
+                auto col = begin % cols;
+                for (std::size_t idx = 0; idx < size; ++idx)
+                {
+                    func(row * paddedCols + col, (bits[idx] >> 8) >= threshold);
+                    if (++col == cols)
+                    {
+                        col = 0;
+                        ++row;
+                    }
+                }
+            }
+        });
+}
+
+void DropoutForward(float* y, const float* x, float rate, std::size_t rows,
+                    unsigned int cols, std::size_t paddedCols,
+                    std::uint64_t seed, std::uint64_t offset)
+{
+    const float scale = rate < 1.0f ? 1.0f / (1.0f - rate) : 0.0f;
+    ForEachDropoutMask(rate, rows, cols, paddedCols, seed, offset,
+                       [=](std::size_t position, bool keep) {
+                           y[position] = keep ? x[position] * scale : 0.0f;
+                       });
+}
+
+void DropoutBackward(float* dx, const float* dy, float rate, std::size_t rows,
+                     unsigned int cols, std::size_t paddedCols,
+                     std::uint64_t seed, std::uint64_t offset)
+{
+    const float scale = rate < 1.0f ? 1.0f / (1.0f - rate) : 0.0f;
+    ForEachDropoutMask(rate, rows, cols, paddedCols, seed, offset,
+                       [=](std::size_t position, bool keep) {
+                           if (keep)
+                               dx[position] += dy[position] * scale;
+                       });
+}
+}  // namespace Sapphire::Compute::Dense::Naive
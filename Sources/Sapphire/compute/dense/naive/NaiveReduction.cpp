@@ -0,0 +1,501 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaiveReduction.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Number of partial results kept for each contiguous reduction
+constexpr unsigned int ReduceLanes = 8;
+//! Number of values summed sequentially before the pairwise summation
+constexpr std::size_t PairwiseLeafSize = 1024;
+//! Number of values of each chunk reduced in parallel. Long reductions are
+//! always split at the same boundaries, so the result does not depend on the
+//! number of threads
+constexpr std::size_t TreeChunkSize = 1 << 15;
+//! Number of contiguous outputs reduced together along the strided axes
+constexpr std::size_t ColumnBlock = 64;
+//! Rows of strided reductions summed sequentially before the pairwise
+//! summation and reduced in each parallel chunk
+constexpr std::size_t PairwiseLeafRows = 32;
+constexpr std::size_t TreeChunkRows = 512;
+
+constexpr auto NoIndex = std::numeric_limits<std::size_t>::max();
+
+struct SumOp
+{
+    using State = float;
+    static constexpr bool IsPairwise = true;
+
+    static State Identity()
+    {
+        return 0.0f;
+    }
+
+    static void Accumulate(State& state, float value, std::size_t)
+    {
+        state += value;
+    }
+
+    static State Combine(State a, State b)
+    {
+        return a + b;
+    }
+};
+
+struct SquareSumOp : SumOp
+{
+    static void Accumulate(State& state, float value, std::size_t)
+    {
+        state += value * value;
+    }
+};
+
+struct MaxOp
+{
+    using State = float;
+    static constexpr bool IsPairwise = false;
+
+    static State Identity()
+    {
+        return -std::numeric_limits<float>::infinity();
+    }
+
+    static void Accumulate(State& state, float value, std::size_t)
+    {
+        state = value > state ? value : state;
+    }
+
+    static State Combine(State a, State b)
+    {
+        return b > a ? b : a;
+    }
+};
+
+struct MinOp
+{
+    using State = float;
+    static constexpr bool IsPairwise = false;
+
+    static State Identity()
+    {
+        return std::numeric_limits<float>::infinity();
+    }
+
+    static void Accumulate(State& state, float value, std::size_t)
+    {
+        state = value < state ? value : state;
+    }
+
+    static State Combine(State a, State b)
+    {
+        return b < a ? b : a;
+    }
+};
+
+struct ArgMaxState
+{
+    float Value = -std::numeric_limits<float>::infinity();
+    std::size_t Index = NoIndex;
+};
+
+struct ArgMaxOp
+{
+    using State = ArgMaxState;
+    static constexpr bool IsPairwise = false;
+
+    static State Identity()
+    {
+        return {};
+    }
+
+    //! Values of each state are accumulated in increasing order of the index,
+    //! so the first maximum is kept
+    static void Accumulate(State& state, float value, std::size_t idx)
+    {
+        if (value > state.Value || state.Index == NoIndex)
+            state = { value, idx };
+    }
+
+    //! Ties are resolved by the index, so the states can be combined in any
+    //! order
+    static State Combine(const State& a, const State& b)
+    {
+        if (a.Index == NoIndex)
+            return b;
+        if (b.Index == NoIndex)
+            return a;
+        if (b.Value > a.Value || (b.Value == a.Value && b.Index < a.Index))
+            return b;
+        return a;
+    }
+};
+
+static float Finalize(float state, ReduceOp op, std::size_t count)
+{
+    if (op == ReduceOp::Mean)
+        return state / static_cast<float>(count);
+    if (op == ReduceOp::Norm)
+        return std::sqrt(state);
+    return state;
+}
+
+static float Finalize(const ArgMaxState& state, ReduceOp, std::size_t)
+{
+    return static_cast<float>(state.Index);
+}
+
+//! Returns input and output offsets of the element at row-major index idx of
+//! dims. Only the first numDims dimensions are used
+static void GetOffsets(const std::vector<ReduceDim>& dims,
+                       std::size_t numDims, std::size_t idx,
+                       std::size_t& inputOffset, std::size_t& outputOffset)
+{
+    inputOffset = 0;
+    outputOffset = 0;
+    for (auto dimIdx = numDims; dimIdx > 0; --dimIdx)
+    {
+        const auto& dim = dims[dimIdx - 1];
+        const auto pos = idx % dim.Size;
+        idx /= dim.Size;
+        inputOffset += pos * dim.InputStride;
+        outputOffset += pos * dim.OutputStride;
+    }
+}
+
+static std::size_t GetInputOffset(const std::vector<ReduceDim>& dims,
+                                  std::size_t numDims, std::size_t idx)
+{
+    std::size_t inputOffset, outputOffset;
+    GetOffsets(dims, numDims, idx, inputOffset, outputOffset);
+    return inputOffset;
+}
+
+//! Combines the states of the lanes pairwise
+template <typename Op>
+static typename Op::State CombineLanes(typename Op::State* lanes)
+{
+    for (unsigned int step = 1; step < ReduceLanes; step *= 2)
+        for (unsigned int lane = 0; lane < ReduceLanes; lane += 2 * step)
+            lanes[lane] = Op::Combine(lanes[lane], lanes[lane + step]);
+    return lanes[0];
+}
+
+//! Combines count states of the chunks as a binary tree in their order
+//! \param stride : distance between the states of adjacent chunks
+template <typename Op>
+static void CombineChunks(typename Op::State* states, std::size_t count,
+                          std::size_t stride, std::size_t width)
+{
+    for (std::size_t step = 1; step < count; step *= 2)
+        for (std::size_t chunk = 0; chunk + step < count; chunk += 2 * step)
+            for (std::size_t col = 0; col < width; ++col)
+                states[chunk * stride + col] =
+                    Op::Combine(states[chunk * stride + col],
+                                states[(chunk + step) * stride + col]);
+}
+
+//! Reduces values [begin, end) of the reduction whose innermost reduced
+//! dimension is contiguous. Each run along the innermost dimension is
+//! accumulated on ReduceLanes lanes updated by vector instructions
+template <typename Op>
+static typename Op::State ReduceInnerLeaf(const float* base,
+                                          const ReducePlan& plan,
+                                          std::size_t begin, std::size_t end)
+{
+    typename Op::State lanes[ReduceLanes];
+    std::fill(lanes, lanes + ReduceLanes, Op::Identity());
+
+    const auto& inner = plan.Reduced.back();
+    const auto numOuter = plan.Reduced.size() - 1;
+    for (auto idx = begin; idx < end;)
+    {
+        const auto col = idx % inner.Size;
+        const auto count = std::min(inner.Size - col, end - idx);
+        const float* data = base +
+                            GetInputOffset(plan.Reduced, numOuter,
+                                           idx / inner.Size) +
+                            col * inner.InputStride;
+
+        std::size_t i = 0;
+        if (inner.InputStride == 1)
+            for (; i + ReduceLanes <= count; i += ReduceLanes)
+                for (unsigned int lane = 0; lane < ReduceLanes; ++lane)
+                    Op::Accumulate(lanes[lane], data[i + lane],
+                                   idx + i + lane);
+        for (; i < count; ++i)
+            Op::Accumulate(lanes[i % ReduceLanes], data[i * inner.InputStride],
+                           idx + i);
+        idx += count;
+    }
+    return CombineLanes<Op>(lanes);
+}
+
+template <typename Op>
+static typename Op::State ReduceInner(const float* base,
+                                      const ReducePlan& plan,
+                                      std::size_t begin, std::size_t end)
+{
+    if (!Op::IsPairwise || end - begin <= PairwiseLeafSize)
+        return ReduceInnerLeaf<Op>(base, plan, begin, end);
+    const auto mid = begin + (end - begin) / 2;
+    return Op::Combine(ReduceInner<Op>(base, plan, begin, mid),
+                       ReduceInner<Op>(base, plan, mid, end));
+}
+
+//! Reduces along the dimensions with the innermost reduced dimension
+//! contiguous, one output at a time
+template <typename Op>
+static void ReduceInnerAxes(float* output, const float* input,
+                            const ReducePlan& plan, ReduceOp op)
+{
+    const auto& kept = plan.Kept;
+    const auto chunks = (plan.ReduceSize + TreeChunkSize - 1) / TreeChunkSize;
+    if (chunks == 1)
+    {
+        Util::ParallelFor(
+            0, plan.OutputSize, Util::GrainSize(plan.ReduceSize),
+            [&](std::size_t begin, std::size_t end) {
+                for (auto idx = begin; idx < end; ++idx)
+                {
+                    std::size_t inputOffset, outputOffset;
+                    GetOffsets(kept, kept.size(), idx, inputOffset,
+                               outputOffset);
+                    output[outputOffset] = Finalize(
+                        ReduceInner<Op>(input + inputOffset, plan, 0,
+                                        plan.ReduceSize),
+                        op, plan.ReduceSize);
+                }
+            });
+        return;
+    }
+
+    //! Long reductions are split into chunks reduced in parallel
+    std::vector<typename Op::State> partials(plan.OutputSize * chunks);
+    Util::ParallelFor(
+        0, partials.size(), 1, [&](std::size_t begin, std::size_t end) {
+            for (auto item = begin; item < end; ++item)
+            {
+                const auto chunk = item % chunks;
+                const auto inputOffset =
+                    GetInputOffset(kept, kept.size(), item / chunks);
+                partials[item] = ReduceInner<Op>(
+                    input + inputOffset, plan, chunk * TreeChunkSize,
+                    std::min(plan.ReduceSize, (chunk + 1) * TreeChunkSize));
+            }
+        });
+
+    for (std::size_t idx = 0; idx < plan.OutputSize; ++idx)
+    {
+        auto* states = partials.data() + idx * chunks;
+        CombineChunks<Op>(states, chunks, 1, 1);
+        std::size_t inputOffset, outputOffset;
+        GetOffsets(kept, kept.size(), idx, inputOffset, outputOffset);
+        output[outputOffset] = Finalize(states[0], op, plan.ReduceSize);
+    }
+}
+
+//! Reduces rows [begin, end) of a block of contiguous outputs along the
+//! strided reduced dimensions. Each row of the block is accumulated by
+//! vector instructions
+template <typename Op>
+static void ReduceOuterLeaf(typename Op::State* states, const float* base,
+                            const ReducePlan& plan, std::size_t width,
+                            std::size_t begin, std::size_t end)
+{
+    std::fill(states, states + width, Op::Identity());
+    const auto colStride = plan.Kept.back().InputStride;
+    for (auto row = begin; row < end; ++row)
+    {
+        const float* data =
+            base + GetInputOffset(plan.Reduced, plan.Reduced.size(), row);
+        if (colStride == 1)
+            for (std::size_t col = 0; col < width; ++col)
+                Op::Accumulate(states[col], data[col], row);
+        else
+            for (std::size_t col = 0; col < width; ++col)
+                Op::Accumulate(states[col], data[col * colStride], row);
+    }
+}
+
+template <typename Op>
+static void ReduceOuter(typename Op::State* states, const float* base,
+                        const ReducePlan& plan, std::size_t width,
+                        std::size_t begin, std::size_t end)
+{
+    if (!Op::IsPairwise || end - begin <= PairwiseLeafRows)
+    {
+        ReduceOuterLeaf<Op>(states, base, plan, width, begin, end);
+        return;
+    }
+
+    const auto mid = begin + (end - begin) / 2;
+    typename Op::State upper[ColumnBlock];
+    ReduceOuter<Op>(states, base, plan, width, begin, mid);
+    ReduceOuter<Op>(upper, base, plan, width, mid, end);
+    for (std::size_t col = 0; col < width; ++col)
+        states[col] = Op::Combine(states[col], upper[col]);
+}
+
+//! Reduces along the strided dimensions with the innermost kept dimension
+//! contiguous. Blocks of ColumnBlock contiguous outputs are reduced together,
+//! so each row of the input is read by vector loads
+template <typename Op>
+static void ReduceOuterAxes(float* output, const float* input,
+                            const ReducePlan& plan, ReduceOp op)
+{
+    const auto& kept = plan.Kept;
+    const auto& column = kept.back();
+    const auto numOuterKept = kept.size() - 1;
+    const auto blocks = (column.Size + ColumnBlock - 1) / ColumnBlock;
+    const auto items = plan.OutputSize / column.Size * blocks;
+    const auto chunks =
+        (plan.ReduceSize + TreeChunkRows - 1) / TreeChunkRows;
+
+    //! Writes the states of the item to the output
+    const auto store = [&](std::size_t item, const typename Op::State* states) {
+        const auto block = item % blocks;
+        const auto colBegin = block * ColumnBlock;
+        const auto width = std::min(ColumnBlock, column.Size - colBegin);
+        std::size_t inputOffset, outputOffset;
+        GetOffsets(kept, numOuterKept, item / blocks, inputOffset,
+                   outputOffset);
+        for (std::size_t col = 0; col < width; ++col)
+            output[outputOffset + (colBegin + col) * column.OutputStride] =
+                Finalize(states[col], op, plan.ReduceSize);
+    };
+    const auto getBase = [&](std::size_t item, std::size_t& width) {
+        const auto colBegin = (item % blocks) * ColumnBlock;
+        width = std::min(ColumnBlock, column.Size - colBegin);
+        return input + GetInputOffset(kept, numOuterKept, item / blocks) +
+               colBegin * column.InputStride;
+    };
+
+    if (chunks == 1)
+    {
+        Util::ParallelFor(
+            0, items, Util::GrainSize(plan.ReduceSize * ColumnBlock),
+            [&](std::size_t begin, std::size_t end) {
+                typename Op::State states[ColumnBlock];
+                for (auto item = begin; item < end; ++item)
+                {
+                    std::size_t width;
+                    const float* base = getBase(item, width);
+                    ReduceOuter<Op>(states, base, plan, width, 0,
+                                    plan.ReduceSize);
+                    store(item, states);
+                }
+            });
+        return;
+    }
+
+    //! Long reductions are split into chunks of rows reduced in parallel
+    std::vector<typename Op::State> partials(items * chunks * ColumnBlock);
+    Util::ParallelFor(
+        0, items * chunks, 1, [&](std::size_t begin, std::size_t end) {
+            for (auto task = begin; task < end; ++task)
+            {
+                const auto chunk = task % chunks;
+                std::size_t width;
+                const float* base = getBase(task / chunks, width);
+                ReduceOuter<Op>(
+                    partials.data() + task * ColumnBlock, base, plan, width,
+                    chunk * TreeChunkRows,
+                    std::min(plan.ReduceSize, (chunk + 1) * TreeChunkRows));
+            }
+        });
+
+    for (std::size_t item = 0; item < items; ++item)
+    {
+        auto* states = partials.data() + item * chunks * ColumnBlock;
+        CombineChunks<Op>(states, chunks, ColumnBlock, ColumnBlock);
+        store(item, states);
+    }
+}
+
+template <typename Op>
+static void ReduceWith(float* output, const float* input,
+                       const ReducePlan& plan, ReduceOp op)
+{
+    if (plan.Kept.empty() ||
+        plan.Reduced.back().InputStride < plan.Kept.back().InputStride)
+        ReduceInnerAxes<Op>(output, input, plan, op);
+    else
+        ReduceOuterAxes<Op>(output, input, plan, op);
+}
+
+ReducePlan MakeReducePlan(const std::vector<std::size_t>& dims,
+                          const std::vector<std::size_t>& inputStrides,
+                          const std::vector<std::size_t>& outputStrides,
+                          const std::vector<bool>& isReduced)
+{
+    ReducePlan plan;
+    //! Whether the last dimension added to the plan was reduced
+    bool wasReduced = false;
+    bool isFirst = true;
+    for (std::size_t idx = 0; idx < dims.size(); ++idx)
+    {
+        if (dims[idx] == 1)
+            continue;
+
+        const ReduceDim dim{ dims[idx], inputStrides[idx],
+                             isReduced[idx] ? 0 : outputStrides[idx] };
+        auto& list = isReduced[idx] ? plan.Reduced : plan.Kept;
+        if (!isFirst && wasReduced == isReduced[idx])
+        {
+            auto& last = list.back();
+            if (last.InputStride == dim.Size * dim.InputStride &&
+                last.OutputStride == dim.Size * dim.OutputStride)
+            {
+                last.Size *= dim.Size;
+                last.InputStride = dim.InputStride;
+                last.OutputStride = dim.OutputStride;
+                continue;
+            }
+        }
+        list.emplace_back(dim);
+        wasReduced = isReduced[idx];
+        isFirst = false;
+    }
+
+    //! Reduction of a single value copies it
+    if (plan.Reduced.empty())
+        plan.Reduced.emplace_back();
+    for (const auto& dim : plan.Kept)
+        plan.OutputSize *= dim.Size;
+    for (const auto& dim : plan.Reduced)
+        plan.ReduceSize *= dim.Size;
+    return plan;
+}
+
+void Reduce(float* output, const float* input, const ReducePlan& plan,
+            ReduceOp op)
+{
+    switch (op)
+    {
+        case ReduceOp::Sum:
+        case ReduceOp::Mean:
+            ReduceWith<SumOp>(output, input, plan, op);
+            break;
+        case ReduceOp::Norm:
+            ReduceWith<SquareSumOp>(output, input, plan, op);
+            break;
+        case ReduceOp::Max:
+            ReduceWith<MaxOp>(output, input, plan, op);
+            break;
+        case ReduceOp::Min:
+            ReduceWith<MinOp>(output, input, plan, op);
+            break;
+        case ReduceOp::ArgMax:
+            ReduceWith<ArgMaxOp>(output, input, plan, op);
+            break;
+    }
+}
+}  // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,221 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaiveTranspose.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <algorithm>
+#include <cstddef>
+
+#if defined(__AVX__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Size of the tiles transposed in the vector registers
+#ifdef __AVX512F__
+constexpr unsigned int TransposeTile = 16;
+#else
+constexpr unsigned int TransposeTile = 8;
+#endif
+//! Size of the blocks transposed by each task. Rows of both input and output
+//! blocks stay in the L1 cache while the block is transposed
+constexpr unsigned int TransposeBlock = 64;
+
+//! Transposes TransposeTile x TransposeTile tile of input into output
+static void TransposeTileKernel(float* output, std::size_t ldOutput,
+                                const float* input, std::size_t ldInput)
+{
+#if defined(__AVX512F__)
+    __m512 r[16], t[16];
+    for (unsigned int i = 0; i < 16; ++i)
+        r[i] = _mm512_loadu_ps(input + i * ldInput);
+
+    //! Interleaves pairs of rows, then pairs of 64 bit elements
+    for (unsigned int i = 0; i < 16; i += 2)
+    {
+        t[i] = _mm512_unpacklo_ps(r[i], r[i + 1]);
+        t[i + 1] = _mm512_unpackhi_ps(r[i], r[i + 1]);
+    }
+    for (unsigned int i = 0; i < 16; i += 4)
+    {
+        const auto t0 = _mm512_castps_pd(t[i]);
+        const auto t1 = _mm512_castps_pd(t[i + 1]);
+        const auto t2 = _mm512_castps_pd(t[i + 2]);
+        const auto t3 = _mm512_castps_pd(t[i + 3]);
+        r[i] = _mm512_castpd_ps(_mm512_unpacklo_pd(t0, t2));
+        r[i + 1] = _mm512_castpd_ps(_mm512_unpackhi_pd(t0, t2));
+        r[i + 2] = _mm512_castpd_ps(_mm512_unpacklo_pd(t1, t3));
+        r[i + 3] = _mm512_castpd_ps(_mm512_unpackhi_pd(t1, t3));
+    }
+
+    //! Each row holds 4x4 transposed blocks in its 128 bit lanes, which are
+    //! gathered by two rounds of lane shuffles
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        t[i] = _mm512_shuffle_f32x4(r[i], r[i + 4], 0x88);
+        t[i + 4] = _mm512_shuffle_f32x4(r[i], r[i + 4], 0xdd);
+        t[i + 8] = _mm512_shuffle_f32x4(r[i + 8], r[i + 12], 0x88);
+        t[i + 12] = _mm512_shuffle_f32x4(r[i + 8], r[i + 12], 0xdd);
+    }
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+        r[i] = _mm512_shuffle_f32x4(t[i], t[i + 8], 0x88);
+        r[i + 8] = _mm512_shuffle_f32x4(t[i], t[i + 8], 0xdd);
+    }
+
+    for (unsigned int i = 0; i < 16; ++i)
+        _mm512_storeu_ps(output + i * ldOutput, r[i]);
+#elif defined(__AVX__)
+    __m256 r[8], t[8];
+    for (unsigned int i = 0; i < 8; ++i)
+        r[i] = _mm256_loadu_ps(input + i * ldInput);
+
+    for (unsigned int i = 0; i < 8; i += 2)
+    {
+        t[i] = _mm256_unpacklo_ps(r[i], r[i + 1]);
+        t[i + 1] = _mm256_unpackhi_ps(r[i], r[i + 1]);
+    }
+    for (unsigned int i = 0; i < 8; i += 4)
+    {
+        r[i] = _mm256_shuffle_ps(t[i], t[i + 2], _MM_SHUFFLE(1, 0, 1, 0));
+        r[i + 1] = _mm256_shuffle_ps(t[i], t[i + 2], _MM_SHUFFLE(3, 2, 3, 2));
+        r[i + 2] =
+            _mm256_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(1, 0, 1, 0));
+        r[i + 3] =
+            _mm256_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(3, 2, 3, 2));
+    }
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        t[i] = _mm256_permute2f128_ps(r[i], r[i + 4], 0x20);
+        t[i + 4] = _mm256_permute2f128_ps(r[i], r[i + 4], 0x31);
+    }
+
+    for (unsigned int i = 0; i < 8; ++i)
+        _mm256_storeu_ps(output + i * ldOutput, t[i]);
+#else
+    for (unsigned int i = 0; i < TransposeTile; ++i)
+        for (unsigned int j = 0; j < TransposeTile; ++j)
+            output[j * ldOutput + i] = input[i * ldInput + j];
+#endif
+}
+
+//! Transposes (rows, cols) part of input into output
+//! Full tiles are transposed in the registers and the edges element-wise
+static void TransposeBlockKernel(float* output, std::size_t ldOutput,
+                                 const float* input, std::size_t ldInput,
+                                 unsigned int rows, unsigned int cols)
+{
+    const auto fullRows = rows - rows % TransposeTile;
+    const auto fullCols = cols - cols % TransposeTile;
+    for (unsigned int i = 0; i < fullRows; i += TransposeTile)
+        for (unsigned int j = 0; j < fullCols; j += TransposeTile)
+            TransposeTileKernel(output + j * ldOutput + i, ldOutput,
+                                input + i * ldInput + j, ldInput);
+
+    for (unsigned int i = 0; i < rows; ++i)
+        for (unsigned int j = i < fullRows ? fullCols : 0; j < cols; ++j)
+            output[j * ldOutput + i] = input[i * ldInput + j];
+}
+
+void Transpose(float* output, const float* input, unsigned int inputRows,
+               unsigned int paddedInputRows, unsigned int inputCols,
+               unsigned int paddedInputCols, unsigned int batchSize,
+               bool broadcast)
+{
+    const auto blocksRow = (inputRows + TransposeBlock - 1) / TransposeBlock;
+    const auto blocksCol = (inputCols + TransposeBlock - 1) / TransposeBlock;
+    const auto blocksPerMatrix =
+        static_cast<std::size_t>(blocksRow) * blocksCol;
+    const auto inputStride =
+        broadcast ? 0 : static_cast<std::size_t>(inputRows) * paddedInputCols;
+    const auto outputStride =
+        static_cast<std::size_t>(inputCols) * paddedInputRows;
+
+    Util::ParallelFor(
+        0, blocksPerMatrix * batchSize,
+        Util::GrainSize(TransposeBlock * TransposeBlock),
+        [&](std::size_t blockBegin, std::size_t blockEnd) {
+            for (auto blockIdx = blockBegin; blockIdx < blockEnd; ++blockIdx)
+            {
+                const auto batchIdx = blockIdx / blocksPerMatrix;
+                const auto rowBegin = static_cast<unsigned int>(
+                    blockIdx % blocksPerMatrix / blocksCol * TransposeBlock);
+                const auto colBegin = static_cast<unsigned int>(
+                    blockIdx % blocksCol * TransposeBlock);
+                TransposeBlockKernel(
+                    output + batchIdx * outputStride +
+                        static_cast<std::size_t>(colBegin) * paddedInputRows +
+                        rowBegin,
+                    paddedInputRows,
+                    input + batchIdx * inputStride +
+                        static_cast<std::size_t>(rowBegin) * paddedInputCols +
+                        colBegin,
+                    paddedInputCols,
+                    std::min(TransposeBlock, inputRows - rowBegin),
+                    std::min(TransposeBlock, inputCols - colBegin));
+            }
+        });
+}
+
+void TransposeInPlace(float* data, unsigned int size, unsigned int paddedSize,
+                      unsigned int batchSize)
+{
+    const auto tiles = size / TransposeTile;
+    const auto fullSize = tiles * TransposeTile;
+    //! Pairs of tiles (i, j) with i <= j in row major order
+    const auto pairsPerMatrix =
+        static_cast<std::size_t>(tiles) * (tiles + 1) / 2;
+    const auto matrixStride = static_cast<std::size_t>(size) * paddedSize;
+
+    Util::ParallelFor(
+        0, pairsPerMatrix * batchSize,
+        Util::GrainSize(2 * TransposeTile * TransposeTile),
+        [&](std::size_t pairBegin, std::size_t pairEnd) {
+            float buffer[TransposeTile * TransposeTile];
+            for (auto pairIdx = pairBegin; pairIdx < pairEnd; ++pairIdx)
+            {
+                float* matrix =
+                    data + pairIdx / pairsPerMatrix * matrixStride;
+                auto remainder = pairIdx % pairsPerMatrix;
+                unsigned int tileRow = 0;
+                while (remainder >= tiles - tileRow)
+                    remainder -= tiles - tileRow++;
+                const auto tileCol =
+                    tileRow + static_cast<unsigned int>(remainder);
+
+                float* upper = matrix +
+                               static_cast<std::size_t>(tileRow) *
+                                   TransposeTile * paddedSize +
+                               tileCol * TransposeTile;
+                float* lower = matrix +
+                               static_cast<std::size_t>(tileCol) *
+                                   TransposeTile * paddedSize +
+                               tileRow * TransposeTile;
+
+                //! Upper tile is kept aside while the lower tile is
+                //! transposed into its place
+                TransposeTileKernel(buffer, TransposeTile, upper, paddedSize);
+                if (upper != lower)
+                    TransposeTileKernel(upper, paddedSize, lower, paddedSize);
+                for (unsigned int i = 0; i < TransposeTile; ++i)
+                    std::copy(buffer + i * TransposeTile,
+                              buffer + (i + 1) * TransposeTile,
+                              lower + i * paddedSize);
+            }
+        });
+
+    //! Elements outside the full tiles are swapped element-wise
+    for (unsigned int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+    {
+        float* matrix = data + batchIdx * matrixStride;
+        for (unsigned int i = 0; i < size; ++i)
+            for (auto j = std::max(i + 1, fullSize); j < size; ++j)
+                std::swap(matrix[i * paddedSize + j],
+                          matrix[j * paddedSize + i]);
+    }
+}
+}  // namespace Sapphire::Compute::Dense::Naive
@@ -8,6 +8,7 @@
 #include <Sapphire/compute/sparse/Sparse.hpp>
 #include <Sapphire/compute/sparse/SparseMatrix.hpp>
 #include <Sapphire/util/MemoryManager.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
 
 namespace Sapphire::Compute
 {
@@ -545,84 +546,86 @@ void CreateSparseMatrixWithDenseMatrix(SparseMatrix** dst, const float* src,
         MemoryManager::GetMemoryHost(sizeof(SparseMatrix) * numMatrices));
     auto* dstPtr = *dst;
 
-#pragma omp parallel for default(none) \
-    shared(numMatrices, m, n, paddedN, src, dstPtr) schedule(static)
-    for (long matrixIdx = 0; matrixIdx < static_cast<long>(numMatrices);
-         matrixIdx++)
-    {
-        uint32_t nnz = 0;
-        for (uint32_t rowIdx = 0; rowIdx < m; ++rowIdx)
+    //! Each matrix is converted on a single task
+    const auto convertMatrices = [&](std::size_t matrixBegin,
+                                     std::size_t matrixEnd) {
+        for (auto matrixIdx = matrixBegin; matrixIdx < matrixEnd; ++matrixIdx)
         {
-            for (uint32_t colIdx = 0; colIdx < n; ++colIdx)
-                if (src[matrixIdx * m * paddedN + rowIdx * paddedN + colIdx] !=
-                    0)
-                    nnz++;
-        }
+            const float* matrix = src + matrixIdx * m * paddedN;
+            auto& sparse = dstPtr[matrixIdx];
 
-        dstPtr[matrixIdx].ROW = static_cast<uint32_t*>(
-            MemoryManager::GetMemoryHost(sizeof(uint32_t) * (m + 1)));
-        dstPtr[matrixIdx].COL = static_cast<uint32_t*>(
-            MemoryManager::GetMemoryHost(sizeof(uint32_t) * (!nnz ? 1 : nnz)));
-        dstPtr[matrixIdx].V = static_cast<float*>(
-            MemoryManager::GetMemoryHost(sizeof(uint32_t) * (!nnz ? 1 : nnz)));
-        dstPtr[matrixIdx].M = m;
-        dstPtr[matrixIdx].N = n;
-        dstPtr[matrixIdx].NNZ = nnz;
-
-        nnz = 0;
-        for (uint32_t rowIdx = 0; rowIdx < m; ++rowIdx)
-        {
-            dstPtr[matrixIdx].ROW[rowIdx] = nnz;
-            for (uint32_t colIdx = 0; colIdx < n; ++colIdx)
+            uint32_t nnz = 0;
+            for (uint32_t rowIdx = 0; rowIdx < m; ++rowIdx)
             {
-                if (src[matrixIdx * m * paddedN + rowIdx * paddedN + colIdx] !=
-                    0)
+                for (uint32_t colIdx = 0; colIdx < n; ++colIdx)
+                    if (matrix[rowIdx * paddedN + colIdx] != 0)
+                        nnz++;
+            }
+
+            sparse.ROW = static_cast<uint32_t*>(
+                MemoryManager::GetMemoryHost(sizeof(uint32_t) * (m + 1)));
+            sparse.COL = static_cast<uint32_t*>(MemoryManager::GetMemoryHost(
+                sizeof(uint32_t) * (!nnz ? 1 : nnz)));
+            sparse.V = static_cast<float*>(MemoryManager::GetMemoryHost(
+                sizeof(uint32_t) * (!nnz ? 1 : nnz)));
+            sparse.M = m;
+            sparse.N = n;
+            sparse.NNZ = nnz;
+
+            nnz = 0;
+            for (uint32_t rowIdx = 0; rowIdx < m; ++rowIdx)
+            {
+                sparse.ROW[rowIdx] = nnz;
+                for (uint32_t colIdx = 0; colIdx < n; ++colIdx)
                 {
-                    dstPtr[matrixIdx].V[nnz] = src[matrixIdx * m * paddedN +
-                                                   rowIdx * paddedN + colIdx];
-                    dstPtr[matrixIdx].COL[nnz] = colIdx;
-                    nnz++;
+                    if (matrix[rowIdx * paddedN + colIdx] != 0)
+                    {
+                        sparse.V[nnz] = matrix[rowIdx * paddedN + colIdx];
+                        sparse.COL[nnz] = colIdx;
+                        nnz++;
+                    }
                 }
             }
+
+            sparse.ROW[m] = nnz;
         }
+    };
 
-        dstPtr[matrixIdx].ROW[m] = nnz;
-    }
+    Util::ParallelFor(0, numMatrices, Util::GrainSize(m * n),
+                      convertMatrices);
 }
 
 void ConvertSparseMatrixToDenseMatrix(float* dst, const SparseMatrix* src,
                                       uint32_t m, uint32_t n, uint32_t paddedN,
                                       uint32_t numMatrices)
 {
-#pragma omp parallel for default(none) shared(dst, numMatrices, m, n, paddedN)
-    for (long matrixIdx = 0; matrixIdx < static_cast<long>(numMatrices); ++
-         matrixIdx)
-        for (long rowIdx = 0; rowIdx < static_cast<long>(m); ++rowIdx)
-            for (long colIdx = 0; colIdx < static_cast<long>(n); ++colIdx)
-                dst[matrixIdx * m * paddedN + rowIdx * paddedN + colIdx] = 0.0f;
-
-#pragma omp parallel for default(none) \
-    shared(src, dst, numMatrices, m, n, paddedN)
-    for (long matrixIdx = 0; matrixIdx < static_cast<long>(numMatrices); ++
-         matrixIdx)
-    {
-        const auto* rows = src[matrixIdx].ROW;
-        const auto* cols = src[matrixIdx].COL;
-        const auto* values = src[matrixIdx].V;
-
-        for (uint32_t rowIdx = 0; rowIdx < m; ++rowIdx)
+    //! Matrices are zeroed and filled on the same task
+    const auto convertMatrices = [&](std::size_t matrixBegin,
+                                     std::size_t matrixEnd) {
+        for (auto matrixIdx = matrixBegin; matrixIdx < matrixEnd; ++matrixIdx)
         {
-            const auto sparseColIdxBegin = rows[rowIdx];
-            const auto sparseColIdxEnd = rows[rowIdx + 1];
-            for (uint32_t sparseColIdx = sparseColIdxBegin;
-                 sparseColIdx < sparseColIdxEnd; ++sparseColIdx)
+            float* matrix = dst + matrixIdx * m * paddedN;
+            for (uint32_t rowIdx = 0; rowIdx < m; ++rowIdx)
+                for (uint32_t colIdx = 0; colIdx < n; ++colIdx)
+                    matrix[rowIdx * paddedN + colIdx] = 0.0f;
+
+            const auto* rows = src[matrixIdx].ROW;
+            const auto* cols = src[matrixIdx].COL;
+            const auto* values = src[matrixIdx].V;
+
+            for (uint32_t rowIdx = 0; rowIdx < m; ++rowIdx)
             {
-                const auto colIdx = cols[sparseColIdx];
-                const auto value = values[sparseColIdx];
-                dst[matrixIdx * m * paddedN + rowIdx * paddedN + colIdx] =
-                    value;
+                const auto sparseColIdxBegin = rows[rowIdx];
+                const auto sparseColIdxEnd = rows[rowIdx + 1];
+                for (uint32_t sparseColIdx = sparseColIdxBegin;
+                     sparseColIdx < sparseColIdxEnd; ++sparseColIdx)
+                    matrix[rowIdx * paddedN + cols[sparseColIdx]] =
+                        values[sparseColIdx];
             }
         }
-    }
+    };
+
+    Util::ParallelFor(0, numMatrices, Util::GrainSize(m * n),
+                      convertMatrices);
 }
 } // namespace Sapphire::Compute
@@ -7,6 +7,7 @@
 #include <Sapphire/compute/sparse/naive/SparseGemm.hpp>
 #include <Sapphire/util/MemoryManager.hpp>
 #include <Sapphire/util/Spinlock.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
 #include <algorithm>
 #include <atomic>
 #include <vector>
@@ -110,76 +111,82 @@ void Gemm(SparseMatrix** output, SparseMatrix* a, SparseMatrix* b, uint32_t m,
         (*output)[i].ROW = static_cast<uint32_t*>(
             Util::MemoryManager::GetMemoryHost(sizeof(uint32_t) * (m + 1)));
 
-#pragma omp parallel for default(none)                                      \
-    shared(numMatrices, m, n, a, b, output, tempIdxBuffer, tempValueBuffer) \
-        schedule(static)
-    for (long matrixIdx = 0; matrixIdx < static_cast<long>(numMatrices); ++
-         matrixIdx)
-    {
-        auto* curMatrixA = a + matrixIdx;
-        auto* curMatrixB = b + matrixIdx;
-        auto* curMatrixOut = (*output) + matrixIdx;
-        uint32_t matrixNNZ = 0;
-        for (uint32_t rowIdx = 0; rowIdx < m; ++rowIdx)
+    //! Each matrix uses its own region of the temporary buffers
+    const auto multiplyMatrices = [&](std::size_t matrixBegin,
+                                      std::size_t matrixEnd) {
+        for (auto matrixIdx = matrixBegin; matrixIdx < matrixEnd; ++matrixIdx)
         {
-            curMatrixOut->ROW[rowIdx] = matrixNNZ;
-            uint32_t rowNNZ = 0;
-            for (auto sparseColIdx = curMatrixA->ROW[rowIdx];
-                 sparseColIdx < curMatrixA->ROW[rowIdx + 1]; ++sparseColIdx)
+            auto* curMatrixA = a + matrixIdx;
+            auto* curMatrixB = b + matrixIdx;
+            auto* curMatrixOut = (*output) + matrixIdx;
+            uint32_t matrixNNZ = 0;
+            for (uint32_t rowIdx = 0; rowIdx < m; ++rowIdx)
             {
-                const auto colIdxA = curMatrixA->COL[sparseColIdx];
-                const auto valueA = curMatrixA->V[sparseColIdx];
-                for (auto sparseColIdxB = curMatrixB->ROW[colIdxA];
-                     sparseColIdxB < curMatrixB->ROW[colIdxA + 1];
-                     ++sparseColIdxB)
+                curMatrixOut->ROW[rowIdx] = matrixNNZ;
+                uint32_t rowNNZ = 0;
+                for (auto sparseColIdx = curMatrixA->ROW[rowIdx];
+                     sparseColIdx < curMatrixA->ROW[rowIdx + 1]; ++sparseColIdx)
                 {
-                    const auto valueB = curMatrixB->V[sparseColIdxB];
-                    const auto colIdxB = curMatrixB->COL[sparseColIdxB];
-                    const auto valueOut = valueA * valueB;
-                    Insert(tempIdxBuffer, tempValueBuffer, m, matrixIdx, rowIdx,
-                           colIdxB, valueOut, &rowNNZ);
+                    const auto colIdxA = curMatrixA->COL[sparseColIdx];
+                    const auto valueA = curMatrixA->V[sparseColIdx];
+                    for (auto sparseColIdxB = curMatrixB->ROW[colIdxA];
+                         sparseColIdxB < curMatrixB->ROW[colIdxA + 1];
+                         ++sparseColIdxB)
+                    {
+                        const auto valueB = curMatrixB->V[sparseColIdxB];
+                        const auto colIdxB = curMatrixB->COL[sparseColIdxB];
+                        const auto valueOut = valueA * valueB;
+                        Insert(tempIdxBuffer, tempValueBuffer, m,
+                               static_cast<uint32_t>(matrixIdx), rowIdx,
+                               colIdxB, valueOut, &rowNNZ);
+                    }
                 }
-            }
 
-            const auto beginOffset = matrixIdx * m * MAX_NNZ_PER_ROW_HOST +
-                                     rowIdx * MAX_NNZ_PER_ROW_HOST;
-            const auto endOffset = matrixIdx * m * MAX_NNZ_PER_ROW_HOST +
-                                   (rowIdx + 1) * MAX_NNZ_PER_ROW_HOST;
+                const auto beginOffset = matrixIdx * m * MAX_NNZ_PER_ROW_HOST +
+                                         rowIdx * MAX_NNZ_PER_ROW_HOST;
+                const auto endOffset = matrixIdx * m * MAX_NNZ_PER_ROW_HOST +
+                                       (rowIdx + 1) * MAX_NNZ_PER_ROW_HOST;
 
-            // std::sort(tempIdxBuffer + beginOffset, tempIdxBuffer +
-            // endOffset);
-            Sort(tempIdxBuffer, tempValueBuffer, beginOffset, endOffset);
+                // std::sort(tempIdxBuffer + beginOffset, tempIdxBuffer +
+                // endOffset);
+                Sort(tempIdxBuffer, tempValueBuffer, beginOffset, endOffset);
 
-            matrixNNZ += rowNNZ;
-        }
-        curMatrixOut->ROW[m] = matrixNNZ;
+                matrixNNZ += rowNNZ;
+            }
+            curMatrixOut->ROW[m] = matrixNNZ;
 
-        curMatrixOut->COL = static_cast<uint32_t*>(
-            Util::MemoryManager::GetMemoryHost(sizeof(uint32_t) * matrixNNZ));
-        curMatrixOut->V = static_cast<float*>(
-            Util::MemoryManager::GetMemoryHost(sizeof(float) * matrixNNZ));
+            curMatrixOut->COL = static_cast<uint32_t*>(
+                Util::MemoryManager::GetMemoryHost(sizeof(uint32_t) *
+                                                   matrixNNZ));
+            curMatrixOut->V = static_cast<float*>(
+                Util::MemoryManager::GetMemoryHost(sizeof(float) * matrixNNZ));
 
-        curMatrixOut->NNZ = matrixNNZ;
-        curMatrixOut->M = m;
-        curMatrixOut->N = n;
+            curMatrixOut->NNZ = matrixNNZ;
+            curMatrixOut->M = m;
+            curMatrixOut->N = n;
 
-        for (size_t rowIdx = 0; rowIdx < m; ++rowIdx)
-        {
-            const auto rowNNZ =
-                curMatrixOut->ROW[rowIdx + 1] - curMatrixOut->ROW[rowIdx];
-            if (rowNNZ)
+            for (size_t rowIdx = 0; rowIdx < m; ++rowIdx)
             {
-                const auto copyOffset = matrixIdx * m * MAX_NNZ_PER_ROW_HOST +
-                                        rowIdx * MAX_NNZ_PER_ROW_HOST;
-                std::copy(tempIdxBuffer + copyOffset,
-                          tempIdxBuffer + copyOffset + rowNNZ,
-                          curMatrixOut->COL + curMatrixOut->ROW[rowIdx]);
-                std::copy(tempValueBuffer + copyOffset,
-                          tempValueBuffer + copyOffset + rowNNZ,
-                          curMatrixOut->V + curMatrixOut->ROW[rowIdx]);
+                const auto rowNNZ =
+                    curMatrixOut->ROW[rowIdx + 1] - curMatrixOut->ROW[rowIdx];
+                if (rowNNZ)
+                {
+                    const auto copyOffset =
+                        matrixIdx * m * MAX_NNZ_PER_ROW_HOST +
+                        rowIdx * MAX_NNZ_PER_ROW_HOST;
+                    std::copy(tempIdxBuffer + copyOffset,
+                              tempIdxBuffer + copyOffset + rowNNZ,
+                              curMatrixOut->COL + curMatrixOut->ROW[rowIdx]);
+                    std::copy(tempValueBuffer + copyOffset,
+                              tempValueBuffer + copyOffset + rowNNZ,
+                              curMatrixOut->V + curMatrixOut->ROW[rowIdx]);
+                }
             }
         }
-    }
+    };
+
+    Util::ParallelFor(0, numMatrices, 1, multiplyMatrices);
+
     delete[] tempIdxBuffer;
     delete[] tempValueBuffer;
 }
@@ -0,0 +1,228 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/operations/Backward/BackwardEngine.hpp>
+#include <Sapphire/util/AtomicWait.hpp>
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+namespace Sapphire::BackProp
+{
+BackwardEngine::BackwardEngine(Model& model, Util::ThreadPool& threadPool)
+    : m_model(model),
+      m_threadPool(threadPool)
+{
+}
+
+void BackwardEngine::Run(int rootKey)
+{
+    m_build(rootKey);
+
+    m_remaining.store(static_cast<std::uint32_t>(m_nodes.size()),
+                      std::memory_order_relaxed);
+    m_threadPool.Submit(&m_nodes.front());
+    m_threadPool.WaitUntilZero(m_remaining);
+
+    m_nodes.clear();
+    if (m_exception)
+        std::rethrow_exception(std::exchange(m_exception, nullptr));
+}
+
+void BackwardEngine::m_build(int rootKey)
+{
+    m_nodes.clear();
+    m_failed = false;
+
+    std::unordered_map<int, std::size_t> nodeIndices;
+    std::unordered_map<const void*, std::size_t> lockIndices;
+
+    const auto getNode = [&](int key, std::vector<std::size_t>& stack) {
+        const auto [it, inserted] = nodeIndices.emplace(key, m_nodes.size());
+        if (inserted)
+        {
+            auto& node = m_nodes.emplace_back();
+            node.Run = m_runNode;
+            node.Engine = this;
+            node.Descriptor = &m_model.GetDescriptor(key);
+            node.Wrapper = node.Descriptor->GetNextBackPropWrapper();
+            stack.emplace_back(it->second);
+        }
+        return it->second;
+    };
+
+    const auto getLock = [&](const TensorUtil::TensorData& tensorData) {
+        const auto lockIdx = lockIndices.size();
+        return lockIndices.emplace(tensorData.GetBufferBase(), lockIdx)
+            .first->second;
+    };
+
+    //! Parameter gradients never overlap each other even if they are views of
+    //! the flat buffer (see Model::FlattenParameters), so they are locked by
+    //! their own start instead of the shared buffer
+    const auto getParameterLock = [&](const TensorUtil::TensorData& grad) {
+        const auto lockIdx = lockIndices.size();
+        const void* start =
+            grad.DenseMatHost ? static_cast<const void*>(grad.DenseMatHost)
+                              : static_cast<const void*>(grad.DenseMatCuda);
+        return lockIndices.emplace(start, lockIdx).first->second;
+    };
+
+    std::vector<std::size_t> stack;
+    getNode(rootKey, stack);
+    while (!stack.empty())
+    {
+        const auto nodeIdx = stack.back();
+        stack.pop_back();
+
+        auto* wrapper = m_nodes[nodeIdx].Wrapper;
+        if (!wrapper)
+            continue;
+
+        std::vector<std::size_t> children;
+        std::vector<std::size_t> locks;
+        for (const auto& gradient : wrapper->GetOutputTensorKeys())
+        {
+            locks.emplace_back(getLock(gradient));
+            if (gradient.GetParentDescKey() < 0)
+                continue;
+            const auto childIdx = getNode(gradient.GetParentDescKey(), stack);
+            children.emplace_back(childIdx);
+            m_nodes[childIdx].Pending.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (wrapper->GetUnitKey() >= 0)
+        {
+            const auto unitDataWrapper =
+                m_model.GetUnitDataWrapper(wrapper->GetUnitKey());
+            for (const auto& [name, gradient] :
+                 unitDataWrapper.GradientDataMap)
+                locks.emplace_back(getParameterLock(gradient));
+            for (const auto& [name, rowGradient] :
+                 unitDataWrapper.RowGradientMap)
+                locks.emplace_back(
+                    lockIndices.emplace(rowGradient.get(), lockIndices.size())
+                        .first->second);
+        }
+
+        std::sort(locks.begin(), locks.end());
+        locks.erase(std::unique(locks.begin(), locks.end()), locks.end());
+
+        auto& node = m_nodes[nodeIdx];
+        node.Children = std::move(children);
+        node.Locks = std::move(locks);
+    }
+
+    m_locks = std::make_unique<Lock[]>(lockIndices.size());
+}
+
+void BackwardEngine::m_runNode(Util::Task* task)
+{
+    auto& node = *static_cast<Node*>(task);
+    auto* engine = node.Engine;
+    if (!engine->m_failed.load(std::memory_order_acquire))
+    {
+        try
+        {
+            //! Lock holder may be this thread waiting inside a parallel
+            //! operation or a nested engine, so node is parked instead of
+            //! blocking, and runs again when the lock is released
+            if (!engine->m_backProp(node))
+                return;
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(engine->m_exceptionMtx);
+            if (!engine->m_exception)
+                engine->m_exception = std::current_exception();
+            engine->m_failed.store(true, std::memory_order_release);
+        }
+    }
+    engine->m_finish(node);
+}
+
+bool BackwardEngine::m_backProp(Node& node)
+{
+    //! Locks are acquired in the ascending order to prevent deadlock
+    for (std::size_t idx = 0; idx < node.Locks.size(); ++idx)
+    {
+        if (m_tryLock(node.Locks[idx], node))
+            continue;
+        while (idx > 0)
+            m_unlock(node.Locks[--idx]);
+        return false;
+    }
+
+    //! Every gradient has arrived, so operand history is consumed
+    node.Descriptor->PopIfOperandHistory();
+    if (!node.Wrapper)
+        return true;
+
+    //! Wrappers may call the model from the worker threads
+    ModelContext context(m_model);
+    try
+    {
+        node.Wrapper->InvokeBackProp(node.Descriptor->BackwardData);
+    }
+    catch (...)
+    {
+        for (auto lockIdx : node.Locks)
+            m_unlock(lockIdx);
+        throw;
+    }
+    for (auto lockIdx : node.Locks)
+        m_unlock(lockIdx);
+
+    node.Descriptor->PopHistory();
+    return true;
+}
+
+bool BackwardEngine::m_tryLock(std::size_t lockIdx, Node& node)
+{
+    auto& lock = m_locks[lockIdx];
+    std::lock_guard<std::mutex> guard(lock.Mtx);
+    if (lock.IsHeld)
+    {
+        lock.Waiters.emplace_back(&node);
+        return false;
+    }
+    lock.IsHeld = true;
+    return true;
+}
+
+void BackwardEngine::m_unlock(std::size_t lockIdx)
+{
+    auto& lock = m_locks[lockIdx];
+    std::vector<Node*> waiters;
+    {
+        std::lock_guard<std::mutex> guard(lock.Mtx);
+        lock.IsHeld = false;
+        waiters.swap(lock.Waiters);
+    }
+    for (auto* waiter : waiters)
+        m_threadPool.Submit(waiter);
+}
+
+void BackwardEngine::m_finish(Node& node)
+{
+    for (auto childIdx : node.Children)
+    {
+        auto& child = m_nodes[childIdx];
+        if (child.Pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            continue;
+
+        //! Leaves only consume their history, so they are finished in place
+        if (child.Wrapper)
+            m_threadPool.Submit(&child);
+        else
+            m_runNode(&child);
+    }
+
+    if (m_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        Util::AtomicNotifyAll(m_remaining);
+}
+}  // namespace Sapphire::BackProp
@@ -0,0 +1,68 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/operations/Backward/BackwardEngine.hpp>
+#include <Sapphire/operations/Backward/CheckpointBackward.hpp>
+#include <stdexcept>
+
+namespace Sapphire::BackProp
+{
+CheckpointBackProp::CheckpointBackProp(
+    Function function, int inputKey, const TensorUtil::TensorData& x,
+    TensorUtil::TensorData dx, TensorUtil::TensorData dy, bool isTraining,
+    std::vector<Compute::Initialize::RandomStream> randomStreams)
+    : BackPropWrapper({ std::move(dx) }, { std::move(dy) }),
+      m_function(std::move(function)),
+      m_inputKey(inputKey),
+      m_inputShape(x.TensorShape),
+      m_isTraining(isTraining),
+      m_randomStreams(std::move(randomStreams))
+{
+    m_savedTensorMap.emplace("x", SavedTensor(x, "x"));
+}
+
+bool CheckpointBackProp::InvokeBackProp(const TensorUtil::TensorData& input)
+{
+    auto& model = ModelManager::GetCurrentModel();
+    //! Recomputed outputs would be different if input has been modified
+    static_cast<void>(m_savedTensorMap.at("x").Get());
+
+    EnableGradGuard gradGuard;
+    TrainingModeGuard trainingGuard(m_isTraining);
+    RecomputeGuard recomputeGuard;
+    Compute::Initialize::RandomReplayGuard replayGuard(m_randomStreams);
+    TensorKeyRecorder recorder;
+    try
+    {
+        //! Replayed input shares both forward and backward data with the
+        //! input, so gradient of the replay is directly accumulated to dx
+        const int inputKey =
+            model.RegisterTensorDescriptorView(m_inputKey, m_inputShape, 0, 0);
+        const Tensor output = m_function(Tensor(m_inputShape, inputKey));
+        auto& outputDesc = model.GetDescriptor(output.TensorDescriptorKey());
+        if (!outputDesc.BackwardData.DenseMatHost &&
+            !outputDesc.BackwardData.DenseMatCuda)
+            throw std::runtime_error(
+                "CheckpointBackProp::InvokeBackProp - Output of the segment "
+                "does not have gradient");
+
+        Compute::Add(outputDesc.BackwardData, outputDesc.BackwardData,
+                     m_gradientInputs[0]);
+        BackwardEngine engine(model);
+        engine.Run(output.TensorDescriptorKey());
+    }
+    catch (...)
+    {
+        model.ReleaseTensorData(recorder.Keys());
+        throw;
+    }
+
+    model.ReleaseTensorData(recorder.Keys());
+    return true;
+}
+}  // namespace Sapphire::BackProp
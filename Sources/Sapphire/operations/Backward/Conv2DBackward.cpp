@@ -0,0 +1,48 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/operations/Backward/Conv2DBackward.hpp>
+
+namespace Sapphire::BackProp
+{
+Conv2DBackProp::Conv2DBackProp(const TensorUtil::TensorData& x,
+                               TensorUtil::TensorData dx,
+                               TensorUtil::TensorData dy, int unitKey,
+                               std::pair<int, int> stride,
+                               std::pair<int, int> dilation,
+                               std::pair<int, int> padding)
+    : BackPropWrapper({ std::move(dx) }, { std::move(dy) }, unitKey),
+      m_stride(stride),
+      m_dilation(dilation),
+      m_padding(padding)
+{
+    m_savedTensorMap.emplace("x", SavedTensor(x, "x"));
+}
+
+bool Conv2DBackProp::InvokeBackProp(const TensorUtil::TensorData& input)
+{
+    const auto& model = ModelManager::GetCurrentModel();
+    auto unitDataWrapper = model.GetUnitDataWrapper(m_unitKey);
+    const auto& weight = unitDataWrapper.TensorDataMap["weight"];
+    TensorUtil::TensorData& dx = m_gradientOutputs[0];
+    const TensorUtil::TensorData& dy = m_gradientInputs[0];
+    const TensorUtil::TensorData x = m_savedTensorMap.at("x").Get();
+
+    //! Gradients are accumulated since x and the weight may be used by other
+    //! operations
+    Compute::Conv2DBackwardData(dx, weight, dy, m_stride.first,
+                                m_stride.second, m_dilation.first,
+                                m_dilation.second, m_padding.first,
+                                m_padding.second);
+    Compute::Conv2DBackwardFilter(unitDataWrapper.GradientDataMap["weight"], x,
+                                  dy, m_stride.first, m_stride.second,
+                                  m_dilation.first, m_dilation.second,
+                                  m_padding.first, m_padding.second);
+    return true;
+}
+}  // namespace Sapphire::BackProp
@@ -0,0 +1,31 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/operations/Backward/CrossEntropyBackward.hpp>
+
+namespace Sapphire::BackProp
+{
+CrossEntropyBackProp::CrossEntropyBackProp(const TensorUtil::TensorData& x,
+                                           TensorUtil::TensorData dx,
+                                           TensorUtil::TensorData dy,
+                                           std::vector<std::size_t> labels,
+                                           std::vector<float> logSumExp)
+    : BackPropWrapper({ std::move(dx) }, { std::move(dy) }),
+      m_labels(std::move(labels)),
+      m_logSumExp(std::move(logSumExp))
+{
+    m_savedTensorMap.emplace("x", SavedTensor(x, "x"));
+}
+
+bool CrossEntropyBackProp::InvokeBackProp(const TensorUtil::TensorData& input)
+{
+    const TensorUtil::TensorData x = m_savedTensorMap.at("x").Get();
+    Compute::CrossEntropyBackward(m_gradientOutputs[0], m_gradientInputs[0], x,
+                                  m_labels, m_logSumExp);
+    return true;
+}
+}  // namespace Sapphire::BackProp
@@ -0,0 +1,28 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/operations/Backward/DropoutBackward.hpp>
+
+namespace Sapphire::BackProp
+{
+DropoutBackProp::DropoutBackProp(TensorUtil::TensorData dx,
+                                 TensorUtil::TensorData dy, float rate,
+                                 std::uint64_t seed, std::uint64_t offset)
+    : BackPropWrapper({ std::move(dx) }, { std::move(dy) }),
+      m_rate(rate),
+      m_seed(seed),
+      m_offset(offset)
+{
+}
+
+bool DropoutBackProp::InvokeBackProp(const TensorUtil::TensorData& input)
+{
+    Compute::DropoutBackward(m_gradientOutputs[0], m_gradientInputs[0],
+                             m_rate, m_seed, m_offset);
+    return true;
+}
+}  // namespace Sapphire::BackProp
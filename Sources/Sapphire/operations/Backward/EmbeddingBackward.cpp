@@ -0,0 +1,28 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/operations/Backward/EmbeddingBackward.hpp>
+
+namespace Sapphire::BackProp
+{
+EmbeddingBackProp::EmbeddingBackProp(TensorUtil::TensorData dy, int unitKey,
+                                     std::vector<std::size_t> indices)
+    : BackPropWrapper({}, { std::move(dy) }, unitKey),
+      m_indices(std::move(indices))
+{
+}
+
+bool EmbeddingBackProp::InvokeBackProp(const TensorUtil::TensorData& input)
+{
+    const auto& model = ModelManager::GetCurrentModel();
+    const auto unitDataWrapper = model.GetUnitDataWrapper(m_unitKey);
+    Compute::EmbeddingBackward(*unitDataWrapper.RowGradientMap.at("weight"),
+                               m_gradientInputs[0], m_indices);
+    return true;
+}
+}  // namespace Sapphire::BackProp
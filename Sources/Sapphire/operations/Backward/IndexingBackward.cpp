@@ -0,0 +1,81 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/operations/Backward/IndexingBackward.hpp>
+
+namespace Sapphire::BackProp
+{
+ReshapeBackProp::ReshapeBackProp(TensorUtil::TensorData dx,
+                                 TensorUtil::TensorData dy, bool isView)
+    : BackPropWrapper({ std::move(dx) }, { std::move(dy) }),
+      m_isView(isView)
+{
+}
+
+bool ReshapeBackProp::InvokeBackProp(const TensorUtil::TensorData& input)
+{
+    if (m_isView)
+        return true;
+
+    auto& dy = m_gradientInputs[0];
+    auto& dx = m_gradientOutputs[0];
+
+    TensorUtil::TensorData temp(dx.TensorShape, dx.GetType(), dx.GetDevice(),
+                                dx.BatchSize);
+    Compute::Reshape(temp, dy);
+    Compute::Add(dx, dx, temp);
+    return true;
+}
+
+ChunkBackProp::ChunkBackProp(TensorUtil::TensorData dx,
+                             TensorUtil::TensorData dy, int dim,
+                             unsigned int start, bool isView)
+    : BackPropWrapper({ std::move(dx) }, { std::move(dy) }),
+      m_dim(dim),
+      m_start(start),
+      m_isView(isView)
+{
+}
+
+bool ChunkBackProp::InvokeBackProp(const TensorUtil::TensorData& input)
+{
+    if (m_isView)
+        return true;
+
+    auto& dy = m_gradientInputs[0];
+    auto& dx = m_gradientOutputs[0];
+
+    TensorUtil::TensorData temp(dx.TensorShape, dx.GetType(), dx.GetDevice(),
+                                dx.BatchSize);
+    Compute::Initialize::Zeros(temp);
+    Compute::CopySlice(temp, dy, m_dim, m_start, 0,
+                       dy.TensorShape.At(m_dim));
+    Compute::Add(dx, dx, temp);
+    return true;
+}
+
+PermuteBackProp::PermuteBackProp(TensorUtil::TensorData dx,
+                                 TensorUtil::TensorData dy,
+                                 std::vector<unsigned int> dims)
+    : BackPropWrapper({ std::move(dx) }, { std::move(dy) }),
+      m_inverseDims(dims.size())
+{
+    for (unsigned int i = 0; i < dims.size(); ++i)
+        m_inverseDims[dims[i]] = i;
+}
+
+bool PermuteBackProp::InvokeBackProp(const TensorUtil::TensorData& input)
+{
+    auto& dy = m_gradientInputs[0];
+    auto& dx = m_gradientOutputs[0];
+
+    const auto dyView = dy.CreatePermuteView(m_inverseDims, -1, false);
+    Compute::Add(dx, dx, dyView);
+    return true;
+}
+}  // namespace Sapphire::BackProp
@@ -12,14 +12,13 @@ namespace Sapphire::BackProp
 LinearBackProp::LinearBackProp(const TensorUtil::TensorData& x,
                                TensorUtil::TensorData dx,
                                TensorUtil::TensorData dy, int unitKey)
-    : BackPropWrapper({ std::move(dx) }, { std::move(dy) }, unitKey),
-      m_batchSize(dy.BatchSize)
+    : BackPropWrapper({ std::move(dx) }, { std::move(dy) }, unitKey)
 {
-    m_savedTensorMap["x"] = x.CreateCopy();
-
     TensorUtil::TensorData& dxRef = m_gradientOutputs[0];
     TensorUtil::TensorData& dyRef = m_gradientInputs[0];
-    TensorUtil::TensorData& xRef = m_savedTensorMap["x"];
+    //! x is saved by reference, so only the shape of the reference is changed
+    //! Strided x is copied since its strides cannot follow the new shape
+    TensorUtil::TensorData xRef = x.GetContiguous();
 
     //! Treat x and dxRef
     xRef.TensorShape.Expand(2);
@@ -31,6 +30,8 @@ LinearBackProp::LinearBackProp(const TensorUtil::TensorData& x,
     xRef.BatchSize = 1;
     dxRef.BatchSize = 1;
     dyRef.BatchSize = 1;
+
+    m_savedTensorMap.emplace("x", SavedTensor(std::move(xRef), "x"));
 }
 
 bool LinearBackProp::InvokeBackProp(const TensorUtil::TensorData& input)
@@ -38,53 +39,41 @@ bool LinearBackProp::InvokeBackProp(const TensorUtil::TensorData& input)
     const auto& model = ModelManager::GetCurrentModel();
     auto unitDataWrapper = model.GetUnitDataWrapper(m_unitKey);
     auto weight = unitDataWrapper.TensorDataMap["weight"];
-    auto bias = unitDataWrapper.TensorDataMap["bias"];
 
+    //! Parameters are updated by the optimizer with the gradients
     m_backProp(weight);
-    m_updateWeight(weight);
-    m_updateBias(bias);
+    m_weightGradient(unitDataWrapper.GradientDataMap["weight"]);
+    m_biasGradient(unitDataWrapper.GradientDataMap["bias"]);
 
     return true;
 }
 
-void LinearBackProp::m_backProp(const TensorUtil::TensorData& weight)
+void LinearBackProp::m_backProp(TensorUtil::TensorData& weight)
 {
-    TensorUtil::TensorData transposedWeight(weight.GetShape().GetTranspose(),
-                                            weight.GetType(),
-                                            weight.GetDevice(), 1);
+    const TensorUtil::TensorData transposedWeight =
+        weight.CreateTransposeView(-1, false);
     TensorUtil::TensorData& dx = m_gradientOutputs[0];
     TensorUtil::TensorData& dy = m_gradientInputs[0];
 
-    Compute::Initialize::Zeros(dx);
-    Compute::Transpose(transposedWeight, weight);
+    //! Gradient is accumulated since x may be used by other operations
     Compute::Gemm(dx, dy, transposedWeight, dx);
 }
 
-void LinearBackProp::m_updateWeight(TensorUtil::TensorData& weight)
+void LinearBackProp::m_weightGradient(TensorUtil::TensorData& weightGradient)
 {
     TensorUtil::TensorData& dy = m_gradientInputs[0];
-    TensorUtil::TensorData& x = m_savedTensorMap["x"];
-    TensorUtil::TensorData transposedA(x.GetShape().GetTranspose(), x.GetType(),
-                                       x.GetDevice(), 1);
+    TensorUtil::TensorData x = m_savedTensorMap.at("x").Get();
+    const TensorUtil::TensorData transposedX = x.CreateTransposeView(-1, false);
 
-    Compute::Transpose(transposedA, x);
-    Compute::Scale(
-        transposedA, transposedA,
-        -1 / static_cast<float>(m_batchSize));  // todo : divide by batch size
-    // and scale by learning rate
-    Compute::Gemm(weight, transposedA, dy, weight);
+    Compute::Gemm(weightGradient, transposedX, dy, weightGradient);
 }
 
-void LinearBackProp::m_updateBias(TensorUtil::TensorData& bias)
+void LinearBackProp::m_biasGradient(TensorUtil::TensorData& biasGradient)
 {
-    TensorUtil::TensorData& gradientIn = m_gradientInputs[0];
-    TensorUtil::TensorData oneVector(Shape({ gradientIn.Rows() }),
-                                     gradientIn.GetType(),
-                                     gradientIn.GetDevice(), 1);
+    TensorUtil::TensorData& dy = m_gradientInputs[0];
 
-    Compute::Initialize::Ones(oneVector);
-    Compute::Scale(oneVector, oneVector, -1.0f);
-    Compute::Gemm(bias, oneVector, gradientIn, bias);
+    //! Gradient of the bias is the sum of dy over the batch
+    Compute::ColumnSum(biasGradient, dy);
 }
 
 }  // namespace Sapphire::BackProp
\ No newline at end of file
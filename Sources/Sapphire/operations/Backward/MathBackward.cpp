@@ -16,15 +16,8 @@ MulBackProp::MulBackProp(const TensorUtil::TensorData& a,
                          TensorUtil::TensorData db, TensorUtil::TensorData dy)
     : BackPropWrapper({ std::move(da), std::move(db) }, { std::move(dy) })
 {
-    TensorUtil::TensorData transposedA(a.TensorShape.GetTranspose(),
-                                       a.GetType(), a.GetDevice(), a.BatchSize);
-    TensorUtil::TensorData transposedB(b.TensorShape.GetTranspose(),
-                                       b.GetType(), b.GetDevice(), b.BatchSize);
-
-    m_savedTensorMap["a"] = a.CreateCopy();
-    m_savedTensorMap["b"] = b.CreateCopy();
-    m_savedTensorMap["transposedA"] = transposedA;
-    m_savedTensorMap["transposedB"] = transposedB;
+    m_savedTensorMap.emplace("a", SavedTensor(a, "a"));
+    m_savedTensorMap.emplace("b", SavedTensor(b, "b"));
 }
 
 bool MulBackProp::InvokeBackProp(const TensorUtil::TensorData& input)
@@ -33,13 +26,11 @@ bool MulBackProp::InvokeBackProp(const TensorUtil::TensorData& input)
     auto& da = m_gradientOutputs[0];
     auto& db = m_gradientOutputs[1];
 
-    auto& a = m_savedTensorMap["a"];
-    auto& b = m_savedTensorMap["b"];
-    auto& transposedA = m_savedTensorMap["transposedA"];
-    auto& transposedB = m_savedTensorMap["transposedB"];
-
-    Compute::Transpose(transposedA, a);
-    Compute::Transpose(transposedB, b);
+    auto a = m_savedTensorMap.at("a").Get();
+    auto b = m_savedTensorMap.at("b").Get();
+    //! Transposed operands are strided views, so no transpose is performed
+    const auto transposedA = a.CreateTransposeView(-1, false);
+    const auto transposedB = b.CreateTransposeView(-1, false);
 
     Compute::Gemm(da, dy, transposedB, da);
     Compute::Gemm(db, transposedA, dy, db);
@@ -16,14 +16,14 @@ MSEBackward::MSEBackward(const TensorUtil::TensorData& x,
     : BackPropWrapper({ std::move(dy) }, { std::move(dx) })
 
 {
-    m_savedTensorMap["x"] = x.CreateCopy();
-    m_savedTensorMap["label"] = label.CreateCopy();
+    m_savedTensorMap.emplace("x", SavedTensor(x, "x"));
+    m_savedTensorMap.emplace("label", SavedTensor(label, "label"));
 }
 
 bool MSEBackward::InvokeBackProp(const TensorUtil::TensorData& input)
 {
-    auto& x = m_savedTensorMap["x"];
-    auto& label = m_savedTensorMap["label"];
+    const auto x = m_savedTensorMap.at("x").Get();
+    const auto label = m_savedTensorMap.at("label").Get();
     auto& dx = m_gradientOutputs[0];
     auto& dy = m_gradientInputs[0];
 
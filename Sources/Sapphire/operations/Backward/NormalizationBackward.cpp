@@ -0,0 +1,64 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/operations/Backward/NormalizationBackward.hpp>
+
+namespace Sapphire::BackProp
+{
+LayerNormBackProp::LayerNormBackProp(const TensorUtil::TensorData& x,
+                                     TensorUtil::TensorData dx,
+                                     TensorUtil::TensorData dy, int unitKey,
+                                     std::vector<float> mean,
+                                     std::vector<float> rstd)
+    : BackPropWrapper({ std::move(dx) }, { std::move(dy) }, unitKey),
+      m_mean(std::move(mean)),
+      m_rstd(std::move(rstd))
+{
+    m_savedTensorMap.emplace("x", SavedTensor(x, "x"));
+}
+
+bool LayerNormBackProp::InvokeBackProp(const TensorUtil::TensorData& input)
+{
+    const auto& model = ModelManager::GetCurrentModel();
+    auto unitDataWrapper = model.GetUnitDataWrapper(m_unitKey);
+    const TensorUtil::TensorData x = m_savedTensorMap.at("x").Get();
+
+    //! Gradients are accumulated since x and the parameters may be used by
+    //! other operations
+    Compute::LayerNormBackward(
+        m_gradientOutputs[0], unitDataWrapper.GradientDataMap["gamma"],
+        unitDataWrapper.GradientDataMap["beta"], m_gradientInputs[0], x,
+        unitDataWrapper.TensorDataMap["gamma"], m_mean, m_rstd);
+    return true;
+}
+
+BatchNormBackProp::BatchNormBackProp(const TensorUtil::TensorData& x,
+                                     TensorUtil::TensorData dx,
+                                     TensorUtil::TensorData dy, int unitKey,
+                                     std::vector<float> mean,
+                                     std::vector<float> rstd)
+    : BackPropWrapper({ std::move(dx) }, { std::move(dy) }, unitKey),
+      m_mean(std::move(mean)),
+      m_rstd(std::move(rstd))
+{
+    m_savedTensorMap.emplace("x", SavedTensor(x, "x"));
+}
+
+bool BatchNormBackProp::InvokeBackProp(const TensorUtil::TensorData& input)
+{
+    const auto& model = ModelManager::GetCurrentModel();
+    auto unitDataWrapper = model.GetUnitDataWrapper(m_unitKey);
+    const TensorUtil::TensorData x = m_savedTensorMap.at("x").Get();
+
+    Compute::BatchNormBackward(
+        m_gradientOutputs[0], unitDataWrapper.GradientDataMap["gamma"],
+        unitDataWrapper.GradientDataMap["beta"], m_gradientInputs[0], x,
+        unitDataWrapper.TensorDataMap["gamma"], m_mean, m_rstd);
+    return true;
+}
+}  // namespace Sapphire::BackProp
@@ -0,0 +1,70 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/operations/Backward/PoolingBackward.hpp>
+
+namespace Sapphire::BackProp
+{
+MaxPool2DBackProp::MaxPool2DBackProp(TensorUtil::TensorData dx,
+                                     TensorUtil::TensorData dy,
+                                     std::vector<std::uint8_t> indices,
+                                     std::pair<int, int> windowSize,
+                                     std::pair<int, int> stride,
+                                     std::pair<int, int> padding)
+    : BackPropWrapper({ std::move(dx) }, { std::move(dy) }),
+      m_indices(std::move(indices)),
+      m_windowSize(windowSize),
+      m_stride(stride),
+      m_padding(padding)
+{
+}
+
+bool MaxPool2DBackProp::InvokeBackProp(const TensorUtil::TensorData& input)
+{
+    //! Gradient is accumulated since x may be used by other operations
+    Compute::MaxPool2DBackward(m_gradientOutputs[0], m_gradientInputs[0],
+                               m_indices, m_windowSize.first,
+                               m_windowSize.second, m_stride.first,
+                               m_stride.second, m_padding.first,
+                               m_padding.second);
+    return true;
+}
+
+AvgPool2DBackProp::AvgPool2DBackProp(TensorUtil::TensorData dx,
+                                     TensorUtil::TensorData dy,
+                                     std::pair<int, int> windowSize,
+                                     std::pair<int, int> stride,
+                                     std::pair<int, int> padding)
+    : BackPropWrapper({ std::move(dx) }, { std::move(dy) }),
+      m_windowSize(windowSize),
+      m_stride(stride),
+      m_padding(padding)
+{
+}
+
+bool AvgPool2DBackProp::InvokeBackProp(const TensorUtil::TensorData& input)
+{
+    Compute::AvgPool2DBackward(m_gradientOutputs[0], m_gradientInputs[0],
+                               m_windowSize.first, m_windowSize.second,
+                               m_stride.first, m_stride.second,
+                               m_padding.first, m_padding.second);
+    return true;
+}
+
+GlobalAvgPoolBackProp::GlobalAvgPoolBackProp(TensorUtil::TensorData dx,
+                                             TensorUtil::TensorData dy)
+    : BackPropWrapper({ std::move(dx) }, { std::move(dy) })
+{
+}
+
+bool GlobalAvgPoolBackProp::InvokeBackProp(
+    const TensorUtil::TensorData& input)
+{
+    Compute::GlobalAvgPoolBackward(m_gradientOutputs[0], m_gradientInputs[0]);
+    return true;
+}
+}  // namespace Sapphire::BackProp
@@ -0,0 +1,31 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/operations/Backward/SavedTensor.hpp>
+#include <stdexcept>
+#include <utility>
+
+namespace Sapphire::BackProp
+{
+SavedTensor::SavedTensor(TensorUtil::TensorData tensorData, std::string name)
+    : m_tensorData(std::move(tensorData)),
+      m_version(m_tensorData.GetVersion()),
+      m_name(std::move(name))
+{
+}
+
+TensorUtil::TensorData SavedTensor::Get() const
+{
+    if (IsModified())
+        throw std::runtime_error(
+            "SavedTensor::Get - Saved tensor '" + m_name +
+            "' has been modified in place after it was saved for back "
+            "propagation (saved version : " + std::to_string(m_version) +
+            ", current version : " +
+            std::to_string(m_tensorData.GetVersion()) + ")");
+    return m_tensorData;
+}
+}  // namespace Sapphire::BackProp
@@ -0,0 +1,66 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/operations/Backward/CheckpointBackward.hpp>
+#include <Sapphire/operations/Forward/Checkpoint.hpp>
+#include <vector>
+
+namespace Sapphire::NN
+{
+Checkpoint::Checkpoint(Function function, bool recompute)
+    : m_function(std::move(function)), m_recompute(recompute)
+{
+}
+
+Tensor Checkpoint::operator()(const Tensor& input)
+{
+    m_savedBytes = 0;
+    if (!m_recompute || !GradMode::IsEnabled())
+        return m_function(input);
+
+    auto& model = ModelManager::GetCurrentModel();
+    std::vector<int> intermediateKeys;
+    int lastKey = -1;
+    Shape outputShape;
+    //! Replay draws the same random values in the same training mode, so
+    //! that it regenerates the outputs of this pass
+    std::vector<Compute::Initialize::RandomStream> randomStreams;
+    const bool isTraining = TrainingMode::IsEnabled();
+    {
+        NoGradGuard guard;
+        TensorKeyRecorder recorder;
+        Compute::Initialize::RandomRecorder randomRecorder;
+        const Tensor output = m_function(input);
+        lastKey = output.TensorDescriptorKey();
+        outputShape = output.GetShape();
+        intermediateKeys = recorder.Keys();
+        randomStreams = randomRecorder.Streams();
+    }
+
+    //! Output takes over the forward data of the last intermediate output
+    const int yKey = model.RegisterTensorDescriptorView(
+        lastKey, model.GetDescriptor(lastKey).ForwardData.TensorShape, 0, 0);
+    m_savedBytes = model.ReleaseTensorData(intermediateKeys);
+
+    auto& xDesc = model.GetDescriptor(input.TensorDescriptorKey());
+    auto& yDesc = model.GetDescriptor(yKey);
+    yDesc.BackwardData = TensorUtil::TensorData(
+        yDesc.ForwardData.TensorShape, yDesc.ForwardData.GetType(),
+        yDesc.ForwardData.GetDevice(), yDesc.GetBatchSize(), yKey);
+
+    auto backPropWrapper = std::make_unique<BackProp::CheckpointBackProp>(
+        m_function, input.TensorDescriptorKey(), xDesc.ForwardData,
+        xDesc.BackwardData, yDesc.BackwardData, isTraining,
+        std::move(randomStreams));
+
+    xDesc.AppendOperandHistory(yKey);
+    yDesc.AppendOutputHistory(std::move(backPropWrapper), false);
+
+    return Tensor(outputShape, yKey);
+}
+}  // namespace Sapphire::NN
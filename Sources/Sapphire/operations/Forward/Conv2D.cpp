@@ -0,0 +1,145 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/operations/Backward/Conv2DBackward.hpp>
+#include <Sapphire/operations/Forward/Conv2D.hpp>
+#include <Sapphire/operations/Unit.hpp>
+#include <Sapphire/tensor/TensorData.hpp>
+#include <stdexcept>
+
+namespace Sapphire::NN
+{
+Conv2D::Conv2D(unsigned int inputChannels, unsigned int outputChannels,
+               std::pair<unsigned int, unsigned int> filterSize,
+               const Device& device, std::pair<int, int> stride,
+               std::pair<int, int> dilation, std::pair<int, int> padding)
+    : m_outputChannels(outputChannels),
+      m_filterSize(filterSize),
+      m_stride(stride),
+      m_dilation(dilation),
+      m_padding(padding)
+{
+    auto& currentModel = ModelManager::GetCurrentModel();
+    const Shape filterShape(
+        { outputChannels, inputChannels, filterSize.first, filterSize.second });
+    UnitDataWrapper wrapper;
+    wrapper.TensorDataMap["weight"] =
+        TensorUtil::TensorData(filterShape, Type::Dense, device, 1);
+    wrapper.GradientDataMap["weight"] =
+        TensorUtil::TensorData(filterShape, Type::Dense, device, 1);
+    Compute::Initialize::HeNormal(
+        wrapper.TensorDataMap["weight"],
+        static_cast<int>(inputChannels * filterSize.first * filterSize.second));
+
+    m_unitKey = currentModel.RegisterUnitDataWrapper(wrapper);
+}
+
+Tensor Conv2D::operator()(const Tensor& tensor) const
+{
+    auto& model = ModelManager::GetCurrentModel();
+    auto unitDataWrapper = model.GetUnitDataWrapper(m_unitKey);
+
+    TensorUtil::TensorDescriptor& xDesc =
+        model.GetDescriptor(tensor.TensorDescriptorKey());
+    const auto& x = xDesc.ForwardData;
+    const Shape shapeInput = x.TensorShape;
+    if (shapeInput.Dim() != 3)
+        throw std::invalid_argument(
+            "NN::Conv2D - Input must have shape (C, H, W)");
+
+    const auto extentRow = static_cast<int>(
+        m_dilation.first * (static_cast<int>(m_filterSize.first) - 1) + 1);
+    const auto extentCol = static_cast<int>(
+        m_dilation.second * (static_cast<int>(m_filterSize.second) - 1) + 1);
+    const auto paddedHeight =
+        static_cast<int>(shapeInput.At(1)) + 2 * m_padding.first;
+    const auto paddedWidth =
+        static_cast<int>(shapeInput.At(2)) + 2 * m_padding.second;
+    if (m_stride.first < 1 || m_stride.second < 1 ||
+        paddedHeight < extentRow || paddedWidth < extentCol)
+        throw std::invalid_argument(
+            "NN::Conv2D - Filter is larger than the input or stride is not "
+            "positive");
+
+    const Shape outputShape(
+        { m_outputChannels,
+          static_cast<unsigned int>((paddedHeight - extentRow) /
+                                        m_stride.first +
+                                    1),
+          static_cast<unsigned int>((paddedWidth - extentCol) /
+                                        m_stride.second +
+                                    1) });
+
+    const auto yKey = model.RegisterTensorDescriptor(
+        outputShape, x.GetType(), x.GetDevice(), x.BatchSize, true);
+    auto& yDesc = model.GetDescriptor(yKey);
+    const auto& weight = unitDataWrapper.TensorDataMap["weight"];
+
+    const auto tileSize =
+        x.GetDevice().Type() == DeviceType::HOST
+            ? Compute::GetWinogradTileSize(
+                  x, weight, yDesc.ForwardData, m_stride.first,
+                  m_stride.second, m_dilation.first, m_dilation.second,
+                  m_padding.first, m_padding.second)
+            : 0;
+    if (tileSize != 0)
+    {
+        //! Stores the transformed weight so later calls can reuse it
+        if (UpdateWinogradWeight(unitDataWrapper, tileSize))
+            model.SetUnitDataWrapper(m_unitKey, unitDataWrapper);
+        const auto& winogradWeight =
+            unitDataWrapper.TensorDataMap.at("winogradWeight");
+        Compute::Conv2DForwardWinograd(yDesc.ForwardData, x, weight,
+                                       winogradWeight, tileSize,
+                                       m_padding.first, m_padding.second);
+    }
+    else
+    {
+        Compute::Conv2DForward(yDesc.ForwardData, x, weight, m_stride.first,
+                               m_stride.second, m_dilation.first,
+                               m_dilation.second, m_padding.first,
+                               m_padding.second);
+    }
+
+    if (!GradMode::IsEnabled())
+        return Tensor(outputShape, yKey);
+
+    auto backPropWrapper = std::make_unique<BackProp::Conv2DBackProp>(
+        xDesc.ForwardData, xDesc.BackwardData, yDesc.BackwardData, m_unitKey,
+        m_stride, m_dilation, m_padding);
+
+    //! Append operand history to the inputDescriptor
+    xDesc.AppendOperandHistory(yKey);
+    //! Append output history to the output descriptor
+    yDesc.AppendOutputHistory(std::move(backPropWrapper), true);
+
+    return Tensor(outputShape, yKey);
+}
+
+bool UpdateWinogradWeight(UnitDataWrapper& unitDataWrapper,
+                          unsigned int tileSize)
+{
+    const auto& weight = unitDataWrapper.TensorDataMap.at("weight");
+    const auto version = weight.GetVersion();
+    auto& cachedTileSize = unitDataWrapper.IntegerLiterals["winogradTileSize"];
+    const auto cacheVersion =
+        unitDataWrapper.CachedVersions.find("winogradWeight");
+
+    if (cacheVersion != unitDataWrapper.CachedVersions.end() &&
+        cacheVersion->second == version &&
+        cachedTileSize == static_cast<int>(tileSize))
+        return false;
+
+    unitDataWrapper.TensorDataMap["winogradWeight"] =
+        Compute::TransformWinogradFilter(weight, tileSize);
+    unitDataWrapper.CachedVersions["winogradWeight"] = version;
+    cachedTileSize = static_cast<int>(tileSize);
+    return true;
+}
+}  // namespace Sapphire::NN
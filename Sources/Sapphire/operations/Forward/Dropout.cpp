@@ -0,0 +1,56 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/operations/Backward/DropoutBackward.hpp>
+#include <Sapphire/operations/Forward/Dropout.hpp>
+#include <memory>
+#include <stdexcept>
+
+namespace Sapphire::NN
+{
+Dropout::Dropout(float rate)
+    : m_rate(rate)
+{
+    if (!(rate >= 0.0f && rate <= 1.0f))
+        throw std::invalid_argument("NN::Dropout - Rate must be in [0, 1]");
+}
+
+Tensor Dropout::operator()(const Tensor& tensor) const
+{
+    if (!TrainingMode::IsEnabled())
+        return tensor;
+
+    auto& model = ModelManager::GetCurrentModel();
+    TensorUtil::TensorDescriptor& xDesc =
+        model.GetDescriptor(tensor.TensorDescriptorKey());
+    const auto& x = xDesc.ForwardData;
+    const Shape outputShape = x.TensorShape;
+
+    const auto yKey = model.RegisterTensorDescriptor(
+        outputShape, x.GetType(), x.GetDevice(), x.BatchSize, true);
+    auto& yDesc = model.GetDescriptor(yKey);
+
+    const auto stream = Compute::Initialize::ReserveRandom(
+        x.TensorShape.Size() * x.BatchSize);
+    Compute::DropoutForward(yDesc.ForwardData, x, m_rate, stream.Seed,
+                            stream.Offset);
+
+    if (!GradMode::IsEnabled())
+        return Tensor(outputShape, yKey);
+
+    auto backPropWrapper = std::make_unique<BackProp::DropoutBackProp>(
+        xDesc.BackwardData, yDesc.BackwardData, m_rate, stream.Seed,
+        stream.Offset);
+
+    xDesc.AppendOperandHistory(yKey);
+    yDesc.AppendOutputHistory(std::move(backPropWrapper), false);
+
+    return Tensor(outputShape, yKey);
+}
+}  // namespace Sapphire::NN
@@ -0,0 +1,96 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/operations/Backward/EmbeddingBackward.hpp>
+#include <Sapphire/operations/Forward/Embedding.hpp>
+#include <Sapphire/operations/Unit.hpp>
+#include <cmath>
+#include <stdexcept>
+
+namespace Sapphire::NN
+{
+Embedding::Embedding(unsigned int numEmbeddings, unsigned int embeddingSize,
+                     const Device& device)
+    : m_embeddingSize(embeddingSize)
+{
+    auto& currentModel = ModelManager::GetCurrentModel();
+    UnitDataWrapper wrapper;
+    wrapper.TensorDataMap["weight"] = TensorUtil::TensorData(
+        Shape({ numEmbeddings, embeddingSize }), Type::Dense, device, 1);
+    Compute::Initialize::Normal(wrapper.TensorDataMap["weight"], 0, 1);
+
+    //! Gradient of the table is not allocated densely
+    auto rowGradient = std::make_shared<RowGradient>();
+    rowGradient->RowSize = embeddingSize;
+    wrapper.RowGradientMap["weight"] = std::move(rowGradient);
+
+    m_unitKey = currentModel.RegisterUnitDataWrapper(wrapper);
+}
+
+//! Returns indices stored in the host data of tensorData
+static std::vector<std::size_t> GetIndices(
+    const TensorUtil::TensorData& tensorData)
+{
+    if (tensorData.GetDevice().Type() != DeviceType::HOST)
+        throw std::runtime_error(
+            "NN::Embedding - Indices must be on the host");
+
+    const auto cols = tensorData.Cols();
+    const auto rows = tensorData.TensorShape.Size() / cols *
+                      static_cast<std::size_t>(tensorData.BatchSize);
+    std::vector<std::size_t> indices;
+    indices.reserve(rows * cols);
+    for (std::size_t row = 0; row < rows; ++row)
+        for (unsigned int col = 0; col < cols; ++col)
+        {
+            const float value =
+                tensorData.DenseMatHost[row * tensorData.PaddedHostColSize +
+                                        col];
+            if (value < 0.0f || value != std::floor(value))
+                throw std::invalid_argument(
+                    "NN::Embedding - Indices must be non-negative integers");
+            indices.emplace_back(static_cast<std::size_t>(value));
+        }
+    return indices;
+}
+
+Tensor Embedding::operator()(const Tensor& tensor) const
+{
+    auto& model = ModelManager::GetCurrentModel();
+    auto unitDataWrapper = model.GetUnitDataWrapper(m_unitKey);
+
+    TensorUtil::TensorDescriptor& xDesc =
+        model.GetDescriptor(tensor.TensorDescriptorKey());
+    const auto& x = xDesc.ForwardData;
+    const auto indices = GetIndices(x.GetContiguous());
+
+    std::vector<unsigned int> outputDims;
+    for (unsigned int dim = 0; dim < x.TensorShape.Dim(); ++dim)
+        outputDims.emplace_back(x.TensorShape.At(dim));
+    outputDims.emplace_back(m_embeddingSize);
+    const Shape outputShape(outputDims);
+
+    const auto& table = unitDataWrapper.TensorDataMap["weight"];
+    const auto yKey = model.RegisterTensorDescriptor(
+        outputShape, Type::Dense, table.GetDevice(), x.BatchSize, true);
+    auto& yDesc = model.GetDescriptor(yKey);
+
+    Compute::EmbeddingForward(yDesc.ForwardData, table, indices);
+
+    if (!GradMode::IsEnabled())
+        return Tensor(outputShape, yKey);
+
+    //! Indices receive no gradient, so no operand history is appended
+    auto backPropWrapper = std::make_unique<BackProp::EmbeddingBackProp>(
+        yDesc.BackwardData, m_unitKey, indices);
+    yDesc.AppendOutputHistory(std::move(backPropWrapper), false);
+
+    return Tensor(outputShape, yKey);
+}
+}  // namespace Sapphire::NN
@@ -10,6 +10,7 @@
 #include <Sapphire/operations/Forward/Linear.hpp>
 #include <Sapphire/operations/Unit.hpp>
 #include <Sapphire/tensor/TensorData.hpp>
+#include <stdexcept>
 
 namespace Sapphire::NN
 {
@@ -25,7 +26,10 @@ Linear::Linear(unsigned int inputFeatureSize, unsigned int outputFeatureSize,
 
     wrapper.TensorDataMap["bias"] =
         TensorUtil::TensorData(Shape({ outputFeatureSize }), type, device, 1);
-
+    wrapper.GradientDataMap["weight"] = TensorUtil::TensorData(
+        Shape({ inputFeatureSize, outputFeatureSize }), type, device, 1);
+    wrapper.GradientDataMap["bias"] =
+        TensorUtil::TensorData(Shape({ outputFeatureSize }), type, device, 1);
     //! Initialize bias and weight
     m_unitKey = currentModel.RegisterUnitDataWrapper(wrapper);
 }
@@ -44,14 +48,26 @@ Tensor Linear::operator()(const Tensor& tensor) const
     const Device device = xDesc.ForwardData.GetDevice();
     const Shape outputShape({ m_outputs });
 
+    //! Quantized weight is only used for inference, since it has no gradient
+    //! to propagate to the earlier units
+    const bool isQuantized =
+        unitDataWrapper.TensorDataMap["weight"].GetDataType() !=
+        DataType::Float32;
+    if (isQuantized && GradMode::IsEnabled())
+        throw std::runtime_error(
+            "NN::Linear - Quantized unit must be called under NoGradGuard");
+
     const auto yKey = model.RegisterTensorDescriptor(outputShape, type, device,
-                                                     batchSize, true);
+                                                     batchSize, !isQuantized);
     auto& yDesc = model.GetDescriptor(yKey);
 
     Compute::Gemm(yDesc.ForwardData, xDesc.ForwardData,
                   unitDataWrapper.TensorDataMap["weight"],
                   unitDataWrapper.TensorDataMap["bias"]);
 
+    if (!GradMode::IsEnabled())
+        return Tensor(outputShape, yKey);
+
     auto backPropWrapper = std::make_unique<BackProp::LinearBackProp>(
         xDesc.ForwardData, xDesc.BackwardData, yDesc.BackwardData,
         m_unitKey);
@@ -64,4 +80,26 @@ Tensor Linear::operator()(const Tensor& tensor) const
     return Tensor(outputShape, yKey);
 }
 
+void Linear::Quantize() const
+{
+    auto& model = ModelManager::GetCurrentModel();
+    auto unitDataWrapper = model.GetUnitDataWrapper(m_unitKey);
+    QuantizeLinear(unitDataWrapper);
+    model.SetUnitDataWrapper(m_unitKey, unitDataWrapper);
+}
+
+void QuantizeLinear(UnitDataWrapper& unitDataWrapper)
+{
+    auto& weight = unitDataWrapper.TensorDataMap.at("weight");
+    if (weight.GetDataType() == DataType::Int8)
+        return;
+
+    //! Rows of channel-major weight are quantized with their own scale, which
+    //! becomes the scale of each output channel
+    auto channelMajor = weight.CreateTransposeView(-1, false)
+                            .GetContiguous()
+                            .ConvertTo(DataType::Int8);
+    weight = channelMajor.CreateTransposeView(-1, false);
+}
+
 }  // namespace Sapphire::NN
\ No newline at end of file
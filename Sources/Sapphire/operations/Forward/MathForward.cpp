@@ -38,6 +38,9 @@ static Tensor Mul(const Tensor& a, const Tensor& b)
     Compute::Gemm(yDesc.ForwardData, aDesc.ForwardData, bDesc.ForwardData,
                   yDesc.ForwardData);
 
+    if (!GradMode::IsEnabled())
+        return Tensor(outputShape, outputKey);
+
     auto backPropWrapper = std::make_unique<BackProp::MulBackProp>(
         aDesc.ForwardData, aDesc.BackwardData, bDesc.ForwardData,
         bDesc.BackwardData, yDesc.BackwardData);
@@ -76,6 +79,9 @@ static Tensor AddOp(const Tensor& a, const Tensor& b)
 
     Compute::Add(descOut.ForwardData, descA.ForwardData, descB.ForwardData);
 
+    if (!GradMode::IsEnabled())
+        return Tensor(outputShape, descOut.GetKey());
+
     auto backPropWrapper = std::make_unique<BackProp::AddBackProp>(
         descA.BackwardData, descB.BackwardData, descOut.BackwardData);
 
@@ -0,0 +1,211 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/operations/Backward/NormalizationBackward.hpp>
+#include <Sapphire/operations/Forward/Normalization.hpp>
+#include <Sapphire/operations/Unit.hpp>
+#include <Sapphire/tensor/TensorData.hpp>
+#include <cmath>
+#include <initializer_list>
+#include <stdexcept>
+
+namespace Sapphire::NN
+{
+//! Returns unitDataWrapper holding "gamma" initialized to ones and "beta"
+//! initialized to zeros with their gradients
+static UnitDataWrapper CreateAffineParameters(unsigned int size,
+                                              const Device& device)
+{
+    const Shape shape({ size });
+    UnitDataWrapper wrapper;
+    wrapper.TensorDataMap["gamma"] =
+        TensorUtil::TensorData(shape, Type::Dense, device, 1);
+    wrapper.TensorDataMap["beta"] =
+        TensorUtil::TensorData(shape, Type::Dense, device, 1);
+    wrapper.GradientDataMap["gamma"] =
+        TensorUtil::TensorData(shape, Type::Dense, device, 1);
+    wrapper.GradientDataMap["beta"] =
+        TensorUtil::TensorData(shape, Type::Dense, device, 1);
+    Compute::Initialize::Ones(wrapper.TensorDataMap["gamma"]);
+    Compute::Initialize::Zeros(wrapper.TensorDataMap["beta"]);
+    return wrapper;
+}
+
+LayerNorm::LayerNorm(unsigned int normalizedSize, const Device& device,
+                     float epsilon)
+    : m_epsilon(epsilon)
+{
+    auto& currentModel = ModelManager::GetCurrentModel();
+    auto wrapper = CreateAffineParameters(normalizedSize, device);
+    m_unitKey = currentModel.RegisterUnitDataWrapper(wrapper);
+}
+
+Tensor LayerNorm::operator()(const Tensor& tensor) const
+{
+    auto& model = ModelManager::GetCurrentModel();
+    auto unitDataWrapper = model.GetUnitDataWrapper(m_unitKey);
+
+    TensorUtil::TensorDescriptor& xDesc =
+        model.GetDescriptor(tensor.TensorDescriptorKey());
+    const auto& x = xDesc.ForwardData;
+    const Shape outputShape = x.TensorShape;
+
+    const auto yKey = model.RegisterTensorDescriptor(
+        outputShape, x.GetType(), x.GetDevice(), x.BatchSize, true);
+    auto& yDesc = model.GetDescriptor(yKey);
+
+    //! Statistics are only needed for back propagation
+    std::vector<float> mean, rstd;
+    const bool isGradEnabled = GradMode::IsEnabled();
+    Compute::LayerNormForward(yDesc.ForwardData, x,
+                              unitDataWrapper.TensorDataMap["gamma"],
+                              unitDataWrapper.TensorDataMap["beta"], m_epsilon,
+                              isGradEnabled ? &mean : nullptr,
+                              isGradEnabled ? &rstd : nullptr);
+
+    if (!isGradEnabled)
+        return Tensor(outputShape, yKey);
+
+    auto backPropWrapper = std::make_unique<BackProp::LayerNormBackProp>(
+        x, xDesc.BackwardData, yDesc.BackwardData, m_unitKey,
+        std::move(mean), std::move(rstd));
+
+    //! Append operand history to the inputDescriptor
+    xDesc.AppendOperandHistory(yKey);
+    //! Append output history to the output descriptor
+    yDesc.AppendOutputHistory(std::move(backPropWrapper), true);
+
+    return Tensor(outputShape, yKey);
+}
+
+BatchNorm::BatchNorm(unsigned int channels, const Device& device,
+                     float momentum, float epsilon)
+    : m_momentum(momentum), m_epsilon(epsilon)
+{
+    auto& currentModel = ModelManager::GetCurrentModel();
+    auto wrapper = CreateAffineParameters(channels, device);
+    //! Running statistics are not parameters, so they have no gradients
+    wrapper.TensorDataMap["runningMean"] =
+        TensorUtil::TensorData(Shape({ channels }), Type::Dense, device, 1);
+    wrapper.TensorDataMap["runningVar"] =
+        TensorUtil::TensorData(Shape({ channels }), Type::Dense, device, 1);
+    Compute::Initialize::Zeros(wrapper.TensorDataMap["runningMean"]);
+    Compute::Initialize::Ones(wrapper.TensorDataMap["runningVar"]);
+    wrapper.IntegerLiterals["folded"] = 0;
+
+    m_unitKey = currentModel.RegisterUnitDataWrapper(wrapper);
+}
+
+Tensor BatchNorm::operator()(const Tensor& tensor) const
+{
+    auto& model = ModelManager::GetCurrentModel();
+    auto unitDataWrapper = model.GetUnitDataWrapper(m_unitKey);
+
+    //! Folded normalization is performed by the preceding linear
+    if (unitDataWrapper.IntegerLiterals["folded"])
+        return tensor;
+
+    TensorUtil::TensorDescriptor& xDesc =
+        model.GetDescriptor(tensor.TensorDescriptorKey());
+    const auto& x = xDesc.ForwardData;
+    const Shape outputShape = x.TensorShape;
+
+    //! Gradient through the running statistics is not supported
+    const bool isTraining = TrainingMode::IsEnabled();
+    const bool isGradEnabled = GradMode::IsEnabled();
+    if (!isTraining && isGradEnabled)
+        throw std::runtime_error(
+            "NN::BatchNorm - Evaluation must be called under NoGradGuard");
+
+    const auto yKey = model.RegisterTensorDescriptor(
+        outputShape, x.GetType(), x.GetDevice(), x.BatchSize, true);
+    auto& yDesc = model.GetDescriptor(yKey);
+
+    //! Running statistics are kept by momentum of 0 while recomputing
+    std::vector<float> mean, rstd;
+    Compute::BatchNormForward(
+        yDesc.ForwardData, x, unitDataWrapper.TensorDataMap["gamma"],
+        unitDataWrapper.TensorDataMap["beta"],
+        unitDataWrapper.TensorDataMap["runningMean"],
+        unitDataWrapper.TensorDataMap["runningVar"],
+        RecomputeGuard::IsRecomputing() ? 0.0f : m_momentum, m_epsilon,
+        isTraining, isGradEnabled ? &mean : nullptr,
+        isGradEnabled ? &rstd : nullptr);
+
+    if (!isGradEnabled)
+        return Tensor(outputShape, yKey);
+
+    auto backPropWrapper = std::make_unique<BackProp::BatchNormBackProp>(
+        x, xDesc.BackwardData, yDesc.BackwardData, m_unitKey,
+        std::move(mean), std::move(rstd));
+
+    //! Append operand history to the inputDescriptor
+    xDesc.AppendOperandHistory(yKey);
+    //! Append output history to the output descriptor
+    yDesc.AppendOutputHistory(std::move(backPropWrapper), true);
+
+    return Tensor(outputShape, yKey);
+}
+
+void FoldBatchNorm(const Linear& linear, const BatchNorm& batchNorm)
+{
+    auto& model = ModelManager::GetCurrentModel();
+    auto linearWrapper = model.GetUnitDataWrapper(linear.GetUnitKey());
+    auto normWrapper = model.GetUnitDataWrapper(batchNorm.GetUnitKey());
+    if (normWrapper.IntegerLiterals["folded"])
+        throw std::runtime_error("NN::FoldBatchNorm - Already folded");
+
+    auto& weight = linearWrapper.TensorDataMap["weight"];
+    auto& bias = linearWrapper.TensorDataMap["bias"];
+    const auto& gamma = normWrapper.TensorDataMap["gamma"];
+    const auto& beta = normWrapper.TensorDataMap["beta"];
+    const auto& runningMean = normWrapper.TensorDataMap["runningMean"];
+    const auto& runningVar = normWrapper.TensorDataMap["runningVar"];
+
+    const unsigned int outputs = weight.Cols();
+    if (gamma.TensorShape != Shape({ outputs }))
+        throw std::invalid_argument(
+            "NN::FoldBatchNorm - Channels do not match outputs of the linear");
+    for (const auto* tensorData :
+         std::initializer_list<const TensorUtil::TensorData*>{
+             &weight, &bias, &gamma, &beta, &runningMean, &runningVar })
+        if (tensorData->GetDevice().Type() != DeviceType::HOST ||
+            tensorData->GetType() != Type::Dense ||
+            tensorData->GetDataType() != DataType::Float32)
+            throw std::runtime_error(
+                "NN::FoldBatchNorm - Only dense Float32 host parameters are "
+                "supported");
+
+    //! y = (xW + b - mean) * s + beta where s = gamma / sqrt(var + epsilon)
+    //! becomes y = x(W * s) + ((b - mean) * s + beta)
+    std::vector<float> scale(outputs);
+    for (unsigned int col = 0; col < outputs; ++col)
+        scale[col] = gamma.DenseMatHost[col] /
+                     std::sqrt(runningVar.DenseMatHost[col] +
+                               batchNorm.GetEpsilon());
+
+    weight.CopyOnWrite();
+    bias.CopyOnWrite();
+    for (unsigned int row = 0; row < weight.Rows(); ++row)
+    {
+        float* weightRow = weight.DenseMatHost + row * weight.PaddedHostColSize;
+        for (unsigned int col = 0; col < outputs; ++col)
+            weightRow[col] *= scale[col];
+    }
+    for (unsigned int col = 0; col < outputs; ++col)
+        bias.DenseMatHost[col] =
+            (bias.DenseMatHost[col] - runningMean.DenseMatHost[col]) *
+                scale[col] +
+            beta.DenseMatHost[col];
+
+    normWrapper.IntegerLiterals["folded"] = 1;
+    model.SetUnitDataWrapper(linear.GetUnitKey(), linearWrapper);
+    model.SetUnitDataWrapper(batchNorm.GetUnitKey(), normWrapper);
+}
+}  // namespace Sapphire::NN
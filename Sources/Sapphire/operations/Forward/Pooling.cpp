@@ -0,0 +1,155 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/operations/Backward/PoolingBackward.hpp>
+#include <Sapphire/operations/Forward/Pooling.hpp>
+#include <stdexcept>
+
+namespace Sapphire::NN
+{
+//! Returns output shape (C, P, Q) of pooling (C, H, W) input
+static Shape GetPooledShape(const Shape& shapeInput,
+                            std::pair<int, int> windowSize,
+                            std::pair<int, int> stride,
+                            std::pair<int, int> padding)
+{
+    if (shapeInput.Dim() != 3)
+        throw std::invalid_argument(
+            "NN::Pool2D - Input must have shape (C, H, W)");
+
+    const auto paddedHeight =
+        static_cast<int>(shapeInput.At(1)) + 2 * padding.first;
+    const auto paddedWidth =
+        static_cast<int>(shapeInput.At(2)) + 2 * padding.second;
+    if (stride.first < 1 || stride.second < 1 ||
+        paddedHeight < windowSize.first || paddedWidth < windowSize.second)
+        throw std::invalid_argument(
+            "NN::Pool2D - Window is larger than the input or stride is not "
+            "positive");
+
+    return Shape({ shapeInput.At(0),
+                   static_cast<unsigned int>(
+                       (paddedHeight - windowSize.first) / stride.first + 1),
+                   static_cast<unsigned int>(
+                       (paddedWidth - windowSize.second) / stride.second +
+                       1) });
+}
+
+MaxPool2D::MaxPool2D(std::pair<int, int> windowSize,
+                     std::pair<int, int> stride, std::pair<int, int> padding)
+    : m_windowSize(windowSize), m_stride(stride), m_padding(padding)
+{
+}
+
+Tensor MaxPool2D::operator()(const Tensor& tensor) const
+{
+    auto& model = ModelManager::GetCurrentModel();
+    TensorUtil::TensorDescriptor& xDesc =
+        model.GetDescriptor(tensor.TensorDescriptorKey());
+    const auto& x = xDesc.ForwardData;
+    const Shape outputShape =
+        GetPooledShape(x.TensorShape, m_windowSize, m_stride, m_padding);
+
+    const auto yKey = model.RegisterTensorDescriptor(
+        outputShape, x.GetType(), x.GetDevice(), x.BatchSize, true);
+    auto& yDesc = model.GetDescriptor(yKey);
+
+    //! Indices are only needed for back propagation
+    std::vector<std::uint8_t> indices;
+    const bool isGradEnabled = GradMode::IsEnabled();
+    Compute::MaxPool2DForward(yDesc.ForwardData, x, m_windowSize.first,
+                              m_windowSize.second, m_stride.first,
+                              m_stride.second, m_padding.first,
+                              m_padding.second,
+                              isGradEnabled ? &indices : nullptr);
+
+    if (!isGradEnabled)
+        return Tensor(outputShape, yKey);
+
+    auto backPropWrapper = std::make_unique<BackProp::MaxPool2DBackProp>(
+        xDesc.BackwardData, yDesc.BackwardData, std::move(indices),
+        m_windowSize, m_stride, m_padding);
+
+    //! Append operand history to the inputDescriptor
+    xDesc.AppendOperandHistory(yKey);
+    //! Append output history to the output descriptor
+    yDesc.AppendOutputHistory(std::move(backPropWrapper), false);
+
+    return Tensor(outputShape, yKey);
+}
+
+AvgPool2D::AvgPool2D(std::pair<int, int> windowSize,
+                     std::pair<int, int> stride, std::pair<int, int> padding)
+    : m_windowSize(windowSize), m_stride(stride), m_padding(padding)
+{
+}
+
+Tensor AvgPool2D::operator()(const Tensor& tensor) const
+{
+    auto& model = ModelManager::GetCurrentModel();
+    TensorUtil::TensorDescriptor& xDesc =
+        model.GetDescriptor(tensor.TensorDescriptorKey());
+    const auto& x = xDesc.ForwardData;
+    const Shape outputShape =
+        GetPooledShape(x.TensorShape, m_windowSize, m_stride, m_padding);
+
+    const auto yKey = model.RegisterTensorDescriptor(
+        outputShape, x.GetType(), x.GetDevice(), x.BatchSize, true);
+    auto& yDesc = model.GetDescriptor(yKey);
+
+    Compute::AvgPool2DForward(yDesc.ForwardData, x, m_windowSize.first,
+                              m_windowSize.second, m_stride.first,
+                              m_stride.second, m_padding.first,
+                              m_padding.second);
+
+    if (!GradMode::IsEnabled())
+        return Tensor(outputShape, yKey);
+
+    auto backPropWrapper = std::make_unique<BackProp::AvgPool2DBackProp>(
+        xDesc.BackwardData, yDesc.BackwardData, m_windowSize, m_stride,
+        m_padding);
+
+    //! Append operand history to the inputDescriptor
+    xDesc.AppendOperandHistory(yKey);
+    //! Append output history to the output descriptor
+    yDesc.AppendOutputHistory(std::move(backPropWrapper), false);
+
+    return Tensor(outputShape, yKey);
+}
+
+Tensor GlobalAvgPool::operator()(const Tensor& tensor) const
+{
+    auto& model = ModelManager::GetCurrentModel();
+    TensorUtil::TensorDescriptor& xDesc =
+        model.GetDescriptor(tensor.TensorDescriptorKey());
+    const auto& x = xDesc.ForwardData;
+    if (x.TensorShape.Dim() != 3)
+        throw std::invalid_argument(
+            "NN::GlobalAvgPool - Input must have shape (C, H, W)");
+    const Shape outputShape({ x.TensorShape.At(0) });
+
+    const auto yKey = model.RegisterTensorDescriptor(
+        outputShape, x.GetType(), x.GetDevice(), x.BatchSize, true);
+    auto& yDesc = model.GetDescriptor(yKey);
+
+    Compute::GlobalAvgPoolForward(yDesc.ForwardData, x);
+
+    if (!GradMode::IsEnabled())
+        return Tensor(outputShape, yKey);
+
+    auto backPropWrapper = std::make_unique<BackProp::GlobalAvgPoolBackProp>(
+        xDesc.BackwardData, yDesc.BackwardData);
+
+    //! Append operand history to the inputDescriptor
+    xDesc.AppendOperandHistory(yKey);
+    //! Append output history to the output descriptor
+    yDesc.AppendOutputHistory(std::move(backPropWrapper), false);
+
+    return Tensor(outputShape, yKey);
+}
+}  // namespace Sapphire::NN
@@ -0,0 +1,78 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/operations/Backward/CrossEntropyBackward.hpp>
+#include <Sapphire/operations/Loss/CrossEntropy.hpp>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace Sapphire::NN::Loss
+{
+//! Returns class indices stored in the host data of tensorData
+static std::vector<std::size_t> GetLabels(
+    const TensorUtil::TensorData& tensorData)
+{
+    if (tensorData.GetDevice().Type() != DeviceType::HOST)
+        throw std::runtime_error(
+            "NN::Loss::CrossEntropy - Labels must be on the host");
+
+    const auto cols = tensorData.Cols();
+    const auto rows = tensorData.TensorShape.Size() / cols *
+                      static_cast<std::size_t>(tensorData.BatchSize);
+    std::vector<std::size_t> labels;
+    labels.reserve(rows * cols);
+    for (std::size_t row = 0; row < rows; ++row)
+        for (unsigned int col = 0; col < cols; ++col)
+        {
+            const float value =
+                tensorData.DenseMatHost[row * tensorData.PaddedHostColSize +
+                                        col];
+            if (value < 0.0f || value != std::floor(value))
+                throw std::invalid_argument(
+                    "NN::Loss::CrossEntropy - Labels must be non-negative "
+                    "integers");
+            labels.emplace_back(static_cast<std::size_t>(value));
+        }
+    return labels;
+}
+
+Tensor CrossEntropy(const Tensor& x, const Tensor& label)
+{
+    Model& model = ModelManager::GetCurrentModel();
+
+    auto& xDesc = model.GetDescriptor(x.TensorDescriptorKey());
+    auto& labelDesc = model.GetDescriptor(label.TensorDescriptorKey());
+    auto labels = GetLabels(labelDesc.ForwardData.GetContiguous());
+
+    const auto yKey = model.RegisterTensorDescriptor(
+        Shape({ 1 }), xDesc.ForwardData.GetType(),
+        xDesc.ForwardData.GetDevice(), 1, true);
+    auto& yDesc = model.GetDescriptor(yKey);
+
+    //! Log-sum-exp of each row is only needed for back propagation
+    std::vector<float> logSumExp;
+    const bool isGradEnabled = GradMode::IsEnabled();
+    Compute::CrossEntropyForward(yDesc.ForwardData, xDesc.ForwardData, labels,
+                                 isGradEnabled ? &logSumExp : nullptr);
+
+    if (!isGradEnabled)
+        return Tensor(Shape({ 1 }), yKey);
+
+    auto backPropWrapper = std::make_unique<BackProp::CrossEntropyBackProp>(
+        xDesc.ForwardData, xDesc.BackwardData, yDesc.BackwardData,
+        std::move(labels), std::move(logSumExp));
+
+    //! Labels receive no gradient, so only x gets the operand history
+    xDesc.AppendOperandHistory(yKey);
+    yDesc.AppendOutputHistory(std::move(backPropWrapper), false);
+
+    return Tensor(Shape({ 1 }), yKey);
+}
+}  // namespace Sapphire::NN::Loss
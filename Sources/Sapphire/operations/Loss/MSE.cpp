@@ -34,6 +34,9 @@ static Tensor MSE(const Tensor& x, const Tensor& label)
 
     Compute::Mean(yDesc.ForwardData, temp);
 
+    if (!GradMode::IsEnabled())
+        return Tensor(Shape({ 1 }), yDescKey);
+
     auto backPropWrapper = std::make_unique<BackProp::MSEBackward>(
         xDesc.ForwardData, xDesc.BackwardData, labelDesc.ForwardData,
         yDesc.BackwardData);
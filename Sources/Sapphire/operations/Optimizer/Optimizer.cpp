@@ -0,0 +1,196 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/operations/Optimizer/Optimizer.hpp>
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+
+namespace Sapphire::NN
+{
+Optimizer::Optimizer(float learningRate) : m_learningRate(learningRate)
+{
+}
+
+void Optimizer::Step(bool zeroGrad)
+{
+    const auto& model = ModelManager::GetCurrentModel();
+    //! Flattened parameters are updated as a single buffer
+    const auto parameters = model.GetParameterBuffers();
+
+    std::vector<Compute::Dense::Naive::OptimizerParameter> buffers;
+    buffers.reserve(parameters.size());
+    std::set<ParameterKey> keys;
+    for (const auto& parameter : parameters)
+    {
+        const auto& data = parameter.Data;
+        if (data.GetDevice().Type() != DeviceType::HOST ||
+            data.GetType() != Type::Dense || !data.IsContiguous())
+            throw std::invalid_argument(
+                "Optimizer::Step - Only contiguous dense parameters on the "
+                "host are supported");
+
+        const ParameterKey key(parameter.UnitKey, parameter.Name);
+        const bool isNew = m_states.find(key) == m_states.end();
+        auto& states = m_getStates(key, data);
+        keys.emplace(key);
+        //! States kept while the parameters were separate are carried over
+        //! to the flat buffer
+        if (isNew && parameter.UnitKey < 0)
+            m_packStates(model.GetParameters(), data, states);
+
+        Compute::Dense::Naive::OptimizerParameter buffer;
+        buffer.Data = data.DenseMatHost;
+        buffer.Gradient = parameter.Gradient.DenseMatHost;
+        buffer.FirstState = states.empty() ? nullptr : states[0].DenseMatHost;
+        buffer.SecondState =
+            states.size() < 2 ? nullptr : states[1].DenseMatHost;
+        buffer.Size = data.DenseTotalLengthHost;
+        buffers.emplace_back(buffer);
+
+        //! Tensors saved from the parameter are no longer valid
+        data.BumpVersion();
+        if (zeroGrad)
+            parameter.Gradient.BumpVersion();
+    }
+
+    //! Tables are updated only on the rows having gradient. States of the
+    //! other rows are left as they are until their rows are used again
+    const auto rowParameters = model.GetRowParameters();
+    for (const auto& parameter : rowParameters)
+    {
+        const auto& data = parameter.Data;
+        const auto& gradient = *parameter.Gradient;
+        if (data.GetDevice().Type() != DeviceType::HOST ||
+            data.GetType() != Type::Dense || !data.IsContiguous())
+            throw std::invalid_argument(
+                "Optimizer::Step - Only contiguous dense parameters on the "
+                "host are supported");
+
+        const ParameterKey key(parameter.UnitKey, parameter.Name);
+        const auto& states = m_getStates(key, data);
+        keys.emplace(key);
+
+        for (std::size_t pos = 0; pos < gradient.Indices.size(); ++pos)
+        {
+            const auto offset =
+                gradient.Indices[pos] * data.PaddedHostColSize;
+            Compute::Dense::Naive::OptimizerParameter buffer;
+            buffer.Data = data.DenseMatHost + offset;
+            buffer.Gradient = parameter.Gradient->Rows.data() +
+                              pos * gradient.RowSize;
+            buffer.FirstState =
+                states.empty() ? nullptr : states[0].DenseMatHost + offset;
+            buffer.SecondState =
+                states.size() < 2 ? nullptr : states[1].DenseMatHost + offset;
+            buffer.Size = gradient.RowSize;
+            buffers.emplace_back(buffer);
+        }
+        data.BumpVersion();
+    }
+
+    for (auto itr = m_states.begin(); itr != m_states.end();)
+        itr = keys.count(itr->first) ? std::next(itr) : m_states.erase(itr);
+
+    ++m_stepCount;
+    m_update(buffers, zeroGrad);
+
+    if (zeroGrad)
+        for (const auto& parameter : rowParameters)
+            parameter.Gradient->Clear();
+}
+
+std::vector<TensorUtil::TensorData>& Optimizer::m_getStates(
+    const ParameterKey& key, const TensorUtil::TensorData& data)
+{
+    auto& states = m_states[key];
+    if (!states.empty() &&
+        states.front().DenseTotalLengthHost != data.DenseTotalLengthHost)
+        states.clear();
+    while (states.size() < m_numStates())
+        states.emplace_back(data.TensorShape, Type::Dense, data.GetDevice(),
+                            data.BatchSize);
+    return states;
+}
+
+void Optimizer::m_packStates(
+    const std::vector<Parameter>& parameters,
+    const TensorUtil::TensorData& flatData,
+    std::vector<TensorUtil::TensorData>& flatStates) const
+{
+    for (const auto& parameter : parameters)
+    {
+        const auto& data = parameter.Data;
+        const auto itr =
+            m_states.find(ParameterKey(parameter.UnitKey, parameter.Name));
+        if (itr == m_states.end() ||
+            data.GetBufferBase() != flatData.GetBufferBase())
+            continue;
+
+        const auto offset = data.DenseMatHost - flatData.DenseMatHost;
+        const auto& states = itr->second;
+        const auto numStates = std::min(states.size(), flatStates.size());
+        for (std::size_t idx = 0; idx < numStates; ++idx)
+            if (states[idx].DenseTotalLengthHost == data.DenseTotalLengthHost)
+                std::copy_n(states[idx].DenseMatHost, data.DenseTotalLengthHost,
+                            flatStates[idx].DenseMatHost + offset);
+    }
+}
+
+SGD::SGD(float learningRate, float weightDecay)
+    : Optimizer(learningRate), m_weightDecay(weightDecay)
+{
+}
+
+void SGD::m_update(
+    const std::vector<Compute::Dense::Naive::OptimizerParameter>& parameters,
+    bool zeroGrad)
+{
+    Compute::Dense::Naive::SgdUpdate(parameters.data(), parameters.size(),
+                                     m_learningRate, m_weightDecay, zeroGrad);
+}
+
+Momentum::Momentum(float learningRate, float momentum, float weightDecay)
+    : Optimizer(learningRate), m_momentum(momentum), m_weightDecay(weightDecay)
+{
+}
+
+void Momentum::m_update(
+    const std::vector<Compute::Dense::Naive::OptimizerParameter>& parameters,
+    bool zeroGrad)
+{
+    Compute::Dense::Naive::MomentumUpdate(parameters.data(), parameters.size(),
+                                          m_learningRate, m_momentum,
+                                          m_weightDecay, zeroGrad);
+}
+
+Adam::Adam(float learningRate, float beta1, float beta2, float epsilon,
+           float weightDecay)
+    : Optimizer(learningRate),
+      m_beta1(beta1),
+      m_beta2(beta2),
+      m_epsilon(epsilon),
+      m_weightDecay(weightDecay)
+{
+}
+
+void Adam::m_update(
+    const std::vector<Compute::Dense::Naive::OptimizerParameter>& parameters,
+    bool zeroGrad)
+{
+    Compute::Dense::Naive::AdamUpdate(
+        parameters.data(), parameters.size(), m_learningRate, m_beta1, m_beta2,
+        m_epsilon, m_weightDecay, m_decoupled, m_stepCount, zeroGrad);
+}
+
+AdamW::AdamW(float learningRate, float beta1, float beta2, float epsilon,
+             float weightDecay)
+    : Adam(learningRate, beta1, beta2, epsilon, weightDecay)
+{
+    m_decoupled = true;
+}
+}  // namespace Sapphire::NN
@@ -6,10 +6,18 @@
 
 #include <immintrin.h>
 #include <Sapphire/compute/cudaUtil/Memory.hpp>
+#include <Sapphire/compute/dense/cuda/Basic.cuh>
+#include <Sapphire/compute/dense/cuda/Initialize.cuh>
+#include <Sapphire/compute/dense/naive/NaiveBasic.hpp>
+#include <Sapphire/compute/dense/naive/NaiveHalf.hpp>
+#include <Sapphire/compute/dense/naive/NaiveInt8.hpp>
+#include <Sapphire/compute/dense/naive/NaiveTranspose.hpp>
 #include <Sapphire/tensor/TensorData.hpp>
 #include <Sapphire/util/MemoryManager.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
 #include <algorithm>
 #include <cstring>
+#include <memory>
 #include <stdexcept>
 
 namespace Sapphire::TensorUtil
@@ -18,6 +26,7 @@ TensorData::TensorData(Shape shape, Type type, Device device,
                        unsigned int batchSize)
     : BatchSize(batchSize),
       TensorShape(std::move(shape)),
+      m_version(std::make_shared<std::atomic<std::uint64_t>>(0)),
       m_type(type),
       m_device(std::move(device))
 {
@@ -32,6 +41,7 @@ TensorData::TensorData(Shape shape, Type type, Device device,
                        unsigned int batchSize, int parentDescKey)
     : BatchSize(batchSize),
       TensorShape(std::move(shape)),
+      m_version(std::make_shared<std::atomic<std::uint64_t>>(0)),
       m_parentDescKey(parentDescKey),
       m_type(type),
       m_device(std::move(device))
@@ -43,6 +53,30 @@ TensorData::TensorData(Shape shape, Type type, Device device,
     m_allocateHost(batchSize);
 }
 
+TensorData::TensorData(Shape shape, Type type, Device device,
+                       unsigned int batchSize, int parentDescKey,
+                       DataType dataType)
+    : BatchSize(batchSize),
+      TensorShape(std::move(shape)),
+      m_version(std::make_shared<std::atomic<std::uint64_t>>(0)),
+      m_parentDescKey(parentDescKey),
+      m_type(type),
+      m_dataType(dataType),
+      m_device(std::move(device))
+{
+    if (m_dataType != DataType::Float32 &&
+        (m_type == Type::Sparse || m_device.Type() == DeviceType::CUDA))
+        throw std::invalid_argument(
+            "TensorData - Data types other than Float32 are only available "
+            "for dense tensors on the host");
+
+    if (m_device.Type() == DeviceType::CUDA)
+    {
+        m_allocateCuda(batchSize);
+    }
+    m_allocateHost(batchSize);
+}
+
 TensorData::TensorData(const TensorData& tensorData)
     : DenseTotalLengthHost(tensorData.DenseTotalLengthHost),
       DenseTotalLengthCuda(tensorData.DenseTotalLengthCuda),
@@ -54,17 +88,29 @@ TensorData::TensorData(const TensorData& tensorData)
       SparseMatHost(tensorData.SparseMatHost),
       SparseMatCuda(tensorData.SparseMatCuda),
       TensorShape(tensorData.TensorShape),
+      m_hostOffset(tensorData.m_hostOffset),
+      m_cudaOffset(tensorData.m_cudaOffset),
+      m_copyOnWrite(tensorData.m_copyOnWrite),
+      m_viewGroup(tensorData.m_viewGroup),
+      m_viewToken(tensorData.m_viewToken),
+      m_strides(tensorData.m_strides),
+      m_permutation(tensorData.m_permutation),
+      m_contiguousCache(std::atomic_load(&tensorData.m_contiguousCache)),
+      m_scale(tensorData.m_scale),
+      m_version(tensorData.m_version),
+      m_parentDescKey(tensorData.m_parentDescKey),
       m_type(tensorData.m_type),
+      m_dataType(tensorData.m_dataType),
       m_device(tensorData.m_device)
 {
     if (DenseMatHost)
     {
         Util::MemoryManager::AddReferenceHost(
-            static_cast<void*>(DenseMatHost));
+            static_cast<void*>(m_hostBase()));
     }
     if (DenseMatCuda)
     {
-        Util::MemoryManager::AddReferenceCuda(static_cast<void*>(DenseMatCuda),
+        Util::MemoryManager::AddReferenceCuda(static_cast<void*>(m_cudaBase()),
                                               m_device.GetID());
     }
 }
@@ -80,15 +126,30 @@ TensorData::TensorData(TensorData&& tensorData) noexcept
       SparseMatHost(tensorData.SparseMatHost),
       SparseMatCuda(tensorData.SparseMatCuda),
       TensorShape(std::move(tensorData.TensorShape)),
+      m_hostOffset(tensorData.m_hostOffset),
+      m_cudaOffset(tensorData.m_cudaOffset),
+      m_copyOnWrite(tensorData.m_copyOnWrite),
+      m_viewGroup(std::move(tensorData.m_viewGroup)),
+      m_viewToken(std::move(tensorData.m_viewToken)),
+      m_strides(std::move(tensorData.m_strides)),
+      m_permutation(std::move(tensorData.m_permutation)),
+      m_contiguousCache(std::move(tensorData.m_contiguousCache)),
+      m_scale(std::move(tensorData.m_scale)),
+      m_version(std::move(tensorData.m_version)),
+      m_parentDescKey(tensorData.m_parentDescKey),
       m_type(tensorData.m_type),
+      m_dataType(tensorData.m_dataType),
       m_device(std::move(tensorData.m_device))
 {
     tensorData.DenseTotalLengthHost = 0;
+    tensorData.DenseTotalLengthCuda = 0;
     tensorData.SparseTotalLength = 0;
     tensorData.DenseMatHost = nullptr;
     tensorData.DenseMatCuda = nullptr;
     tensorData.SparseMatHost = nullptr;
     tensorData.SparseMatCuda = nullptr;
+    tensorData.m_hostOffset = 0;
+    tensorData.m_cudaOffset = 0;
 }
 
 TensorData& TensorData::operator=(const TensorData& tensorData)
@@ -96,6 +157,24 @@ TensorData& TensorData::operator=(const TensorData& tensorData)
     if (this == &tensorData)
         return *this;
 
+    //! References to the new buffer must be added before releasing the
+    //! current buffer since both of them can point to the same buffer
+    if (tensorData.DenseMatHost)
+    {
+        Util::MemoryManager::AddReferenceHost(
+            static_cast<void*>(tensorData.m_hostBase()));
+    }
+    if (tensorData.DenseMatCuda)
+    {
+        Util::MemoryManager::AddReferenceCuda(
+            static_cast<void*>(tensorData.m_cudaBase()),
+            tensorData.m_device.GetID());
+    }
+
+    m_freeHost();
+    if (m_device.Type() == DeviceType::CUDA)
+        m_freeCuda();
+
     DenseTotalLengthHost = tensorData.DenseTotalLengthHost;
     DenseTotalLengthCuda = tensorData.DenseTotalLengthCuda;
     SparseTotalLength = tensorData.SparseTotalLength;
@@ -106,26 +185,35 @@ TensorData& TensorData::operator=(const TensorData& tensorData)
     SparseMatHost = tensorData.SparseMatHost;
     SparseMatCuda = tensorData.SparseMatCuda;
     TensorShape = tensorData.TensorShape;
+    m_hostOffset = tensorData.m_hostOffset;
+    m_cudaOffset = tensorData.m_cudaOffset;
+    m_copyOnWrite = tensorData.m_copyOnWrite;
+    m_viewGroup = tensorData.m_viewGroup;
+    m_viewToken = tensorData.m_viewToken;
+    m_strides = tensorData.m_strides;
+    m_permutation = tensorData.m_permutation;
+    m_contiguousCache = std::atomic_load(&tensorData.m_contiguousCache);
+    m_scale = tensorData.m_scale;
+    m_version = tensorData.m_version;
+    m_parentDescKey = tensorData.m_parentDescKey;
     m_type = tensorData.m_type;
+    m_dataType = tensorData.m_dataType;
     m_device = tensorData.m_device;
 
-    if (DenseMatHost)
-    {
-        Util::MemoryManager::AddReferenceHost(
-            static_cast<void*>(DenseMatHost));
-    }
-    if (DenseMatCuda)
-    {
-        Util::MemoryManager::AddReferenceCuda(static_cast<void*>(DenseMatCuda),
-                                              m_device.GetID());
-    }
-
     return *this;
 }
 
 TensorData& TensorData::operator=(TensorData&& tensorData) noexcept
 {
+    if (this == &tensorData)
+        return *this;
+
+    m_freeHost();
+    if (m_device.Type() == DeviceType::CUDA)
+        m_freeCuda();
+
     DenseTotalLengthHost = tensorData.DenseTotalLengthHost;
+    DenseTotalLengthCuda = tensorData.DenseTotalLengthCuda;
     SparseTotalLength = tensorData.SparseTotalLength;
     PaddedHostColSize = tensorData.PaddedHostColSize;
     BatchSize = tensorData.BatchSize;
@@ -134,26 +222,49 @@ TensorData& TensorData::operator=(TensorData&& tensorData) noexcept
     SparseMatHost = tensorData.SparseMatHost;
     SparseMatCuda = tensorData.SparseMatCuda;
     TensorShape = std::move(tensorData.TensorShape);
+    m_hostOffset = tensorData.m_hostOffset;
+    m_cudaOffset = tensorData.m_cudaOffset;
+    m_copyOnWrite = tensorData.m_copyOnWrite;
+    m_viewGroup = std::move(tensorData.m_viewGroup);
+    m_viewToken = std::move(tensorData.m_viewToken);
+    m_strides = std::move(tensorData.m_strides);
+    m_permutation = std::move(tensorData.m_permutation);
+    m_contiguousCache = std::move(tensorData.m_contiguousCache);
+    m_scale = std::move(tensorData.m_scale);
+    m_version = std::move(tensorData.m_version);
+    m_parentDescKey = tensorData.m_parentDescKey;
     m_type = tensorData.m_type;
+    m_dataType = tensorData.m_dataType;
     m_device = std::move(tensorData.m_device);
 
     tensorData.DenseTotalLengthHost = 0;
+    tensorData.DenseTotalLengthCuda = 0;
     tensorData.SparseTotalLength = 0;
     tensorData.DenseMatHost = nullptr;
     tensorData.DenseMatCuda = nullptr;
     tensorData.SparseMatHost = nullptr;
     tensorData.SparseMatCuda = nullptr;
+    tensorData.m_hostOffset = 0;
+    tensorData.m_cudaOffset = 0;
 
     return *this;
 }
 
 TensorData::~TensorData()
 {
-    m_freeHost();
+    //! Destructor must not throw. Memory pools may have been destroyed already
+    //! if the tensor is destroyed during the static destruction
+    try
+    {
+        m_freeHost();
 
-    if (m_device.Type() == DeviceType::CUDA)
+        if (m_device.Type() == DeviceType::CUDA)
+        {
+            m_freeCuda();
+        }
+    }
+    catch (const std::exception&)
     {
-        m_freeCuda();
     }
 }
 
@@ -169,7 +280,8 @@ void TensorData::CopyTensorData(TensorData dest, const TensorData& src)
         throw std::invalid_argument("Shape mismatch while copying tensorData");
     }
 
-    if (dest.GetType() != src.GetType())
+    if (dest.GetType() != src.GetType() ||
+        dest.GetDataType() != src.GetDataType())
     {
         throw std::invalid_argument("Type mismatch while copying tensorData");
     }
@@ -188,7 +300,7 @@ void TensorData::CopyTensorData(TensorData dest, const TensorData& src)
         else
         {
             std::memcpy(dest.DenseMatHost, src.DenseMatHost,
-                        src.DenseTotalLengthHost * sizeof(float));
+                        src.DenseTotalLengthHost * src.m_elementByteSize());
             dest.DenseTotalLengthHost = src.DenseTotalLengthHost;
         }
     }
@@ -214,12 +326,420 @@ void TensorData::CopyTensorData(TensorData dest, const TensorData& src)
 TensorData TensorData::CreateCopy() const
 {
     TensorData tensorData(TensorShape, GetType(), GetDevice(), BatchSize,
-                          m_parentDescKey);
+                          m_parentDescKey, m_dataType);
 
     DeepCopy(tensorData, *this);
     return tensorData;
 }
 
+TensorData TensorData::ConvertTo(DataType dataType) const
+{
+    if (m_device.Type() != DeviceType::HOST || m_type == Type::Sparse)
+        throw std::invalid_argument(
+            "ConvertTo - Only dense tensors on the host can be converted");
+
+    if (dataType == m_dataType)
+        return CreateCopy();
+
+    //! Conversion between types other than float goes through float
+    if (m_dataType != DataType::Float32 && dataType != DataType::Float32)
+        return ConvertTo(DataType::Float32).ConvertTo(dataType);
+
+    const TensorData src = GetContiguous();
+    TensorData tensorData(TensorShape, m_type, m_device, BatchSize,
+                          m_parentDescKey, dataType);
+    const auto rows =
+        static_cast<unsigned int>(DenseTotalLengthHost / PaddedHostColSize);
+
+    //! Padding is converted as well, so layout of the rows is preserved
+    if (dataType == DataType::Int8)
+    {
+        tensorData.m_scale = std::make_shared<TensorData>(
+            Shape({ rows }), Type::Dense, m_device, 1);
+        Compute::Dense::Naive::QuantizeRows(
+            tensorData.Int8MatHost(), tensorData.ScaleHost(), src.DenseMatHost,
+            rows, Cols(), PaddedHostColSize);
+    }
+    else if (m_dataType == DataType::Int8)
+        Compute::Dense::Naive::DequantizeRows(
+            tensorData.DenseMatHost, src.Int8MatHost(), src.ScaleHost(), rows,
+            Cols(), PaddedHostColSize);
+    else if (dataType == DataType::Float32)
+        Compute::Dense::Naive::ConvertToFloat(tensorData.DenseMatHost,
+                                              src.HalfMatHost(),
+                                              DenseTotalLengthHost, m_dataType);
+    else
+        Compute::Dense::Naive::ConvertFromFloat(tensorData.HalfMatHost(),
+                                                src.DenseMatHost,
+                                                DenseTotalLengthHost, dataType);
+
+    return tensorData;
+}
+
+TensorData TensorData::CreateView(Shape shape, unsigned int batchSize,
+                                  unsigned long hostOffset,
+                                  unsigned long cudaOffset, int parentDescKey,
+                                  bool copyOnWrite)
+{
+    if (m_type == Type::Sparse)
+        throw std::runtime_error("CreateView - Sparse not implemented");
+    if (m_dataType != DataType::Float32)
+        throw std::runtime_error(
+            "CreateView - View of 16 bit data type not implemented");
+    if (!IsContiguous())
+        throw std::invalid_argument(
+            "CreateView - Cannot create view of non-contiguous tensorData");
+
+    TensorData view(*this);
+    view.TensorShape = std::move(shape);
+    view.BatchSize = batchSize;
+    view.m_parentDescKey = parentDescKey;
+
+    const auto cols = view.Cols();
+    const auto rows =
+        view.TensorShape.Size() / (cols > 0 ? cols : 1) * batchSize;
+    view.PaddedHostColSize = m_paddedColSize(cols);
+    view.DenseTotalLengthHost = view.PaddedHostColSize * rows;
+
+    if (hostOffset + view.DenseTotalLengthHost > DenseTotalLengthHost)
+        throw std::invalid_argument("CreateView - View exceeds host buffer");
+
+    view.DenseMatHost += hostOffset;
+    view.m_hostOffset += hostOffset;
+
+    if (DenseMatCuda)
+    {
+        view.DenseTotalLengthCuda =
+            static_cast<unsigned long>(view.TensorShape.Size()) * batchSize;
+        if (cudaOffset + view.DenseTotalLengthCuda > DenseTotalLengthCuda)
+            throw std::invalid_argument(
+                "CreateView - View exceeds cuda buffer");
+
+        view.DenseMatCuda += cudaOffset;
+        view.m_cudaOffset += cudaOffset;
+    }
+
+    if (copyOnWrite)
+    {
+        m_copyOnWrite = true;
+        view.m_copyOnWrite = true;
+        m_addView(view);
+    }
+
+    return view;
+}
+
+bool TensorData::IsViewCompatible(const Shape& shape) const
+{
+    if (m_type == Type::Sparse || m_dataType != DataType::Float32 ||
+        !IsContiguous() || shape.Size() != TensorShape.Size())
+        return false;
+
+    if (shape.Cols() == Cols())
+        return true;
+
+    //! Row boundaries of the padded host buffer must not move
+    const auto padUnitSize = static_cast<unsigned long>(32 / sizeof(float));
+    return Cols() % padUnitSize == 0 && shape.Cols() % padUnitSize == 0;
+}
+
+void TensorData::CopyOnWrite()
+{
+    m_contiguousCache.reset();
+
+    if (!IsContiguous())
+    {
+        *this = m_createContiguousCopy();
+        return;
+    }
+
+    if (m_copyOnWrite && m_type != Type::Sparse)
+    {
+        if (m_hasOtherViews())
+        {
+            TensorData detached(TensorShape, m_type, m_device, BatchSize,
+                                m_parentDescKey, m_dataType);
+            DeepCopy(detached, *this);
+            *this = std::move(detached);
+        }
+
+        m_copyOnWrite = false;
+        m_viewGroup.reset();
+        m_viewToken.reset();
+    }
+
+    //! Buffer is written in place from here
+    BumpVersion();
+}
+
+void TensorData::m_addView(TensorData& view)
+{
+    if (!m_viewGroup)
+    {
+        m_viewGroup = std::make_shared<ViewGroup>();
+        m_viewToken = std::make_shared<int>(0);
+        m_viewGroup->Tokens.emplace_back(m_viewToken);
+    }
+
+    view.m_viewGroup = m_viewGroup;
+    view.m_viewToken = std::make_shared<int>(0);
+    std::lock_guard<std::mutex> lock(m_viewGroup->Mtx);
+    m_viewGroup->Tokens.emplace_back(view.m_viewToken);
+}
+
+bool TensorData::m_hasOtherViews() const
+{
+    if (!m_viewGroup)
+        return false;
+
+    std::lock_guard<std::mutex> lock(m_viewGroup->Mtx);
+    auto& tokens = m_viewGroup->Tokens;
+    //! Tokens of the released views are removed on the way
+    tokens.erase(std::remove_if(tokens.begin(), tokens.end(),
+                                [](const std::weak_ptr<int>& token) {
+                                    return token.expired();
+                                }),
+                 tokens.end());
+    for (const auto& token : tokens)
+        if (token.lock() != m_viewToken)
+            return true;
+    return false;
+}
+
+std::uint64_t TensorData::GetVersion() const
+{
+    return m_version ? m_version->load(std::memory_order_acquire) : 0;
+}
+
+void TensorData::BumpVersion() const
+{
+    if (m_version)
+        m_version->fetch_add(1, std::memory_order_acq_rel);
+}
+
+TensorData TensorData::CreatePermuteView(const std::vector<unsigned int>& dims,
+                                         int parentDescKey, bool copyOnWrite)
+{
+    if (m_type == Type::Sparse)
+        throw std::runtime_error("CreatePermuteView - Sparse not implemented");
+    if (m_dataType != DataType::Float32 && m_dataType != DataType::Int8)
+        throw std::runtime_error(
+            "CreatePermuteView - View of 16 bit data type not implemented");
+
+    const auto dim = TensorShape.Dim();
+    if (dims.size() != dim)
+        throw std::invalid_argument(
+            "CreatePermuteView - Number of dimensions mismatch");
+
+    std::vector<bool> isUsed(dim, false);
+    for (auto axis : dims)
+    {
+        if (axis >= dim || isUsed[axis])
+            throw std::invalid_argument(
+                "CreatePermuteView - Given dimensions are not permutation");
+        isUsed[axis] = true;
+    }
+
+    const auto strides = GetStrides();
+    TensorData view(*this);
+    view.m_parentDescKey = parentDescKey;
+    view.m_contiguousCache.reset();
+    view.m_strides = std::vector<unsigned long>(dim + 1);
+    view.m_permutation = std::vector<unsigned int>(dim);
+    view.m_strides[0] = strides[0];
+
+    std::vector<unsigned int> shapeVector(dim);
+    for (unsigned int i = 0; i < dim; ++i)
+    {
+        shapeVector[i] = TensorShape.At(dims[i]);
+        view.m_strides[i + 1] = strides[dims[i] + 1];
+        view.m_permutation[i] =
+            m_permutation.empty() ? dims[i] : m_permutation[dims[i]];
+    }
+    view.TensorShape = Shape(shapeVector);
+
+    //! Permuting back to the original order restores the contiguous layout
+    if (view.m_strides == view.m_defaultStrides())
+    {
+        view.m_strides.clear();
+        view.m_permutation.clear();
+    }
+
+    if (copyOnWrite)
+    {
+        m_copyOnWrite = true;
+        view.m_copyOnWrite = true;
+        m_addView(view);
+    }
+
+    return view;
+}
+
+TensorData TensorData::CreateTransposeView(int parentDescKey,
+                                           bool copyOnWrite)
+{
+    const auto dim = TensorShape.Dim();
+    if (dim < 2)
+        throw std::invalid_argument(
+            "CreateTransposeView - Shape must have dimension of at least 2");
+
+    std::vector<unsigned int> dims(dim);
+    for (unsigned int i = 0; i < dim; ++i)
+        dims[i] = i;
+    std::swap(dims[dim - 1], dims[dim - 2]);
+
+    return CreatePermuteView(dims, parentDescKey, copyOnWrite);
+}
+
+bool TensorData::IsMatrixContiguous() const
+{
+    if (IsContiguous())
+        return true;
+
+    for (unsigned int i = 0; i + 2 < m_permutation.size(); ++i)
+        if (m_permutation[i] != i)
+            return false;
+    return true;
+}
+
+std::vector<unsigned long> TensorData::GetStrides() const
+{
+    if (IsContiguous())
+        return m_defaultStrides();
+    return m_strides;
+}
+
+unsigned long TensorData::RowStride() const
+{
+    const auto dim = TensorShape.Dim();
+    if (IsContiguous() || dim < 2)
+        return PaddedHostColSize;
+    return m_strides[dim - 1];
+}
+
+unsigned long TensorData::ColStride() const
+{
+    if (IsContiguous())
+        return 1;
+    return m_strides[TensorShape.Dim()];
+}
+
+unsigned long TensorData::MatrixStride() const
+{
+    const auto dim = TensorShape.Dim();
+    if (IsContiguous())
+        return dim > 0 ? TensorShape.Rows() * PaddedHostColSize : 1;
+    return dim >= 3 ? m_strides[dim - 2] : m_strides[0];
+}
+
+TensorData TensorData::GetContiguous() const
+{
+    if (IsContiguous())
+        return *this;
+
+    //! Saved tensors are read by the threads of the backward engine at the
+    //! same time, so the cache is published atomically. Threads racing on the
+    //! first call make their own copies, and only one of them is kept
+    auto cache = std::atomic_load(&m_contiguousCache);
+    if (!cache)
+    {
+        auto copy = std::make_shared<TensorData>(m_createContiguousCopy());
+        if (std::atomic_compare_exchange_strong(&m_contiguousCache, &cache,
+                                                copy))
+            cache = std::move(copy);
+    }
+    return *cache;
+}
+
+std::vector<unsigned long> TensorData::m_defaultStrides() const
+{
+    const auto dim = TensorShape.Dim();
+    std::vector<unsigned long> strides(dim + 1);
+    strides[dim] = 1;
+    if (dim > 0)
+        strides[dim - 1] = PaddedHostColSize;
+    for (int i = static_cast<int>(dim) - 2; i >= 0; --i)
+        strides[i] = strides[i + 1] * TensorShape.At(i);
+    return strides;
+}
+
+//! Returns true if the strides with the batch as the first dimension
+//! describe transposed matrices stored one after another, which are copied by
+//! the blocked transpose
+static bool IsBatchedTranspose(const std::vector<unsigned int>& shape,
+                               const std::vector<unsigned long>& strides)
+{
+    const auto dim = shape.size();
+    if (dim < 3 || strides[dim - 2] != 1 || strides[dim - 1] < shape[dim - 2])
+        return false;
+
+    //! Stored matrices have the columns of the view as their rows
+    auto expected = static_cast<unsigned long>(shape[dim - 1]) *
+                    strides[dim - 1];
+    for (auto i = dim - 2; i-- > 0;)
+    {
+        if (shape[i] > 1 && strides[i] != expected)
+            return false;
+        expected *= shape[i];
+    }
+    return true;
+}
+
+TensorData TensorData::m_createContiguousCopy() const
+{
+    if (m_dataType != DataType::Float32)
+        throw std::runtime_error(
+            "m_createContiguousCopy - Only float data can be made contiguous");
+
+    TensorData contiguous(TensorShape, m_type, m_device, BatchSize,
+                          m_parentDescKey);
+
+    if (m_device.Type() == DeviceType::CUDA)
+    {
+        //! Cuda data is not padded, so transpose is the only permutation
+        //! that can be restored with existing kernels
+        const auto dim = static_cast<unsigned int>(m_permutation.size());
+        bool isTranspose = dim >= 2 && m_permutation[dim - 1] == dim - 2 &&
+                           m_permutation[dim - 2] == dim - 1;
+        for (unsigned int i = 0; i + 2 < dim; ++i)
+            isTranspose &= m_permutation[i] == i;
+
+        if (!isTranspose)
+            throw std::runtime_error(
+                "m_createContiguousCopy - Only transpose is supported for "
+                "cuda tensors");
+
+        const auto rows = TensorShape.Rows();
+        const auto cols = TensorShape.Cols();
+        Compute::Dense::Cuda::Transpose(
+            contiguous.DenseMatCuda, DenseMatCuda, cols, rows,
+            TensorShape.Size() * BatchSize / (rows * cols), false);
+    }
+
+    std::vector<unsigned int> shapeVector = TensorShape.GetShapeVector();
+    shapeVector.insert(shapeVector.begin(), BatchSize);
+
+    if (IsBatchedTranspose(shapeVector, m_strides))
+    {
+        const auto dim = shapeVector.size();
+        const auto numMatrices =
+            TensorShape.Size() * BatchSize / (TensorShape.Rows() * Cols());
+        Compute::Dense::Naive::Transpose(
+            contiguous.DenseMatHost, DenseMatHost, shapeVector[dim - 1],
+            contiguous.PaddedHostColSize, shapeVector[dim - 2],
+            static_cast<unsigned int>(m_strides[dim - 1]), numMatrices,
+            false);
+        return contiguous;
+    }
+
+    Compute::Dense::Naive::StridedCopy(
+        contiguous.DenseMatHost, DenseMatHost, shapeVector.data(),
+        m_strides.data(), static_cast<unsigned int>(shapeVector.size()),
+        contiguous.PaddedHostColSize);
+
+    return contiguous;
+}
+
 bool TensorData::SendTo(const Device& device)
 {
     if (m_device == device)
@@ -227,6 +747,14 @@ bool TensorData::SendTo(const Device& device)
         return false;
     }
 
+    if (m_dataType != DataType::Float32 && device.Type() == DeviceType::CUDA)
+        throw std::invalid_argument(
+            "SendTo - Data types other than Float32 are only available on the "
+            "host");
+
+    if (!IsContiguous())
+        *this = m_createContiguousCopy();
+
     if (m_device.Type() == DeviceType::HOST &&
         device.Type() == DeviceType::CUDA)
     {
@@ -254,13 +782,20 @@ bool TensorData::SendTo(const Device& device)
 
 void TensorData::DeepCopy(TensorData& dst, const TensorData& src)
 {
-    if (dst.GetType() != src.GetType())
+    if (dst.GetType() != src.GetType() ||
+        dst.GetDataType() != src.GetDataType())
         throw std::invalid_argument(
             "DeepCopy - matrix or device type mismatch");
 
     if (dst.GetDevice().Type() != src.GetDevice().Type())
         throw std::invalid_argument("DeepCopy - Device type mismatch");
 
+    if (!src.IsContiguous())
+    {
+        DeepCopy(dst, src.GetContiguous());
+        return;
+    }
+
     auto deviceType = dst.GetDevice().Type();
     auto matrixType = dst.GetType();
 
@@ -273,8 +808,11 @@ void TensorData::DeepCopy(TensorData& dst, const TensorData& src)
         throw std::runtime_error("DeepCopy - Not implemented");
 
     else if (deviceType == DeviceType::HOST && matrixType == Type::Dense)
+    {
         std::memcpy(dst.DenseMatHost, src.DenseMatHost,
-                    dst.DenseTotalLengthHost);
+                    dst.DenseTotalLengthHost * dst.m_elementByteSize());
+        dst.m_scale = src.m_scale;
+    }
 
     else if (deviceType == DeviceType::HOST && matrixType == Type::Sparse)
         throw std::runtime_error("DeepCopy - Not implemented");
@@ -358,8 +896,10 @@ void TensorData::m_freeHost()
     }
     else if (DenseMatHost)
     {
-        Util::MemoryManager::DeReferenceHost(static_cast<void*>(DenseMatHost));
+        Util::MemoryManager::DeReferenceHost(static_cast<void*>(m_hostBase()));
+        DenseMatHost = nullptr;
         DenseTotalLengthHost = 0;
+        m_hostOffset = 0;
     }
 }
 
@@ -374,22 +914,18 @@ void TensorData::m_freeCuda()
     else if (DenseMatCuda)
     {
         //         Compute::Cuda::CudaFree((void *)DenseMatCuda);
-        Util::MemoryManager::DeReferenceCuda(static_cast<void*>(DenseMatCuda),
+        Util::MemoryManager::DeReferenceCuda(static_cast<void*>(m_cudaBase()),
                                              m_device.GetID());
+        DenseMatCuda = nullptr;
         DenseTotalLengthCuda = 0;
+        m_cudaOffset = 0;
     }
 }
 
 void TensorData::m_allocateHost(unsigned int batchSize)
 {
-    const auto colSize = Cols();
-
     const auto padUnitSize = static_cast<unsigned long>(32 / sizeof(float));
-
-    const auto paddedColumnSize =
-        colSize % padUnitSize == 0
-            ? colSize
-            : colSize / padUnitSize * padUnitSize + padUnitSize;
+    const auto paddedColumnSize = m_paddedColSize(Cols());
 
     if (m_type == Type::Sparse)
     {
@@ -408,14 +944,23 @@ void TensorData::m_allocateHost(unsigned int batchSize)
 
         PaddedHostColSize = paddedColumnSize;
         DenseTotalLengthHost = totalSize;
-        DenseMatHost = static_cast<float*>(
-            Util::MemoryManager::GetMemoryHost(totalSize * sizeof(float)));
+        m_hostOffset = 0;
+        DenseMatHost = static_cast<float*>(Util::MemoryManager::GetMemoryHost(
+            totalSize * m_elementByteSize()));
 
-#pragma omp parallel for default(none) schedule(static) \
-    shared(totalSize, padUnitSize)
-        for (long i = 0; i < static_cast<long>(totalSize / padUnitSize); ++i)
-            _mm256_store_ps(DenseMatHost + i * padUnitSize,
-                            _mm256_set1_ps(0.0f));
+        if (m_dataType != DataType::Float32)
+        {
+            std::memset(DenseMatHost, 0, totalSize * m_elementByteSize());
+            return;
+        }
+
+        const auto zeroFill = [&](std::size_t begin, std::size_t end) {
+            for (auto i = begin; i < end; ++i)
+                _mm256_store_ps(DenseMatHost + i * padUnitSize,
+                                _mm256_set1_ps(0.0f));
+        };
+        Util::ParallelFor(0, totalSize / padUnitSize,
+                          Util::GrainSize(padUnitSize), zeroFill);
     }
 }
 
@@ -434,8 +979,22 @@ void TensorData::m_allocateCuda(unsigned int batchSize)
     else
     {
         const unsigned long totalSize = TensorShape.Size() * batchSize;
+        DenseTotalLengthCuda = totalSize;
+        m_cudaOffset = 0;
         DenseMatCuda = static_cast<float*>(Util::MemoryManager::GetMemoryCuda(
             totalSize * sizeof(float), m_device.GetID()));
+        //! Pooled device blocks keep the data of their previous owner, so
+        //! they are zero-filled like the host buffer
+        Compute::Dense::Cuda::Scalar(DenseMatCuda, 0.0f, totalSize);
     }
 }
+
+unsigned long TensorData::m_paddedColSize(unsigned long colSize)
+{
+    const auto padUnitSize = static_cast<unsigned long>(32 / sizeof(float));
+
+    return colSize % padUnitSize == 0
+               ? colSize
+               : colSize / padUnitSize * padUnitSize + padUnitSize;
+}
 } // namespace Sapphire::TensorUtil
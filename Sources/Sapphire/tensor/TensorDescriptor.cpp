@@ -20,6 +20,16 @@ TensorDescriptor::TensorDescriptor(const Shape &shape, Type type,
 {
 }
 
+TensorDescriptor::TensorDescriptor(TensorData forwardData,
+                                   TensorData backwardData, int key)
+    : ForwardData(std::move(forwardData)),
+      BackwardData(std::move(backwardData)),
+      m_key(key),
+      m_batchSize(ForwardData.BatchSize),
+      m_trainable(false)
+{
+}
+
 TensorDescriptor::TensorDescriptor(TensorDescriptor &&tensorData) noexcept
     : ForwardData(std::move(tensorData.ForwardData)),
       BackwardData(std::move(tensorData.BackwardData)),
@@ -81,7 +91,9 @@ void TensorDescriptor::RemoveGradientInputKey(int tensorKey)
             "list");
     }
 
-    history.GradientInputTensorKeys.erase(it);
+    //! Order of the keys is irrelevant, so the last key fills the hole
+    *it = history.GradientInputTensorKeys.back();
+    history.GradientInputTensorKeys.pop_back();
 }
 
 void TensorDescriptor::PopIfOperandHistory()
@@ -96,6 +108,16 @@ void TensorDescriptor::PopHistory()
         m_history.pop_back();
 }
 
+BackProp::BackPropWrapper* TensorDescriptor::GetNextBackPropWrapper() const
+{
+    auto it = m_history.rbegin();
+    if (it != m_history.rend() && !it->IsOutput)
+        ++it;
+    if (it == m_history.rend() || !it->IsOutput)
+        return nullptr;
+    return it->Wrapper.get();
+}
+
 bool TensorDescriptor::IsBackPropReady() const
 
 {
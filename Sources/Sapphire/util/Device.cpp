@@ -5,24 +5,28 @@
 // property of any third parties.
 
 #include <Sapphire/util/Device.hpp>
+#include <mutex>
 #include <stdexcept>
 
 namespace Sapphire
 {
-Device::Device(std::string name)
+static std::mutex& DeviceRegistryMutex()
+{
+    static std::mutex mtx;
+    return mtx;
+}
+
+Device::Device(const std::string& name)
     : m_id(-1),
-      m_type(DeviceType::HOST),
-      m_name(std::move(name)),
-      m_padByteSize(32)
+      m_type(DeviceType::HOST)
 {
     //! todo : change padByteSize according to hardware support
+    m_index = m_register({ m_id, m_type, name, 32, 0 });
 }
 
-Device::Device(int id, std::string name)
+Device::Device(int id, const std::string& name)
     : m_id(id),
-      m_type(DeviceType::CUDA),
-      m_name(std::move(name)),
-      m_padByteSize(32)
+      m_type(DeviceType::CUDA)
 {
     if (id >= GetAvailableCudaDeviceCount())
     {
@@ -35,17 +39,53 @@ Device::Device(int id, std::string name)
                            m_id);
     cudaDeviceGetAttribute(&minorCapability, cudaDevAttrComputeCapabilityMinor,
                            m_id);
-    m_cudaCapability = majorCapability * 10 + minorCapability;
+    m_index = m_register({ m_id, m_type, name, 32,
+                           majorCapability * 10 + minorCapability });
 }
 
-bool Device::operator==(const Device& device) const
+const std::string& Device::Name() const
 {
-    return m_id == device.m_id && m_type == device.m_type &&
-           m_name == device.m_name && m_padByteSize == device.m_padByteSize;
+    return m_getInfo(m_index).Name;
 }
 
-bool Device::operator!=(const Device& device) const
+int Device::GetCudaCapability() const
 {
-    return !(*this == device);
+    if (m_type != DeviceType::CUDA)
+    {
+        throw std::runtime_error(
+            "GetCudaCapability - Device is not set as CUDA");
+    }
+    return m_getInfo(m_index).CudaCapability;
+}
+
+std::deque<Device::DeviceInfo>& Device::m_registry()
+{
+    static std::deque<DeviceInfo> registry = {
+        { -1, DeviceType::HOST, "Undefined", 0, 0 }
+    };
+    return registry;
+}
+
+const Device::DeviceInfo& Device::m_getInfo(unsigned int index)
+{
+    std::lock_guard<std::mutex> lock(DeviceRegistryMutex());
+    return m_registry().at(index);
+}
+
+unsigned int Device::m_register(const DeviceInfo& deviceInfo)
+{
+    std::lock_guard<std::mutex> lock(DeviceRegistryMutex());
+    auto& registry = m_registry();
+    for (std::size_t index = 0; index < registry.size(); ++index)
+    {
+        const auto& entry = registry[index];
+        if (entry.Id == deviceInfo.Id && entry.Type == deviceInfo.Type &&
+            entry.Name == deviceInfo.Name &&
+            entry.PadByteSize == deviceInfo.PadByteSize)
+            return static_cast<unsigned int>(index);
+    }
+
+    registry.emplace_back(deviceInfo);
+    return static_cast<unsigned int>(registry.size() - 1);
 }
 }  // namespace Sapphire
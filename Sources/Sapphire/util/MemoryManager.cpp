@@ -165,6 +165,35 @@ void MemoryManager::DeReferenceHost(void* ptr)
     }
 }
 
+int MemoryManager::GetReferenceCountCuda(void* ptr, int deviceId)
+{
+    std::lock_guard<std::mutex> lock(m_cudaPoolMtx);
+
+    const auto itr =
+        m_cudaBusyMemoryPool.find(std::make_pair(deviceId, intptr_t(ptr)));
+    if (itr == m_cudaBusyMemoryPool.end())
+    {
+        throw std::runtime_error(
+            "GetReferenceCountCuda - Reference was not found");
+    }
+
+    return itr->second.RefCount;
+}
+
+int MemoryManager::GetReferenceCountHost(void* ptr)
+{
+    std::lock_guard<std::mutex> lock(m_hostPoolMtx);
+
+    const auto itr = m_hostBusyMemoryPool.find(intptr_t(ptr));
+    if (itr == m_hostBusyMemoryPool.end())
+    {
+        throw std::runtime_error(
+            "GetReferenceCountHost - Reference was not found");
+    }
+
+    return itr->second.RefCount;
+}
+
 void MemoryManager::ClearUnusedCudaMemoryPool()
 {
     std::lock_guard<std::mutex> lock(m_cudaPoolMtx);
@@ -0,0 +1,399 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/util/AtomicWait.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <algorithm>
+
+namespace Sapphire::Util
+{
+//! Pool and index of the worker running on current thread
+static thread_local ThreadPool* currentPool = nullptr;
+static thread_local unsigned int currentWorkerIdx = 0;
+
+WorkStealingDeque::WorkStealingDeque(std::size_t capacity)
+{
+    std::size_t size = 2;
+    while (size < capacity)
+        size <<= 1;
+    m_buffers.emplace_back(std::make_unique<Buffer>(size));
+    m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+}
+
+void WorkStealingDeque::Push(Task* task)
+{
+    const auto bottom = m_bottom.load(std::memory_order_relaxed);
+    const auto top = m_top.load(std::memory_order_acquire);
+    auto* buffer = m_buffer.load(std::memory_order_relaxed);
+
+    if (bottom - top > static_cast<std::int64_t>(buffer->Mask))
+    {
+        auto grown = std::make_unique<Buffer>((buffer->Mask + 1) * 2);
+        for (auto idx = top; idx < bottom; ++idx)
+            grown->At(idx).store(
+                buffer->At(idx).load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+        buffer = grown.get();
+        m_buffers.emplace_back(std::move(grown));
+        m_buffer.store(buffer, std::memory_order_release);
+    }
+
+    //! Release store publishes the task to the thieves reading the bottom
+    buffer->At(bottom).store(task, std::memory_order_relaxed);
+    m_bottom.store(bottom + 1, std::memory_order_release);
+}
+
+Task* WorkStealingDeque::Pop()
+{
+    const auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    auto* buffer = m_buffer.load(std::memory_order_relaxed);
+    m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto top = m_top.load(std::memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Task* task = buffer->At(bottom).load(std::memory_order_relaxed);
+    if (top == bottom)
+    {
+        //! Last task is raced with the thieves
+        if (!m_top.compare_exchange_strong(top, top + 1,
+                                           std::memory_order_seq_cst,
+                                           std::memory_order_relaxed))
+            task = nullptr;
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return task;
+}
+
+Task* WorkStealingDeque::Steal()
+{
+    auto top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto bottom = m_bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom)
+        return nullptr;
+
+    auto* buffer = m_buffer.load(std::memory_order_acquire);
+    Task* task = buffer->At(top).load(std::memory_order_relaxed);
+    if (!m_top.compare_exchange_strong(top, top + 1,
+                                       std::memory_order_seq_cst,
+                                       std::memory_order_relaxed))
+        return nullptr;
+    return task;
+}
+
+bool WorkStealingDeque::Empty() const
+{
+    return m_top.load(std::memory_order_acquire) >=
+           m_bottom.load(std::memory_order_acquire);
+}
+
+std::mutex ThreadPool::m_globalMtx;
+std::unique_ptr<ThreadPool> ThreadPool::m_global;
+std::atomic<ThreadPool*> ThreadPool::m_globalPtr = nullptr;
+std::atomic<unsigned int> ThreadPool::m_globalBudget = 0;
+
+ThreadPool::ThreadPool(unsigned int numThreads)
+    : m_sharedQueue(1024)
+{
+    numThreads = std::max(1u, numThreads);
+    for (unsigned int idx = 0; idx < numThreads; ++idx)
+        m_deques.emplace_back(std::make_unique<WorkStealingDeque>());
+    for (unsigned int idx = 0; idx < numThreads; ++idx)
+        m_workers.emplace_back([this, idx]() { m_workerLoop(idx); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    m_stop.store(true, std::memory_order_seq_cst);
+    m_epoch.fetch_add(1, std::memory_order_seq_cst);
+    AtomicNotifyAll(m_epoch);
+    for (auto& worker : m_workers)
+        worker.join();
+}
+
+bool ThreadPool::IsWorker() const
+{
+    return currentPool == this;
+}
+
+void ThreadPool::Submit(Task* task)
+{
+    task->Done.store(0, std::memory_order_relaxed);
+    if (IsWorker())
+        m_deques[currentWorkerIdx]->Push(task);
+    else
+        m_sharedQueue.Push(task);
+    m_notifyWorker();
+}
+
+void ThreadPool::WaitUntilZero(std::atomic<std::uint32_t>& counter)
+{
+    if (IsWorker())
+    {
+        m_helpUntilZero(counter);
+        return;
+    }
+
+    for (auto value = counter.load(std::memory_order_acquire); value != 0;
+         value = counter.load(std::memory_order_acquire))
+        AtomicWait(counter, value);
+}
+
+ThreadPool& ThreadPool::Global()
+{
+    if (auto* pool = m_globalPtr.load(std::memory_order_acquire))
+        return *pool;
+
+    std::lock_guard<std::mutex> lock(m_globalMtx);
+    if (!m_global)
+    {
+        m_global = std::make_unique<ThreadPool>(GetGlobalThreadBudget());
+        m_globalPtr.store(m_global.get(), std::memory_order_release);
+    }
+    return *m_global;
+}
+
+void ThreadPool::SetGlobalThreadBudget(unsigned int numThreads)
+{
+    std::lock_guard<std::mutex> lock(m_globalMtx);
+    m_globalBudget = std::max(1u, numThreads);
+    m_globalPtr.store(nullptr, std::memory_order_release);
+    m_global.reset();
+}
+
+unsigned int ThreadPool::GetGlobalThreadBudget()
+{
+    const auto budget = m_globalBudget.load();
+    if (budget > 0)
+        return budget;
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void ThreadPool::m_parallelFor(std::size_t begin, std::size_t end,
+                               std::size_t grainSize, RangeFunction function)
+{
+    if (begin >= end)
+        return;
+
+    if (grainSize == 0)
+        grainSize =
+            std::max<std::size_t>(1, (end - begin) / (NumThreads() * 4));
+
+    if (end - begin <= grainSize)
+    {
+        function.Invoke(function.Object, begin, end);
+        return;
+    }
+
+    if (IsWorker())
+    {
+        m_runRange(begin, end, grainSize, function);
+        return;
+    }
+
+    //! Threads outside the pool hand the whole range to the workers
+    RangeTask task;
+    task.Run = m_runRangeTask;
+    task.Pool = this;
+    task.Begin = begin;
+    task.End = end;
+    task.GrainSize = grainSize;
+    task.Function = function;
+    Submit(&task);
+
+    while (task.Done.load(std::memory_order_acquire) == 0)
+        AtomicWait(task.Done, 0);
+    if (task.Exception)
+        std::rethrow_exception(task.Exception);
+}
+
+void ThreadPool::m_runRange(std::size_t begin, std::size_t end,
+                            std::size_t grainSize, RangeFunction function)
+{
+    auto& deque = *m_deques[currentWorkerIdx];
+    while (end - begin > grainSize)
+    {
+        //! Upper half is exposed to the thieves while lower half is executed
+        const auto mid = begin + (end - begin) / 2;
+        RangeTask upper;
+        upper.Run = m_runRangeTask;
+        upper.Pool = this;
+        upper.Begin = mid;
+        upper.End = end;
+        upper.GrainSize = grainSize;
+        upper.Function = function;
+        deque.Push(&upper);
+        m_notifyWorker();
+
+        //! Upper must be reclaimed before unwinding, since it lives on this
+        //! stack frame
+        std::exception_ptr exception;
+        try
+        {
+            m_runRange(begin, mid, grainSize, function);
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        //! Every task pushed after upper has been popped, so upper is at the
+        //! bottom unless it has been stolen
+        if (deque.Pop() != &upper)
+        {
+            std::atomic<std::uint32_t>& done = upper.Done;
+            while (done.load(std::memory_order_acquire) == 0)
+            {
+                if (Task* task = m_findTask(currentWorkerIdx))
+                    task->Run(task);
+                else
+                    std::this_thread::yield();
+            }
+            if (!exception)
+                exception = upper.Exception;
+            if (exception)
+                std::rethrow_exception(exception);
+            return;
+        }
+        if (exception)
+            std::rethrow_exception(exception);
+        begin = mid;
+    }
+
+    function.Invoke(function.Object, begin, end);
+}
+
+void ThreadPool::m_runRangeTask(Task* task)
+{
+    auto* rangeTask = static_cast<RangeTask*>(task);
+    //! Exception is rethrown by the thread waiting for the task
+    try
+    {
+        rangeTask->Pool->m_runRange(rangeTask->Begin, rangeTask->End,
+                                    rangeTask->GrainSize, rangeTask->Function);
+    }
+    catch (...)
+    {
+        rangeTask->Exception = std::current_exception();
+    }
+    rangeTask->Done.store(1, std::memory_order_release);
+    //! Wakes up the thread outside the pool waiting for the task
+    AtomicNotifyAll(rangeTask->Done);
+}
+
+Task* ThreadPool::m_findTask(unsigned int workerIdx)
+{
+    if (Task* task = m_deques[workerIdx]->Pop())
+        return task;
+
+    const auto numDeques = static_cast<unsigned int>(m_deques.size());
+    for (unsigned int offset = 1; offset < numDeques; ++offset)
+        if (Task* task = m_deques[(workerIdx + offset) % numDeques]->Steal())
+            return task;
+
+    if (auto task = m_sharedQueue.TryPop())
+        return *task;
+    return nullptr;
+}
+
+void ThreadPool::m_helpUntilZero(std::atomic<std::uint32_t>& counter)
+{
+    while (counter.load(std::memory_order_acquire) != 0)
+    {
+        if (Task* task = m_findTask(currentWorkerIdx))
+            task->Run(task);
+        else
+            std::this_thread::yield();
+    }
+}
+
+void ThreadPool::m_workerLoop(unsigned int workerIdx)
+{
+    currentPool = this;
+    currentWorkerIdx = workerIdx;
+
+    while (!m_stop.load(std::memory_order_acquire))
+    {
+        if (Task* task = m_findTask(workerIdx))
+        {
+            task->Run(task);
+            continue;
+        }
+
+        //! Sleeps until new task is submitted. Checking for tasks after
+        //! registering as a sleeper prevents missing the notification
+        m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const auto epoch = m_epoch.load(std::memory_order_seq_cst);
+        if (!m_hasTask() && !m_stop.load(std::memory_order_seq_cst))
+            AtomicWait(m_epoch, epoch);
+        m_sleepers.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    currentPool = nullptr;
+}
+
+void ThreadPool::m_notifyWorker()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_sleepers.load(std::memory_order_relaxed) > 0)
+    {
+        m_epoch.fetch_add(1, std::memory_order_seq_cst);
+        AtomicNotify(m_epoch, 1);
+    }
+}
+
+bool ThreadPool::m_hasTask() const
+{
+    if (m_sharedQueue.Size() > 0)
+        return true;
+    for (const auto& deque : m_deques)
+        if (!deque->Empty())
+            return true;
+    return false;
+}
+
+void TaskGroup::Wait()
+{
+    m_threadPool.WaitUntilZero(m_pending);
+    m_tasks.clear();
+
+    std::exception_ptr exception;
+    {
+        std::lock_guard<std::mutex> lock(m_exceptionMtx);
+        std::swap(exception, m_exception);
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+void TaskGroup::m_runTask(Task* task)
+{
+    auto* functionTask = static_cast<FunctionTask*>(task);
+    auto* group = functionTask->Group;
+    try
+    {
+        functionTask->Function();
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(group->m_exceptionMtx);
+        if (!group->m_exception)
+            group->m_exception = std::current_exception();
+    }
+
+    functionTask->Done.store(1, std::memory_order_release);
+    if (group->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        AtomicNotifyAll(group->m_pending);
+}
+}  // namespace Sapphire::Util
@@ -8,46 +8,13 @@
 
 namespace Sapphire
 {
-Shape::Shape(std::initializer_list<unsigned int> shape) : m_shapeVector(shape)
+Shape::Shape(const std::vector<unsigned int>& shape)
 {
-}
-
-Shape::Shape(std::vector<unsigned int> shape) : m_shapeVector(std::move(shape))
-{
-}
-
-Shape::Shape(Shape&& shape) noexcept
-    : m_shapeVector(std::move(shape.m_shapeVector))
-{
-}
-
-Shape& Shape::operator=(const Shape& shape)
-{
-    if (this == &shape)
-        return *this;
-    m_shapeVector = shape.m_shapeVector;
-    return *this;
-}
-
-Shape& Shape::operator=(Shape&& shape) noexcept
-{
-    m_shapeVector = std::move(shape.m_shapeVector);
-    return *this;
-}
-
-unsigned int& Shape::operator[](unsigned int index)
-{
-    return m_shapeVector.at(index);
-}
-
-bool Shape::operator==(const Shape& shape) const
-{
-    return m_shapeVector == shape.m_shapeVector;
-}
-
-bool Shape::operator!=(const Shape& shape) const
-{
-    return m_shapeVector != shape.m_shapeVector;
+    if (shape.size() > MaxDim)
+        throw std::invalid_argument(
+            "Shape - Dimension exceeds maximum dimension");
+    for (auto dim : shape)
+        m_dims[m_dim++] = dim;
 }
 
 std::string Shape::ToString() const
@@ -56,43 +23,22 @@ std::string Shape::ToString() const
     msg += "Dim : " + std::to_string(Dim()) + " ";
     msg += " [";
 
-    for (auto dim : m_shapeVector)
-        msg += (std::to_string(dim) + " ");
+    for (unsigned int i = 0; i < m_dim; ++i)
+        msg += (std::to_string(m_dims[i]) + " ");
 
     msg += " ] ";
     return msg;
 }
 
-unsigned int Shape::At(unsigned int index) const
-{
-    return m_shapeVector.at(index);
-}
-
-unsigned int Shape::Dim() const
-{
-    return static_cast<unsigned int>(m_shapeVector.size());
-}
-
-unsigned int Shape::Size() const noexcept
-{
-    unsigned int size = 1;
-    for (auto i : m_shapeVector)
-    {
-        size *= i;
-    }
-
-    return size;
-}
-
 void Shape::Set(unsigned int dim, unsigned int value)
 {
-    if (dim >= m_shapeVector.size())
+    if (dim >= m_dim)
     {
         throw std::invalid_argument(
             "Shape::Set - Given dimension exceeds shape dimension");
     }
 
-    m_shapeVector.at(dim) = value;
+    m_dims[dim] = value;
 }
 
 void Shape::Expand(unsigned int dim)
@@ -100,34 +46,32 @@ void Shape::Expand(unsigned int dim)
     if (dim <= Dim())
         return;
 
-    std::vector<unsigned int> newShapeVector(dim);
-    for (unsigned int i = 0; i < dim; i++)
-    {
-        if (i < dim - m_shapeVector.size())
-            newShapeVector.at(i) = 1;
-        else
-            newShapeVector.at(i) =
-                m_shapeVector.at(i - (dim - m_shapeVector.size()));
-    }
+    if (dim > MaxDim)
+        throw std::invalid_argument(
+            "Shape::Expand - Dimension exceeds maximum dimension");
+
+    //! Moves existing dimensions to the back and fills the front with 1
+    const auto offset = dim - m_dim;
+    for (unsigned int i = dim; i > 0; --i)
+        m_dims[i - 1] = i - 1 >= offset ? m_dims[i - 1 - offset] : 1;
 
-    m_shapeVector = newShapeVector;
+    m_dim = dim;
 }
 
 Shape Shape::GetTranspose() const
 {
-    if (m_shapeVector.size() < 2)
+    if (m_dim < 2)
     {
         throw std::runtime_error(
             "GetTranspose - Shape must have dimension of at least 2 to perform "
             "transpose");
     }
 
-    auto vector = m_shapeVector;
-    auto temp = vector.at(vector.size() - 1);
-    vector.at(vector.size() - 1) = vector.at(vector.size() - 2);
-    vector.at(vector.size() - 2) = temp;
+    auto shape = *this;
+    shape.m_dims[m_dim - 1] = m_dims[m_dim - 2];
+    shape.m_dims[m_dim - 2] = m_dims[m_dim - 1];
 
-    return Shape(vector);
+    return shape;
 }
 
 }  // namespace Sapphire
@@ -0,0 +1,95 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/Compute.hpp>
+#include <Sapphire/tensor/TensorData.hpp>
+#include <Sapphire/util/ThreadPool.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include "doctest.h"
+
+//! Counts heap allocations of the test executable while counting is enabled
+static std::atomic<bool> countAllocations{ false };
+static std::atomic<unsigned long> allocationCount{ 0 };
+
+void* operator new(std::size_t size)
+{
+    if (countAllocations)
+        ++allocationCount;
+    if (void* ptr = std::malloc(size > 0 ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace Sapphire::Test
+{
+//! Returns number of heap allocations performed by the function
+template <typename Func>
+static unsigned long CountAllocations(Func func)
+{
+    allocationCount = 0;
+    countAllocations = true;
+    func();
+    countAllocations = false;
+    return allocationCount;
+}
+
+TEST_CASE("Small operations do not allocate")
+{
+    const Device host("host");
+    const Shape shape({ 4, 6 });
+    TensorUtil::TensorData a(shape, Type::Dense, host, 2);
+    TensorUtil::TensorData b(shape, Type::Dense, host, 2);
+    TensorUtil::TensorData bias(Shape({ 6 }), Type::Dense, host, 1);
+    TensorUtil::TensorData out(shape, Type::Dense, host, 2);
+    TensorUtil::TensorData weight(Shape({ 6, 6 }), Type::Dense, host, 1);
+    //! Global pool is created by its first use, which must not be counted
+    //! regardless of the tests run before
+    Util::ThreadPool::Global();
+
+    CHECK(CountAllocations([&]() {
+              const Shape copied = shape;
+              Shape expanded = copied;
+              expanded.Expand(Shape::MaxDim);
+              const Device device = host;
+              CHECK(device == a.GetDevice());
+          }) == 0);
+
+    CHECK(CountAllocations([&]() { Compute::Add(out, a, b); }) == 0);
+    CHECK(CountAllocations([&]() { Compute::Add(out, a, bias); }) == 0);
+    CHECK(CountAllocations([&]() { Compute::Sub(out, a, b); }) == 0);
+    CHECK(CountAllocations([&]() { Compute::Dot(out, a, b); }) == 0);
+    CHECK(CountAllocations([&]() { Compute::ColumnSum(bias, a); }) == 0);
+    CHECK(CountAllocations([&]() { Compute::Gemm(out, a, weight, out); }) ==
+          0);
+
+    //! First gemm of the thread does not depend on storage of earlier calls
+    unsigned long firstGemmAllocations = 0;
+    std::thread thread([&]() {
+        firstGemmAllocations =
+            CountAllocations([&]() { Compute::Gemm(out, a, weight, out); });
+    });
+    thread.join();
+    CHECK(firstGemmAllocations == 0);
+
+    CHECK(CountAllocations([&]() {
+              const TensorUtil::TensorData copied = a;
+              CHECK(copied.TensorShape == a.TensorShape);
+          }) == 0);
+}
+}  // namespace Sapphire::Test
@@ -7,12 +7,28 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 
 #include <Sapphire/Tests/BasicComputationTest.hpp>
+#include <Sapphire/Tests/BatchedGemmTest.hpp>
 #include <Sapphire/Tests/BroadcastTest.hpp>
 #include <Sapphire/Tests/ComputationTest.hpp>
+#include <Sapphire/Tests/ConcurrentQueueTest.hpp>
+#include <Sapphire/Tests/ConvolutionTest.hpp>
 #include <Sapphire/Tests/CudaFunctionalityTest.cuh>
+#include <Sapphire/Tests/EmbeddingTest.hpp>
+#include <Sapphire/Tests/HalfPrecisionTest.hpp>
+#include <Sapphire/Tests/LossTest.hpp>
+#include <Sapphire/Tests/ModelTest.hpp>
+#include <Sapphire/Tests/NormalizationTest.hpp>
+#include <Sapphire/Tests/OptimizerTest.hpp>
+#include <Sapphire/Tests/PoolingTest.hpp>
+#include <Sapphire/Tests/QuantizationTest.hpp>
+#include <Sapphire/Tests/RandomTest.hpp>
+#include <Sapphire/Tests/ReductionTest.hpp>
 #include <Sapphire/Tests/SparseGemmTest.hpp>
 #include <Sapphire/Tests/SparseMemoryTest.hpp>
+#include <Sapphire/Tests/TensorViewTest.hpp>
 #include <Sapphire/Tests/Test.hpp>
+#include <Sapphire/Tests/ThreadPoolTest.hpp>
+#include <Sapphire/Tests/TransposeTest.hpp>
 #include <iostream>
 #include "doctest.h"
 #define EnableAllTest
@@ -88,6 +104,16 @@ TEST_CASE("Gemm Broadcast Test")
             BroadcastMixed();
     }
 
+    SUBCASE("Host broadcast")
+    {
+        TestHostBroadcast();
+    }
+
+    SUBCASE("Broadcast accumulation")
+    {
+        TestBroadcastAccumulation();
+    }
+
     SUBCASE("Gemm Broadcast")
     {
         for (int loopIdx = 0; loopIdx < testLoops; loopIdx++)
@@ -108,6 +134,24 @@ TEST_CASE("Gemm Broadcast Test")
     }
 }
 
+TEST_CASE("Batched gemm test")
+{
+    SUBCASE("Broadcast over the batch")
+    {
+        TestBatchedGemm();
+    }
+
+    SUBCASE("Schedules")
+    {
+        TestGemmSchedules();
+    }
+
+    SUBCASE("Schedule benchmark")
+    {
+        BenchmarkBatchedGemm();
+    }
+}
+
 TEST_CASE("Basic computation test")
 {
     const int testLoops = 5;
@@ -157,6 +201,291 @@ TEST_CASE("Basic computation test")
     }
 }
 
+TEST_CASE("Tensor view test")
+{
+    SUBCASE("Reshape view")
+    {
+        TestReshapeView();
+    }
+
+    SUBCASE("Chunk view")
+    {
+        TestChunkView();
+    }
+
+    SUBCASE("Copy on write")
+    {
+        TestViewCopyOnWrite();
+    }
+
+    SUBCASE("Transpose view")
+    {
+        TestTransposeView();
+    }
+
+    SUBCASE("Permute view")
+    {
+        TestPermuteView();
+    }
+}
+
+TEST_CASE("Transpose test")
+{
+    SUBCASE("Blocked transpose")
+    {
+        TestTranspose();
+    }
+
+    SUBCASE("In-place transpose")
+    {
+        TestTransposeInPlace();
+    }
+}
+
+TEST_CASE("Half precision test")
+{
+    SUBCASE("Conversion")
+    {
+        TestHalfConversion();
+    }
+
+    SUBCASE("Gemm")
+    {
+        TestHalfGemm();
+    }
+
+    SUBCASE("Element-wise")
+    {
+        TestHalfElementWise();
+    }
+
+    SUBCASE("Non Float32 rejected")
+    {
+        TestNonFloat32Rejected();
+    }
+}
+
+TEST_CASE("Concurrent queue test")
+{
+    SUBCASE("Single thread")
+    {
+        TestConcurrentQueueSingleThread();
+    }
+
+    SUBCASE("Multi thread")
+    {
+        TestConcurrentQueueMultiThread();
+    }
+
+    SUBCASE("Contention benchmark")
+    {
+        BenchmarkConcurrentQueue();
+    }
+}
+
+TEST_CASE("Thread pool test")
+{
+    SUBCASE("Parallel for")
+    {
+        TestParallelFor();
+    }
+
+    SUBCASE("Parallel for exception")
+    {
+        TestParallelForException();
+    }
+
+    SUBCASE("Task group")
+    {
+        TestTaskGroup();
+    }
+
+    SUBCASE("Thread budget")
+    {
+        TestThreadBudget();
+    }
+}
+
+TEST_CASE("Quantization test")
+{
+    SUBCASE("Int8 linear")
+    {
+        TestInt8Linear();
+    }
+
+    SUBCASE("Quantized linear grad mode")
+    {
+        TestQuantizedLinearGradMode();
+    }
+}
+
+TEST_CASE("Random test")
+{
+    SUBCASE("Philox")
+    {
+        TestPhilox();
+    }
+
+    SUBCASE("Random initialize")
+    {
+        TestRandomInitialize();
+    }
+
+    SUBCASE("Dropout")
+    {
+        TestDropout();
+    }
+
+    SUBCASE("Checkpoint dropout")
+    {
+        TestCheckpointDropout();
+    }
+}
+
+TEST_CASE("Reduction test")
+{
+    SUBCASE("Reduction")
+    {
+        TestReduction();
+    }
+
+    SUBCASE("Long reduction")
+    {
+        TestLongReduction();
+    }
+
+    SUBCASE("Column sum")
+    {
+        TestColumnSum();
+    }
+}
+
+TEST_CASE("Convolution test")
+{
+    SUBCASE("Host convolution")
+    {
+        TestHostConvolution();
+    }
+
+    SUBCASE("Winograd convolution")
+    {
+        TestWinogradConvolution();
+    }
+}
+
+TEST_CASE("Pooling test")
+{
+    SUBCASE("Host pooling")
+    {
+        TestHostPooling();
+    }
+
+    SUBCASE("Pooling units")
+    {
+        TestPoolingUnits();
+    }
+}
+
+TEST_CASE("Normalization test")
+{
+    SUBCASE("Host normalization")
+    {
+        TestHostNormalization();
+    }
+
+    SUBCASE("BatchNorm folding")
+    {
+        TestBatchNormFolding();
+    }
+
+    SUBCASE("Checkpoint BatchNorm")
+    {
+        TestCheckpointBatchNorm();
+    }
+}
+
+TEST_CASE("Embedding test")
+{
+    SUBCASE("Embedding kernels")
+    {
+        TestEmbeddingKernels();
+    }
+
+    SUBCASE("Sparse row update")
+    {
+        TestEmbeddingSparseUpdate();
+    }
+}
+
+TEST_CASE("Loss test")
+{
+    SUBCASE("Cross entropy kernels")
+    {
+        TestCrossEntropyKernels();
+    }
+
+    SUBCASE("Cross entropy gradient")
+    {
+        TestCrossEntropyGradient();
+    }
+}
+
+TEST_CASE("Optimizer test")
+{
+    SUBCASE("Gradient accumulation")
+    {
+        TestGradientAccumulation();
+    }
+
+    SUBCASE("Optimizer update")
+    {
+        TestOptimizerUpdate();
+    }
+
+    SUBCASE("Flatten parameters")
+    {
+        TestFlattenParameters();
+    }
+
+    SUBCASE("Optimizer state after flattening")
+    {
+        TestFlattenOptimizerState();
+    }
+}
+
+TEST_CASE("Model test")
+{
+    SUBCASE("Concurrent models")
+    {
+        TestConcurrentModels();
+    }
+
+    SUBCASE("Parallel backward")
+    {
+        TestParallelBackward();
+    }
+
+    SUBCASE("Deep backward")
+    {
+        TestDeepBackward();
+    }
+
+    SUBCASE("No grad")
+    {
+        TestNoGrad();
+    }
+
+    SUBCASE("Saved tensor")
+    {
+        TestSavedTensor();
+    }
+
+    SUBCASE("Checkpoint")
+    {
+        TestCheckpoint();
+    }
+}
+
 TEST_CASE("SparseMemory function Test")
 {
     SUBCASE("SparseMemoryAllocationHost")